@@ -0,0 +1,139 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Host implementation of the little bit of hardware the motion core touches
+
+#include "HostSim.h"
+
+#include "libs/Kernel.h"
+#include "StepTicker.h"
+#include "MemoryPool.h"
+#include "platform_memory.h"
+#include "mbed.h"
+#include "mri.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+uint32_t SystemCoreClock = 100000000;
+
+sim_gpio_hook_t sim_gpio_hook = nullptr;
+LPC_GPIO_TypeDef sim_gpio[5] = {{0}, {1}, {2}, {3}, {4}};
+LPC_TIM_TypeDef sim_tim[4];
+LPC_SC_TypeDef sim_sc;
+LPC_WDT_TypeDef sim_wdt;
+LPC_PINCON_TypeDef sim_pincon;
+DWT_Type sim_dwt;
+CoreDebug_Type sim_core_debug;
+
+// FirmConfigSource refers to the config.default that is linked into the firmware, the host always uses the explicit range constructor
+char _binary_config_default_start;
+char _binary_config_default_end;
+
+uint64_t sim_ticks = 0;
+uint32_t sim_idle_quantum = 10;
+uint32_t sim_blocks_executed = 0;
+sim_block_hook_t sim_block_hook = nullptr;
+sim_idle_hook_t sim_idle_hook = nullptr;
+double sim_isr_seconds = 0;
+uint64_t sim_isr_cycles = 0;
+uint64_t sim_active_ticks = 0;
+double sim_idle_seconds = 0;
+
+// AHB0 and AHB1 are 16KB each on the LPC1769
+static uint8_t ahb0_ram[16 * 1024] __attribute__ ((aligned (8)));
+static uint8_t ahb1_ram[16 * 1024] __attribute__ ((aligned (8)));
+static MemoryPool ahb0_pool(ahb0_ram, sizeof(ahb0_ram));
+static MemoryPool ahb1_pool(ahb1_ram, sizeof(ahb1_ram));
+MemoryPool *_AHB0 = &ahb0_pool;
+MemoryPool *_AHB1 = &ahb1_pool;
+
+// host cpu cycle counter, falls back to nanoseconds where there is no time stamp counter
+static inline uint64_t host_cycles()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+uint32_t sim_cycles(void)
+{
+    return (uint32_t)host_cycles();
+}
+
+void sim_run_ticks(uint32_t n)
+{
+    StepTicker *st = StepTicker::getInstance();
+    auto start = std::chrono::steady_clock::now();
+    uint64_t start_cycles = host_cycles();
+    for (uint32_t i = 0; i < n; ++i) {
+        const Block *last = st->get_current_block();
+        st->step_tick();
+        if(st->get_current_block() != last && st->get_current_block() != nullptr) {
+            ++sim_blocks_executed;
+            if(sim_block_hook != nullptr) sim_block_hook();
+        }
+        if(last != nullptr || st->get_current_block() != nullptr) ++sim_active_ticks;
+        // the unstep timer always fires well before the next tick
+        st->unstep_tick();
+        ++sim_ticks;
+    }
+    sim_isr_cycles += host_cycles() - start_cycles;
+    sim_isr_seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+void sim_idle()
+{
+    sim_run_ticks(sim_idle_quantum);
+    if(sim_idle_hook != nullptr) sim_idle_hook();
+}
+
+extern "C" uint32_t us_ticker_read(void)
+{
+    return (uint32_t)(sim_ticks * 1000000ULL / THEKERNEL->base_stepping_frequency);
+}
+
+extern "C" void wait_us(int us)
+{
+    sim_run_ticks((uint64_t)us * THEKERNEL->base_stepping_frequency / 1000000ULL);
+}
+
+extern "C" void wait_ms(int ms)
+{
+    wait_us(ms * 1000);
+}
+
+extern "C" void wait(float s)
+{
+    wait_us(s * 1000000.0F);
+}
+
+extern "C" void __debugbreak(void)
+{
+    fprintf(stderr, "__debugbreak() at tick %llu\n", (unsigned long long)sim_ticks);
+    abort();
+}
+
+extern "C" int __mriPlatform_CommUartIndex(void)
+{
+    return 0;
+}
+
+extern "C" void set_high_on_debug(int port, int pin) {}
+extern "C" void set_low_on_debug(int port, int pin) {}
+
+void NVIC_SystemReset(void)
+{
+    fprintf(stderr, "system reset requested\n");
+    exit(1);
+}
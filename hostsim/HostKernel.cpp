@@ -0,0 +1,198 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+Host replacement for src/libs/Kernel.cpp, only the motion core modules are created
+(StepTicker, Conveyor, GcodeDispatch, Robot and Planner), everything else is left null.
+ON_IDLE advances the simulated time, see HostSim.h
+*/
+
+#include "HostSim.h"
+
+#include "libs/Kernel.h"
+#include "libs/Module.h"
+#include "libs/Config.h"
+#include "libs/StreamOutputPool.h"
+#include "checksumm.h"
+#include "ConfigValue.h"
+#include "FirmConfigSource.h"
+
+#include "libs/StepTicker.h"
+#include "libs/Scheduler.h"
+#include "modules/communication/GcodeDispatch.h"
+#include "modules/robot/Planner.h"
+#include "modules/robot/Robot.h"
+#include "modules/robot/Conveyor.h"
+#include "StepperMotor.h"
+#include "SimpleShell.h"
+#include "platform_memory.h"
+
+#include <stdio.h>
+#include <string>
+#include <chrono>
+
+#define base_stepping_frequency_checksum            CHECKSUM("base_stepping_frequency")
+#define microseconds_per_step_pulse_checksum        CHECKSUM("microseconds_per_step_pulse")
+#define grbl_mode_checksum                          CHECKSUM("grbl_mode")
+#define ok_per_line_checksum                        CHECKSUM("ok_per_line")
+#define ahb_slabs_enable_checksum                   CHECKSUM("ahb_slabs_enable")
+
+const char *sim_config_file = nullptr;
+
+// sends everything written to THEKERNEL->streams to stdout
+class StdoutStream : public StreamOutput {
+    public:
+        int puts(const char *s) { return fputs(s, stdout); }
+};
+
+static StdoutStream stdout_stream;
+
+// the config is loaded into memory and handed to the config parser that is normally used for the built in config.default
+static std::string config_text;
+
+static bool load_config_text(const char *fn)
+{
+    FILE *fp = fopen(fn, "r");
+    if(fp == nullptr) return false;
+    char buf[512];
+    size_t n;
+    while((n = fread(buf, 1, sizeof(buf), fp)) > 0) config_text.append(buf, n);
+    fclose(fp);
+    return true;
+}
+
+Kernel* Kernel::instance;
+
+Kernel::Kernel()
+{
+    halted = false;
+    feed_hold = false;
+    enable_feed_hold = false;
+    bad_mcu = false;
+    stop_request = false;
+    use_leds = false;
+
+    instance = this; // setup the Singleton instance of the kernel
+
+    this->scheduler = new Scheduler();
+
+    this->serial = nullptr;
+    this->slow_ticker = nullptr;
+    this->adc = nullptr;
+    this->simpleshell = nullptr;
+    this->configurator = nullptr;
+
+    if(sim_config_file != nullptr && !load_config_text(sim_config_file)) {
+        fprintf(stderr, "could not read config file %s, using defaults\n", sim_config_file);
+    }
+    this->config = new Config(new FirmConfigSource("host", config_text.data(), config_text.data() + config_text.size()));
+    this->config->config_cache_load();
+
+    this->streams = new StreamOutputPool();
+    this->streams->append_stream(&stdout_stream);
+
+    if(this->config->value( ahb_slabs_enable_checksum )->by_default(false)->as_bool()) {
+        AHB0.set_slabs(true);
+        AHB1.set_slabs(true);
+    }
+
+    this->current_path = "/";
+
+    this->grbl_mode = this->config->value( grbl_mode_checksum )->by_default(false)->as_bool();
+    this->ok_per_line = this->config->value( ok_per_line_checksum )->by_default(true)->as_bool();
+
+    this->step_ticker = new StepTicker();
+
+    // Configure the step ticker
+    this->base_stepping_frequency = this->config->value(base_stepping_frequency_checksum)->by_default(100000)->as_number();
+    float microseconds_per_step_pulse = this->config->value(microseconds_per_step_pulse_checksum)->by_default(1)->as_number();
+    this->step_ticker->set_frequency( this->base_stepping_frequency );
+    this->step_ticker->set_unstep_time( microseconds_per_step_pulse );
+
+    // Core modules
+    this->add_module( this->conveyor       = new Conveyor()      );
+    this->add_module( this->gcode_dispatch = new GcodeDispatch() );
+    this->add_module( this->robot          = new Robot()         );
+
+    this->planner = new Planner();
+}
+
+std::string Kernel::get_query_string()
+{
+    std::string str("<");
+    str.append(halted ? "Alarm" : this->conveyor->is_idle() ? "Idle" : "Run");
+    str.append(">\n");
+    return str;
+}
+
+void Kernel::add_module(Module* module)
+{
+    module->on_module_loaded();
+}
+
+void Kernel::register_for_event(_EVENT_ENUM id_event, Module *mod)
+{
+    this->hooks[id_event].push_back(mod);
+}
+
+void Kernel::immediate_halt()
+{
+    this->halted = true;
+    conveyor->flush_queue();
+    for(auto &a : robot->actuators) a->stop_moving();
+}
+
+void Kernel::call_event(_EVENT_ENUM id_event, void * argument)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    if(id_event == ON_HALT) {
+        this->halted = (argument == nullptr);
+        if(!this->halted && this->feed_hold) this->feed_hold= false;
+    }
+
+    for (auto m : hooks[id_event]) {
+        (m->*kernel_callback_functions[id_event])(argument);
+    }
+
+    if(id_event == ON_HALT) {
+        this->robot->reset_position_from_current_actuator_position();
+
+    }else if(id_event == ON_MAIN_LOOP) {
+        this->scheduler->run(Scheduler::MAIN_LOOP);
+
+    }else if(id_event == ON_IDLE) {
+        this->scheduler->run(Scheduler::IDLE);
+        // this is where the step ticker interrupts would have been running
+        sim_idle();
+        sim_idle_seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+}
+
+bool Kernel::kernel_has_event(_EVENT_ENUM id_event, Module *mod)
+{
+    for (auto m : hooks[id_event]) {
+        if(m == mod) return true;
+    }
+    return false;
+}
+
+void Kernel::unregister_for_event(_EVENT_ENUM id_event, Module *mod)
+{
+    for (auto i = hooks[id_event].begin(); i != hooks[id_event].end(); ++i) {
+        if(*i == mod) {
+            hooks[id_event].erase(i);
+            return;
+        }
+    }
+}
+
+// there is no shell on the host
+bool SimpleShell::parse_command(const char *cmd, string args, StreamOutput *stream)
+{
+    return false;
+}
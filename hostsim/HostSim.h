@@ -0,0 +1,52 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stdint.h>
+
+// Simulated time for the host build.
+// There are no interrupts on the host, instead the step ticker ISRs are run synchronously whenever the
+// firmware would be waiting, ie each time ON_IDLE is called. Each idle call advances time by sim_idle_quantum ticks.
+// All time in the simulator is measured in step ticker ticks, us_ticker_read() is derived from it.
+
+// config file the host Kernel loads, must be set before the Kernel is created
+extern const char *sim_config_file;
+
+// total number of step ticks executed so far
+extern uint64_t sim_ticks;
+
+// number of step ticks run for each ON_IDLE, models the time the main loop takes on the target
+extern uint32_t sim_idle_quantum;
+
+// number of blocks the step ticker has started executing
+extern uint32_t sim_blocks_executed;
+
+// called each time the step ticker starts executing a new block
+typedef void (*sim_block_hook_t)();
+extern sim_block_hook_t sim_block_hook;
+
+// called each time ON_IDLE has run its ticks, this is where the simulated serial link delivers what has arrived
+typedef void (*sim_idle_hook_t)();
+extern sim_idle_hook_t sim_idle_hook;
+
+// wall clock time and host cpu cycles spent running the step ticker ISRs
+extern double sim_isr_seconds;
+extern uint64_t sim_isr_cycles;
+
+// number of ticks where the step ticker had a block to execute
+extern uint64_t sim_active_ticks;
+
+// wall clock time spent in ON_IDLE, which includes the ISRs and any time spent waiting for room in the queue,
+// so it can be excluded from the planner throughput
+extern double sim_idle_seconds;
+
+// runs the step and unstep ISRs for the given number of ticks
+void sim_run_ticks(uint32_t n);
+
+// the ON_IDLE hook calls this, it runs sim_idle_quantum ticks
+void sim_idle();
@@ -0,0 +1,125 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "SerialLink.h"
+#include "HostSim.h"
+
+#include "libs/Kernel.h"
+#include "SerialConsole.h"
+#include "lpc17xx_uart.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+LPC_UART_TypeDef sim_uart[4];
+
+SerialLink *SerialLink::instance = nullptr;
+
+uint32_t UART_Send(LPC_UART_TypeDef *uart, uint8_t *buf, uint32_t len, TRANSFER_BLOCK_Type flag)
+{
+    if(SerialLink::getInstance() != nullptr) SerialLink::getInstance()->from_firmware(buf, len);
+    return len;
+}
+
+SerialLink::SerialLink(SerialConsole *console, uint32_t latency, bool windowed, const std::vector<std::string> &lines)
+    : console(console), lines(lines), latency(latency), windowed(windowed)
+{
+    instance = this;
+    sim_idle_hook = idle_hook;
+}
+
+bool SerialLink::is_done() const
+{
+    return THEKERNEL->is_halted() || (negotiated && next_line == lines.size() && oks == lines.size());
+}
+
+void SerialLink::from_firmware(const uint8_t *buf, uint32_t len)
+{
+    for (uint32_t i = 0; i < len; ++i) to_host.push_back({sim_ticks + latency, (char)buf[i]});
+}
+
+void SerialLink::idle_hook()
+{
+    instance->poll();
+}
+
+void SerialLink::send(const std::string &line)
+{
+    for (char c : line) to_firmware.push_back({sim_ticks + latency, c});
+    to_firmware.push_back({sim_ticks + latency, '\n'});
+}
+
+void SerialLink::on_host_line(const std::string &line)
+{
+    if(line.compare(0, 2, "ok") == 0) {
+        waiting = false;
+        if(!negotiated) {
+            // the ok of M880, the window has been set up
+            negotiated = true;
+            return;
+        }
+        ++oks;
+        last_ok_tick = sim_ticks;
+
+    } else if(line.compare(0, 7, "window:") == 0) {
+        window = strtoul(line.c_str() + 7, nullptr, 10);
+
+    } else if(line.compare(0, 6, "freed:") == 0) {
+        in_flight -= strtoul(line.c_str() + 6, nullptr, 10);
+        ++reports;
+
+    } else if(line.compare(0, 5, "error") == 0 || line.compare(0, 5, "Error") == 0 || line.compare(0, 2, "!!") == 0) {
+        ++errors;
+    }
+}
+
+void SerialLink::poll()
+{
+    // what has reached the firmware goes through the receive interrupt
+    while(!to_firmware.empty() && to_firmware.front().arrival <= sim_ticks) {
+        console->on_serial_char_received(to_firmware.front().c);
+        to_firmware.pop_front();
+    }
+
+    while(!to_host.empty() && to_host.front().arrival <= sim_ticks) {
+        char c = to_host.front().c;
+        to_host.pop_front();
+        if(c == '\n') {
+            on_host_line(host_line);
+            host_line.clear();
+        } else if(c != '\r') {
+            host_line += c;
+        }
+    }
+
+    if(!negotiated) {
+        if(!windowed) {
+            negotiated = true;
+
+        } else if(!waiting) {
+            send("M880 S1");
+            waiting = true;
+            return;
+
+        } else {
+            return;
+        }
+    }
+
+    if(next_line == 0) first_send_tick = sim_ticks;
+    if(windowed && window > 0) {
+        // keep the receive buffer full
+        while(next_line < lines.size() && in_flight + lines[next_line].size() + 1 <= window) {
+            in_flight += lines[next_line].size() + 1;
+            send(lines[next_line++]);
+        }
+
+    } else if(!waiting && next_line < lines.size()) {
+        send(lines[next_line++]);
+        waiting = true;
+    }
+}
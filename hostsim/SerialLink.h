@@ -0,0 +1,77 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <deque>
+#include <string>
+#include <vector>
+
+class SerialConsole;
+
+// A host streaming lines to the firmware's SerialConsole over a link that takes the given number of ticks each way.
+// There is no limit on how many bytes the link carries, like USB where the latency is what limits a host waiting for
+// each ok. Everything is driven from sim_idle_hook, so the bytes arrive while the firmware is waiting for room in the
+// queue just as they would from the receive interrupt.
+//
+// Without windowing the host sends a line and waits for its ok before sending the next, as fast-stream.py does with
+// the serial port buffering taken away. With windowing it turns on windowed streaming with M880 S1 and then keeps the
+// receive buffer full, counting the bytes it has sent less the bytes the firmware reports as freed (see RxWindow.h),
+// which is what stream-window.py does.
+class SerialLink {
+    public:
+        SerialLink(SerialConsole *console, uint32_t latency, bool windowed, const std::vector<std::string> &lines);
+
+        // true once every line has been sent and acknowledged, or the firmware has halted
+        bool is_done() const;
+
+        uint32_t get_lines() const { return lines.size(); }
+        uint32_t get_errors() const { return errors; }
+        uint32_t get_window() const { return window; }
+        uint32_t get_reports() const { return reports; }
+        // ticks from the first line sent to the ok of the last one
+        uint64_t get_stream_ticks() const { return last_ok_tick - first_send_tick; }
+
+        static SerialLink *getInstance() { return instance; }
+
+        // the firmware sending to the host
+        void from_firmware(const uint8_t *buf, uint32_t len);
+
+    private:
+        static void idle_hook();
+        void poll();
+        void on_host_line(const std::string &line);
+        void send(const std::string &line);
+
+        static SerialLink *instance;
+
+        struct byte_t {
+            uint64_t arrival;
+            char c;
+        };
+        std::deque<byte_t> to_firmware, to_host;
+        std::string host_line;
+
+        SerialConsole *console;
+        const std::vector<std::string> &lines;
+        uint32_t latency;
+        uint32_t next_line{0};
+        uint32_t oks{0};
+        uint32_t errors{0};
+        uint32_t reports{0};
+        // bytes sent that the firmware has not yet reported as freed
+        uint32_t in_flight{0};
+        // the receive buffer size the firmware replied with, 0 until then
+        uint32_t window{0};
+        uint64_t first_send_tick{0};
+        uint64_t last_ok_tick{0};
+        bool windowed;
+        // sent a line and waiting for its ok, this is also how M880 is sent before streaming windowed
+        bool waiting{false};
+        bool negotiated{false};
+};
@@ -0,0 +1,136 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "StepRecorder.h"
+#include "HostSim.h"
+
+#include "libs/Kernel.h"
+#include "Config.h"
+#include "ConfigValue.h"
+#include "Pin.h"
+#include "Robot.h"
+#include "StepperMotor.h"
+#include "utils.h"
+#include "checksumm.h"
+
+#include <string>
+#include <vector>
+
+#define extruder_checksum CHECKSUM("extruder")
+#define enable_checksum   CHECKSUM("enable")
+#define step_pin_checksum CHECKSUM("step_pin")
+#define dir_pin_checksum  CHECKSUM("dir_pin")
+
+StepRecorder *StepRecorder::instance;
+
+StepRecorder::StepRecorder()
+{
+    instance = this;
+    num_motors = 0;
+    record_edges = false;
+    seen_step = false;
+    first_tick = last_tick = 0;
+}
+
+void StepRecorder::start(bool record_edges)
+{
+    static const char *names[] = {"alpha", "beta", "gamma", "delta", "epsilon", "zeta"};
+
+    this->record_edges = record_edges;
+    num_motors = 0;
+
+    // the extruders register their motors after the axis, in the order they are in the config
+    std::vector<uint16_t> extruders, modules;
+    THEKERNEL->config->get_module_list(&modules, extruder_checksum);
+    for(auto cs : modules) {
+        if(THEKERNEL->config->value(extruder_checksum, cs, enable_checksum)->as_bool()) extruders.push_back(cs);
+    }
+    size_t next_extruder = 0;
+
+    for (uint8_t m = 0; m < THEROBOT->get_number_registered_motors() && m < k_max_actuators; ++m) {
+        Pin step, dir;
+        if(THEROBOT->actuators[m]->is_extruder() && next_extruder < extruders.size()) {
+            uint16_t cs = extruders[next_extruder++];
+            step.from_string(THEKERNEL->config->value(extruder_checksum, cs, step_pin_checksum)->by_default("nc")->as_string());
+            dir.from_string(THEKERNEL->config->value(extruder_checksum, cs, dir_pin_checksum)->by_default("nc")->as_string());
+        } else {
+            std::string name(names[m]);
+            step.from_string(THEKERNEL->config->value(get_checksum(name + "_step_pin"))->by_default("nc")->as_string());
+            dir.from_string(THEKERNEL->config->value(get_checksum(name + "_dir_pin"))->by_default("nc")->as_string());
+        }
+
+        motor_t &mt = motor[m];
+        mt.step_port = step.connected() ? step.port_number : 0xFF;
+        mt.step_mask = step.connected() ? 1 << step.pin : 0;
+        mt.step_inverting = step.is_inverting();
+        mt.dir_port = dir.connected() ? dir.port_number : 0xFF;
+        mt.dir_mask = dir.connected() ? 1 << dir.pin : 0;
+        mt.dir_inverting = dir.is_inverting();
+        mt.step_level = false;
+        mt.dir_level = THEROBOT->actuators[m]->which_direction();
+        mt.steps = 0;
+        mt.position = 0;
+        num_motors = m + 1;
+    }
+
+    sim_gpio_hook = &StepRecorder::gpio_hook;
+    sim_block_hook = &StepRecorder::block_hook;
+}
+
+void StepRecorder::stop()
+{
+    sim_gpio_hook = nullptr;
+    sim_block_hook = nullptr;
+}
+
+void StepRecorder::gpio_hook(uint8_t port, uint32_t mask, bool level)
+{
+    instance->on_write(port, mask, level);
+}
+
+void StepRecorder::block_hook()
+{
+    if(instance->record_edges) instance->edges.push_back({sim_ticks, 0, 'B', true});
+}
+
+void StepRecorder::on_write(uint8_t port, uint32_t mask, bool level)
+{
+    for (uint8_t m = 0; m < num_motors; ++m) {
+        motor_t &mt = motor[m];
+        if(port == mt.step_port && (mask & mt.step_mask)) {
+            bool l = level ^ mt.step_inverting;
+            if(l && !mt.step_level) {
+                // rising edge of the step pulse
+                ++mt.steps;
+                mt.position += mt.dir_level ? -1 : 1;
+                if(!seen_step) {
+                    first_tick = sim_ticks;
+                    seen_step = true;
+                }
+                last_tick = sim_ticks;
+                if(record_edges) edges.push_back({sim_ticks, m, 'S', true});
+            }
+            mt.step_level = l;
+        }
+
+        if(port == mt.dir_port && (mask & mt.dir_mask)) {
+            bool l = level ^ mt.dir_inverting;
+            if(l != mt.dir_level) {
+                mt.dir_level = l;
+                if(record_edges) edges.push_back({sim_ticks, m, 'D', l});
+            }
+        }
+    }
+}
+
+void StepRecorder::write_csv(FILE *fp) const
+{
+    fprintf(fp, "tick,motor,edge,level\n");
+    for(auto &e : edges) {
+        fprintf(fp, "%llu,%u,%c,%d\n", (unsigned long long)e.tick, e.motor, e.type, e.level ? 1 : 0);
+    }
+}
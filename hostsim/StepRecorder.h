@@ -0,0 +1,70 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "ActuatorCoordinates.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <vector>
+
+// Watches the simulated GPIO ports and records every step pulse and direction change of the actuators,
+// tagged with the step ticker tick it happened on.
+// The pins are looked up from the same config keys Robot uses (alpha_step_pin etc)
+class StepRecorder {
+    public:
+        StepRecorder();
+
+        // find the step and dir pins of the configured actuators, and hook the gpio writes
+        void start(bool record_edges);
+        void stop();
+
+        struct edge_t {
+            uint64_t tick;
+            uint8_t motor;
+            char type; // 'S' step pulse, 'D' direction change, 'B' start of a block (motor is always 0)
+            bool level; // the direction for a D edge, always 1 otherwise
+        };
+
+        const std::vector<edge_t>& get_edges() const { return edges; }
+        uint8_t get_num_motors() const { return num_motors; }
+        uint32_t get_steps(uint8_t m) const { return motor[m].steps; }
+        int32_t get_position(uint8_t m) const { return motor[m].position; }
+        uint64_t get_first_tick() const { return first_tick; }
+        uint64_t get_last_tick() const { return last_tick; }
+
+        void write_csv(FILE *fp) const;
+
+        static StepRecorder *getInstance() { return instance; }
+
+    private:
+        static void gpio_hook(uint8_t port, uint32_t mask, bool level);
+        static void block_hook();
+        void on_write(uint8_t port, uint32_t mask, bool level);
+
+        static StepRecorder *instance;
+
+        struct motor_t {
+            uint8_t step_port, dir_port;
+            uint32_t step_mask, dir_mask;
+            bool step_inverting, dir_inverting;
+            bool step_level, dir_level;
+            uint32_t steps;
+            int32_t position;
+        };
+
+        std::vector<edge_t> edges;
+        motor_t motor[k_max_actuators];
+        uint64_t first_tick, last_tick;
+
+        struct {
+            uint8_t num_motors:4;
+            bool record_edges:1;
+            bool seen_step:1;
+        };
+};
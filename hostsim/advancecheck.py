@@ -0,0 +1,183 @@
+#!/usr/bin/env python
+"""Checks that pressure advance pushes the filament ahead while extruding and never changes how much is extruded.
+
+Runs each gcode file through hostsim with the given config and again with extruder.<name>.pressure_advance added,
+then compares the extruder position in the two step timelines. The advance is carried from one extruding block to the
+next, so a single block may extrude more or less than it does without advance and the net extrusion is not compared
+block by block. At the start of every block the advanced extruder may only be ahead by what the advance allows at the
+fastest extrusion rate in the file, plus a couple of steps while it catches up. The advance is let go on a block that
+does not extrude and at the end, so the net extrusion is compared over each run of extruding blocks between two such
+releases, measured once the advanced extruder has caught up: on every block that does not move the extruder and is
+long enough for it to catch up (travels), and at the end of the file. The advanced extruder must not change direction
+more often than the one without advance, except for going back and forward again on a travel without a retract, where
+the advance is let go. Every other motor must step exactly as it does without advance.
+
+usage: advancecheck.py [-c config] [-e extruder] [-k seconds] hostsim file.gcode ...
+
+e.g.
+    make && ./advancecheck.py build/hostsim samples/extrude.gcode
+"""
+
+from __future__ import print_function
+import argparse
+import math
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+
+
+def read_trace(fn):
+    """returns the block start ticks, and for each motor the list of (tick, position) after each of its steps"""
+    blocks = []
+    steps = {}
+    pos, dirs = {}, {}
+    with open(fn) as f:
+        f.readline()
+        for line in f:
+            tick, motor, edge, level = line.strip().split(',')
+            tick, motor = int(tick), int(motor)
+            if edge == 'B':
+                blocks.append(tick)
+            elif edge == 'D':
+                dirs[motor] = -1 if level == '1' else 1
+            elif level == '1':
+                pos[motor] = pos.get(motor, 0) + dirs.get(motor, 1)
+                steps.setdefault(motor, []).append((tick, pos[motor]))
+    return blocks, steps
+
+
+def reversals(steps):
+    """how many times the motor changes direction"""
+    return sum(1 for i in range(2, len(steps)) if (steps[i][1] - steps[i - 1][1]) != (steps[i - 1][1] - steps[i - 2][1]))
+
+
+def position_at(steps, tick):
+    """the position after every step up to the given tick, steps is sorted by tick. A block starts on the tick the
+    last step of the block before it is taken"""
+    lo, hi = 0, len(steps)
+    while lo < hi:
+        mid = (lo + hi) // 2
+        if steps[mid][0] <= tick:
+            lo = mid + 1
+        else:
+            hi = mid
+    return steps[lo - 1][1] if lo > 0 else 0
+
+
+def peak_rate(steps, window):
+    """the most steps taken in window ticks"""
+    peak, j = 0, 0
+    for i in range(len(steps)):
+        while steps[i][0] - steps[j][0] >= window:
+            j += 1
+        peak = max(peak, i - j + 1)
+    return float(peak) / window
+
+
+def run(sim, config, gcode, out):
+    subprocess.check_call([sim, '-c', config, '-o', out, gcode], stdout=open(os.devnull, 'w'))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='compare pressure advanced extrusion with plain extrusion in hostsim')
+    parser.add_argument('-c', '--config', default='../ConfigSamples/Smoothieboard/config')
+    parser.add_argument('-e', '--extruder', default='hotend', help='name of the extruder module in the config')
+    parser.add_argument('-m', '--motor', type=int, default=3, help='motor number of the extruder')
+    parser.add_argument('-k', type=float, default=0.05, help='pressure advance to test in seconds')
+    parser.add_argument('sim')
+    parser.add_argument('gcode', nargs='+')
+    args = parser.parse_args()
+
+    tmp = tempfile.mkdtemp()
+    advance_config = os.path.join(tmp, 'config')
+    with open(advance_config, 'w') as f:
+        f.write(open(args.config).read())
+        f.write("\nextruder.%s.pressure_advance %f\n" % (args.extruder, args.k))
+    frequency = 100000
+    for line in open(args.config):
+        words = line.split('#', 1)[0].split()
+        if len(words) >= 2 and words[0] == 'base_stepping_frequency':
+            frequency = float(words[1])
+
+    ok = True
+    for g in args.gcode:
+        print("%s: pressure advance %1.3f s" % (g, args.k))
+        ref_out, adv_out = os.path.join(tmp, 'plain.csv'), os.path.join(tmp, 'advance.csv')
+        run(args.sim, args.config, g, ref_out)
+        run(args.sim, advance_config, g, adv_out)
+        ref_blocks, ref_steps = read_trace(ref_out)
+        adv_blocks, adv_steps = read_trace(adv_out)
+        e_ref, e_adv = ref_steps.get(args.motor, []), adv_steps.get(args.motor, [])
+
+        if len(ref_blocks) != len(adv_blocks):
+            print("  block count differs %d != %d" % (len(ref_blocks), len(adv_blocks)))
+            ok = False
+            continue
+
+        # the block timing does not change, so neither may the other motors
+        for m in set(ref_steps) | set(adv_steps):
+            if m != args.motor and ref_steps.get(m, []) != adv_steps.get(m, []):
+                print("  motor %d steps differently with pressure advance" % m)
+                ok = False
+
+        # the advance is at most k times the fastest extrusion, measured over 1ms so it is not just the step spacing
+        bound = int(math.ceil(args.k * peak_rate(e_ref, int(frequency / 1000)) * frequency)) + 2
+        worst, bad, released = 0, 0, 0
+        ends = ref_blocks[1:] + [max(ref_blocks[-1], e_ref[-1][0] if e_ref else 0, e_adv[-1][0] if e_adv else 0) + bound + 1]
+        previous = 0
+        # ticks where the advance has been let go and the advanced extruder has caught up
+        releases = [0]
+        for start, end in zip(ref_blocks, ends):
+            ahead = position_at(e_adv, start) - position_at(e_ref, start)
+            worst = max(worst, abs(ahead))
+            if abs(ahead) > bound:
+                bad += 1
+            # a travel right after extruding lets the advance go, the extruder goes back and then forward again
+            if position_at(e_ref, start) == position_at(e_ref, end) and position_at(e_ref, start) > position_at(e_ref, previous):
+                released += 1
+            previous = start
+            # on a block that does not extrude the advanced extruder catches up at a step a tick
+            if position_at(e_ref, start) == position_at(e_ref, end) and end - start > bound:
+                releases.append(start + bound)
+        releases.append(ends[-1])
+
+        # between two releases the advanced extruder must extrude exactly as much as the plain one
+        runs, wrong = 0, 0
+        for a, b in zip(releases, releases[1:]):
+            ref_net = position_at(e_ref, b) - position_at(e_ref, a)
+            adv_net = position_at(e_adv, b) - position_at(e_adv, a)
+            if ref_net != 0:
+                runs += 1
+            if adv_net != ref_net:
+                print("  ticks %d to %d: extruder moves %d steps with advance, %d without" % (a, b, adv_net, ref_net))
+                wrong += 1
+        if wrong > 0:
+            print("  %d runs of extruding blocks extrude differently with pressure advance" % wrong)
+            ok = False
+
+        print("  %d blocks, extruder %d steps without advance, %d with, most ahead at a block start %d steps (allowed %d), net extrusion checked on %d runs between releases" %
+              (len(ref_blocks), len(e_ref), len(e_adv), worst, bound, runs))
+        print("  extruder changes direction %d times without advance, %d with (allowed %d)" %
+              (reversals(e_ref), reversals(e_adv), reversals(e_ref) + 2 * released))
+        if reversals(e_adv) > reversals(e_ref) + 2 * released:
+            print("  the advanced extruder steps back and forth")
+            ok = False
+        if bad > 0:
+            print("  %d blocks start with the extruder further ahead than the advance allows" % bad)
+            ok = False
+        if (e_ref[-1][1] if e_ref else 0) != (e_adv[-1][1] if e_adv else 0):
+            print("  extruder ends at %d steps with advance, %d without" % (e_adv[-1][1] if e_adv else 0, e_ref[-1][1] if e_ref else 0))
+            ok = False
+        if args.k > 0 and len(e_adv) <= len(e_ref):
+            print("  the extruder did not take any extra steps, pressure advance is not working")
+            ok = False
+
+    shutil.rmtree(tmp)
+    print("PASS" if ok else "FAIL")
+    sys.exit(0 if ok else 1)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,128 @@
+#!/usr/bin/env python
+"""Checks that arcs planned as single moves (native_arcs) follow the same path as arcs cut into segments.
+
+Runs each gcode file through hostsim twice, once with the given config and once with native_arcs enabled, then
+rebuilds the tool position after every step from both step timelines. Every position of the native run must be within
+mm_max_arc_error of the path of the segmented run, plus a step of the coarsest axis as both paths are made of whole
+steps, and both runs must end up in the same place.
+
+usage: arccheck.py [-c config] [--tolerance mm] hostsim file.gcode ...
+
+e.g.
+    make && ./arccheck.py build/hostsim samples/arcs.gcode
+"""
+
+from __future__ import print_function
+import argparse
+import math
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+
+
+def read_config(fn):
+    config = {}
+    with open(fn) as f:
+        for line in f:
+            words = line.split('#', 1)[0].split()
+            if len(words) >= 2:
+                config[words[0]] = words[1]
+    return config
+
+
+def read_positions(fn, steps_per_mm):
+    """returns the list of positions in mm after each step, the block count and the last tick"""
+    pos = [0] * len(steps_per_mm)
+    dirs = [1] * len(steps_per_mm)
+    positions = [tuple(pos)]
+    blocks, last_tick = 0, 0
+    with open(fn) as f:
+        f.readline()
+        for line in f:
+            tick, motor, edge, level = line.strip().split(',')
+            motor = int(motor)
+            if edge == 'B':
+                blocks += 1
+            elif motor >= len(pos):
+                continue
+            elif edge == 'D':
+                dirs[motor] = -1 if level == '1' else 1
+            elif level == '1':
+                pos[motor] += dirs[motor]
+                last_tick = int(tick)
+                positions.append(tuple(p / s for p, s in zip(pos, steps_per_mm)))
+    return positions, blocks, last_tick
+
+
+def distance_to_segment(p, a, b):
+    abx, aby, abz = b[0] - a[0], b[1] - a[1], b[2] - a[2]
+    apx, apy, apz = p[0] - a[0], p[1] - a[1], p[2] - a[2]
+    l2 = abx * abx + aby * aby + abz * abz
+    t = 0 if l2 == 0 else max(0, min(1, (apx * abx + apy * aby + apz * abz) / l2))
+    return math.sqrt((apx - t * abx) ** 2 + (apy - t * aby) ** 2 + (apz - t * abz) ** 2)
+
+
+def max_deviation(test, ref, window=12):
+    """the furthest any test position is from the reference path. Both runs make the same steps, so by the time either
+    gets somewhere it has made about the same number of steps and the closest reference segment is near the same index"""
+    worst, worst_at = 0, None
+    for i, p in enumerate(test):
+        lo, hi = max(0, i - window), min(len(ref) - 1, i + window)
+        best = min(distance_to_segment(p, ref[k], ref[k + 1]) for k in range(lo, hi)) if hi > lo else 0
+        if best > worst:
+            worst, worst_at = best, p
+    return worst, worst_at
+
+
+def run(sim, config, gcode, out):
+    subprocess.check_call([sim, '-c', config, '-o', out, gcode], stdout=open(os.devnull, 'w'))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='compare native arcs with segmented arcs in hostsim')
+    parser.add_argument('-c', '--config', default='../ConfigSamples/Smoothieboard/config')
+    parser.add_argument('--tolerance', type=float, help='allowed deviation in mm, defaults to mm_max_arc_error plus a step')
+    parser.add_argument('sim')
+    parser.add_argument('gcode', nargs='+')
+    args = parser.parse_args()
+
+    config = read_config(args.config)
+    steps_per_mm = [float(config.get(k, 1)) for k in ('alpha_steps_per_mm', 'beta_steps_per_mm', 'gamma_steps_per_mm')]
+    tolerance = args.tolerance
+    if tolerance is None:
+        tolerance = float(config.get('mm_max_arc_error', 0.01)) + 1.0 / min(steps_per_mm)
+
+    tmp = tempfile.mkdtemp()
+    native_config = os.path.join(tmp, 'config')
+    with open(native_config, 'w') as f:
+        f.write(open(args.config).read())
+        f.write("\nnative_arcs true\n")
+
+    ok = True
+    for g in args.gcode:
+        print("%s:" % g)
+        seg_out, nat_out = os.path.join(tmp, 'segmented.csv'), os.path.join(tmp, 'native.csv')
+        run(args.sim, args.config, g, seg_out)
+        run(args.sim, native_config, g, nat_out)
+        seg, seg_blocks, seg_ticks = read_positions(seg_out, steps_per_mm)
+        nat, nat_blocks, nat_ticks = read_positions(nat_out, steps_per_mm)
+
+        print("  segmented: %d blocks, %d steps, last step at tick %d" % (seg_blocks, len(seg) - 1, seg_ticks))
+        print("  native:    %d blocks, %d steps, last step at tick %d" % (nat_blocks, len(nat) - 1, nat_ticks))
+        if seg[-1] != nat[-1]:
+            print("  end position differs %s != %s" % (seg[-1], nat[-1]))
+            ok = False
+        worst, at = max_deviation(nat, seg)
+        print("  max deviation from the segmented path %1.4f mm at (%s), allowed %1.4f mm" % (worst, ', '.join('%1.3f' % v for v in at or ()), tolerance))
+        if worst > tolerance:
+            ok = False
+
+    shutil.rmtree(tmp)
+    print("PASS" if ok else "FAIL")
+    sys.exit(0 if ok else 1)
+
+
+if __name__ == '__main__':
+    main()
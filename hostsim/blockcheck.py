@@ -0,0 +1,89 @@
+#!/usr/bin/env python
+"""Checks that blocks prepared for the step ticker only when they get a step buffer step exactly as before.
+
+Runs each gcode file through hostsim with the given config, where every block in the queue has a step buffer, and again
+with planner_step_buffers set, with trapezoid ramps, s-curves and the input shaper, which still gives every block a step
+buffer. The planner must work out the same trapezoids and the step ticker execute them the same way, so the two step
+timelines, with the block starts, have to be identical. Then it reports the memory the queue takes and how far ahead
+the planner sees with the queue as configured, and with planner_queue_size doubled and step buffers for 3/8 of it.
+
+usage: blockcheck.py [-c config] [-n step buffers] hostsim file.gcode ...
+
+e.g.
+    make && ./blockcheck.py build/hostsim samples/square.gcode
+"""
+
+from __future__ import print_function
+import argparse
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+
+
+VARIANTS = [('trapezoid', []), ('s-curve', ['s_curve_jerk 50000']), ('input shaper', ['input_shaper zvd'])]
+
+
+def read_config(fn):
+    config = {}
+    with open(fn) as f:
+        for line in f:
+            words = line.split('#', 1)[0].split()
+            if len(words) >= 2:
+                config[words[0]] = words[1]
+    return config
+
+
+def write_config(fn, base, lines):
+    with open(fn, 'w') as f:
+        f.write(open(base).read())
+        f.write('\n' + ''.join(l + '\n' for l in lines))
+
+
+def run(sim, config, gcode, out):
+    """returns the report lines about the queue"""
+    report = subprocess.check_output([sim, '-c', config, '-o', out, gcode]).decode()
+    return [l for l in report.splitlines() if l.startswith('queue')]
+
+
+def main():
+    parser = argparse.ArgumentParser(description='compare blocks with and without a step buffer each in hostsim')
+    parser.add_argument('-c', '--config', default='../ConfigSamples/Smoothieboard/config')
+    parser.add_argument('-n', '--buffers', type=int, default=4, help='step buffers to test with')
+    parser.add_argument('sim')
+    parser.add_argument('gcode', nargs='+')
+    args = parser.parse_args()
+
+    queue_size = int(read_config(args.config).get('planner_queue_size', 32))
+    tmp = tempfile.mkdtemp()
+    every, few = os.path.join(tmp, 'every'), os.path.join(tmp, 'few')
+    every_out, few_out = os.path.join(tmp, 'every.csv'), os.path.join(tmp, 'few.csv')
+
+    ok = True
+    for g in args.gcode:
+        print("%s:" % g)
+        for name, lines in VARIANTS:
+            write_config(every, args.config, lines)
+            write_config(few, args.config, lines + ['planner_step_buffers %d' % args.buffers])
+            run(args.sim, every, g, every_out)
+            run(args.sim, few, g, few_out)
+            a, b = open(every_out).read(), open(few_out).read()
+            same = a == b
+            print("  %-13s %d edges, %s with %d step buffers" % (name + ':', a.count('\n') - 1, 'the same' if same else 'DIFFERENT', args.buffers))
+            ok &= same
+
+    # the look ahead the same memory buys, on the last file
+    print("queue depth on %s:" % args.gcode[-1])
+    for lines in ([], ['planner_queue_size %d' % (queue_size * 2), 'planner_step_buffers %d' % (queue_size * 3 // 8)]):
+        write_config(few, args.config, lines)
+        for l in run(args.sim, few, args.gcode[-1], few_out):
+            print("  " + l)
+
+    shutil.rmtree(tmp)
+    print("PASS" if ok else "FAIL")
+    sys.exit(0 if ok else 1)
+
+
+if __name__ == '__main__':
+    main()
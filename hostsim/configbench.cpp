@@ -0,0 +1,276 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Loads a config file, with a file it includes, as the board does at boot and checks the config snapshot: that it is
+// written when config_snapshot is set, that the next load comes from it with the same values, and that it is not used
+// once the config, the included file or the snapshot itself has changed, and is removed when config_snapshot is unset.
+// It also checks every lookup in the indexed cache finds what a search of each value in turn finds.
+//
+// Then it reports the time to load the config from the text and from the snapshot, and for lookups of every key in it
+// and as many that are not, as modules asking for defaults make, searching each value in turn and with the index.
+//
+// usage: configbench [-n loads] config
+
+#include "HostSim.h"
+
+#include "libs/Kernel.h"
+#include "libs/Config.h"
+#include "libs/ConfigCache.h"
+#include "libs/ConfigValue.h"
+#include "libs/ConfigSources/FileConfigSource.h"
+#include "libs/utils.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+struct entry_t {
+    uint16_t cs[3];
+    std::string value;
+    bool operator==(const entry_t &o) const { return memcmp(cs, o.cs, sizeof(cs)) == 0 && value == o.value; }
+};
+
+static std::string dir;
+
+static bool write_file(const std::string &name, const std::string &text)
+{
+    FILE *fp = fopen((dir + "/" + name).c_str(), "w");
+    if(fp == NULL) return false;
+    fwrite(text.data(), 1, text.size(), fp);
+    fclose(fp);
+    return true;
+}
+
+static bool exists(const std::string &name)
+{
+    return access((dir + "/" + name).c_str(), F_OK) == 0;
+}
+
+static bool check(bool ok, const char *what)
+{
+    if(!ok) printf("FAILED: %s\n", what);
+    return ok;
+}
+
+// the checksums of the key on each line that has one, in order
+static std::vector<entry_t> keys_of(const std::string &text)
+{
+    std::vector<entry_t> keys;
+    size_t p = 0;
+    while(p < text.size()) {
+        size_t eol = text.find('\n', p);
+        if(eol == std::string::npos) eol = text.size();
+        std::string line = text.substr(p, eol - p);
+        p = eol + 1;
+        size_t b = line.find_first_not_of(" \t");
+        if(b == std::string::npos || line[b] == '#') continue;
+        size_t e = line.find_first_of(" \t", b);
+        // included files are read into the cache, the include line is not
+        if(e == std::string::npos || line.compare(b, e - b, "include") == 0) continue;
+        entry_t k;
+        get_checksums(k.cs, line.substr(b, e - b));
+        keys.push_back(k);
+    }
+    return keys;
+}
+
+// loads the config in dir, returns the value of each key and whether it was read from the text
+static bool load(const std::vector<entry_t> &keys, std::vector<entry_t> &values)
+{
+    FileConfigSource *source = new FileConfigSource(dir + "/config", "sd");
+    Config config(source, (dir + "/config.bin").c_str());
+    config.config_cache_load();
+    // only reading the text finds the included files
+    bool parsed = !source->get_included().empty();
+
+    values = keys;
+    for (auto &v : values) v.value = config.value(v.cs)->as_string();
+    return parsed;
+}
+
+// the cache as it was, each line is compared with every value before it and each lookup with every value
+static void linear_add(std::vector<entry_t> &cache, const entry_t &e)
+{
+    for (auto &v : cache) {
+        if(memcmp(v.cs, e.cs, sizeof(e.cs)) == 0) {
+            v = e;
+            return;
+        }
+    }
+    cache.push_back(e);
+}
+
+static const entry_t *linear_lookup(const std::vector<entry_t> &cache, const uint16_t *cs)
+{
+    for (auto &v : cache) {
+        if(memcmp(v.cs, cs, sizeof(v.cs)) == 0) return &v;
+    }
+    return nullptr;
+}
+
+// each load prints the files it includes, these go nowhere while loads are timed
+static int quiet(int saved)
+{
+    fflush(stdout);
+    if(saved >= 0) {
+        dup2(saved, fileno(stdout));
+        close(saved);
+        return -1;
+    }
+    saved = dup(fileno(stdout));
+    int null = open("/dev/null", O_WRONLY);
+    dup2(null, fileno(stdout));
+    close(null);
+    return saved;
+}
+
+static double seconds_since(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char *argv[])
+{
+    int n = 200;
+    int c;
+    while((c = getopt(argc, argv, "n:")) != -1) {
+        if(c == 'n') n = atoi(optarg);
+        else {
+            fprintf(stderr, "usage: %s [-n loads] config\n", argv[0]);
+            return 1;
+        }
+    }
+    if(optind >= argc) {
+        fprintf(stderr, "usage: %s [-n loads] config\n", argv[0]);
+        return 1;
+    }
+
+    std::string text;
+    FILE *fp = fopen(argv[optind], "r");
+    if(fp == NULL) {
+        fprintf(stderr, "could not read %s\n", argv[optind]);
+        return 1;
+    }
+    char buf[4096];
+    size_t len;
+    while((len = fread(buf, 1, sizeof(buf), fp)) > 0) text.append(buf, len);
+    fclose(fp);
+
+    char tmpl[] = "/tmp/configbench-XXXXXX";
+    if(mkdtemp(tmpl) == NULL) return 1;
+    dir = tmpl;
+
+    sim_config_file = argv[optind];
+    new Kernel();
+    bool ok = true;
+
+    std::string config = text + "\ninclude extra\nconfig_snapshot true\n";
+    std::string extra = "extra.value 5\n";
+    write_file("config", config);
+    write_file("extra", extra);
+    std::vector<entry_t> keys = keys_of(config + extra);
+
+    std::vector<entry_t> first, second;
+    ok &= check(load(keys, first), "the config was not read from the text the first time");
+    ok &= check(exists("config.bin"), "the snapshot was not written");
+    ok &= check(!load(keys, second), "the config was not read from the snapshot");
+    ok &= check(first == second, "the snapshot has different values to the text");
+
+    // the text changed, with a line that replaces an earlier one
+    write_file("config", config + "extra.value 6\n");
+    ok &= check(load(keys, second), "the snapshot was used after the config changed");
+    bool replaced = false;
+    for (auto &e : second) {
+        if(memcmp(e.cs, keys.back().cs, sizeof(e.cs)) == 0) replaced = e.value == "6";
+    }
+    ok &= check(replaced, "a later line did not replace an earlier one");
+    ok &= check(!load(keys, second), "the new snapshot was not used");
+
+    // the included file changed
+    write_file("extra", "extra.value 7\n");
+    ok &= check(load(keys, second), "the snapshot was used after an included file changed");
+
+    // the snapshot was cut short
+    ok &= check(!load(keys, second), "the new snapshot was not used");
+    ok &= check(truncate((dir + "/config.bin").c_str(), 100) == 0 && load(keys, second), "a snapshot cut short was used");
+
+    // config_snapshot unset
+    write_file("extra", extra);
+    write_file("config", text + "\ninclude extra\n");
+    ok &= check(load(keys, second), "the config was not read from the text without config_snapshot");
+    ok &= check(!exists("config.bin"), "the snapshot was not removed without config_snapshot");
+    write_file("config", config);
+    load(keys, first);
+
+    // every key is found as searching each value found it, and keys that are not there are not found
+    ConfigCache cache;
+    FileConfigSource(dir + "/config", "sd").transfer_values_to_cache(&cache);
+    std::vector<entry_t> linear;
+    for (auto &e : first) linear_add(linear, e);
+    std::vector<entry_t> lookups;
+    for (auto &e : first) {
+        lookups.push_back(e);
+        entry_t missing = e;
+        missing.cs[2] ^= 0x5A5A;
+        lookups.push_back(missing);
+    }
+    bool found = true;
+    for (auto &k : lookups) {
+        if((cache.lookup(k.cs) != NULL) != (linear_lookup(linear, k.cs) != nullptr)) found = false;
+    }
+    ok &= check(found, "the index and a search of each value found different keys");
+
+    // loading the text as it was, with the duplicate check and lookups searching each value
+    int saved = quiet(-1);
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < n; ++i) {
+        Config config(new FileConfigSource(dir + "/config", "sd"));
+        config.config_cache_load();
+    }
+    double text_s = seconds_since(start) / n;
+
+    start = std::chrono::steady_clock::now();
+    size_t hits = 0;
+    for (int i = 0; i < n; ++i) {
+        std::vector<entry_t> old;
+        for (auto &e : first) linear_add(old, e);
+        for (auto &k : lookups) hits += linear_lookup(old, k.cs) != nullptr;
+    }
+    double linear_s = seconds_since(start) / n;
+
+    // and from the snapshot with the index
+    Config snapshot(new FileConfigSource(dir + "/config", "sd"), (dir + "/config.bin").c_str());
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < n; ++i) snapshot.config_cache_load();
+    double snapshot_s = seconds_since(start) / n;
+    quiet(saved);
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < n; ++i) {
+        for (auto &k : lookups) hits += cache.lookup(k.cs) != NULL;
+    }
+    double index_s = seconds_since(start) / n;
+
+    printf("%s: %u values, %u lookups\n", argv[optind], (unsigned)first.size(), (unsigned)lookups.size());
+    printf("text load %1.1f us, duplicate checks and lookups searching each value %1.1f us\n", text_s * 1e6, linear_s * 1e6);
+    printf("snapshot load %1.1f us, lookups with the index %1.1f us\n", snapshot_s * 1e6, index_s * 1e6);
+    printf("boot config %1.1f us before, %1.1f us with the index and snapshot, %1.1f times faster\n", (text_s + linear_s) * 1e6,
+           (snapshot_s + index_s) * 1e6, (text_s + linear_s) / (snapshot_s + index_s));
+
+    remove((dir + "/config").c_str());
+    remove((dir + "/config.bin").c_str());
+    remove((dir + "/extra").c_str());
+    rmdir(dir.c_str());
+
+    printf(ok ? "PASS\n" : "FAIL\n");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,93 @@
+#!/usr/bin/env python
+"""Checks deferred segmentation keeps each delta tower within its max_rate.
+
+Runs lines across the bed at right angles to the alpha tower through hostsim with the delta config, with alpha_max_rate
+lowered so it limits them, segmented and with deferred_segmentation. Over each line the alpha carriage goes up and back
+down to about where it started, so it has to be limited on the segments it moves the most in, not on how far it gets
+over the whole line. The fastest the alpha motor steps over any 10ms must be within its max_rate both ways.
+
+usage: deltacheck.py [-c config] hostsim
+
+e.g.
+    make && ./deltacheck.py build/hostsim
+"""
+
+from __future__ import print_function
+import argparse
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+
+
+MAX_RATE = 1200  # mm/min for alpha
+WINDOW = 1000  # ticks, 10ms at the 100kHz of the sample config
+
+
+def read_config(fn):
+    config = {}
+    with open(fn) as f:
+        for line in f:
+            words = line.split('#', 1)[0].split()
+            if len(words) >= 2:
+                config[words[0]] = words[1]
+    return config
+
+
+def write_gcode(fn):
+    # the alpha tower is at 210 degrees, these lines go at right angles to it through the middle of the bed
+    with open(fn, 'w') as f:
+        f.write("G21\nG90\nG1 X30 Y-51.962 Z50 F3000\n")
+        for i in range(4):
+            f.write("G1 X-30 Y51.962 F6000\n" if i % 2 == 0 else "G1 X30 Y-51.962 F6000\n")
+
+
+def peak_rate(fn, motor):
+    """the most steps the motor issued in any WINDOW ticks, in steps per second"""
+    ticks = []
+    with open(fn) as f:
+        f.readline()
+        for line in f:
+            tick, m, edge, level = line.strip().split(',')
+            if int(m) == motor and edge == 'S' and level == '1':
+                ticks.append(int(tick))
+    most, j = 0, 0
+    for i in range(len(ticks)):
+        while ticks[i] - ticks[j] >= WINDOW:
+            j += 1
+        most = max(most, i - j + 1)
+    return most * 100000.0 / WINDOW
+
+
+def main():
+    parser = argparse.ArgumentParser(description='check deferred segmentation keeps a delta tower within its max_rate')
+    parser.add_argument('-c', '--config', default='../ConfigSamples/Smoothieboard.delta/config')
+    parser.add_argument('sim')
+    args = parser.parse_args()
+
+    steps_per_mm = float(read_config(args.config).get('alpha_steps_per_mm', 100))
+    limit = MAX_RATE / 60.0 * steps_per_mm
+    tmp = tempfile.mkdtemp()
+    gcode, config, out = os.path.join(tmp, 'lines.gcode'), os.path.join(tmp, 'config'), os.path.join(tmp, 'out.csv')
+    write_gcode(gcode)
+
+    ok = True
+    for name, lines in (('segmented', []), ('deferred', ['deferred_segmentation true'])):
+        with open(config, 'w') as f:
+            f.write(open(args.config).read())
+            f.write('\nalpha_max_rate %d\n' % MAX_RATE + ''.join(l + '\n' for l in lines))
+        subprocess.check_output([args.sim, '-c', config, '-o', out, gcode])
+        rate = peak_rate(out, 0)
+        # a step either way of the window for where it falls on the steps
+        within = rate <= limit + 2 * 100000.0 / WINDOW
+        print("%-10s alpha at most %6.0f steps/s, max_rate is %6.0f steps/s%s" % (name + ':', rate, limit, '' if within else ', TOO FAST'))
+        ok &= within
+
+    shutil.rmtree(tmp)
+    print("PASS" if ok else "FAIL")
+    sys.exit(0 if ok else 1)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,173 @@
+#!/usr/bin/env python
+"""Checks that two builds of the host simulator produce the same steps.
+
+Runs each gcode file through a reference and a test build of hostsim, then compares the step timelines.
+Every block must issue the same steps in the same directions on every motor. The tick each step happens on,
+counted from the start of its block, may differ by --max-deviation ticks or by --max-fraction of the time since the
+previous step, whichever is larger. The second bound is there for the last few steps of a deceleration, where the
+rate is close to zero and a tiny difference in rate moves a step by many ticks. Such a last step also moves the end
+of its block, so the block starts drift apart over a long file; the start of every block, counted from the start of
+the first block, may move by no more than --max-drift ticks. When --random is given a seeded random corpus of that
+many lines is generated and checked as well.
+
+usage: equivalence.py [-c config] [--max-deviation ticks] [--max-fraction f] [--max-drift ticks] [--random lines] reference_sim test_sim [file.gcode ...]
+
+e.g. compare the 2.30 fixed point step ticker with the default 2.62 one
+    make && make BUILD=build/fp32 STEPTICKER_FP32=1
+    ./equivalence.py --random 5000 build/hostsim build/fp32/hostsim samples/*.gcode
+"""
+
+from __future__ import print_function
+import argparse
+import math
+import os
+import random
+import shutil
+import subprocess
+import sys
+import tempfile
+
+
+def random_corpus(fn, lines, seed):
+    rnd = random.Random(seed)
+    x, y, z = 0.0, 0.0, 0.0
+    with open(fn, 'w') as f:
+        f.write("G21\nG90\n")
+        n = 0
+        while n < lines:
+            kind = rnd.random()
+            if kind < 0.3:
+                # long move
+                x, y = rnd.uniform(0, 200), rnd.uniform(0, 200)
+                f.write("G1 X%.3f Y%.3f F%d\n" % (x, y, rnd.choice([600, 3000, 6000, 12000, 30000])))
+                n += 1
+            elif kind < 0.4:
+                z = rnd.uniform(0, 10)
+                f.write("G1 Z%.3f F%d\n" % (z, rnd.choice([100, 300, 600])))
+                n += 1
+            else:
+                # a curve of short segments, like sliced or CAM output
+                cx, cy, r = rnd.uniform(40, 160), rnd.uniform(40, 160), rnd.uniform(1, 30)
+                a0, da = rnd.uniform(0, 2 * math.pi), rnd.choice([-1, 1]) * rnd.uniform(0.02, 0.3)
+                f.write("G1 F%d\n" % rnd.choice([1200, 3000, 6000]))
+                for i in range(rnd.randint(5, 60)):
+                    a = a0 + i * da
+                    x, y = cx + r * math.cos(a), cy + r * math.sin(a)
+                    f.write("G1 X%.3f Y%.3f\n" % (x, y))
+                    n += 1
+
+
+def read_timeline(fn):
+    """returns the list of block start ticks and a dict of motor -> list of (block, tick in block, direction) for each step"""
+    blocks = []
+    steps = {}
+    dirs = {}
+    with open(fn) as f:
+        f.readline()
+        for line in f:
+            tick, motor, edge, level = line.strip().split(',')
+            tick, motor = int(tick), int(motor)
+            if edge == 'B':
+                blocks.append(tick)
+            elif edge == 'D':
+                dirs[motor] = level
+            else:
+                b = len(blocks) - 1
+                steps.setdefault(motor, []).append((b, tick - blocks[b], dirs.get(motor, '0')))
+    return blocks, steps
+
+
+def compare(ref, test, max_deviation, max_fraction, max_drift):
+    """the steps are compared relative to the start of the block they are in, a block that takes a tick longer
+    would otherwise shift every step that comes after it, the drift of the block starts is checked on its own"""
+    ok = True
+    (ref_blocks, ref_steps), (test_blocks, test_steps) = ref, test
+    if len(ref_blocks) != len(test_blocks):
+        print("  block count differs %d != %d" % (len(ref_blocks), len(test_blocks)))
+        return False
+    if ref_blocks:
+        # lines before the first block, like those a job leaves out, only offset the timeline
+        drift = [(t - test_blocks[0]) - (r - ref_blocks[0]) for r, t in zip(ref_blocks, test_blocks)]
+        worst = max(range(len(drift)), key=lambda b: abs(drift[b]))
+        print("  %d blocks, end of last block moved by %d ticks, block %d by %d" % (len(ref_blocks), test_blocks[-1] - ref_blocks[-1], worst, drift[worst]))
+        if abs(drift[worst]) > max_drift:
+            print("  block %d starts %d ticks away, more than %d" % (worst, drift[worst], max_drift))
+            ok = False
+
+    for m in sorted(set(ref_steps) | set(test_steps)):
+        r, t = ref_steps.get(m, []), test_steps.get(m, [])
+        if len(r) != len(t):
+            print("  motor %d: step count differs %d != %d" % (m, len(r), len(t)))
+            ok = False
+            continue
+        worst, worst_fraction, total, out_of_bounds = 0, 0, 0, 0
+        last_block, last_tick = -1, 0
+        for (rb, rt, rd), (tb, tt, td) in zip(r, t):
+            if rb != tb:
+                print("  motor %d: step moved from block %d to block %d" % (m, rb, tb))
+                ok = False
+                break
+            if rd != td:
+                print("  motor %d: direction differs in block %d" % (m, rb))
+                ok = False
+                break
+            d = abs(rt - tt)
+            interval = rt - last_tick if rb == last_block else rt
+            last_block, last_tick = rb, rt
+            total += d
+            worst = max(worst, d)
+            if d > 0:
+                worst_fraction = max(worst_fraction, float(d) / max(interval, 1))
+            if d > max(max_deviation, max_fraction * interval):
+                out_of_bounds += 1
+        mean = float(total) / len(r) if r else 0
+        print("  motor %d: %d steps, timing deviation max %d mean %1.2f ticks, max %1.2f of a step interval" % (m, len(r), worst, mean, worst_fraction))
+        if out_of_bounds > 0:
+            print("  motor %d: %d steps deviate by more than %d ticks and %1.2f of a step interval" % (m, out_of_bounds, max_deviation, max_fraction))
+            ok = False
+    return ok
+
+
+def run(sim, config, gcode, out):
+    cmd = [sim, '-o', out]
+    if config:
+        cmd += ['-c', config]
+    subprocess.check_call(cmd + [gcode], stdout=open(os.devnull, 'w'))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='compare the step timelines of two hostsim builds')
+    parser.add_argument('-c', '--config', default='../ConfigSamples/Smoothieboard/config')
+    parser.add_argument('--max-deviation', type=int, default=10, help='maximum allowed step timing deviation in ticks')
+    parser.add_argument('--max-fraction', type=float, default=0.25, help='maximum allowed deviation as a fraction of the step interval')
+    parser.add_argument('--max-drift', type=int, default=1000, help='maximum allowed move of a block start in ticks')
+    parser.add_argument('--random', type=int, default=0, help='also check a random corpus of this many lines')
+    parser.add_argument('--seed', type=int, default=1)
+    parser.add_argument('reference')
+    parser.add_argument('test')
+    parser.add_argument('gcode', nargs='*')
+    args = parser.parse_args()
+
+    tmp = tempfile.mkdtemp()
+    files = list(args.gcode)
+    if args.random > 0:
+        fn = os.path.join(tmp, 'random.gcode')
+        random_corpus(fn, args.random, args.seed)
+        files.append(fn)
+
+    ok = True
+    for g in files:
+        print("%s:" % g)
+        ref_out, test_out = os.path.join(tmp, 'ref.csv'), os.path.join(tmp, 'test.csv')
+        run(args.reference, args.config, g, ref_out)
+        run(args.test, args.config, g, test_out)
+        if not compare(read_timeline(ref_out), read_timeline(test_out), args.max_deviation, args.max_fraction, args.max_drift):
+            ok = False
+
+    shutil.rmtree(tmp)
+    print("PASS" if ok else "FAIL")
+    sys.exit(0 if ok else 1)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,290 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Converts a gcode file to a compiled job the Player can play without parsing it, see CompiledJob.h.
+//
+// Each line is looked at as the Player and GcodeDispatch would when the file is played: lines that are too long are
+// dropped, comments and lines GcodeDispatch only replies ok to are left out, and an X, Y, Z or F line on its own is
+// given the G0 to G3 it would have been played with. A line with a single G0 to G3 made of letters and numbers that fit
+// in a record becomes a move, with the values read by strtof as the Gcode tokenizer reads them, anything else is kept
+// as text and played as a line. The modal state is followed through the file for the checkpoints.
+//
+// usage: gcode2job [-i lines between checkpoints] file.gcode file.job
+
+#include "CompiledJob.h"
+#include "ReadAhead.h"
+#include "Gcode.h"
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#define GCODE_FRAME_START '\x02'
+
+static std::vector<CompiledJobRecord> records;
+static std::vector<CompiledJobCheckpoint> checkpoints;
+static uint32_t moves, texts, skipped, dropped;
+
+// the modal state as it is when the line being converted is played
+static struct {
+    uint8_t modal_group_1;
+    uint8_t flags;
+    uint8_t plane;
+    uint8_t wcs;
+    float seek_rate, feed_rate, s_value;
+    bool uploading;
+} state= {0, 0, 17, 0, 0, 0, 0, false};
+
+static void add_text(const char *p, size_t n, uint32_t line)
+{
+    CompiledJobRecord r;
+    memset(&r, 0, sizeof(r));
+    r.type= CompiledJobRecord::TEXT;
+    r.length= n;
+    r.line= line;
+    size_t first= n < sizeof(r.text) ? n : sizeof(r.text);
+    memcpy(r.text, p, first);
+    records.push_back(r);
+    for (size_t i = first; i < n; i += sizeof(r)) {
+        memset(&r, 0, sizeof(r));
+        memcpy(&r, p + i, n - i < sizeof(r) ? n - i : sizeof(r));
+        records.push_back(r);
+    }
+    ++texts;
+}
+
+// a single G0 to G3 with each letter once and a number after it, as a move record
+static bool make_move(const char *p, const char *end, uint32_t line, CompiledJobRecord &r)
+{
+    std::string s(p, end);
+    p= s.c_str();
+    char *e;
+    if(*p != 'G') return false;
+    long g= strtol(p + 1, &e, 10);
+    if(e == p + 1 || g < 0 || g > 3 || *e == '.') return false;
+
+    uint32_t letters= 0;
+    float values[26];
+    for (p= e; *p != '\0';) {
+        if(*p == ' ') {
+            ++p;
+            continue;
+        }
+        if(*p < 'A' || *p > 'Z' || *p == 'G' || *p == 'M' || *p == 'N' || (letters & (1 << (*p - 'A')))) return false;
+        float v= strtof(p + 1, &e);
+        if(e == p + 1) return false;
+        letters |= 1 << (*p - 'A');
+        values[*p - 'A']= v;
+        p= e;
+    }
+    if(__builtin_popcount(letters) > Gcode::max_words) return false;
+
+    memset(&r, 0, sizeof(r));
+    r.type= g;
+    r.line= line;
+    r.move.letters= letters;
+    for (int l = 0, i = 0; l < 26; ++l) {
+        if(letters & (1 << l)) r.move.values[i++]= values[l];
+    }
+    return true;
+}
+
+// follows what a command does to the modal state
+static void track(const char *p, const char *end)
+{
+    Gcode gcode(p, end - p, nullptr);
+    if(gcode.has_g) {
+        if(gcode.g < 4) {
+            state.modal_group_1= gcode.g;
+            if(gcode.has_letter('F')) {
+                if(gcode.g == 0) state.seek_rate= gcode.get_value('F');
+                else state.feed_rate= gcode.get_value('F');
+                state.flags |= gcode.g == 0 ? CompiledJob::HAS_SEEK : CompiledJob::HAS_FEED;
+            }
+            if(gcode.has_letter('S')) {
+                state.s_value= gcode.get_value('S');
+                state.flags |= CompiledJob::HAS_S;
+            }
+        } else if(gcode.g >= 17 && gcode.g <= 19) {
+            state.plane= gcode.g;
+        } else if(gcode.g == 20) {
+            state.flags |= CompiledJob::INCHES;
+        } else if(gcode.g == 21) {
+            state.flags &= ~CompiledJob::INCHES;
+        } else if(gcode.g >= 54 && gcode.g <= 59) {
+            state.wcs= gcode.g - 54;
+            if(gcode.g == 59 && gcode.subcode > 0) state.wcs= std::min(5 + gcode.subcode, 8);
+        } else if(gcode.g == 90) {
+            state.flags &= ~(CompiledJob::RELATIVE | CompiledJob::RELATIVE_E);
+        } else if(gcode.g == 91) {
+            state.flags |= CompiledJob::RELATIVE | CompiledJob::RELATIVE_E;
+        }
+    }
+    if(gcode.has_m) {
+        if(gcode.m == 82) state.flags &= ~CompiledJob::RELATIVE_E;
+        else if(gcode.m == 83) state.flags |= CompiledJob::RELATIVE_E;
+        else if(gcode.m == 2) state.modal_group_1= 1;
+        else if(gcode.m == 28) state.uploading= true;
+    }
+}
+
+static const char *find_first_of(const char *p, const char *end, const char *set)
+{
+    while(p < end && strchr(set, *p) == nullptr) ++p;
+    return p;
+}
+
+// each command on a line without its comments, split where GcodeDispatch splits them
+static void track_line(const char *p, const char *end)
+{
+    for (const char *next; p < end; p= next) {
+        next= end - p > 2 ? find_first_of(p + 2, end, "GM") : end;
+        track(p, next);
+    }
+}
+
+static void convert_line(const char *p, const char *end, uint32_t line, uint32_t interval)
+{
+    if(state.uploading) {
+        // the lines up to M29 are written to a file when it is played
+        if(end - p >= 3 && strncmp(p, "M29", 3) == 0) state.uploading= false;
+        add_text(p, end - p, line);
+        return;
+    }
+
+    std::string rewritten;
+    char first= *p;
+    if(first == GCODE_FRAME_START || first == '$' || islower(first)) {
+        add_text(p, end - p, line);
+        return;
+    }
+
+    if(first == 'N') {
+        // line numbers and checksums are left to GcodeDispatch
+        const char *cs= find_first_of(p, end, "*");
+        const char *c= p + strspn(p, "N0123456789.,- ");
+        const char *eol= find_first_of(c, cs, ";(");
+        track_line(c, eol);
+        add_text(p, end - p, line);
+        return;
+    }
+
+    const char *n= find_first_of(p, end, "XYZF");
+    if(first != 'G' && first != 'M' && first != 'T' && first != 'S') {
+        if(first == ';' || first == '(' || !(n == p || (first == ' ' && n != end))) {
+            // a comment or something GcodeDispatch just replies ok to
+            ++skipped;
+            return;
+        }
+        // as GcodeDispatch plays an X, Y, Z or F on its own
+        char buf[6];
+        snprintf(buf, sizeof(buf), "G%d ", *n == 'F' ? 1 : state.modal_group_1);
+        rewritten.assign(buf).append(p, end);
+        p= rewritten.data();
+        end= p + rewritten.size();
+    }
+
+    end= find_first_of(p, end, ";(");
+    const char *next= end - p > 2 ? find_first_of(p + 2, end, "GM") : end;
+
+    CompiledJobRecord r;
+    if(next == end && make_move(p, end, line, r)) {
+        if(r.type <= 1 && (checkpoints.empty() ? line > interval : line - checkpoints.back().line >= interval)) {
+            CompiledJobCheckpoint cp;
+            memset(&cp, 0, sizeof(cp));
+            cp.record= records.size();
+            cp.line= line;
+            cp.flags= state.flags;
+            cp.plane= state.plane;
+            cp.wcs= state.wcs;
+            cp.seek_rate= state.seek_rate;
+            cp.feed_rate= state.feed_rate;
+            cp.s_value= state.s_value;
+            checkpoints.push_back(cp);
+        }
+        records.push_back(r);
+        ++moves;
+    } else {
+        add_text(p, end - p, line);
+    }
+
+    track_line(p, end);
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t interval= 100;
+    int c;
+    while((c = getopt(argc, argv, "i:")) != -1) {
+        if(c == 'i' && atoi(optarg) > 0) interval= atoi(optarg);
+        else {
+            fprintf(stderr, "usage: %s [-i lines between checkpoints] file.gcode file.job\n", argv[0]);
+            return 1;
+        }
+    }
+    if(argc - optind != 2) {
+        fprintf(stderr, "usage: %s [-i lines between checkpoints] file.gcode file.job\n", argv[0]);
+        return 1;
+    }
+
+    FILE *fp= fopen(argv[optind], "rb");
+    if(fp == nullptr) {
+        fprintf(stderr, "could not open %s\n", argv[optind]);
+        return 1;
+    }
+    std::string file;
+    char buf[4096];
+    size_t n;
+    while((n= fread(buf, 1, sizeof(buf), fp)) > 0) file.append(buf, n);
+    fclose(fp);
+
+    // split as ReadAhead does, less a \r before the \n, without empty lines and lines that are too long
+    uint32_t line= 0;
+    for (size_t p = 0; p < file.size();) {
+        size_t e= file.find('\n', p);
+        if(e == std::string::npos) e= file.size();
+        size_t len= e - p;
+        ++line;
+        if(len > 0 && file[p + len - 1] == '\r') --len;
+        if(len > ReadAhead::max_line) ++dropped;
+        else if(len > 0) convert_line(file.data() + p, file.data() + p + len, line, interval);
+        p= e + 1;
+    }
+
+    CompiledJobHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, COMPILED_JOB_MAGIC, sizeof(header.magic));
+    header.records= records.size();
+    header.checkpoints= checkpoints.size();
+    header.lines= line;
+
+    CompiledJobRecord end;
+    memset(&end, 0, sizeof(end));
+    end.type= CompiledJobRecord::END;
+    end.line= line;
+
+    FILE *out= fopen(argv[optind + 1], "wb");
+    if(out == nullptr) {
+        fprintf(stderr, "could not write %s\n", argv[optind + 1]);
+        return 1;
+    }
+    fwrite(&header, sizeof(header), 1, out);
+    fwrite(records.data(), sizeof(CompiledJobRecord), records.size(), out);
+    fwrite(&end, sizeof(end), 1, out);
+    fwrite(checkpoints.data(), sizeof(CompiledJobCheckpoint), checkpoints.size(), out);
+    long size= ftell(out);
+    fclose(out);
+
+    printf("%s: %u lines, %u moves, %u text lines, %u left out, %u too long, %u checkpoints, %ld bytes\n", argv[optind + 1], line,
+           moves, texts, skipped, dropped, (unsigned)checkpoints.size(), size);
+    return 0;
+}
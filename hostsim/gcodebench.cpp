@@ -0,0 +1,333 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Runs the Gcode unit tests on the host, checks the tokenizer gives the same answers as scanning the line for every
+// letter of every line in the given files, then reports lines parsed per second and heap allocations per line.
+// The G0 to G3 moves are also sent as binary frames (see GcodeFrame.h), checked to give the same answers as the text
+// and benchmarked against the text.
+//
+// usage: gcodebench [-n repeats] [-r random lines] file.gcode ...
+//
+// -r also checks that many lines of random letters, digits and punctuation, they are not benchmarked
+
+#include "Gcode.h"
+#include "GcodeFrame.h"
+#include "libs/StreamOutput.h"
+
+#include "easyunit/testharness.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+// every heap allocation goes through here, including the ones made inside libc like strdup
+extern "C" void *__libc_malloc(size_t size);
+static uint32_t malloc_calls;
+extern "C" void *malloc(size_t size)
+{
+    ++malloc_calls;
+    return __libc_malloc(size);
+}
+
+// how a line was looked up before it was tokenized, each lookup scans the line
+class ScannedGcode {
+    public:
+        ScannedGcode(const std::string &line)
+        {
+            command= strdup(line.c_str());
+            char *p= nullptr;
+            has_g= has_letter('G');
+            if(has_g) g= get_int('G', &p);
+            has_m= has_letter('M');
+            if(has_m) m= get_int('M', &p);
+            subcode= 0;
+            if((has_g || has_m) && p != nullptr && *p == '.') subcode= strtoul(p + 1, &p, 10);
+            if(p != nullptr) {
+                char *n= strdup(p);
+                free(command);
+                command= n;
+            }
+        }
+        ~ScannedGcode() { free(command); }
+
+        bool has_letter(char letter) const
+        {
+            for (size_t i = 0; i < strlen(command); ++i) {
+                if(command[i] == letter) return true;
+            }
+            return false;
+        }
+
+        float get_value(char letter) const
+        {
+            for (const char *cs = command; *cs; cs++) {
+                if(letter == *cs) {
+                    char *cn;
+                    float r= strtof(cs + 1, &cn);
+                    if(cn > cs + 1) return r;
+                }
+            }
+            return 0;
+        }
+
+        int get_int(char letter, char **ptr= nullptr) const
+        {
+            char *cn= nullptr;
+            for (const char *cs = command; *cs; cs++) {
+                if(letter == *cs) {
+                    int r= strtol(cs + 1, &cn, 10);
+                    if(ptr != nullptr) *ptr= cn;
+                    if(cn > cs + 1) return r;
+                }
+            }
+            if(ptr != nullptr) *ptr= nullptr;
+            return 0;
+        }
+
+        int get_num_args() const
+        {
+            int count= 0;
+            for(size_t i = 0; i < strlen(command); i++) {
+                if(command[i] >= 'A' && command[i] <= 'Z' && command[i] != 'T') count++;
+            }
+            return count;
+        }
+
+        char *command;
+        unsigned int m= 0, g= 0, subcode;
+        bool has_g, has_m;
+};
+
+// the lookups Robot and the extruder make for a move
+template <class T> static float lookups(const T &gc)
+{
+    float sum= 0;
+    if(gc.has_g) sum += gc.g;
+    for (char c : {'X', 'Y', 'Z', 'E', 'F', 'A', 'B', 'C', 'S', 'P'}) {
+        if(gc.has_letter(c)) sum += gc.get_value(c);
+    }
+    return sum;
+}
+
+static bool same(const std::string &line)
+{
+    Gcode gc(line, &StreamOutput::NullStream);
+    ScannedGcode sc(line);
+    bool ok= gc.has_g == sc.has_g && gc.has_m == sc.has_m && gc.subcode == (sc.subcode & 7) &&
+             (!gc.has_g || gc.g == sc.g) && (!gc.has_m || gc.m == sc.m) &&
+             strcmp(gc.get_command(), sc.command) == 0 && gc.get_num_args() == sc.get_num_args();
+    for (char c = 'A'; c <= 'Z' && ok; ++c) {
+        ok= gc.has_letter(c) == sc.has_letter(c) && gc.get_int(c) == sc.get_int(c) &&
+            (gc.get_value(c) == sc.get_value(c) || (gc.get_value(c) != gc.get_value(c) && sc.get_value(c) != sc.get_value(c)));
+    }
+    if(!ok) printf("tokenized and scanned lookups differ for: %s\n", line.c_str());
+    return ok;
+}
+
+template <class T> static void bench(const char *name, const std::vector<std::string> &lines, int repeats)
+{
+    float sum= 0;
+    uint32_t calls= malloc_calls;
+    auto start= std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; ++r) {
+        for (auto &l : lines) {
+            T *gc= new T(l, &StreamOutput::NullStream);
+            sum += lookups(*gc);
+            delete gc;
+        }
+    }
+    double secs= std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    double n= (double)lines.size() * repeats;
+    printf("%-9s %10.0f lines/s, %1.2f heap allocations per line (checksum %g)\n", name, n / secs, (malloc_calls - calls) / n, sum);
+}
+
+// the frame stream-window.py --binary sends for a move, without GCODE_FRAME_START, or an empty string if the line is
+// not a G0 to G3 made of letters and numbers that fit in a frame
+static std::string encode_frame(const std::string &line)
+{
+    const char *p= line.c_str();
+    char *e;
+    if(*p != 'G') return "";
+    long g= strtol(p + 1, &e, 10);
+    if(e == p + 1 || g < 0 || g > 3 || *e == '.') return "";
+
+    uint32_t letters= 0;
+    float values[26];
+    for (p= e; *p != '\0';) {
+        if(*p == ' ') {
+            ++p;
+            continue;
+        }
+        if(*p < 'A' || *p > 'Z' || *p == 'G' || (letters & (1 << (*p - 'A')))) return "";
+        float v= strtof(p + 1, &e);
+        if(e == p + 1) return "";
+        letters |= 1 << (*p - 'A');
+        values[*p - 'A']= v;
+        p= e;
+    }
+    if(__builtin_popcount(letters) > Gcode::max_words) return "";
+
+    std::vector<uint8_t> frame;
+    frame.push_back(g);
+    for (int i = 0; i < 4; ++i) frame.push_back(letters >> (i * 8));
+    for (int l = 0; l < 26; ++l) {
+        if(letters & (1 << l)) {
+            uint8_t b[4];
+            memcpy(b, &values[l], 4);
+            frame.insert(frame.end(), b, b + 4);
+        }
+    }
+    uint16_t crc= GcodeFrame::crc16(frame.data(), frame.size());
+    frame.push_back(crc & 0xFF);
+    frame.push_back(crc >> 8);
+
+    static const char b64[]= "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    std::string out;
+    uint32_t bits= 0;
+    int nbits= 0;
+    for (uint8_t b : frame) {
+        bits= (bits << 8) | b;
+        nbits += 8;
+        while(nbits >= 6) {
+            nbits -= 6;
+            out += b64[(bits >> nbits) & 0x3F];
+        }
+    }
+    if(nbits > 0) out += b64[(bits << (6 - nbits)) & 0x3F];
+    return out;
+}
+
+// a framed move has to look like the text it was made from to everything that handles a move
+static bool same_frame(const std::string &line, const std::string &frame)
+{
+    const char *error= nullptr;
+    Gcode *fc= GcodeFrame::decode(frame.data(), frame.size(), &StreamOutput::NullStream, &error);
+    if(fc == nullptr) {
+        printf("frame for %s was rejected: %s\n", line.c_str(), error);
+        return false;
+    }
+    Gcode gc(line, &StreamOutput::NullStream);
+    bool ok= fc->has_g && !fc->has_m && fc->g == gc.g && fc->subcode == gc.subcode && fc->get_num_args() == gc.get_num_args();
+    for (char c = 'A'; c <= 'Z' && ok; ++c) {
+        ok= fc->has_letter(c) == gc.has_letter(c) && fc->get_value(c) == gc.get_value(c) && fc->get_int(c) == gc.get_int(c);
+    }
+    delete fc;
+
+    // and a frame that was damaged on the way must not be run
+    std::string bad(frame);
+    bad[bad.size() / 2]= bad[bad.size() / 2] == 'A' ? 'B' : 'A';
+    fc= GcodeFrame::decode(bad.data(), bad.size(), &StreamOutput::NullStream, &error);
+    if(fc != nullptr) {
+        printf("damaged frame for %s was accepted\n", line.c_str());
+        delete fc;
+        ok= false;
+    }
+
+    if(!ok) printf("framed and text lookups differ for: %s\n", line.c_str());
+    return ok;
+}
+
+static void bench_frames(const std::vector<std::string> &moves, const std::vector<std::string> &frames, int repeats)
+{
+    float sum= 0;
+    const char *error;
+    uint32_t calls= malloc_calls;
+    auto start= std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; ++r) {
+        for (auto &f : frames) {
+            Gcode *gc= GcodeFrame::decode(f.data(), f.size(), &StreamOutput::NullStream, &error);
+            sum += lookups(*gc);
+            delete gc;
+        }
+    }
+    double secs= std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    double n= (double)frames.size() * repeats;
+    size_t text_bytes= 0, frame_bytes= 0;
+    for (auto &m : moves) text_bytes += m.size() + 1;
+    for (auto &f : frames) frame_bytes += f.size() + 2;
+    printf("%-9s %10.0f lines/s, %1.2f heap allocations per line (checksum %g), %1.1f bytes per move, %1.1f as text\n",
+           "framed", n / secs, (malloc_calls - calls) / n, sum, frame_bytes / (double)frames.size(), text_bytes / (double)moves.size());
+}
+
+// the scanned version has the same constructor as Gcode for bench()
+class ScannedLine : public ScannedGcode {
+    public:
+        ScannedLine(const std::string &line, StreamOutput *) : ScannedGcode(line) {}
+};
+
+int main(int argc, char *argv[])
+{
+    int repeats= 20;
+    int random_lines= 0;
+    int c;
+    while((c = getopt(argc, argv, "n:r:")) != -1) {
+        if(c == 'n') repeats= atoi(optarg);
+        else if(c == 'r') random_lines= atoi(optarg);
+        else {
+            fprintf(stderr, "usage: %s [-n repeats] [-r random lines] file.gcode ...\n", argv[0]);
+            return 1;
+        }
+    }
+
+    const TestResult *result= TestRegistry::runAndPrint();
+    bool ok= result->getFailures() == 0 && result->getErrors() == 0;
+
+    // the lines the dispatcher hands to Gcode, without line numbers, checksums and comments
+    std::vector<std::string> lines;
+    for (int i = optind; i < argc; ++i) {
+        FILE *fp= fopen(argv[i], "r");
+        if(fp == nullptr) {
+            fprintf(stderr, "could not open %s\n", argv[i]);
+            return 1;
+        }
+        char buf[256];
+        while(fgets(buf, sizeof(buf), fp) != nullptr) {
+            buf[strcspn(buf, ";(\r\n")]= '\0';
+            if(buf[0] != '\0') lines.push_back(buf);
+        }
+        fclose(fp);
+    }
+
+    for (auto &l : lines) {
+        if(!same(l)) ok= false;
+    }
+    srand(1);
+    for (int i = 0; i < random_lines; ++i) {
+        static const char *starts[]= {"", "G", "M", "G1 ", "M117 "};
+        static const char chars[]= "GMXYZEFSPT .-+0123456789e.abN*";
+        std::string l(starts[rand() % 5]);
+        for (int n = 1 + rand() % 70; n > 0; --n) l += chars[rand() % (sizeof(chars) - 1)];
+        if(!same(l)) ok= false;
+    }
+    printf("%u lines and %d random lines checked\n", (unsigned)lines.size(), random_lines);
+
+    std::vector<std::string> moves, frames;
+    for (auto &l : lines) {
+        std::string f= encode_frame(l);
+        if(f.empty()) continue;
+        if(!same_frame(l, f)) ok= false;
+        moves.push_back(l);
+        frames.push_back(f);
+    }
+    printf("%u moves checked as binary frames\n", (unsigned)moves.size());
+
+    if(!lines.empty()) {
+        bench<ScannedLine>("scanned", lines, repeats);
+        bench<Gcode>("tokenized", lines, repeats);
+    }
+    if(!moves.empty()) {
+        bench<Gcode>("moves", moves, repeats);
+        bench_frames(moves, frames, repeats);
+    }
+
+    printf(ok ? "PASS\n" : "FAIL\n");
+    return ok ? 0 : 1;
+}
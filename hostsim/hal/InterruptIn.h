@@ -0,0 +1,14 @@
+// Host replacement for mbed InterruptIn, pin interrupts are never raised on the host
+
+#pragma once
+
+#include "PinNames.h"
+
+namespace mbed {
+class InterruptIn {
+    public:
+        InterruptIn(PinName pin) {}
+        template<typename T> void rise(T *tptr, void (T::*mptr)(void)) {}
+        template<typename T> void fall(T *tptr, void (T::*mptr)(void)) {}
+};
+}
@@ -0,0 +1,15 @@
+// Host replacement for the mbed PinNames.h, pins are numbered port * 32 + pin like the target
+// only the names used by Pin::hardware_pwm() are defined
+
+#pragma once
+
+typedef enum {
+    P1_18 = 32 + 18, P1_20 = 32 + 20, P1_21 = 32 + 21, P1_23 = 32 + 23, P1_24 = 32 + 24, P1_26 = 32 + 26,
+    P2_0 = 64 + 0, P2_1 = 64 + 1, P2_2 = 64 + 2, P2_3 = 64 + 3, P2_4 = 64 + 4, P2_5 = 64 + 5,
+    P3_25 = 96 + 25, P3_26 = 96 + 26,
+    NC = -1
+} PinName;
+
+typedef enum {
+    Port0 = 0, Port1 = 1, Port2 = 2, Port3 = 3, Port4 = 4
+} PortName;
@@ -0,0 +1,16 @@
+// Host replacement for mbed PwmOut, hardware pwm is not simulated so the output is inert
+
+#pragma once
+
+#include "PinNames.h"
+
+namespace mbed {
+class PwmOut {
+    public:
+        PwmOut(PinName pin) {}
+        void write(float value) {}
+        float read() { return 0; }
+        void period_us(int us) {}
+        void pulsewidth_us(int us) {}
+};
+}
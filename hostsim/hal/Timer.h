@@ -0,0 +1,5 @@
+// Host replacement for mbed Timer.h, nothing in the motion core needs more than us_ticker_read()
+
+#pragma once
+
+#include "mbed.h"
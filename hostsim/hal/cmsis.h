@@ -0,0 +1,5 @@
+// Host replacement for the mbed cmsis.h umbrella header
+
+#pragma once
+
+#include "LPC17xx.h"
@@ -0,0 +1,8 @@
+// newlib specific header, glibc has the same functions in math.h
+
+#pragma once
+
+#include <math.h>
+
+// newlib has infinityf() in math.h, glibc does not
+inline float infinityf() { return __builtin_inff(); }
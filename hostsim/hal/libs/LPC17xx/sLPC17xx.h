@@ -0,0 +1,161 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Host replacement for the smoothed LPC17xx device header (src/libs/LPC17xx/sLPC17xx.h).
+// Only the peripherals touched by the motion core are modelled, they are plain memory so writes are harmless,
+// the simulator drives the timer interrupts itself.
+// Writes to FIOSET/FIOCLR update the simulated pin state and are reported to the edge recorder,
+// this is how the simulator captures every step and direction edge without touching StepperMotor.
+
+#pragma once
+
+#include <stdint.h>
+#include "system_LPC17xx.h"
+
+// called for every write to a port, port is 0-4, mask is the pins written and level is the new state
+typedef void (*sim_gpio_hook_t)(uint8_t port, uint32_t mask, bool level);
+extern sim_gpio_hook_t sim_gpio_hook;
+
+class SimGpioWriteRegister {
+    public:
+        SimGpioWriteRegister(uint8_t port, uint32_t *state, bool level) : port(port), level(level), state(state) {}
+        SimGpioWriteRegister& operator=(uint32_t mask)
+        {
+            if(level) *state |= mask;
+            else *state &= ~mask;
+            if(sim_gpio_hook != nullptr) sim_gpio_hook(port, mask, level);
+            return *this;
+        }
+
+    private:
+        uint8_t port;
+        bool level;
+        uint32_t *state;
+};
+
+typedef struct SimGpioPort {
+    SimGpioPort(uint8_t port) : FIODIR(0), FIOMASK(0), FIOPIN(0), FIOSET(port, &FIOPIN, true), FIOCLR(port, &FIOPIN, false) {}
+    uint32_t FIODIR;
+    uint32_t FIOMASK;
+    uint32_t FIOPIN;
+    SimGpioWriteRegister FIOSET;
+    SimGpioWriteRegister FIOCLR;
+} LPC_GPIO_TypeDef;
+
+extern LPC_GPIO_TypeDef sim_gpio[5];
+
+#define LPC_GPIO0 (&sim_gpio[0])
+#define LPC_GPIO1 (&sim_gpio[1])
+#define LPC_GPIO2 (&sim_gpio[2])
+#define LPC_GPIO3 (&sim_gpio[3])
+#define LPC_GPIO4 (&sim_gpio[4])
+
+typedef enum IRQn {
+    PendSV_IRQn = -2,
+    WDT_IRQn = 0,
+    TIMER0_IRQn,
+    TIMER1_IRQn,
+    TIMER2_IRQn,
+    TIMER3_IRQn,
+    UART0_IRQn,
+    UART1_IRQn,
+    UART2_IRQn,
+    UART3_IRQn,
+    ADC_IRQn,
+    USB_IRQn,
+} IRQn_Type;
+
+typedef struct {
+    volatile uint32_t IR;
+    volatile uint32_t TCR;
+    volatile uint32_t TC;
+    volatile uint32_t PR;
+    volatile uint32_t PC;
+    volatile uint32_t MCR;
+    volatile uint32_t MR0;
+    volatile uint32_t MR1;
+    volatile uint32_t MR2;
+    volatile uint32_t MR3;
+} LPC_TIM_TypeDef;
+
+typedef struct {
+    volatile uint32_t PCONP;
+    volatile uint32_t PCLKSEL0;
+    volatile uint32_t PCLKSEL1;
+} LPC_SC_TypeDef;
+
+typedef struct {
+    volatile uint32_t WDMOD;
+    volatile uint32_t WDTC;
+    volatile uint32_t WDFEED;
+    volatile uint32_t WDTV;
+    volatile uint32_t WDCLKSEL;
+} LPC_WDT_TypeDef;
+
+typedef struct {
+    volatile uint32_t PINSEL[11];
+    volatile uint32_t PINMODE0, PINMODE1, PINMODE2, PINMODE3, PINMODE4, PINMODE5, PINMODE6, PINMODE7, PINMODE8, PINMODE9;
+    volatile uint32_t PINMODE_OD0, PINMODE_OD1, PINMODE_OD2, PINMODE_OD3, PINMODE_OD4;
+} LPC_PINCON_TypeDef;
+
+extern LPC_TIM_TypeDef sim_tim[4];
+extern LPC_SC_TypeDef sim_sc;
+extern LPC_WDT_TypeDef sim_wdt;
+extern LPC_PINCON_TypeDef sim_pincon;
+
+#define LPC_TIM0 (&sim_tim[0])
+#define LPC_TIM1 (&sim_tim[1])
+#define LPC_TIM2 (&sim_tim[2])
+#define LPC_TIM3 (&sim_tim[3])
+#define LPC_SC   (&sim_sc)
+#define LPC_WDT  (&sim_wdt)
+#define LPC_PINCON (&sim_pincon)
+
+// the DWT cycle counter counts host cpu cycles, writing it sets the count from now on
+uint32_t sim_cycles(void);
+
+class SimCycleCounter {
+    public:
+        SimCycleCounter() : offset(0) {}
+        operator uint32_t() const { return sim_cycles() - offset; }
+        SimCycleCounter& operator=(uint32_t count)
+        {
+            offset = sim_cycles() - count;
+            return *this;
+        }
+
+    private:
+        uint32_t offset;
+};
+
+typedef struct {
+    volatile uint32_t CTRL;
+    SimCycleCounter CYCCNT;
+} DWT_Type;
+
+typedef struct {
+    volatile uint32_t DEMCR;
+} CoreDebug_Type;
+
+extern DWT_Type sim_dwt;
+extern CoreDebug_Type sim_core_debug;
+
+#define DWT       (&sim_dwt)
+#define CoreDebug (&sim_core_debug)
+#define DWT_CTRL_CYCCNTENA_Msk     (1UL << 0)
+#define CoreDebug_DEMCR_TRCENA_Msk (1UL << 24)
+
+inline void NVIC_EnableIRQ(IRQn_Type) {}
+inline void NVIC_DisableIRQ(IRQn_Type) {}
+inline void NVIC_SetPriority(IRQn_Type, uint32_t) {}
+inline uint32_t NVIC_GetPriority(IRQn_Type) { return 0; }
+inline void NVIC_SetPriorityGrouping(uint32_t) {}
+inline void NVIC_SetPendingIRQ(IRQn_Type) {}
+void NVIC_SystemReset(void);
+
+inline void __disable_irq() {}
+inline void __enable_irq() {}
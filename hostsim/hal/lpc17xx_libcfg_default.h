@@ -0,0 +1,3 @@
+// Host replacement for the LPC17xx driver library configuration, there is nothing to configure
+
+#pragma once
@@ -0,0 +1,15 @@
+// Host replacement for the LPC17xx pin select driver, pins are not simulated
+
+#pragma once
+
+#include <stdint.h>
+
+typedef struct {
+    uint8_t Portnum;
+    uint8_t Pinnum;
+    uint8_t Funcnum;
+    uint8_t Pinmode;
+    uint8_t OpenDrain;
+} PINSEL_CFG_Type;
+
+inline void PINSEL_ConfigPin(PINSEL_CFG_Type *) {}
@@ -0,0 +1,59 @@
+// Host replacement for the LPC17xx UART driver, only what SerialConsole uses.
+// Setting up the UART does nothing, what is sent goes to the simulated serial link, see SerialLink.h,
+// which also delivers the received characters to SerialConsole as the receive interrupt would.
+
+#pragma once
+
+#include <stdint.h>
+
+typedef enum { DISABLE = 0, ENABLE = !DISABLE } FunctionalState;
+typedef enum { NONE_BLOCKING = 0, BLOCKING } TRANSFER_BLOCK_Type;
+
+typedef struct {
+    uint32_t Baud_rate;
+} UART_CFG_Type;
+
+typedef struct {
+    uint32_t FIFO_State;
+} UART_FIFO_CFG_Type;
+
+typedef struct {
+    uint32_t uart;
+} LPC_UART_TypeDef;
+
+extern LPC_UART_TypeDef sim_uart[4];
+
+#define LPC_UART0 (&sim_uart[0])
+#define LPC_UART1 (&sim_uart[1])
+#define LPC_UART2 (&sim_uart[2])
+#define LPC_UART3 (&sim_uart[3])
+
+#define UART_IIR_INTID_MASK 0x0E
+#define UART_IIR_INTID_RLS  0x06
+#define UART_IIR_INTID_RDA  0x04
+#define UART_IIR_INTID_CTI  0x0C
+
+#define UART_LSR_RXFE 0x80
+#define UART_LSR_OE   0x02
+#define UART_LSR_PE   0x04
+#define UART_LSR_FE   0x08
+#define UART_LSR_BI   0x10
+
+typedef enum { UART_INTCFG_RBR = 0, UART_INTCFG_THRE, UART_INTCFG_RLS } UART_INT_Type;
+
+// the interrupt handler is never called, so there is never anything to read here
+inline uint32_t UART_GetIntId(LPC_UART_TypeDef *) { return 0x01; }
+inline uint8_t UART_GetLineStatus(LPC_UART_TypeDef *) { return 0; }
+inline uint32_t UART_Receive(LPC_UART_TypeDef *, uint8_t *, uint32_t, TRANSFER_BLOCK_Type) { return 0; }
+
+inline void UART_ConfigStructInit(UART_CFG_Type *cfg) { cfg->Baud_rate = 9600; }
+inline void UART_Init(LPC_UART_TypeDef *, UART_CFG_Type *) {}
+inline void UART_DeInit(LPC_UART_TypeDef *) {}
+inline void UART_FIFOConfigStructInit(UART_FIFO_CFG_Type *cfg) { cfg->FIFO_State = ENABLE; }
+inline void UART_FIFOConfig(LPC_UART_TypeDef *, UART_FIFO_CFG_Type *) {}
+inline void UART_TxCmd(LPC_UART_TypeDef *, FunctionalState) {}
+inline void UART_IntConfig(LPC_UART_TypeDef *, UART_INT_Type, FunctionalState) {}
+
+// sends to the host at the other end of the simulated serial link
+uint32_t UART_Send(LPC_UART_TypeDef *uart, uint8_t *buf, uint32_t len, TRANSFER_BLOCK_Type flag);
+inline void UART_SendByte(LPC_UART_TypeDef *uart, uint8_t c) { UART_Send(uart, &c, 1, BLOCKING); }
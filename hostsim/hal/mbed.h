@@ -0,0 +1,25 @@
+// Host replacement for mbed.h, only the calls used by the motion core are provided.
+// us_ticker_read() returns the simulated time, which is derived from the step ticker tick count.
+
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "cmsis.h"
+#include "wait_api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+uint32_t us_ticker_read(void);
+#ifdef __cplusplus
+}
+
+// the target mbed.h pulls std into the global namespace and some sources rely on it
+#include <string>
+#include <vector>
+using namespace std;
+#endif
@@ -0,0 +1,15 @@
+// Host replacement for the MRI debug monitor header.
+// __debugbreak() is fatal on the host as there is no debugger to drop into.
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+void __debugbreak(void);
+int __mriPlatform_CommUartIndex(void);
+#ifdef __cplusplus
+}
+#endif
+
+#define MRI_ENABLE 0
@@ -0,0 +1,14 @@
+// forced into FileConfigSource on the host, newlib's fpos_t is a long the line lengths are worked out with, glibc's
+// is a struct
+
+#pragma once
+
+#include <stdio.h>
+#include <cstdio>
+
+static inline int host_fgetpos(FILE *fp, long *pos) { *pos = ftell(fp); return *pos < 0 ? -1 : 0; }
+static inline int host_fsetpos(FILE *fp, const long *pos) { return fseek(fp, *pos, SEEK_SET); }
+
+#define fpos_t long
+#define fgetpos host_fgetpos
+#define fsetpos host_fsetpos
@@ -0,0 +1,7 @@
+// Host replacement for the mbed port api
+
+#pragma once
+
+#include "PinNames.h"
+
+inline PinName port_pin(PortName port, int pin_n) { return (PinName)(port * 32 + pin_n); }
@@ -0,0 +1,5 @@
+// Host replacement for the smoothed LPC17xx device header
+
+#pragma once
+
+#include "libs/LPC17xx/sLPC17xx.h"
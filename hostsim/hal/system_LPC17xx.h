@@ -0,0 +1,7 @@
+// Host replacement for the CMSIS system header, the simulated core clock matches a Smoothieboard
+
+#pragma once
+
+#include <stdint.h>
+
+extern uint32_t SystemCoreClock;
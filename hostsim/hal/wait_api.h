@@ -0,0 +1,13 @@
+// Host replacement for the mbed wait api
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+void wait(float s);
+void wait_ms(int ms);
+void wait_us(int us);
+#ifdef __cplusplus
+}
+#endif
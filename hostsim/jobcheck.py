@@ -0,0 +1,87 @@
+#!/usr/bin/env python
+"""Checks that a compiled job moves the machine exactly as the gcode file it was made from.
+
+Converts each gcode file with gcode2job, runs the file and the job through hostsim and compares the step timelines.
+Every block must issue the same steps in the same directions at the same tick counted from the start of the block.
+Lines the job leaves out, like comments, take a main loop each when the file is played, so the blocks may start
+later in the file than in the job, the timelines are only identical when nothing was left out.
+
+Then the lines of the file before its middle checkpoint are played, and the job is started from that checkpoint with
+-l, as a job that was stopped there would be resumed. The modes are changed in between, the modal state the checkpoint
+puts back has to be the state the lines left, so the steps must again be the same as those of the whole file.
+
+usage: jobcheck.py [-c config] gcode2job hostsim file.gcode ...
+
+e.g.
+    make build/hostsim build/gcode2job && ./jobcheck.py build/gcode2job build/hostsim samples/*.gcode
+"""
+
+from __future__ import print_function
+import argparse
+import os
+import shutil
+import struct
+import subprocess
+import sys
+import tempfile
+
+from equivalence import read_timeline, compare
+
+
+def read_checkpoints(fn):
+    """returns the lines of the checkpoints in a compiled job"""
+    with open(fn, 'rb') as f:
+        data = f.read()
+    magic, records, checkpoints, lines = struct.unpack_from('<8sIII', data)
+    offset = (records + 2) * 64
+    return [struct.unpack_from('<II', data, offset + i * 24)[1] for i in range(checkpoints)]
+
+
+def run(sim, config, out, args):
+    cmd = [sim, '-c', config, '-o', out] + args
+    subprocess.check_call(cmd, stdout=open(os.devnull, 'w'))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='compare the steps of compiled jobs with the gcode they were made from')
+    parser.add_argument('-c', '--config', default='../ConfigSamples/Smoothieboard/config')
+    parser.add_argument('gcode2job')
+    parser.add_argument('hostsim')
+    parser.add_argument('gcode', nargs='+')
+    args = parser.parse_args()
+
+    tmp = tempfile.mkdtemp()
+    ok = True
+    for g in args.gcode:
+        print("%s:" % g)
+        job, text_out, job_out = os.path.join(tmp, 'test.job'), os.path.join(tmp, 'text.csv'), os.path.join(tmp, 'job.csv')
+        subprocess.check_call([args.gcode2job, g, job], stdout=open(os.devnull, 'w'))
+        run(args.hostsim, args.config, text_out, [g])
+        run(args.hostsim, args.config, job_out, [job])
+        text, played = read_timeline(text_out), read_timeline(job_out)
+        if not compare(text, played, 0, 0, 0):
+            ok = False
+        print("  timelines are %s" % ("identical" if open(text_out).read() == open(job_out).read() else "offset by the lines left out"))
+
+        checkpoints = read_checkpoints(job)
+        if not checkpoints:
+            continue
+        # the lines before the checkpoint are played as text first, so the job carries on from where they left off
+        line = checkpoints[len(checkpoints) // 2]
+        prefix = os.path.join(tmp, 'prefix.gcode')
+        with open(g) as f, open(prefix, 'w') as p:
+            p.writelines(f.readlines()[:line - 1])
+            # the modes the checkpoint always puts back are changed, so they are only right if it does
+            p.write("G20 G91 M83 G18 G55\n")
+        print("  started at line %d, checkpoint %d of %d, after the lines before it:" % (line, len(checkpoints) // 2 + 1, len(checkpoints)))
+        run(args.hostsim, args.config, job_out, ['-l', str(line), prefix, job])
+        if not compare(text, read_timeline(job_out), 0, 0, 0):
+            ok = False
+
+    shutil.rmtree(tmp)
+    print("PASS" if ok else "FAIL")
+    sys.exit(0 if ok else 1)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,333 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Runs a gcode file through the real motion core and reports the resulting step timeline
+//
+// usage: hostsim [-c config] [-o timeline.csv] [-q ticks_per_idle] [-s latency_us [-w]] file.gcode
+//        hostsim [-c config] [-o timeline.csv] [-q ticks_per_idle] [-l line] file.gcode|file.job ...
+//        hostsim [-c config] -b motors
+//
+// -b runs the step ticker benchmark instead of a file, it moves the given number of axis (XYZABC) back and forth
+// and reports the cost of a step tick while a block is being executed
+//
+// -s streams the file to SerialConsole over a simulated link with the given latency each way, waiting for the ok of
+// each line, or with -w using windowed streaming, and reports the lines per second the host managed to send
+//
+// A compiled job made by gcode2job is played as the Player plays it, a record per main loop, from the start or with -l
+// from the checkpoint at or before the given line. Several files are played one after the other
+
+#include "HostSim.h"
+#include "StepRecorder.h"
+#include "SerialLink.h"
+
+#include "libs/Kernel.h"
+#include "libs/SerialMessage.h"
+#include "libs/StreamOutput.h"
+#include "StepTicker.h"
+#include "StepperMotor.h"
+#include "Conveyor.h"
+#include "Robot.h"
+#include "Planner.h"
+#include "ExtruderMaker.h"
+#include "SerialConsole.h"
+#include "ReadAhead.h"
+#include "CompiledJob.h"
+#include "Profiler.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <chrono>
+#include <string>
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "usage: %s [-c config] [-o timeline.csv] [-q ticks_per_idle] [-s latency_us [-w]] file.gcode\n", prog);
+    fprintf(stderr, "       %s [-c config] [-o timeline.csv] [-q ticks_per_idle] [-l line] file.gcode|file.job ...\n", prog);
+    fprintf(stderr, "       %s [-c config] -b motors\n", prog);
+    exit(1);
+}
+
+static FILE *open_file(const char *fn)
+{
+    FILE *fp = fopen(fn, "r");
+    if(fp == nullptr) {
+        fprintf(stderr, "could not open %s\n", fn);
+        exit(1);
+    }
+    return fp;
+}
+
+// every heap allocation goes through here, so the ones made while a line is dispatched can be counted
+extern "C" void *__libc_malloc(size_t size);
+static uint32_t malloc_calls;
+extern "C" void *malloc(size_t size)
+{
+    ++malloc_calls;
+    return __libc_malloc(size);
+}
+
+// heap allocations made dispatching the lines, and the last line that needed any, after that the line buffer and
+// everything the dispatcher uses has been allocated and it runs without allocating
+static uint32_t dispatch_mallocs= 0, dispatched_lines= 0, last_malloc_line= 0;
+
+static void send_line(Kernel *kernel, const char *line)
+{
+    // reused for every line like the serial drivers do
+    static struct SerialMessage message = {&(StreamOutput::NullStream), ""};
+    uint32_t calls= malloc_calls;
+    message.message.assign(line);
+    kernel->call_event(ON_CONSOLE_LINE_RECEIVED, &message);
+    ++dispatched_lines;
+    if(malloc_calls != calls) {
+        dispatch_mallocs += malloc_calls - calls;
+        last_malloc_line= dispatched_lines;
+    }
+    kernel->call_event(ON_MAIN_LOOP);
+    kernel->call_event(ON_IDLE);
+}
+
+// how far ahead the planner can see, sampled after each line once the first block has started
+static uint32_t queue_samples= 0;
+static double queue_blocks_sum= 0, queue_mm_sum= 0;
+
+static void sample_queue()
+{
+    if(sim_ticks == 0) return;
+    unsigned int blocks;
+    float mm;
+    THECONVEYOR->get_queue_depth(blocks, mm);
+    queue_blocks_sum += blocks;
+    queue_mm_sum += mm;
+    ++queue_samples;
+}
+
+// plays a compiled job a record per main loop as the Player does, returns the number of records played
+static uint32_t play_job(Kernel *kernel, FILE *fp, const CompiledJobHeader &header, uint32_t start_line)
+{
+    static struct SerialMessage message = {&(StreamOutput::NullStream), ""};
+    ReadAhead reader;
+    std::string setup;
+    uint32_t line = start_line;
+    if(!CompiledJob::start(fp, header, reader, 4096, line, setup)) {
+        fprintf(stderr, "no memory to play the job\n");
+        exit(1);
+    }
+    if(!setup.empty()) {
+        printf("starting at line %u: %s\n", line, setup.c_str());
+        send_line(kernel, setup.c_str());
+    }
+
+    uint32_t records = 0;
+    for (;;) {
+        uint32_t calls= malloc_calls;
+        if(!CompiledJob::play_next(reader, message, nullptr)) break;
+        ++dispatched_lines;
+        if(malloc_calls != calls) {
+            dispatch_mallocs += malloc_calls - calls;
+            last_malloc_line= dispatched_lines;
+        }
+        kernel->call_event(ON_MAIN_LOOP);
+        kernel->call_event(ON_IDLE);
+        sample_queue();
+        ++records;
+        reader.fill();
+    }
+    return records;
+}
+
+// long moves on the first n axis, all active motors step on most ticks
+static uint32_t send_benchmark(Kernel *kernel, int n)
+{
+    static const char axis[] = "XYZABC";
+    char buf[128];
+    uint32_t lines = 0;
+    for (int i = 0; i < 20; ++i) {
+        int l = 0;
+        l += snprintf(&buf[l], sizeof(buf) - l, "G1");
+        for (int a = 0; a < n; ++a) {
+            l += snprintf(&buf[l], sizeof(buf) - l, " %c%d", axis[a], (i & 1) ? 0 : 200 - a);
+        }
+        if(i == 0) snprintf(&buf[l], sizeof(buf) - l, " F60000");
+        send_line(kernel, buf);
+        ++lines;
+    }
+    return lines;
+}
+
+int main(int argc, char *argv[])
+{
+    const char *timeline_file = nullptr;
+    int bench_motors = 0;
+    int stream_latency = -1;
+    bool windowed = false;
+    uint32_t start_line = 0;
+    int c;
+    while((c = getopt(argc, argv, "b:c:l:o:q:s:w")) != -1) {
+        switch(c) {
+            case 'b': bench_motors = atoi(optarg); break;
+            case 'c': sim_config_file = optarg; break;
+            case 'l': start_line = strtoul(optarg, nullptr, 10); break;
+            case 'o': timeline_file = optarg; break;
+            case 'q': sim_idle_quantum = strtoul(optarg, nullptr, 10); break;
+            case 's': stream_latency = atoi(optarg); break;
+            case 'w': windowed = true; break;
+            default: usage(argv[0]);
+        }
+    }
+    if(optind >= argc && bench_motors == 0) usage(argv[0]);
+
+    FILE *gfp = nullptr;
+    if(bench_motors == 0) gfp = open_file(argv[optind]);
+
+    Kernel *kernel = new Kernel();
+
+    // the extruders are made as main.cpp does, so E moves are stepped too
+    ExtruderMaker *em= new ExtruderMaker();
+    em->load_tools();
+    delete em;
+
+    if(bench_motors > THEROBOT->get_number_registered_motors()) {
+        fprintf(stderr, "only %d motors are configured\n", THEROBOT->get_number_registered_motors());
+        return 1;
+    }
+
+    // start the timers and interrupts, as main.cpp does
+    THEKERNEL->conveyor->start(THEROBOT->get_number_registered_motors());
+    THEKERNEL->step_ticker->start();
+#ifdef PROFILE_PROBES
+    Profiler::start();
+#endif
+
+    StepRecorder recorder;
+    // the recorder is left out of the benchmark as it adds to the cost of each step
+    if(bench_motors == 0) recorder.start(timeline_file != nullptr);
+
+    auto start = std::chrono::steady_clock::now();
+
+    // feed the lines in as fast as the main loop takes them, replies are discarded
+    char buf[256];
+    uint32_t lines = 0;
+    SerialLink *link = nullptr;
+    CompiledJobHeader job;
+    if(gfp != nullptr && stream_latency >= 0) {
+        // or send them over the serial link and run the main loop until the host has had every ok
+        static std::vector<std::string> file_lines;
+        while(fgets(buf, sizeof(buf), gfp) != nullptr) {
+            size_t n = strcspn(buf, "\r\n");
+            if(n > 0) file_lines.emplace_back(buf, n);
+        }
+        fclose(gfp);
+
+        SerialConsole *console = new SerialConsole(0);
+        kernel->add_module(console);
+        link = new SerialLink(console, (uint64_t)stream_latency * kernel->base_stepping_frequency / 1000000, windowed, file_lines);
+        while(!link->is_done()) {
+            kernel->call_event(ON_MAIN_LOOP);
+            kernel->call_event(ON_IDLE);
+            sample_queue();
+        }
+        lines = link->get_lines();
+
+    } else if(gfp != nullptr) {
+        // several files are played one after the other, like the lines before a job started part way through
+        for (int i = optind; gfp != nullptr;) {
+            if(CompiledJob::read_header(gfp, job)) {
+                lines += play_job(kernel, gfp, job, start_line);
+            } else {
+                while(fgets(buf, sizeof(buf), gfp) != nullptr) {
+                    size_t n = strcspn(buf, "\r\n");
+                    buf[n] = '\0';
+                    if(n == 0) continue;
+                    send_line(kernel, buf);
+                    sample_queue();
+                    ++lines;
+                }
+            }
+            fclose(gfp);
+            gfp = ++i < argc ? open_file(argv[i]) : nullptr;
+        }
+
+    } else {
+        lines = send_benchmark(kernel, bench_motors);
+    }
+
+    // let everything finish
+    THECONVEYOR->wait_for_idle();
+
+    double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    double planner_wall = wall - sim_idle_seconds;
+    double sim_secs = (double)sim_ticks / kernel->base_stepping_frequency;
+
+    printf("lines: %u\n", lines);
+    if(dispatched_lines > 0) {
+        printf("dispatch: %1.2f heap allocations per line, none after line %u\n", (double)dispatch_mallocs / dispatched_lines, last_malloc_line);
+    }
+    if(link != nullptr) {
+        double stream_secs = (double)link->get_stream_ticks() / kernel->base_stepping_frequency;
+        printf("stream: %s, %d us latency, %u lines in %1.4f s, %1.0f lines/s, %u window reports, %u errors\n",
+               windowed ? (link->get_window() > 0 ? "windowed" : "windowed not supported") : "ok per line", stream_latency,
+               lines, stream_secs, stream_secs > 0 ? lines / stream_secs : 0, link->get_reports(), link->get_errors());
+    }
+    printf("blocks: %u\n", sim_blocks_executed);
+    printf("simulated time: %1.4f s (%llu ticks at %lu Hz)\n", sim_secs, (unsigned long long)sim_ticks, (unsigned long)kernel->base_stepping_frequency);
+    printf("motion: first step at tick %llu, last step at tick %llu\n", (unsigned long long)recorder.get_first_tick(), (unsigned long long)recorder.get_last_tick());
+    printf("wall time: %1.4f s, idle %1.4f s (step ticker %1.4f s), planner side %1.4f s\n", wall, sim_idle_seconds, sim_isr_seconds, planner_wall);
+    if(planner_wall > 0) printf("planner blocks/s: %1.0f\n", sim_blocks_executed / planner_wall);
+    const Planner::stats_t &ps = THEKERNEL->planner->get_stats();
+    if(ps.appended > 0) {
+        printf("planner: %u blocks appended, %u segments merged, %1.2f reverse passes and %1.2f forward passes per block\n", ps.appended,
+               ps.merged, (double)ps.reverse_passes / ps.appended, (double)ps.forward_passes / ps.appended);
+    }
+    if(queue_samples > 0) {
+        printf("queue: %1.1f blocks, %1.2f mm ahead on average\n", queue_blocks_sum / queue_samples, queue_mm_sum / queue_samples);
+    }
+    // as the queue command shows it
+    const Conveyor::stats_t &cs = THECONVEYOR->get_stats();
+    const StepTicker::stats_t &ss = THEKERNEL->step_ticker->get_stats();
+    if(cs.queued_us > 0) {
+        printf("underruns: %u, %1.3f s waiting, %u forced decels, %1.1f blocks %1.2f mm queued on average, %u ms max fetch delay\n", ss.underruns,
+               (double)ss.underrun_ticks / kernel->base_stepping_frequency, cs.forced_decels, (double)cs.blocks_us / cs.queued_us,
+               (double)cs.um_us / cs.queued_us / 1000, cs.max_fetch_delay_us / 1000);
+    }
+
+    size_t queue_bytes = sizeof(Block) * THECONVEYOR->get_queue_size(), buffer_bytes = Block::step_buffer_size() * THECONVEYOR->get_step_buffers();
+    printf("queue memory: %u blocks of %u bytes, %u step buffers of %u bytes, %u bytes\n", (unsigned)THECONVEYOR->get_queue_size(), (unsigned)sizeof(Block),
+           (unsigned)THECONVEYOR->get_step_buffers(), (unsigned)Block::step_buffer_size(), (unsigned)(queue_bytes + buffer_bytes));
+    if(sim_secs > 0) {
+        printf("main loop: %1.2f ms per second of motion\n", (wall - sim_isr_seconds) * 1000 / sim_secs);
+    }
+    if(sim_active_ticks > 0) {
+        printf("step tick: %1.1f host cycles/tick, %1.1f ns/tick over %llu active ticks\n", (double)sim_isr_cycles / sim_active_ticks,
+               sim_isr_seconds * 1e9 / sim_active_ticks, (unsigned long long)sim_active_ticks);
+    }
+    for (uint8_t m = 0; m < recorder.get_num_motors(); ++m) {
+        printf("motor %u: steps %u, position %d, expected %d\n", m, recorder.get_steps(m), recorder.get_position(m), THEROBOT->actuators[m]->get_current_step());
+    }
+#ifdef PROFILE_PROBES
+    // as prof -v shows it, in host cycles
+    class : public StreamOutput {
+        public:
+            int puts(const char *str) { return fputs(str, stdout); }
+    } out;
+    Profiler::report(&out, true);
+#endif
+
+    if(timeline_file != nullptr) {
+        FILE *ofp = fopen(timeline_file, "w");
+        if(ofp == nullptr) {
+            fprintf(stderr, "could not write %s\n", timeline_file);
+            return 1;
+        }
+        recorder.write_csv(ofp);
+        fclose(ofp);
+        printf("timeline: %lu edges written to %s\n", (unsigned long)recorder.get_edges().size(), timeline_file);
+    }
+
+    return 0;
+}
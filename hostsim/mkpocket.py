@@ -0,0 +1,41 @@
+#!/usr/bin/env python
+"""Writes a CAM style job made of short segments, as make planbench and the other targets use it.
+
+A spiral pocket of 0.05mm segments around X50 Y50 with a 1mm step over, then a zig zag finishing pass over a 20mm by
+5mm area in 0.2mm segments that wiggle 0.1mm either side of each row, about 4000 moves in all at F3000.
+
+usage: mkpocket.py > pocket.gcode
+"""
+
+from __future__ import print_function
+import math
+
+
+def main():
+    print("; CAM style job made of 0.05mm segments, a spiral pocket followed by a zig zag finishing pass")
+    print("G21\nG90\nG1 Z1 F300\nG1 X60 Y50 F6000\nG1 Z0 F300\nG1 F3000")
+
+    # r = r0 + k a, each segment 0.05mm long along the spiral
+    r0, k, seg = 0.5, 1 / (2 * math.pi), 0.05
+    a = 0.0
+    while True:
+        r = r0 + k * a
+        a += seg / math.hypot(r, k)
+        r = r0 + k * a
+        if r > 7:
+            break
+        print("G1 X%.3f Y%.3f" % (50 + r * math.cos(a), 50 + r * math.sin(a)))
+
+    for row in range(10):
+        y = 40 + row * 0.5
+        xs = [40 + i * 0.2 for i in range(101)]
+        if row % 2:
+            xs.reverse()
+        for x in xs:
+            print("G1 X%.3f Y%.3f" % (x, y + 0.1 * math.sin(2 * math.pi * (x - 40) / 2.5)))
+    print("G1 X40.000 Y45.000")
+    print("G1 Z1 F300")
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,189 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Compares PublicData requests sent to every module that registered for ON_GET_PUBLIC_DATA and ON_SET_PUBLIC_DATA,
+// as all modules did, with requests sent only to the modules that registered for their first checksum.
+//
+// The modules are those of a typical board: three temperature controls, four switches, an extruder, endstops, the
+// tool manager, the player, the laser, the panel and the network. Each answers the requests for its checksums as the
+// real module does, and the requests are those the panel, M105 and a host polling for ? make. First it checks every
+// request gets the same answer both ways, and that a module that still registers for the events gets the requests no
+// handler takes, then it reports requests per second each way.
+//
+// usage: pdbench [-c config] [-n requests]
+
+#include "HostSim.h"
+
+#include "libs/Kernel.h"
+#include "libs/Module.h"
+#include "PublicData.h"
+#include "PublicDataRequest.h"
+#include "checksumm.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <chrono>
+#include <vector>
+
+// answers get and set requests that start with csa and are for csb, or for any csb if it is 0
+class Handler : public Module {
+    public:
+        Handler(uint16_t csa, uint16_t csb, int value) : csa(csa), csb(csb), value(value) {}
+
+        void on_get_public_data(void *argument)
+        {
+            PublicDataRequest *pdr = static_cast<PublicDataRequest *>(argument);
+            if(!pdr->starts_with(csa)) return;
+            if(csb != 0 && !pdr->second_element_is(csb)) return;
+            *static_cast<int *>(pdr->get_data_ptr()) = value;
+            pdr->set_taken();
+        }
+
+        void on_set_public_data(void *argument)
+        {
+            PublicDataRequest *pdr = static_cast<PublicDataRequest *>(argument);
+            if(!pdr->starts_with(csa)) return;
+            if(csb != 0 && !pdr->second_element_is(csb)) return;
+            value = *static_cast<int *>(pdr->get_data_ptr());
+            pdr->set_taken();
+        }
+
+        uint16_t csa, csb;
+        int value;
+};
+
+struct request_t {
+    uint16_t csa, csb;
+};
+
+static std::vector<Handler *> make_handlers()
+{
+    std::vector<Handler *> v;
+    v.push_back(new Handler(CHECKSUM("temperature_control"), CHECKSUM("hotend"), 1));
+    v.push_back(new Handler(CHECKSUM("temperature_control"), CHECKSUM("hotend2"), 2));
+    v.push_back(new Handler(CHECKSUM("temperature_control"), CHECKSUM("bed"), 3));
+    v.push_back(new Handler(CHECKSUM("switch"), CHECKSUM("fan"), 4));
+    v.push_back(new Handler(CHECKSUM("switch"), CHECKSUM("fan2"), 5));
+    v.push_back(new Handler(CHECKSUM("switch"), CHECKSUM("psu"), 6));
+    v.push_back(new Handler(CHECKSUM("switch"), CHECKSUM("led"), 7));
+    v.push_back(new Handler(CHECKSUM("extruder"), 0, 8));
+    v.push_back(new Handler(CHECKSUM("endstops"), 0, 9));
+    v.push_back(new Handler(CHECKSUM("tool_manager"), 0, 10));
+    v.push_back(new Handler(CHECKSUM("player"), 0, 11));
+    v.push_back(new Handler(CHECKSUM("laser"), 0, 12));
+    v.push_back(new Handler(CHECKSUM("panel"), 0, 13));
+    v.push_back(new Handler(CHECKSUM("network"), 0, 14));
+    return v;
+}
+
+// what is asked for most, the temperatures for M105 and the panel, the fan, homing state and progress for ?
+static const request_t requests[] = {
+    {CHECKSUM("temperature_control"), CHECKSUM("hotend")},
+    {CHECKSUM("temperature_control"), CHECKSUM("bed")},
+    {CHECKSUM("switch"), CHECKSUM("fan")},
+    {CHECKSUM("endstops"), CHECKSUM("get_homing_status")},
+    {CHECKSUM("player"), CHECKSUM("is_playing")},
+    {CHECKSUM("laser"), 0},
+    {CHECKSUM("tool_manager"), CHECKSUM("get_active_tool")},
+    {CHECKSUM("switch"), CHECKSUM("psu")},
+};
+#define n_requests (sizeof(requests) / sizeof(requests[0]))
+
+static bool answers(const std::vector<Handler *> &handlers, std::vector<int> &got)
+{
+    bool ok = true;
+    got.clear();
+    for (auto &r : requests) {
+        int v = 0;
+        bool taken = PublicData::get_value(r.csa, r.csb, &v);
+        got.push_back(taken ? v : -1);
+    }
+    int v = 0;
+    if(PublicData::get_value(CHECKSUM("nothing"), 0, &v)) {
+        printf("a request no module answers was taken\n");
+        ok = false;
+    }
+    v = 42;
+    if(!PublicData::set_value(CHECKSUM("switch"), CHECKSUM("led"), &v) || handlers[6]->value != 42) {
+        printf("a set request did not get to its module\n");
+        ok = false;
+    }
+    handlers[6]->value = 7;
+    return ok;
+}
+
+static double rate(int n)
+{
+    int v;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < n; ++i) {
+        const request_t &r = requests[i % n_requests];
+        PublicData::get_value(r.csa, r.csb, &v);
+    }
+    return n / std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char *argv[])
+{
+    int n = 2000000;
+    int c;
+    while((c = getopt(argc, argv, "c:n:")) != -1) {
+        if(c == 'c') sim_config_file = optarg;
+        else if(c == 'n') n = atoi(optarg);
+        else {
+            fprintf(stderr, "usage: %s [-c config] [-n requests]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    new Kernel();
+    bool ok = true;
+
+    // every module gets every request
+    std::vector<Handler *> broadcast = make_handlers();
+    for (auto h : broadcast) {
+        h->register_for_event(ON_GET_PUBLIC_DATA);
+        h->register_for_event(ON_SET_PUBLIC_DATA);
+    }
+    std::vector<int> expected;
+    if(!answers(broadcast, expected)) ok = false;
+    double broadcast_rate = rate(n);
+    for (auto h : broadcast) {
+        THEKERNEL->unregister_for_event(ON_GET_PUBLIC_DATA, h);
+        THEKERNEL->unregister_for_event(ON_SET_PUBLIC_DATA, h);
+    }
+
+    // each module only gets the requests for its checksum, but the network module still registers for the events
+    std::vector<Handler *> indexed = make_handlers();
+    for (auto h : indexed) {
+        if(h->csa == CHECKSUM("network")) {
+            h->register_for_event(ON_GET_PUBLIC_DATA);
+            h->register_for_event(ON_SET_PUBLIC_DATA);
+        } else {
+            h->register_for_public_data(ON_GET_PUBLIC_DATA, h->csa);
+            h->register_for_public_data(ON_SET_PUBLIC_DATA, h->csa);
+        }
+    }
+    std::vector<int> got;
+    if(!answers(indexed, got)) ok = false;
+    if(got != expected) {
+        printf("the answers differ from those of the broadcast\n");
+        ok = false;
+    }
+    int v = 0;
+    if(!PublicData::get_value(CHECKSUM("network"), 0, &v) || v != 14) {
+        printf("a module registered for the event did not get its request\n");
+        ok = false;
+    }
+    double indexed_rate = rate(n);
+
+    printf("%u modules: broadcast %1.0f requests/s, indexed %1.0f requests/s, %1.1f times faster\n", (unsigned)broadcast.size(),
+           broadcast_rate, indexed_rate, indexed_rate / broadcast_rate);
+    printf(ok ? "PASS\n" : "FAIL\n");
+    return ok ? 0 : 1;
+}
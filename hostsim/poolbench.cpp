@@ -0,0 +1,270 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Replays traces of allocations and frees on a 16KB MemoryPool, as AHB0 is on the LPC1769, first fit only and with
+// slabs. Each allocation is filled with a pattern that is checked when it is freed, and once everything is freed the
+// whole pool must be free in one piece again. Then it reports the allocations and frees per second, the allocations
+// that failed and the worst fragmentation, the part of the free space not in the largest free region, each way.
+//
+// The board's trace has the block ring, serial consoles and their buffers allocated at boot, then network buffers of
+// a few sizes that come and go, a USB mass storage page, the Player's read ahead buffer and a probe grid now and then.
+// The random trace has sizes up to 256 bytes, mostly small, freed in random order with the pool nearly full. Traces
+// can also be given in files, a line "a <id> <bytes>" allocates and "f <id>" frees.
+//
+// usage: poolbench [-n repeats] [trace ...]
+
+#include "MemoryPool.h"
+#include "StreamOutput.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+extern "C" void __debugbreak(void)
+{
+    fprintf(stderr, "__debugbreak()\n");
+    abort();
+}
+
+class StdoutStream : public StreamOutput {
+    public:
+        int puts(const char *str) { return fputs(str, stdout); }
+};
+
+struct op_t {
+    bool alloc;
+    uint32_t id;
+    uint16_t size;
+};
+
+struct trace_t {
+    std::string name;
+    std::vector<op_t> ops;
+    uint32_t ids;
+};
+
+static uint32_t seed = 12345;
+static uint32_t rnd(uint32_t n)
+{
+    seed = seed * 1103515245U + 12345U;
+    return (seed >> 8) % n;
+}
+
+static uint32_t alloc_op(trace_t &t, uint16_t size)
+{
+    t.ops.push_back({true, t.ids, size});
+    return t.ids++;
+}
+
+static void free_op(trace_t &t, uint32_t id)
+{
+    t.ops.push_back({false, id, 0});
+}
+
+static trace_t board_trace()
+{
+    trace_t t = {"board", {}, 0};
+    // boot: the block ring, two serial consoles with their rx and tx buffers
+    alloc_op(t, 4480);
+    for (int i = 0; i < 2; ++i) {
+        alloc_op(t, 280);
+        alloc_op(t, 128);
+        alloc_op(t, 256);
+    }
+    static const uint16_t net[] = {20, 36, 52, 60, 100, 124, 124};
+    std::vector<uint32_t> live;
+    int32_t readahead = alloc_op(t, 1152), page = -1, grid = -1;
+    for (int i = 0; i < 20000; ++i) {
+        if(live.size() < 48 && (live.empty() || rnd(2) == 0)) {
+            live.push_back(alloc_op(t, net[rnd(sizeof(net) / sizeof(net[0]))]));
+        } else {
+            // mostly in order, as packets are sent and acknowledged
+            size_t j = rnd(4) == 0 ? rnd(live.size()) : 0;
+            free_op(t, live[j]);
+            live.erase(live.begin() + j);
+        }
+        if(i % 1000 == 500) page = alloc_op(t, 512);
+        if(i % 1000 == 900 && page >= 0) free_op(t, page);
+        if(i % 5000 == 4999) {
+            // a file is played again
+            free_op(t, readahead);
+            readahead = alloc_op(t, 1152);
+        }
+        if(i % 7000 == 3000) grid = alloc_op(t, 196);
+        if(i % 7000 == 6000 && grid >= 0) free_op(t, grid);
+    }
+    return t;
+}
+
+static trace_t random_trace()
+{
+    trace_t t = {"random", {}, 0};
+    std::vector<std::pair<uint32_t, uint16_t>> live;
+    uint32_t live_bytes = 0;
+    for (int i = 0; i < 40000; ++i) {
+        uint16_t size = rnd(5) == 0 ? 125 + rnd(132) : 1 + rnd(124);
+        if(live_bytes + size < 12 * 1024 && rnd(2) == 0) {
+            live.push_back({alloc_op(t, size), size});
+            live_bytes += size;
+        } else if(!live.empty()) {
+            size_t j = rnd(live.size());
+            free_op(t, live[j].first);
+            live_bytes -= live[j].second;
+            live.erase(live.begin() + j);
+        }
+    }
+    return t;
+}
+
+static bool read_trace(const char *fn, trace_t &t)
+{
+    FILE *fp = fopen(fn, "r");
+    if(fp == NULL) return false;
+    t.name = fn;
+    t.ids = 0;
+    char c;
+    unsigned long id, size;
+    int n;
+    while((n = fscanf(fp, " %c %lu", &c, &id)) == 2) {
+        if(c == 'a' && fscanf(fp, " %lu", &size) == 1) t.ops.push_back({true, (uint32_t)id, (uint16_t)size});
+        else if(c == 'f') t.ops.push_back({false, (uint32_t)id, 0});
+        else break;
+        if(id >= t.ids) t.ids = id + 1;
+    }
+    bool ok = feof(fp);
+    fclose(fp);
+    return ok;
+}
+
+struct result_t {
+    double ops_per_s;
+    uint32_t failed;
+    uint32_t worst_fragmentation;
+    bool ok;
+};
+
+static uint8_t pattern(uint32_t id, size_t i)
+{
+    return (uint8_t)(id * 31 + i);
+}
+
+// replays the trace checking every allocation, finding the worst fragmentation after each operation
+static result_t check(MemoryPool &pool, const trace_t &t, bool slabs, StreamOutput *out)
+{
+    result_t r = {0, 0, 0, true};
+    uint32_t whole = pool.free();
+    pool.set_slabs(slabs);
+    std::vector<uint8_t *> p(t.ids, nullptr);
+    std::vector<uint16_t> sizes(t.ids, 0);
+    for (auto &o : t.ops) {
+        if(o.alloc) {
+            p[o.id] = (uint8_t *)pool.alloc(o.size);
+            sizes[o.id] = o.size;
+            if(p[o.id] == nullptr) ++r.failed;
+            else for (size_t i = 0; i < o.size; ++i) p[o.id][i] = pattern(o.id, i);
+        } else if(p[o.id] != nullptr) {
+            for (size_t i = 0; i < sizes[o.id]; ++i) {
+                if(p[o.id][i] != pattern(o.id, i)) r.ok = false;
+            }
+            pool.dealloc(p[o.id]);
+            p[o.id] = nullptr;
+        }
+        uint32_t f = pool.free();
+        uint32_t frag = f ? 100 - (pool.largest_free() * 100) / f : 0;
+        if(frag > r.worst_fragmentation) r.worst_fragmentation = frag;
+    }
+    // as mem shows them at the end of the trace
+    if(slabs) pool.stats(out, t.name.c_str());
+    for (uint32_t id = 0; id < t.ids; ++id) {
+        if(p[id] != nullptr) pool.dealloc(p[id]);
+    }
+
+    // the empty pages kept for each slab class are given back when the pool is needed in one piece
+    void *all = pool.alloc(whole - 4);
+    if(all == nullptr) r.ok = false;
+    else pool.dealloc(all);
+    if(pool.free() != whole) r.ok = false;
+    pool.set_slabs(false);
+    return r;
+}
+
+static double rate(MemoryPool &pool, const trace_t &t, bool slabs, int repeats)
+{
+    uint32_t whole = pool.free();
+    pool.set_slabs(slabs);
+    std::vector<void *> p(t.ids, nullptr);
+    auto start = std::chrono::steady_clock::now();
+    for (int n = 0; n < repeats; ++n) {
+        for (auto &o : t.ops) {
+            if(o.alloc) p[o.id] = pool.alloc(o.size);
+            else if(p[o.id] != nullptr) {
+                pool.dealloc(p[o.id]);
+                p[o.id] = nullptr;
+            }
+        }
+        for (auto &q : p) {
+            if(q != nullptr) pool.dealloc(q);
+            q = nullptr;
+        }
+    }
+    double s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    // gives back the empty pages kept for the slab classes
+    void *all = pool.alloc(whole - 4);
+    if(all != nullptr) pool.dealloc(all);
+    pool.set_slabs(false);
+    return (double)t.ops.size() * repeats / s;
+}
+
+int main(int argc, char *argv[])
+{
+    int repeats = 20;
+    int c;
+    while((c = getopt(argc, argv, "n:")) != -1) {
+        if(c == 'n') repeats = atoi(optarg);
+        else {
+            fprintf(stderr, "usage: %s [-n repeats] [trace ...]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    std::vector<trace_t> traces = {board_trace(), random_trace()};
+    for (int i = optind; i < argc; ++i) {
+        trace_t t;
+        if(!read_trace(argv[i], t)) {
+            fprintf(stderr, "could not read trace %s\n", argv[i]);
+            return 1;
+        }
+        traces.push_back(t);
+    }
+
+    static uint8_t ram[16 * 1024] __attribute__ ((aligned (8)));
+    StdoutStream out;
+
+    bool ok = true;
+    for (auto &t : traces) {
+        // a new pool for each trace so its stats are of that trace only
+        MemoryPool pool(ram, sizeof(ram));
+        result_t r[2];
+        for (int s = 0; s < 2; ++s) {
+            r[s] = check(pool, t, s == 1, &out);
+            if(!r[s].ok) printf("FAILED: %s trace %s, an allocation was overwritten or the pool was not all free after\n", t.name.c_str(), s ? "with slabs" : "first fit");
+            ok &= r[s].ok;
+            r[s].ops_per_s = rate(pool, t, s == 1, repeats);
+        }
+        printf("%s: %u operations, first fit %1.2f M/s, %u failed, worst fragmentation %u%%\n", t.name.c_str(), (unsigned)t.ops.size(),
+               r[0].ops_per_s / 1e6, r[0].failed, r[0].worst_fragmentation);
+        printf("%s: %u operations, slabs     %1.2f M/s, %u failed, worst fragmentation %u%%, %1.1f times faster\n", t.name.c_str(), (unsigned)t.ops.size(),
+               r[1].ops_per_s / 1e6, r[1].failed, r[1].worst_fragmentation, r[1].ops_per_s / r[0].ops_per_s);
+    }
+
+    printf(ok ? "PASS\n" : "FAIL\n");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,102 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Checks the Profiler on a cycle counter that only moves when it is told to: that each probe keeps the calls, min, max
+// and mean of what it recorded, that each call goes in the histogram bucket of its power of two, that a probe inside
+// another counts towards both, that step ticks taken inside a probe and the time waiting for room in the queue are not
+// counted by it, that it works across the counter wrapping, and that reset starts again. Then it prints the report as
+// the prof command does.
+//
+// usage: probecheck (built with PROFILE_PROBES=1, see make probes)
+
+#include "Profiler.h"
+#include "StreamOutput.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+// the DWT cycle counter of the host HAL reads this
+static uint32_t now = 0;
+uint32_t sim_cycles(void) { return now; }
+DWT_Type sim_dwt;
+CoreDebug_Type sim_core_debug;
+
+class StdoutStream : public StreamOutput {
+    public:
+        int puts(const char *str) { return fputs(str, stdout); }
+};
+
+static bool check(bool ok, const char *what)
+{
+    if(!ok) printf("FAILED: %s\n", what);
+    return ok;
+}
+
+static void step_tick(uint32_t c)
+{
+    PROFILE_SCOPE(STEP_TICK);
+    now += c;
+}
+
+static void recalculate(uint32_t c)
+{
+    PROFILE_SCOPE(RECALCULATE);
+    now += c;
+}
+
+int main()
+{
+    bool ok = true;
+    Profiler::start();
+
+    // calls, min, max, mean and buckets
+    static const uint32_t cycles[] = {0, 1, 2, 3, 1000, 1023, 1024, 0x80000000U};
+    for (auto c : cycles) Profiler::record(Profiler::CHECK_QUEUE, c);
+    const Profiler::probe_t &q = Profiler::get(Profiler::CHECK_QUEUE);
+    uint64_t total = 0;
+    for (auto c : cycles) total += c;
+    ok &= check(q.calls == 8 && q.min == 0 && q.max == 0x80000000U && q.total == total, "the calls, min, max or total are wrong");
+    ok &= check(q.histogram[0] == 1 && q.histogram[1] == 1 && q.histogram[2] == 2 && q.histogram[10] == 2 && q.histogram[11] == 1 &&
+                q.histogram[Profiler::n_buckets - 1] == 1, "a call is in the wrong bucket");
+
+    // a probe inside another counts towards both, a step tick inside either towards neither
+    {
+        PROFILE_SCOPE(APPEND_BLOCK);
+        now += 100;
+        recalculate(50);
+        step_tick(30);
+        {
+            // waiting for room in the queue, with a step tick while it waits
+            PROFILE_WAIT();
+            now += 5000;
+            step_tick(30);
+        }
+        now += 10;
+    }
+    const Profiler::probe_t &a = Profiler::get(Profiler::APPEND_BLOCK);
+    const Profiler::probe_t &r = Profiler::get(Profiler::RECALCULATE);
+    const Profiler::probe_t &s = Profiler::get(Profiler::STEP_TICK);
+    ok &= check(r.calls == 1 && r.total == 50, "a probe inside another did not count its own cycles");
+    ok &= check(a.calls == 1 && a.total == 160, "a probe did not count the probe inside it, or counted the step ticks or the wait");
+    ok &= check(s.calls == 2 && s.min == 30 && s.max == 30, "the step ticks did not count their own cycles");
+
+    // across the counter wrapping
+    now = 0xFFFFFF00U;
+    recalculate(0x200);
+    ok &= check(r.calls == 2 && r.max == 0x200, "a probe was wrong across the counter wrapping");
+
+    StdoutStream out;
+    Profiler::report(&out, true);
+
+    Profiler::reset();
+    ok &= check(a.calls == 0 && r.calls == 0 && s.calls == 0 && q.calls == 0 && q.histogram[0] == 0, "reset left calls behind");
+    recalculate(7);
+    ok &= check(r.calls == 1 && r.min == 7 && r.max == 7, "the min or max was not started again by reset");
+
+    printf(ok ? "PASS\n" : "FAIL\n");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,206 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Checks the lines ReadAhead splits a file into are the lines the Player plays, for the given files and for files of
+// random lines that end in \n or \r\n, are empty or too long and cross the halves of the buffer, with several buffer
+// sizes and with fill() called between the lines as on_idle would. Then reports the lines per second and the reads
+// per thousand lines of the files given, with fgets as the Player used to read them and with ReadAhead.
+//
+// usage: readbench [-n repeats] [-r random files] file.gcode ...
+
+#include "ReadAhead.h"
+#include "MemoryPool.h"
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+// the buffer comes from AHB0, which is 16KB on the LPC1769
+static uint8_t ahb0[16384];
+static MemoryPool ahb0_pool(ahb0, sizeof(ahb0));
+MemoryPool *_AHB0= &ahb0_pool;
+
+// the read times are real time here, not simulated time
+extern "C" uint32_t us_ticker_read(void)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+extern "C" void __debugbreak(void)
+{
+    fprintf(stderr, "__debugbreak()\n");
+    abort();
+}
+
+// the lines a file has, each ends at a \n or the end of the file, less a \r before the \n, not counting empty lines
+// and lines longer than ReadAhead::max_line
+static std::vector<std::string> expected_lines(const std::string &file)
+{
+    std::vector<std::string> lines;
+    size_t p= 0;
+    while(p < file.size()) {
+        size_t e= file.find('\n', p);
+        if(e == std::string::npos) e= file.size();
+        size_t n= e - p;
+        if(n > 0 && file[p + n - 1] == '\r') --n;
+        if(n > 0 && n <= ReadAhead::max_line) lines.push_back(file.substr(p, n));
+        p= e + 1;
+    }
+    return lines;
+}
+
+static uint32_t read_calls;
+
+// reads the file with ReadAhead, calling fill() every fill_every lines if it is not 0, and returns the number of lines
+static size_t read_ahead_lines(const char *fn, size_t size, int fill_every, std::vector<std::string> *lines= nullptr)
+{
+    size_t n= 0;
+    FILE *fp= fopen(fn, "r");
+    // the Player finds the size of the file first, which may leave newlib with some of it buffered
+    fseek(fp, 0, SEEK_END);
+    fseek(fp, 0, SEEK_SET);
+
+    ReadAhead reader;
+    if(!reader.start(fp, size)) {
+        printf("no memory for a %u byte read ahead\n", (unsigned)size);
+        fclose(fp);
+        return 0;
+    }
+    size_t len;
+    const char *line;
+    while((line= reader.next_line(len)) != nullptr) {
+        if(lines != nullptr) lines->push_back(std::string(line, len));
+        if(fill_every > 0 && ++n % fill_every == 0) reader.fill();
+    }
+    read_calls += reader.stats.fills + reader.stats.stalls;
+    reader.stop();
+    fclose(fp);
+    return reader.stats.lines;
+}
+
+static bool check(const char *fn, const std::string &contents)
+{
+    std::vector<std::string> expected= expected_lines(contents);
+    bool ok= true;
+    for (size_t size : {1024, 4096, 8192}) {
+        for (int fill_every : {0, 1, 3}) {
+            std::vector<std::string> lines;
+            read_ahead_lines(fn, size, fill_every, &lines);
+            if(lines != expected) {
+                size_t i= 0;
+                while(i < lines.size() && i < expected.size() && lines[i] == expected[i]) ++i;
+                printf("%s: %u byte read ahead filling every %d lines differs at line %u of %u\n", fn, (unsigned)size, fill_every, (unsigned)i,
+                       (unsigned)expected.size());
+                ok= false;
+            }
+        }
+    }
+    return ok;
+}
+
+static std::string read_file(const char *fn)
+{
+    std::string s;
+    FILE *fp= fopen(fn, "rb");
+    if(fp == nullptr) return s;
+    char buf[4096];
+    size_t n;
+    while((n= fread(buf, 1, sizeof(buf), fp)) > 0) s.append(buf, n);
+    fclose(fp);
+    return s;
+}
+
+// newlib on the LPC1769 gives a file a 1024 byte buffer and refills it with one read at a time
+static ssize_t cookie_read(void *cookie, char *buf, size_t n)
+{
+    ++read_calls;
+    return read(*(int *)cookie, buf, n);
+}
+
+// how the Player read the file before, one fgets per line, returns the number of lines it would play
+static size_t fgets_lines(const char *fn)
+{
+    int fd= open(fn, O_RDONLY);
+    cookie_io_functions_t io= {cookie_read, nullptr, nullptr, nullptr};
+    FILE *fp= fopencookie(&fd, "r", io);
+    static char stdio_buf[1024];
+    setvbuf(fp, stdio_buf, _IOFBF, sizeof(stdio_buf));
+    char buf[130];
+    size_t n= 0;
+    while(fgets(buf, sizeof(buf), fp) != NULL) {
+        if(strspn(buf, "\r\n") != strlen(buf)) ++n;
+    }
+    fclose(fp);
+    close(fd);
+    return n;
+}
+
+int main(int argc, char *argv[])
+{
+    int repeats= 20;
+    int random_files= 20;
+    int c;
+    while((c = getopt(argc, argv, "n:r:")) != -1) {
+        if(c == 'n') repeats= atoi(optarg);
+        else if(c == 'r') random_files= atoi(optarg);
+        else {
+            fprintf(stderr, "usage: %s [-n repeats] [-r random files] file.gcode ...\n", argv[0]);
+            return 1;
+        }
+    }
+
+    bool ok= true;
+    for (int i = optind; i < argc; ++i) {
+        if(!check(argv[i], read_file(argv[i]))) ok= false;
+    }
+
+    char tmp[]= "/tmp/readbenchXXXXXX";
+    int fd= mkstemp(tmp);
+    close(fd);
+    srand(1);
+    for (int i = 0; i < random_files; ++i) {
+        std::string s;
+        for (int n = rand() % 600; n > 0; --n) {
+            int len= rand() % 8 == 0 ? rand() % 300 : rand() % 60;
+            for (int j = 0; j < len; ++j) s += "G1 X0.5Y-2;(\r"[rand() % 13];
+            s += rand() % 4 == 0 ? "\r\n" : "\n";
+        }
+        if(rand() % 2 == 0 && !s.empty()) s.erase(s.size() - 1);
+        FILE *fp= fopen(tmp, "wb");
+        fwrite(s.data(), 1, s.size(), fp);
+        fclose(fp);
+        if(!check(tmp, s)) ok= false;
+    }
+    unlink(tmp);
+    printf("%d files and %d random files checked\n", argc - optind, random_files);
+
+    for (int i = optind; i < argc; ++i) {
+        size_t lines= 0, ahead_lines= 0;
+        uint32_t calls= read_calls;
+        auto start= std::chrono::steady_clock::now();
+        for (int r = 0; r < repeats; ++r) lines += fgets_lines(argv[i]);
+        double fgets_secs= std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        uint32_t fgets_reads= read_calls - calls;
+
+        calls= read_calls;
+        start= std::chrono::steady_clock::now();
+        for (int r = 0; r < repeats; ++r) ahead_lines += read_ahead_lines(argv[i], 4096, 1);
+        double ahead_secs= std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        uint32_t ahead_reads= read_calls - calls;
+
+        printf("%s: fgets %10.0f lines/s %5.1f reads per 1000 lines, read ahead %10.0f lines/s %5.1f reads per 1000 lines\n", argv[i],
+               lines / fgets_secs, fgets_reads * 1000.0 / lines, ahead_lines / ahead_secs, ahead_reads * 1000.0 / ahead_lines);
+    }
+
+    printf(ok ? "PASS\n" : "FAIL\n");
+    return ok ? 0 : 1;
+}
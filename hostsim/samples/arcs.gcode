@@ -0,0 +1,26 @@
+; arcs of different sizes and directions, full circles and a helix, see arccheck.py
+G21
+G90
+G17
+G0 X20 Y20 F6000
+G1 X40 Y20 F3000
+G2 X60 Y40 I0 J20
+G3 X80 Y60 I20 J0
+G1 X80 Y80
+G2 X80 Y80 I10 J0
+G3 X80 Y80 I-40 J0
+G1 X100 Y80 F6000
+G2 X110 Y90 I10 J0
+G2 X120 Y80 I0 J-10
+G2 X110 Y70 I-10 J0
+G2 X100 Y80 I0 J10
+G3 X101 Y81 I1 J0 F1200
+G3 X100 Y82 I0 J1
+G1 X100 Y100 F3000
+G2 X100 Y100 Z5 I30 J0 F1500
+G2 X160 Y100 Z2 I30 J0 F3000
+G3 X100 Y100 I-30 J0 F9000
+G1 X100 Y120
+G3 X150 Y170 I50 J0 F3000
+G2 X100 Y120 I-50 J0
+G1 X20 Y20 Z0 F6000
@@ -0,0 +1,3316 @@
+; a few layers of a delta print, perimeters of 1mm segments, infill and travels, see make deltabench
+G21
+G90
+G1 Z0.20 F6000
+G0 X40.000 Y0 F9000
+G1 F2400
+G1 X39.987 Y1.001
+G1 X39.950 Y2.002
+G1 X39.887 Y3.001
+G1 X39.800 Y3.999
+G1 X39.687 Y4.993
+G1 X39.550 Y5.985
+G1 X39.387 Y6.973
+G1 X39.201 Y7.957
+G1 X38.989 Y8.936
+G1 X38.753 Y9.909
+G1 X38.493 Y10.876
+G1 X38.209 Y11.836
+G1 X37.901 Y12.788
+G1 X37.569 Y13.733
+G1 X37.213 Y14.669
+G1 X36.834 Y15.596
+G1 X36.432 Y16.513
+G1 X36.008 Y17.420
+G1 X35.560 Y18.316
+G1 X35.091 Y19.200
+G1 X34.599 Y20.072
+G1 X34.086 Y20.932
+G1 X33.551 Y21.779
+G1 X32.996 Y22.612
+G1 X32.419 Y23.430
+G1 X31.823 Y24.234
+G1 X31.206 Y25.023
+G1 X30.570 Y25.797
+G1 X29.915 Y26.554
+G1 X29.241 Y27.294
+G1 X28.549 Y28.018
+G1 X27.838 Y28.723
+G1 X27.111 Y29.411
+G1 X26.366 Y30.080
+G1 X25.605 Y30.731
+G1 X24.828 Y31.362
+G1 X24.035 Y31.974
+G1 X23.227 Y32.565
+G1 X22.405 Y33.137
+G1 X21.568 Y33.687
+G1 X20.718 Y34.216
+G1 X19.855 Y34.724
+G1 X18.980 Y35.210
+G1 X18.093 Y35.674
+G1 X17.194 Y36.116
+G1 X16.285 Y36.535
+G1 X15.365 Y36.931
+G1 X14.436 Y37.304
+G1 X13.498 Y37.654
+G1 X12.551 Y37.980
+G1 X11.596 Y38.282
+G1 X10.635 Y38.560
+G1 X9.666 Y38.815
+G1 X8.692 Y39.044
+G1 X7.712 Y39.250
+G1 X6.727 Y39.430
+G1 X5.738 Y39.586
+G1 X4.745 Y39.718
+G1 X3.749 Y39.824
+G1 X2.751 Y39.905
+G1 X1.752 Y39.962
+G1 X0.751 Y39.993
+G1 X-0.250 Y39.999
+G1 X-1.251 Y39.980
+G1 X-2.252 Y39.937
+G1 X-3.251 Y39.868
+G1 X-4.248 Y39.774
+G1 X-5.242 Y39.655
+G1 X-6.233 Y39.511
+G1 X-7.220 Y39.343
+G1 X-8.202 Y39.150
+G1 X-9.180 Y38.932
+G1 X-10.151 Y38.690
+G1 X-11.116 Y38.424
+G1 X-12.075 Y38.134
+G1 X-13.025 Y37.820
+G1 X-13.968 Y37.482
+G1 X-14.902 Y37.121
+G1 X-15.826 Y36.736
+G1 X-16.741 Y36.328
+G1 X-17.645 Y35.898
+G1 X-18.538 Y35.445
+G1 X-19.419 Y34.970
+G1 X-20.288 Y34.473
+G1 X-21.145 Y33.954
+G1 X-21.988 Y33.414
+G1 X-22.818 Y32.854
+G1 X-23.633 Y32.272
+G1 X-24.433 Y31.671
+G1 X-25.218 Y31.049
+G1 X-25.987 Y30.408
+G1 X-26.740 Y29.748
+G1 X-27.477 Y29.069
+G1 X-28.196 Y28.373
+G1 X-28.897 Y27.658
+G1 X-29.580 Y26.926
+G1 X-30.245 Y26.177
+G1 X-30.891 Y25.412
+G1 X-31.517 Y24.631
+G1 X-32.124 Y23.834
+G1 X-32.710 Y23.023
+G1 X-33.276 Y22.197
+G1 X-33.821 Y21.357
+G1 X-34.345 Y20.504
+G1 X-34.848 Y19.638
+G1 X-35.328 Y18.759
+G1 X-35.787 Y17.869
+G1 X-36.223 Y16.968
+G1 X-36.636 Y16.056
+G1 X-37.027 Y15.134
+G1 X-37.394 Y14.202
+G1 X-37.738 Y13.262
+G1 X-38.058 Y12.313
+G1 X-38.354 Y11.357
+G1 X-38.626 Y10.393
+G1 X-38.874 Y9.423
+G1 X-39.098 Y8.447
+G1 X-39.297 Y7.466
+G1 X-39.472 Y6.480
+G1 X-39.621 Y5.490
+G1 X-39.746 Y4.496
+G1 X-39.847 Y3.500
+G1 X-39.922 Y2.502
+G1 X-39.972 Y1.502
+G1 X-39.997 Y0.501
+G1 X-39.997 Y-0.501
+G1 X-39.972 Y-1.502
+G1 X-39.922 Y-2.502
+G1 X-39.847 Y-3.500
+G1 X-39.746 Y-4.496
+G1 X-39.621 Y-5.490
+G1 X-39.472 Y-6.480
+G1 X-39.297 Y-7.466
+G1 X-39.098 Y-8.447
+G1 X-38.874 Y-9.423
+G1 X-38.626 Y-10.393
+G1 X-38.354 Y-11.357
+G1 X-38.058 Y-12.313
+G1 X-37.738 Y-13.262
+G1 X-37.394 Y-14.202
+G1 X-37.027 Y-15.134
+G1 X-36.636 Y-16.056
+G1 X-36.223 Y-16.968
+G1 X-35.787 Y-17.869
+G1 X-35.328 Y-18.759
+G1 X-34.848 Y-19.638
+G1 X-34.345 Y-20.504
+G1 X-33.821 Y-21.357
+G1 X-33.276 Y-22.197
+G1 X-32.710 Y-23.023
+G1 X-32.124 Y-23.834
+G1 X-31.517 Y-24.631
+G1 X-30.891 Y-25.412
+G1 X-30.245 Y-26.177
+G1 X-29.580 Y-26.926
+G1 X-28.897 Y-27.658
+G1 X-28.196 Y-28.373
+G1 X-27.477 Y-29.069
+G1 X-26.740 Y-29.748
+G1 X-25.987 Y-30.408
+G1 X-25.218 Y-31.049
+G1 X-24.433 Y-31.671
+G1 X-23.633 Y-32.272
+G1 X-22.818 Y-32.854
+G1 X-21.988 Y-33.414
+G1 X-21.145 Y-33.954
+G1 X-20.288 Y-34.473
+G1 X-19.419 Y-34.970
+G1 X-18.538 Y-35.445
+G1 X-17.645 Y-35.898
+G1 X-16.741 Y-36.328
+G1 X-15.826 Y-36.736
+G1 X-14.902 Y-37.121
+G1 X-13.968 Y-37.482
+G1 X-13.025 Y-37.820
+G1 X-12.075 Y-38.134
+G1 X-11.116 Y-38.424
+G1 X-10.151 Y-38.690
+G1 X-9.180 Y-38.932
+G1 X-8.202 Y-39.150
+G1 X-7.220 Y-39.343
+G1 X-6.233 Y-39.511
+G1 X-5.242 Y-39.655
+G1 X-4.248 Y-39.774
+G1 X-3.251 Y-39.868
+G1 X-2.252 Y-39.937
+G1 X-1.251 Y-39.980
+G1 X-0.250 Y-39.999
+G1 X0.751 Y-39.993
+G1 X1.752 Y-39.962
+G1 X2.751 Y-39.905
+G1 X3.749 Y-39.824
+G1 X4.745 Y-39.718
+G1 X5.738 Y-39.586
+G1 X6.727 Y-39.430
+G1 X7.712 Y-39.250
+G1 X8.692 Y-39.044
+G1 X9.666 Y-38.815
+G1 X10.635 Y-38.560
+G1 X11.596 Y-38.282
+G1 X12.551 Y-37.980
+G1 X13.498 Y-37.654
+G1 X14.436 Y-37.304
+G1 X15.365 Y-36.931
+G1 X16.285 Y-36.535
+G1 X17.194 Y-36.116
+G1 X18.093 Y-35.674
+G1 X18.980 Y-35.210
+G1 X19.855 Y-34.724
+G1 X20.718 Y-34.216
+G1 X21.568 Y-33.687
+G1 X22.405 Y-33.137
+G1 X23.227 Y-32.565
+G1 X24.035 Y-31.974
+G1 X24.828 Y-31.362
+G1 X25.605 Y-30.731
+G1 X26.366 Y-30.080
+G1 X27.111 Y-29.411
+G1 X27.838 Y-28.723
+G1 X28.549 Y-28.018
+G1 X29.241 Y-27.294
+G1 X29.915 Y-26.554
+G1 X30.570 Y-25.797
+G1 X31.206 Y-25.023
+G1 X31.823 Y-24.234
+G1 X32.419 Y-23.430
+G1 X32.996 Y-22.612
+G1 X33.551 Y-21.779
+G1 X34.086 Y-20.932
+G1 X34.599 Y-20.072
+G1 X35.091 Y-19.200
+G1 X35.560 Y-18.316
+G1 X36.008 Y-17.420
+G1 X36.432 Y-16.513
+G1 X36.834 Y-15.596
+G1 X37.213 Y-14.669
+G1 X37.569 Y-13.733
+G1 X37.901 Y-12.788
+G1 X38.209 Y-11.836
+G1 X38.493 Y-10.876
+G1 X38.753 Y-9.909
+G1 X38.989 Y-8.936
+G1 X39.201 Y-7.957
+G1 X39.387 Y-6.973
+G1 X39.550 Y-5.985
+G1 X39.687 Y-4.993
+G1 X39.800 Y-3.999
+G1 X39.887 Y-3.001
+G1 X39.950 Y-2.002
+G1 X39.987 Y-1.001
+G1 X40.000 Y-0.000
+G0 X39.550 Y0 F9000
+G1 F2400
+G1 X39.537 Y1.002
+G1 X39.499 Y2.003
+G1 X39.436 Y3.003
+G1 X39.347 Y4.001
+G1 X39.233 Y4.997
+G1 X39.094 Y5.989
+G1 X38.930 Y6.977
+G1 X38.740 Y7.961
+G1 X38.526 Y8.940
+G1 X38.287 Y9.913
+G1 X38.024 Y10.880
+G1 X37.736 Y11.840
+G1 X37.424 Y12.792
+G1 X37.088 Y13.736
+G1 X36.728 Y14.671
+G1 X36.345 Y15.597
+G1 X35.938 Y16.512
+G1 X35.508 Y17.418
+G1 X35.056 Y18.312
+G1 X34.580 Y19.194
+G1 X34.083 Y20.064
+G1 X33.564 Y20.921
+G1 X33.023 Y21.764
+G1 X32.461 Y22.594
+G1 X31.878 Y23.409
+G1 X31.275 Y24.209
+G1 X30.652 Y24.993
+G1 X30.009 Y25.762
+G1 X29.347 Y26.514
+G1 X28.666 Y27.249
+G1 X27.966 Y27.966
+G1 X27.249 Y28.666
+G1 X26.514 Y29.347
+G1 X25.762 Y30.009
+G1 X24.993 Y30.652
+G1 X24.209 Y31.275
+G1 X23.409 Y31.878
+G1 X22.594 Y32.461
+G1 X21.764 Y33.023
+G1 X20.921 Y33.564
+G1 X20.064 Y34.083
+G1 X19.194 Y34.580
+G1 X18.312 Y35.056
+G1 X17.418 Y35.508
+G1 X16.512 Y35.938
+G1 X15.597 Y36.345
+G1 X14.671 Y36.728
+G1 X13.736 Y37.088
+G1 X12.792 Y37.424
+G1 X11.840 Y37.736
+G1 X10.880 Y38.024
+G1 X9.913 Y38.287
+G1 X8.940 Y38.526
+G1 X7.961 Y38.740
+G1 X6.977 Y38.930
+G1 X5.989 Y39.094
+G1 X4.997 Y39.233
+G1 X4.001 Y39.347
+G1 X3.003 Y39.436
+G1 X2.003 Y39.499
+G1 X1.002 Y39.537
+G1 X0.000 Y39.550
+G1 X-1.002 Y39.537
+G1 X-2.003 Y39.499
+G1 X-3.003 Y39.436
+G1 X-4.001 Y39.347
+G1 X-4.997 Y39.233
+G1 X-5.989 Y39.094
+G1 X-6.977 Y38.930
+G1 X-7.961 Y38.740
+G1 X-8.940 Y38.526
+G1 X-9.913 Y38.287
+G1 X-10.880 Y38.024
+G1 X-11.840 Y37.736
+G1 X-12.792 Y37.424
+G1 X-13.736 Y37.088
+G1 X-14.671 Y36.728
+G1 X-15.597 Y36.345
+G1 X-16.512 Y35.938
+G1 X-17.418 Y35.508
+G1 X-18.312 Y35.056
+G1 X-19.194 Y34.580
+G1 X-20.064 Y34.083
+G1 X-20.921 Y33.564
+G1 X-21.764 Y33.023
+G1 X-22.594 Y32.461
+G1 X-23.409 Y31.878
+G1 X-24.209 Y31.275
+G1 X-24.993 Y30.652
+G1 X-25.762 Y30.009
+G1 X-26.514 Y29.347
+G1 X-27.249 Y28.666
+G1 X-27.966 Y27.966
+G1 X-28.666 Y27.249
+G1 X-29.347 Y26.514
+G1 X-30.009 Y25.762
+G1 X-30.652 Y24.993
+G1 X-31.275 Y24.209
+G1 X-31.878 Y23.409
+G1 X-32.461 Y22.594
+G1 X-33.023 Y21.764
+G1 X-33.564 Y20.921
+G1 X-34.083 Y20.064
+G1 X-34.580 Y19.194
+G1 X-35.056 Y18.312
+G1 X-35.508 Y17.418
+G1 X-35.938 Y16.512
+G1 X-36.345 Y15.597
+G1 X-36.728 Y14.671
+G1 X-37.088 Y13.736
+G1 X-37.424 Y12.792
+G1 X-37.736 Y11.840
+G1 X-38.024 Y10.880
+G1 X-38.287 Y9.913
+G1 X-38.526 Y8.940
+G1 X-38.740 Y7.961
+G1 X-38.930 Y6.977
+G1 X-39.094 Y5.989
+G1 X-39.233 Y4.997
+G1 X-39.347 Y4.001
+G1 X-39.436 Y3.003
+G1 X-39.499 Y2.003
+G1 X-39.537 Y1.002
+G1 X-39.550 Y0.000
+G1 X-39.537 Y-1.002
+G1 X-39.499 Y-2.003
+G1 X-39.436 Y-3.003
+G1 X-39.347 Y-4.001
+G1 X-39.233 Y-4.997
+G1 X-39.094 Y-5.989
+G1 X-38.930 Y-6.977
+G1 X-38.740 Y-7.961
+G1 X-38.526 Y-8.940
+G1 X-38.287 Y-9.913
+G1 X-38.024 Y-10.880
+G1 X-37.736 Y-11.840
+G1 X-37.424 Y-12.792
+G1 X-37.088 Y-13.736
+G1 X-36.728 Y-14.671
+G1 X-36.345 Y-15.597
+G1 X-35.938 Y-16.512
+G1 X-35.508 Y-17.418
+G1 X-35.056 Y-18.312
+G1 X-34.580 Y-19.194
+G1 X-34.083 Y-20.064
+G1 X-33.564 Y-20.921
+G1 X-33.023 Y-21.764
+G1 X-32.461 Y-22.594
+G1 X-31.878 Y-23.409
+G1 X-31.275 Y-24.209
+G1 X-30.652 Y-24.993
+G1 X-30.009 Y-25.762
+G1 X-29.347 Y-26.514
+G1 X-28.666 Y-27.249
+G1 X-27.966 Y-27.966
+G1 X-27.249 Y-28.666
+G1 X-26.514 Y-29.347
+G1 X-25.762 Y-30.009
+G1 X-24.993 Y-30.652
+G1 X-24.209 Y-31.275
+G1 X-23.409 Y-31.878
+G1 X-22.594 Y-32.461
+G1 X-21.764 Y-33.023
+G1 X-20.921 Y-33.564
+G1 X-20.064 Y-34.083
+G1 X-19.194 Y-34.580
+G1 X-18.312 Y-35.056
+G1 X-17.418 Y-35.508
+G1 X-16.512 Y-35.938
+G1 X-15.597 Y-36.345
+G1 X-14.671 Y-36.728
+G1 X-13.736 Y-37.088
+G1 X-12.792 Y-37.424
+G1 X-11.840 Y-37.736
+G1 X-10.880 Y-38.024
+G1 X-9.913 Y-38.287
+G1 X-8.940 Y-38.526
+G1 X-7.961 Y-38.740
+G1 X-6.977 Y-38.930
+G1 X-5.989 Y-39.094
+G1 X-4.997 Y-39.233
+G1 X-4.001 Y-39.347
+G1 X-3.003 Y-39.436
+G1 X-2.003 Y-39.499
+G1 X-1.002 Y-39.537
+G1 X-0.000 Y-39.550
+G1 X1.002 Y-39.537
+G1 X2.003 Y-39.499
+G1 X3.003 Y-39.436
+G1 X4.001 Y-39.347
+G1 X4.997 Y-39.233
+G1 X5.989 Y-39.094
+G1 X6.977 Y-38.930
+G1 X7.961 Y-38.740
+G1 X8.940 Y-38.526
+G1 X9.913 Y-38.287
+G1 X10.880 Y-38.024
+G1 X11.840 Y-37.736
+G1 X12.792 Y-37.424
+G1 X13.736 Y-37.088
+G1 X14.671 Y-36.728
+G1 X15.597 Y-36.345
+G1 X16.512 Y-35.938
+G1 X17.418 Y-35.508
+G1 X18.312 Y-35.056
+G1 X19.194 Y-34.580
+G1 X20.064 Y-34.083
+G1 X20.921 Y-33.564
+G1 X21.764 Y-33.023
+G1 X22.594 Y-32.461
+G1 X23.409 Y-31.878
+G1 X24.209 Y-31.275
+G1 X24.993 Y-30.652
+G1 X25.762 Y-30.009
+G1 X26.514 Y-29.347
+G1 X27.249 Y-28.666
+G1 X27.966 Y-27.966
+G1 X28.666 Y-27.249
+G1 X29.347 Y-26.514
+G1 X30.009 Y-25.762
+G1 X30.652 Y-24.993
+G1 X31.275 Y-24.209
+G1 X31.878 Y-23.409
+G1 X32.461 Y-22.594
+G1 X33.023 Y-21.764
+G1 X33.564 Y-20.921
+G1 X34.083 Y-20.064
+G1 X34.580 Y-19.194
+G1 X35.056 Y-18.312
+G1 X35.508 Y-17.418
+G1 X35.938 Y-16.512
+G1 X36.345 Y-15.597
+G1 X36.728 Y-14.671
+G1 X37.088 Y-13.736
+G1 X37.424 Y-12.792
+G1 X37.736 Y-11.840
+G1 X38.024 Y-10.880
+G1 X38.287 Y-9.913
+G1 X38.526 Y-8.940
+G1 X38.740 Y-7.961
+G1 X38.930 Y-6.977
+G1 X39.094 Y-5.989
+G1 X39.233 Y-4.997
+G1 X39.347 Y-4.001
+G1 X39.436 Y-3.003
+G1 X39.499 Y-2.003
+G1 X39.537 Y-1.002
+G1 X39.550 Y-0.000
+G0 X39.100 Y0 F9000
+G1 F2400
+G1 X39.087 Y1.003
+G1 X39.049 Y2.005
+G1 X38.984 Y3.005
+G1 X38.894 Y4.004
+G1 X38.779 Y5.000
+G1 X38.638 Y5.993
+G1 X38.472 Y6.982
+G1 X38.280 Y7.966
+G1 X38.063 Y8.945
+G1 X37.821 Y9.918
+G1 X37.554 Y10.884
+G1 X37.263 Y11.844
+G1 X36.947 Y12.796
+G1 X36.607 Y13.739
+G1 X36.242 Y14.673
+G1 X35.854 Y15.597
+G1 X35.443 Y16.512
+G1 X35.007 Y17.415
+G1 X34.549 Y18.307
+G1 X34.069 Y19.187
+G1 X33.565 Y20.054
+G1 X33.040 Y20.908
+G1 X32.493 Y21.749
+G1 X31.925 Y22.575
+G1 X31.335 Y23.386
+G1 X30.725 Y24.182
+G1 X30.095 Y24.962
+G1 X29.445 Y25.725
+G1 X28.776 Y26.472
+G1 X28.087 Y27.201
+G1 X27.381 Y27.912
+G1 X26.656 Y28.605
+G1 X25.914 Y29.280
+G1 X25.154 Y29.934
+G1 X24.378 Y30.570
+G1 X23.587 Y31.185
+G1 X22.779 Y31.779
+G1 X21.957 Y32.353
+G1 X21.120 Y32.905
+G1 X20.269 Y33.436
+G1 X19.405 Y33.945
+G1 X18.528 Y34.431
+G1 X17.639 Y34.895
+G1 X16.739 Y35.336
+G1 X15.827 Y35.754
+G1 X14.905 Y36.148
+G1 X13.973 Y36.518
+G1 X13.032 Y36.864
+G1 X12.083 Y37.186
+G1 X11.125 Y37.484
+G1 X10.160 Y37.757
+G1 X9.189 Y38.005
+G1 X8.211 Y38.228
+G1 X7.228 Y38.426
+G1 X6.240 Y38.599
+G1 X5.249 Y38.746
+G1 X4.253 Y38.868
+G1 X3.255 Y38.964
+G1 X2.255 Y39.035
+G1 X1.253 Y39.080
+G1 X0.251 Y39.099
+G1 X-0.752 Y39.093
+G1 X-1.754 Y39.061
+G1 X-2.755 Y39.003
+G1 X-3.755 Y38.919
+G1 X-4.751 Y38.810
+G1 X-5.745 Y38.676
+G1 X-6.735 Y38.516
+G1 X-7.720 Y38.330
+G1 X-8.701 Y38.120
+G1 X-9.675 Y37.884
+G1 X-10.643 Y37.623
+G1 X-11.605 Y37.338
+G1 X-12.558 Y37.028
+G1 X-13.504 Y36.694
+G1 X-14.440 Y36.336
+G1 X-15.367 Y35.954
+G1 X-16.284 Y35.548
+G1 X-17.190 Y35.118
+G1 X-18.085 Y34.666
+G1 X-18.968 Y34.191
+G1 X-19.839 Y33.693
+G1 X-20.696 Y33.173
+G1 X-21.540 Y32.632
+G1 X-22.370 Y32.069
+G1 X-23.185 Y31.485
+G1 X-23.984 Y30.880
+G1 X-24.768 Y30.255
+G1 X-25.536 Y29.609
+G1 X-26.287 Y28.945
+G1 X-27.021 Y28.261
+G1 X-27.736 Y27.559
+G1 X-28.434 Y26.839
+G1 X-29.113 Y26.101
+G1 X-29.773 Y25.346
+G1 X-30.413 Y24.574
+G1 X-31.033 Y23.786
+G1 X-31.633 Y22.982
+G1 X-32.211 Y22.164
+G1 X-32.769 Y21.330
+G1 X-33.305 Y20.483
+G1 X-33.820 Y19.622
+G1 X-34.312 Y18.749
+G1 X-34.781 Y17.863
+G1 X-35.228 Y16.965
+G1 X-35.651 Y16.056
+G1 X-36.051 Y15.136
+G1 X-36.428 Y14.207
+G1 X-36.780 Y13.268
+G1 X-37.108 Y12.321
+G1 X-37.412 Y11.365
+G1 X-37.691 Y10.402
+G1 X-37.945 Y9.432
+G1 X-38.175 Y8.456
+G1 X-38.379 Y7.474
+G1 X-38.558 Y6.488
+G1 X-38.712 Y5.497
+G1 X-38.840 Y4.502
+G1 X-38.943 Y3.505
+G1 X-39.020 Y2.505
+G1 X-39.071 Y1.504
+G1 X-39.097 Y0.501
+G1 X-39.097 Y-0.501
+G1 X-39.071 Y-1.504
+G1 X-39.020 Y-2.505
+G1 X-38.943 Y-3.505
+G1 X-38.840 Y-4.502
+G1 X-38.712 Y-5.497
+G1 X-38.558 Y-6.488
+G1 X-38.379 Y-7.474
+G1 X-38.175 Y-8.456
+G1 X-37.945 Y-9.432
+G1 X-37.691 Y-10.402
+G1 X-37.412 Y-11.365
+G1 X-37.108 Y-12.321
+G1 X-36.780 Y-13.268
+G1 X-36.428 Y-14.207
+G1 X-36.051 Y-15.136
+G1 X-35.651 Y-16.056
+G1 X-35.228 Y-16.965
+G1 X-34.781 Y-17.863
+G1 X-34.312 Y-18.749
+G1 X-33.820 Y-19.622
+G1 X-33.305 Y-20.483
+G1 X-32.769 Y-21.330
+G1 X-32.211 Y-22.164
+G1 X-31.633 Y-22.982
+G1 X-31.033 Y-23.786
+G1 X-30.413 Y-24.574
+G1 X-29.773 Y-25.346
+G1 X-29.113 Y-26.101
+G1 X-28.434 Y-26.839
+G1 X-27.736 Y-27.559
+G1 X-27.021 Y-28.261
+G1 X-26.287 Y-28.945
+G1 X-25.536 Y-29.609
+G1 X-24.768 Y-30.255
+G1 X-23.984 Y-30.880
+G1 X-23.185 Y-31.485
+G1 X-22.370 Y-32.069
+G1 X-21.540 Y-32.632
+G1 X-20.696 Y-33.173
+G1 X-19.839 Y-33.693
+G1 X-18.968 Y-34.191
+G1 X-18.085 Y-34.666
+G1 X-17.190 Y-35.118
+G1 X-16.284 Y-35.548
+G1 X-15.367 Y-35.954
+G1 X-14.440 Y-36.336
+G1 X-13.504 Y-36.694
+G1 X-12.558 Y-37.028
+G1 X-11.605 Y-37.338
+G1 X-10.643 Y-37.623
+G1 X-9.675 Y-37.884
+G1 X-8.701 Y-38.120
+G1 X-7.720 Y-38.330
+G1 X-6.735 Y-38.516
+G1 X-5.745 Y-38.676
+G1 X-4.751 Y-38.810
+G1 X-3.755 Y-38.919
+G1 X-2.755 Y-39.003
+G1 X-1.754 Y-39.061
+G1 X-0.752 Y-39.093
+G1 X0.251 Y-39.099
+G1 X1.253 Y-39.080
+G1 X2.255 Y-39.035
+G1 X3.255 Y-38.964
+G1 X4.253 Y-38.868
+G1 X5.249 Y-38.746
+G1 X6.240 Y-38.599
+G1 X7.228 Y-38.426
+G1 X8.211 Y-38.228
+G1 X9.189 Y-38.005
+G1 X10.160 Y-37.757
+G1 X11.125 Y-37.484
+G1 X12.083 Y-37.186
+G1 X13.032 Y-36.864
+G1 X13.973 Y-36.518
+G1 X14.905 Y-36.148
+G1 X15.827 Y-35.754
+G1 X16.739 Y-35.336
+G1 X17.639 Y-34.895
+G1 X18.528 Y-34.431
+G1 X19.405 Y-33.945
+G1 X20.269 Y-33.436
+G1 X21.120 Y-32.905
+G1 X21.957 Y-32.353
+G1 X22.779 Y-31.779
+G1 X23.587 Y-31.185
+G1 X24.378 Y-30.570
+G1 X25.154 Y-29.934
+G1 X25.914 Y-29.280
+G1 X26.656 Y-28.605
+G1 X27.381 Y-27.912
+G1 X28.087 Y-27.201
+G1 X28.776 Y-26.472
+G1 X29.445 Y-25.725
+G1 X30.095 Y-24.962
+G1 X30.725 Y-24.182
+G1 X31.335 Y-23.386
+G1 X31.925 Y-22.575
+G1 X32.493 Y-21.749
+G1 X33.040 Y-20.908
+G1 X33.565 Y-20.054
+G1 X34.069 Y-19.187
+G1 X34.549 Y-18.307
+G1 X35.007 Y-17.415
+G1 X35.443 Y-16.512
+G1 X35.854 Y-15.597
+G1 X36.242 Y-14.673
+G1 X36.607 Y-13.739
+G1 X36.947 Y-12.796
+G1 X37.263 Y-11.844
+G1 X37.554 Y-10.884
+G1 X37.821 Y-9.918
+G1 X38.063 Y-8.945
+G1 X38.280 Y-7.966
+G1 X38.472 Y-6.982
+G1 X38.638 Y-5.993
+G1 X38.779 Y-5.000
+G1 X38.894 Y-4.004
+G1 X38.984 Y-3.005
+G1 X39.049 Y-2.005
+G1 X39.087 Y-1.003
+G1 X39.100 Y-0.000
+G1 F4800
+G0 X20.352 Y-32.681 F9000
+G1 X32.681 Y-20.352 F4800
+G0 X35.638 Y-14.567 F9000
+G1 X14.567 Y-35.638 F4800
+G0 X10.272 Y-37.104 F9000
+G1 X37.104 Y-10.272 F4800
+G0 X37.926 Y-6.621 F9000
+G1 X6.621 Y-37.926 F4800
+G0 X3.367 Y-38.353 F9000
+G1 X38.353 Y-3.367 F4800
+G0 X38.498 Y-0.393 F9000
+G1 X0.393 Y-38.498 F4800
+G0 X-2.365 Y-38.427 F9000
+G1 X38.427 Y2.365 F4800
+G0 X38.181 Y4.947 F9000
+G1 X-4.947 Y-38.181 F4800
+G0 X-7.380 Y-37.786 F9000
+G1 X37.786 Y7.380 F4800
+G0 X37.262 Y9.685 F9000
+G1 X-9.685 Y-37.262 F4800
+G0 X-11.874 Y-36.623 F9000
+G1 X36.623 Y11.874 F4800
+G0 X35.880 Y13.960 F9000
+G1 X-13.960 Y-35.880 F4800
+G0 X-15.949 Y-35.041 F9000
+G1 X35.041 Y15.949 F4800
+G0 X34.112 Y17.849 F9000
+G1 X-17.849 Y-34.112 F4800
+G0 X-19.664 Y-33.099 F9000
+G1 X33.099 Y19.664 F4800
+G0 X32.005 Y21.399 F9000
+G1 X-21.399 Y-32.005 F4800
+G0 X-23.055 Y-30.833 F9000
+G1 X30.833 Y23.055 F4800
+G0 X29.586 Y24.636 F9000
+G1 X-24.636 Y-29.586 F4800
+G0 X-26.142 Y-28.264 F9000
+G1 X28.264 Y26.142 F4800
+G0 X26.868 Y27.575 F9000
+G1 X-27.575 Y-26.868 F4800
+G0 X-28.934 Y-25.398 F9000
+G1 X25.398 Y28.934 F4800
+G0 X23.855 Y30.219 F9000
+G1 X-30.219 Y-23.855 F4800
+G0 X-31.429 Y-22.237 F9000
+G1 X22.237 Y31.429 F4800
+G0 X20.541 Y32.562 F9000
+G1 X-32.562 Y-20.541 F4800
+G0 X-33.616 Y-18.767 F9000
+G1 X18.767 Y33.616 F4800
+G0 X16.910 Y34.588 F9000
+G1 X-34.588 Y-16.910 F4800
+G0 X-35.472 Y-14.966 F9000
+G1 X14.966 Y35.472 F4800
+G0 X12.929 Y36.264 F9000
+G1 X-36.264 Y-12.929 F4800
+G0 X-36.956 Y-10.793 F9000
+G1 X10.793 Y36.956 F4800
+G0 X8.548 Y37.539 F9000
+G1 X-37.539 Y-8.548 F4800
+G0 X-38.001 Y-6.181 F9000
+G1 X6.181 Y38.001 F4800
+G0 X3.676 Y38.324 F9000
+G1 X-38.324 Y-3.676 F4800
+G0 X-38.487 Y-1.010 F9000
+G1 X1.010 Y38.487 F4800
+G0 X-1.850 Y38.456 F9000
+G1 X-38.456 Y1.850 F4800
+G0 X-38.180 Y4.954 F9000
+G1 X-4.954 Y38.180 F4800
+G0 X-8.386 Y37.575 F9000
+G1 X-37.575 Y8.386 F4800
+G0 X-36.478 Y12.312 F9000
+G1 X-12.312 Y36.478 F4800
+G0 X-17.149 Y34.470 F9000
+G1 X-34.470 Y17.149 F4800
+G1 Z0.40 F6000
+G0 X40.000 Y0 F9000
+G1 F2400
+G1 X39.987 Y1.001
+G1 X39.950 Y2.002
+G1 X39.887 Y3.001
+G1 X39.800 Y3.999
+G1 X39.687 Y4.993
+G1 X39.550 Y5.985
+G1 X39.387 Y6.973
+G1 X39.201 Y7.957
+G1 X38.989 Y8.936
+G1 X38.753 Y9.909
+G1 X38.493 Y10.876
+G1 X38.209 Y11.836
+G1 X37.901 Y12.788
+G1 X37.569 Y13.733
+G1 X37.213 Y14.669
+G1 X36.834 Y15.596
+G1 X36.432 Y16.513
+G1 X36.008 Y17.420
+G1 X35.560 Y18.316
+G1 X35.091 Y19.200
+G1 X34.599 Y20.072
+G1 X34.086 Y20.932
+G1 X33.551 Y21.779
+G1 X32.996 Y22.612
+G1 X32.419 Y23.430
+G1 X31.823 Y24.234
+G1 X31.206 Y25.023
+G1 X30.570 Y25.797
+G1 X29.915 Y26.554
+G1 X29.241 Y27.294
+G1 X28.549 Y28.018
+G1 X27.838 Y28.723
+G1 X27.111 Y29.411
+G1 X26.366 Y30.080
+G1 X25.605 Y30.731
+G1 X24.828 Y31.362
+G1 X24.035 Y31.974
+G1 X23.227 Y32.565
+G1 X22.405 Y33.137
+G1 X21.568 Y33.687
+G1 X20.718 Y34.216
+G1 X19.855 Y34.724
+G1 X18.980 Y35.210
+G1 X18.093 Y35.674
+G1 X17.194 Y36.116
+G1 X16.285 Y36.535
+G1 X15.365 Y36.931
+G1 X14.436 Y37.304
+G1 X13.498 Y37.654
+G1 X12.551 Y37.980
+G1 X11.596 Y38.282
+G1 X10.635 Y38.560
+G1 X9.666 Y38.815
+G1 X8.692 Y39.044
+G1 X7.712 Y39.250
+G1 X6.727 Y39.430
+G1 X5.738 Y39.586
+G1 X4.745 Y39.718
+G1 X3.749 Y39.824
+G1 X2.751 Y39.905
+G1 X1.752 Y39.962
+G1 X0.751 Y39.993
+G1 X-0.250 Y39.999
+G1 X-1.251 Y39.980
+G1 X-2.252 Y39.937
+G1 X-3.251 Y39.868
+G1 X-4.248 Y39.774
+G1 X-5.242 Y39.655
+G1 X-6.233 Y39.511
+G1 X-7.220 Y39.343
+G1 X-8.202 Y39.150
+G1 X-9.180 Y38.932
+G1 X-10.151 Y38.690
+G1 X-11.116 Y38.424
+G1 X-12.075 Y38.134
+G1 X-13.025 Y37.820
+G1 X-13.968 Y37.482
+G1 X-14.902 Y37.121
+G1 X-15.826 Y36.736
+G1 X-16.741 Y36.328
+G1 X-17.645 Y35.898
+G1 X-18.538 Y35.445
+G1 X-19.419 Y34.970
+G1 X-20.288 Y34.473
+G1 X-21.145 Y33.954
+G1 X-21.988 Y33.414
+G1 X-22.818 Y32.854
+G1 X-23.633 Y32.272
+G1 X-24.433 Y31.671
+G1 X-25.218 Y31.049
+G1 X-25.987 Y30.408
+G1 X-26.740 Y29.748
+G1 X-27.477 Y29.069
+G1 X-28.196 Y28.373
+G1 X-28.897 Y27.658
+G1 X-29.580 Y26.926
+G1 X-30.245 Y26.177
+G1 X-30.891 Y25.412
+G1 X-31.517 Y24.631
+G1 X-32.124 Y23.834
+G1 X-32.710 Y23.023
+G1 X-33.276 Y22.197
+G1 X-33.821 Y21.357
+G1 X-34.345 Y20.504
+G1 X-34.848 Y19.638
+G1 X-35.328 Y18.759
+G1 X-35.787 Y17.869
+G1 X-36.223 Y16.968
+G1 X-36.636 Y16.056
+G1 X-37.027 Y15.134
+G1 X-37.394 Y14.202
+G1 X-37.738 Y13.262
+G1 X-38.058 Y12.313
+G1 X-38.354 Y11.357
+G1 X-38.626 Y10.393
+G1 X-38.874 Y9.423
+G1 X-39.098 Y8.447
+G1 X-39.297 Y7.466
+G1 X-39.472 Y6.480
+G1 X-39.621 Y5.490
+G1 X-39.746 Y4.496
+G1 X-39.847 Y3.500
+G1 X-39.922 Y2.502
+G1 X-39.972 Y1.502
+G1 X-39.997 Y0.501
+G1 X-39.997 Y-0.501
+G1 X-39.972 Y-1.502
+G1 X-39.922 Y-2.502
+G1 X-39.847 Y-3.500
+G1 X-39.746 Y-4.496
+G1 X-39.621 Y-5.490
+G1 X-39.472 Y-6.480
+G1 X-39.297 Y-7.466
+G1 X-39.098 Y-8.447
+G1 X-38.874 Y-9.423
+G1 X-38.626 Y-10.393
+G1 X-38.354 Y-11.357
+G1 X-38.058 Y-12.313
+G1 X-37.738 Y-13.262
+G1 X-37.394 Y-14.202
+G1 X-37.027 Y-15.134
+G1 X-36.636 Y-16.056
+G1 X-36.223 Y-16.968
+G1 X-35.787 Y-17.869
+G1 X-35.328 Y-18.759
+G1 X-34.848 Y-19.638
+G1 X-34.345 Y-20.504
+G1 X-33.821 Y-21.357
+G1 X-33.276 Y-22.197
+G1 X-32.710 Y-23.023
+G1 X-32.124 Y-23.834
+G1 X-31.517 Y-24.631
+G1 X-30.891 Y-25.412
+G1 X-30.245 Y-26.177
+G1 X-29.580 Y-26.926
+G1 X-28.897 Y-27.658
+G1 X-28.196 Y-28.373
+G1 X-27.477 Y-29.069
+G1 X-26.740 Y-29.748
+G1 X-25.987 Y-30.408
+G1 X-25.218 Y-31.049
+G1 X-24.433 Y-31.671
+G1 X-23.633 Y-32.272
+G1 X-22.818 Y-32.854
+G1 X-21.988 Y-33.414
+G1 X-21.145 Y-33.954
+G1 X-20.288 Y-34.473
+G1 X-19.419 Y-34.970
+G1 X-18.538 Y-35.445
+G1 X-17.645 Y-35.898
+G1 X-16.741 Y-36.328
+G1 X-15.826 Y-36.736
+G1 X-14.902 Y-37.121
+G1 X-13.968 Y-37.482
+G1 X-13.025 Y-37.820
+G1 X-12.075 Y-38.134
+G1 X-11.116 Y-38.424
+G1 X-10.151 Y-38.690
+G1 X-9.180 Y-38.932
+G1 X-8.202 Y-39.150
+G1 X-7.220 Y-39.343
+G1 X-6.233 Y-39.511
+G1 X-5.242 Y-39.655
+G1 X-4.248 Y-39.774
+G1 X-3.251 Y-39.868
+G1 X-2.252 Y-39.937
+G1 X-1.251 Y-39.980
+G1 X-0.250 Y-39.999
+G1 X0.751 Y-39.993
+G1 X1.752 Y-39.962
+G1 X2.751 Y-39.905
+G1 X3.749 Y-39.824
+G1 X4.745 Y-39.718
+G1 X5.738 Y-39.586
+G1 X6.727 Y-39.430
+G1 X7.712 Y-39.250
+G1 X8.692 Y-39.044
+G1 X9.666 Y-38.815
+G1 X10.635 Y-38.560
+G1 X11.596 Y-38.282
+G1 X12.551 Y-37.980
+G1 X13.498 Y-37.654
+G1 X14.436 Y-37.304
+G1 X15.365 Y-36.931
+G1 X16.285 Y-36.535
+G1 X17.194 Y-36.116
+G1 X18.093 Y-35.674
+G1 X18.980 Y-35.210
+G1 X19.855 Y-34.724
+G1 X20.718 Y-34.216
+G1 X21.568 Y-33.687
+G1 X22.405 Y-33.137
+G1 X23.227 Y-32.565
+G1 X24.035 Y-31.974
+G1 X24.828 Y-31.362
+G1 X25.605 Y-30.731
+G1 X26.366 Y-30.080
+G1 X27.111 Y-29.411
+G1 X27.838 Y-28.723
+G1 X28.549 Y-28.018
+G1 X29.241 Y-27.294
+G1 X29.915 Y-26.554
+G1 X30.570 Y-25.797
+G1 X31.206 Y-25.023
+G1 X31.823 Y-24.234
+G1 X32.419 Y-23.430
+G1 X32.996 Y-22.612
+G1 X33.551 Y-21.779
+G1 X34.086 Y-20.932
+G1 X34.599 Y-20.072
+G1 X35.091 Y-19.200
+G1 X35.560 Y-18.316
+G1 X36.008 Y-17.420
+G1 X36.432 Y-16.513
+G1 X36.834 Y-15.596
+G1 X37.213 Y-14.669
+G1 X37.569 Y-13.733
+G1 X37.901 Y-12.788
+G1 X38.209 Y-11.836
+G1 X38.493 Y-10.876
+G1 X38.753 Y-9.909
+G1 X38.989 Y-8.936
+G1 X39.201 Y-7.957
+G1 X39.387 Y-6.973
+G1 X39.550 Y-5.985
+G1 X39.687 Y-4.993
+G1 X39.800 Y-3.999
+G1 X39.887 Y-3.001
+G1 X39.950 Y-2.002
+G1 X39.987 Y-1.001
+G1 X40.000 Y-0.000
+G0 X39.550 Y0 F9000
+G1 F2400
+G1 X39.537 Y1.002
+G1 X39.499 Y2.003
+G1 X39.436 Y3.003
+G1 X39.347 Y4.001
+G1 X39.233 Y4.997
+G1 X39.094 Y5.989
+G1 X38.930 Y6.977
+G1 X38.740 Y7.961
+G1 X38.526 Y8.940
+G1 X38.287 Y9.913
+G1 X38.024 Y10.880
+G1 X37.736 Y11.840
+G1 X37.424 Y12.792
+G1 X37.088 Y13.736
+G1 X36.728 Y14.671
+G1 X36.345 Y15.597
+G1 X35.938 Y16.512
+G1 X35.508 Y17.418
+G1 X35.056 Y18.312
+G1 X34.580 Y19.194
+G1 X34.083 Y20.064
+G1 X33.564 Y20.921
+G1 X33.023 Y21.764
+G1 X32.461 Y22.594
+G1 X31.878 Y23.409
+G1 X31.275 Y24.209
+G1 X30.652 Y24.993
+G1 X30.009 Y25.762
+G1 X29.347 Y26.514
+G1 X28.666 Y27.249
+G1 X27.966 Y27.966
+G1 X27.249 Y28.666
+G1 X26.514 Y29.347
+G1 X25.762 Y30.009
+G1 X24.993 Y30.652
+G1 X24.209 Y31.275
+G1 X23.409 Y31.878
+G1 X22.594 Y32.461
+G1 X21.764 Y33.023
+G1 X20.921 Y33.564
+G1 X20.064 Y34.083
+G1 X19.194 Y34.580
+G1 X18.312 Y35.056
+G1 X17.418 Y35.508
+G1 X16.512 Y35.938
+G1 X15.597 Y36.345
+G1 X14.671 Y36.728
+G1 X13.736 Y37.088
+G1 X12.792 Y37.424
+G1 X11.840 Y37.736
+G1 X10.880 Y38.024
+G1 X9.913 Y38.287
+G1 X8.940 Y38.526
+G1 X7.961 Y38.740
+G1 X6.977 Y38.930
+G1 X5.989 Y39.094
+G1 X4.997 Y39.233
+G1 X4.001 Y39.347
+G1 X3.003 Y39.436
+G1 X2.003 Y39.499
+G1 X1.002 Y39.537
+G1 X0.000 Y39.550
+G1 X-1.002 Y39.537
+G1 X-2.003 Y39.499
+G1 X-3.003 Y39.436
+G1 X-4.001 Y39.347
+G1 X-4.997 Y39.233
+G1 X-5.989 Y39.094
+G1 X-6.977 Y38.930
+G1 X-7.961 Y38.740
+G1 X-8.940 Y38.526
+G1 X-9.913 Y38.287
+G1 X-10.880 Y38.024
+G1 X-11.840 Y37.736
+G1 X-12.792 Y37.424
+G1 X-13.736 Y37.088
+G1 X-14.671 Y36.728
+G1 X-15.597 Y36.345
+G1 X-16.512 Y35.938
+G1 X-17.418 Y35.508
+G1 X-18.312 Y35.056
+G1 X-19.194 Y34.580
+G1 X-20.064 Y34.083
+G1 X-20.921 Y33.564
+G1 X-21.764 Y33.023
+G1 X-22.594 Y32.461
+G1 X-23.409 Y31.878
+G1 X-24.209 Y31.275
+G1 X-24.993 Y30.652
+G1 X-25.762 Y30.009
+G1 X-26.514 Y29.347
+G1 X-27.249 Y28.666
+G1 X-27.966 Y27.966
+G1 X-28.666 Y27.249
+G1 X-29.347 Y26.514
+G1 X-30.009 Y25.762
+G1 X-30.652 Y24.993
+G1 X-31.275 Y24.209
+G1 X-31.878 Y23.409
+G1 X-32.461 Y22.594
+G1 X-33.023 Y21.764
+G1 X-33.564 Y20.921
+G1 X-34.083 Y20.064
+G1 X-34.580 Y19.194
+G1 X-35.056 Y18.312
+G1 X-35.508 Y17.418
+G1 X-35.938 Y16.512
+G1 X-36.345 Y15.597
+G1 X-36.728 Y14.671
+G1 X-37.088 Y13.736
+G1 X-37.424 Y12.792
+G1 X-37.736 Y11.840
+G1 X-38.024 Y10.880
+G1 X-38.287 Y9.913
+G1 X-38.526 Y8.940
+G1 X-38.740 Y7.961
+G1 X-38.930 Y6.977
+G1 X-39.094 Y5.989
+G1 X-39.233 Y4.997
+G1 X-39.347 Y4.001
+G1 X-39.436 Y3.003
+G1 X-39.499 Y2.003
+G1 X-39.537 Y1.002
+G1 X-39.550 Y0.000
+G1 X-39.537 Y-1.002
+G1 X-39.499 Y-2.003
+G1 X-39.436 Y-3.003
+G1 X-39.347 Y-4.001
+G1 X-39.233 Y-4.997
+G1 X-39.094 Y-5.989
+G1 X-38.930 Y-6.977
+G1 X-38.740 Y-7.961
+G1 X-38.526 Y-8.940
+G1 X-38.287 Y-9.913
+G1 X-38.024 Y-10.880
+G1 X-37.736 Y-11.840
+G1 X-37.424 Y-12.792
+G1 X-37.088 Y-13.736
+G1 X-36.728 Y-14.671
+G1 X-36.345 Y-15.597
+G1 X-35.938 Y-16.512
+G1 X-35.508 Y-17.418
+G1 X-35.056 Y-18.312
+G1 X-34.580 Y-19.194
+G1 X-34.083 Y-20.064
+G1 X-33.564 Y-20.921
+G1 X-33.023 Y-21.764
+G1 X-32.461 Y-22.594
+G1 X-31.878 Y-23.409
+G1 X-31.275 Y-24.209
+G1 X-30.652 Y-24.993
+G1 X-30.009 Y-25.762
+G1 X-29.347 Y-26.514
+G1 X-28.666 Y-27.249
+G1 X-27.966 Y-27.966
+G1 X-27.249 Y-28.666
+G1 X-26.514 Y-29.347
+G1 X-25.762 Y-30.009
+G1 X-24.993 Y-30.652
+G1 X-24.209 Y-31.275
+G1 X-23.409 Y-31.878
+G1 X-22.594 Y-32.461
+G1 X-21.764 Y-33.023
+G1 X-20.921 Y-33.564
+G1 X-20.064 Y-34.083
+G1 X-19.194 Y-34.580
+G1 X-18.312 Y-35.056
+G1 X-17.418 Y-35.508
+G1 X-16.512 Y-35.938
+G1 X-15.597 Y-36.345
+G1 X-14.671 Y-36.728
+G1 X-13.736 Y-37.088
+G1 X-12.792 Y-37.424
+G1 X-11.840 Y-37.736
+G1 X-10.880 Y-38.024
+G1 X-9.913 Y-38.287
+G1 X-8.940 Y-38.526
+G1 X-7.961 Y-38.740
+G1 X-6.977 Y-38.930
+G1 X-5.989 Y-39.094
+G1 X-4.997 Y-39.233
+G1 X-4.001 Y-39.347
+G1 X-3.003 Y-39.436
+G1 X-2.003 Y-39.499
+G1 X-1.002 Y-39.537
+G1 X-0.000 Y-39.550
+G1 X1.002 Y-39.537
+G1 X2.003 Y-39.499
+G1 X3.003 Y-39.436
+G1 X4.001 Y-39.347
+G1 X4.997 Y-39.233
+G1 X5.989 Y-39.094
+G1 X6.977 Y-38.930
+G1 X7.961 Y-38.740
+G1 X8.940 Y-38.526
+G1 X9.913 Y-38.287
+G1 X10.880 Y-38.024
+G1 X11.840 Y-37.736
+G1 X12.792 Y-37.424
+G1 X13.736 Y-37.088
+G1 X14.671 Y-36.728
+G1 X15.597 Y-36.345
+G1 X16.512 Y-35.938
+G1 X17.418 Y-35.508
+G1 X18.312 Y-35.056
+G1 X19.194 Y-34.580
+G1 X20.064 Y-34.083
+G1 X20.921 Y-33.564
+G1 X21.764 Y-33.023
+G1 X22.594 Y-32.461
+G1 X23.409 Y-31.878
+G1 X24.209 Y-31.275
+G1 X24.993 Y-30.652
+G1 X25.762 Y-30.009
+G1 X26.514 Y-29.347
+G1 X27.249 Y-28.666
+G1 X27.966 Y-27.966
+G1 X28.666 Y-27.249
+G1 X29.347 Y-26.514
+G1 X30.009 Y-25.762
+G1 X30.652 Y-24.993
+G1 X31.275 Y-24.209
+G1 X31.878 Y-23.409
+G1 X32.461 Y-22.594
+G1 X33.023 Y-21.764
+G1 X33.564 Y-20.921
+G1 X34.083 Y-20.064
+G1 X34.580 Y-19.194
+G1 X35.056 Y-18.312
+G1 X35.508 Y-17.418
+G1 X35.938 Y-16.512
+G1 X36.345 Y-15.597
+G1 X36.728 Y-14.671
+G1 X37.088 Y-13.736
+G1 X37.424 Y-12.792
+G1 X37.736 Y-11.840
+G1 X38.024 Y-10.880
+G1 X38.287 Y-9.913
+G1 X38.526 Y-8.940
+G1 X38.740 Y-7.961
+G1 X38.930 Y-6.977
+G1 X39.094 Y-5.989
+G1 X39.233 Y-4.997
+G1 X39.347 Y-4.001
+G1 X39.436 Y-3.003
+G1 X39.499 Y-2.003
+G1 X39.537 Y-1.002
+G1 X39.550 Y-0.000
+G0 X39.100 Y0 F9000
+G1 F2400
+G1 X39.087 Y1.003
+G1 X39.049 Y2.005
+G1 X38.984 Y3.005
+G1 X38.894 Y4.004
+G1 X38.779 Y5.000
+G1 X38.638 Y5.993
+G1 X38.472 Y6.982
+G1 X38.280 Y7.966
+G1 X38.063 Y8.945
+G1 X37.821 Y9.918
+G1 X37.554 Y10.884
+G1 X37.263 Y11.844
+G1 X36.947 Y12.796
+G1 X36.607 Y13.739
+G1 X36.242 Y14.673
+G1 X35.854 Y15.597
+G1 X35.443 Y16.512
+G1 X35.007 Y17.415
+G1 X34.549 Y18.307
+G1 X34.069 Y19.187
+G1 X33.565 Y20.054
+G1 X33.040 Y20.908
+G1 X32.493 Y21.749
+G1 X31.925 Y22.575
+G1 X31.335 Y23.386
+G1 X30.725 Y24.182
+G1 X30.095 Y24.962
+G1 X29.445 Y25.725
+G1 X28.776 Y26.472
+G1 X28.087 Y27.201
+G1 X27.381 Y27.912
+G1 X26.656 Y28.605
+G1 X25.914 Y29.280
+G1 X25.154 Y29.934
+G1 X24.378 Y30.570
+G1 X23.587 Y31.185
+G1 X22.779 Y31.779
+G1 X21.957 Y32.353
+G1 X21.120 Y32.905
+G1 X20.269 Y33.436
+G1 X19.405 Y33.945
+G1 X18.528 Y34.431
+G1 X17.639 Y34.895
+G1 X16.739 Y35.336
+G1 X15.827 Y35.754
+G1 X14.905 Y36.148
+G1 X13.973 Y36.518
+G1 X13.032 Y36.864
+G1 X12.083 Y37.186
+G1 X11.125 Y37.484
+G1 X10.160 Y37.757
+G1 X9.189 Y38.005
+G1 X8.211 Y38.228
+G1 X7.228 Y38.426
+G1 X6.240 Y38.599
+G1 X5.249 Y38.746
+G1 X4.253 Y38.868
+G1 X3.255 Y38.964
+G1 X2.255 Y39.035
+G1 X1.253 Y39.080
+G1 X0.251 Y39.099
+G1 X-0.752 Y39.093
+G1 X-1.754 Y39.061
+G1 X-2.755 Y39.003
+G1 X-3.755 Y38.919
+G1 X-4.751 Y38.810
+G1 X-5.745 Y38.676
+G1 X-6.735 Y38.516
+G1 X-7.720 Y38.330
+G1 X-8.701 Y38.120
+G1 X-9.675 Y37.884
+G1 X-10.643 Y37.623
+G1 X-11.605 Y37.338
+G1 X-12.558 Y37.028
+G1 X-13.504 Y36.694
+G1 X-14.440 Y36.336
+G1 X-15.367 Y35.954
+G1 X-16.284 Y35.548
+G1 X-17.190 Y35.118
+G1 X-18.085 Y34.666
+G1 X-18.968 Y34.191
+G1 X-19.839 Y33.693
+G1 X-20.696 Y33.173
+G1 X-21.540 Y32.632
+G1 X-22.370 Y32.069
+G1 X-23.185 Y31.485
+G1 X-23.984 Y30.880
+G1 X-24.768 Y30.255
+G1 X-25.536 Y29.609
+G1 X-26.287 Y28.945
+G1 X-27.021 Y28.261
+G1 X-27.736 Y27.559
+G1 X-28.434 Y26.839
+G1 X-29.113 Y26.101
+G1 X-29.773 Y25.346
+G1 X-30.413 Y24.574
+G1 X-31.033 Y23.786
+G1 X-31.633 Y22.982
+G1 X-32.211 Y22.164
+G1 X-32.769 Y21.330
+G1 X-33.305 Y20.483
+G1 X-33.820 Y19.622
+G1 X-34.312 Y18.749
+G1 X-34.781 Y17.863
+G1 X-35.228 Y16.965
+G1 X-35.651 Y16.056
+G1 X-36.051 Y15.136
+G1 X-36.428 Y14.207
+G1 X-36.780 Y13.268
+G1 X-37.108 Y12.321
+G1 X-37.412 Y11.365
+G1 X-37.691 Y10.402
+G1 X-37.945 Y9.432
+G1 X-38.175 Y8.456
+G1 X-38.379 Y7.474
+G1 X-38.558 Y6.488
+G1 X-38.712 Y5.497
+G1 X-38.840 Y4.502
+G1 X-38.943 Y3.505
+G1 X-39.020 Y2.505
+G1 X-39.071 Y1.504
+G1 X-39.097 Y0.501
+G1 X-39.097 Y-0.501
+G1 X-39.071 Y-1.504
+G1 X-39.020 Y-2.505
+G1 X-38.943 Y-3.505
+G1 X-38.840 Y-4.502
+G1 X-38.712 Y-5.497
+G1 X-38.558 Y-6.488
+G1 X-38.379 Y-7.474
+G1 X-38.175 Y-8.456
+G1 X-37.945 Y-9.432
+G1 X-37.691 Y-10.402
+G1 X-37.412 Y-11.365
+G1 X-37.108 Y-12.321
+G1 X-36.780 Y-13.268
+G1 X-36.428 Y-14.207
+G1 X-36.051 Y-15.136
+G1 X-35.651 Y-16.056
+G1 X-35.228 Y-16.965
+G1 X-34.781 Y-17.863
+G1 X-34.312 Y-18.749
+G1 X-33.820 Y-19.622
+G1 X-33.305 Y-20.483
+G1 X-32.769 Y-21.330
+G1 X-32.211 Y-22.164
+G1 X-31.633 Y-22.982
+G1 X-31.033 Y-23.786
+G1 X-30.413 Y-24.574
+G1 X-29.773 Y-25.346
+G1 X-29.113 Y-26.101
+G1 X-28.434 Y-26.839
+G1 X-27.736 Y-27.559
+G1 X-27.021 Y-28.261
+G1 X-26.287 Y-28.945
+G1 X-25.536 Y-29.609
+G1 X-24.768 Y-30.255
+G1 X-23.984 Y-30.880
+G1 X-23.185 Y-31.485
+G1 X-22.370 Y-32.069
+G1 X-21.540 Y-32.632
+G1 X-20.696 Y-33.173
+G1 X-19.839 Y-33.693
+G1 X-18.968 Y-34.191
+G1 X-18.085 Y-34.666
+G1 X-17.190 Y-35.118
+G1 X-16.284 Y-35.548
+G1 X-15.367 Y-35.954
+G1 X-14.440 Y-36.336
+G1 X-13.504 Y-36.694
+G1 X-12.558 Y-37.028
+G1 X-11.605 Y-37.338
+G1 X-10.643 Y-37.623
+G1 X-9.675 Y-37.884
+G1 X-8.701 Y-38.120
+G1 X-7.720 Y-38.330
+G1 X-6.735 Y-38.516
+G1 X-5.745 Y-38.676
+G1 X-4.751 Y-38.810
+G1 X-3.755 Y-38.919
+G1 X-2.755 Y-39.003
+G1 X-1.754 Y-39.061
+G1 X-0.752 Y-39.093
+G1 X0.251 Y-39.099
+G1 X1.253 Y-39.080
+G1 X2.255 Y-39.035
+G1 X3.255 Y-38.964
+G1 X4.253 Y-38.868
+G1 X5.249 Y-38.746
+G1 X6.240 Y-38.599
+G1 X7.228 Y-38.426
+G1 X8.211 Y-38.228
+G1 X9.189 Y-38.005
+G1 X10.160 Y-37.757
+G1 X11.125 Y-37.484
+G1 X12.083 Y-37.186
+G1 X13.032 Y-36.864
+G1 X13.973 Y-36.518
+G1 X14.905 Y-36.148
+G1 X15.827 Y-35.754
+G1 X16.739 Y-35.336
+G1 X17.639 Y-34.895
+G1 X18.528 Y-34.431
+G1 X19.405 Y-33.945
+G1 X20.269 Y-33.436
+G1 X21.120 Y-32.905
+G1 X21.957 Y-32.353
+G1 X22.779 Y-31.779
+G1 X23.587 Y-31.185
+G1 X24.378 Y-30.570
+G1 X25.154 Y-29.934
+G1 X25.914 Y-29.280
+G1 X26.656 Y-28.605
+G1 X27.381 Y-27.912
+G1 X28.087 Y-27.201
+G1 X28.776 Y-26.472
+G1 X29.445 Y-25.725
+G1 X30.095 Y-24.962
+G1 X30.725 Y-24.182
+G1 X31.335 Y-23.386
+G1 X31.925 Y-22.575
+G1 X32.493 Y-21.749
+G1 X33.040 Y-20.908
+G1 X33.565 Y-20.054
+G1 X34.069 Y-19.187
+G1 X34.549 Y-18.307
+G1 X35.007 Y-17.415
+G1 X35.443 Y-16.512
+G1 X35.854 Y-15.597
+G1 X36.242 Y-14.673
+G1 X36.607 Y-13.739
+G1 X36.947 Y-12.796
+G1 X37.263 Y-11.844
+G1 X37.554 Y-10.884
+G1 X37.821 Y-9.918
+G1 X38.063 Y-8.945
+G1 X38.280 Y-7.966
+G1 X38.472 Y-6.982
+G1 X38.638 Y-5.993
+G1 X38.779 Y-5.000
+G1 X38.894 Y-4.004
+G1 X38.984 Y-3.005
+G1 X39.049 Y-2.005
+G1 X39.087 Y-1.003
+G1 X39.100 Y-0.000
+G1 F4800
+G0 X20.352 Y-32.681 F9000
+G1 X32.681 Y-20.352 F4800
+G0 X35.638 Y-14.567 F9000
+G1 X14.567 Y-35.638 F4800
+G0 X10.272 Y-37.104 F9000
+G1 X37.104 Y-10.272 F4800
+G0 X37.926 Y-6.621 F9000
+G1 X6.621 Y-37.926 F4800
+G0 X3.367 Y-38.353 F9000
+G1 X38.353 Y-3.367 F4800
+G0 X38.498 Y-0.393 F9000
+G1 X0.393 Y-38.498 F4800
+G0 X-2.365 Y-38.427 F9000
+G1 X38.427 Y2.365 F4800
+G0 X38.181 Y4.947 F9000
+G1 X-4.947 Y-38.181 F4800
+G0 X-7.380 Y-37.786 F9000
+G1 X37.786 Y7.380 F4800
+G0 X37.262 Y9.685 F9000
+G1 X-9.685 Y-37.262 F4800
+G0 X-11.874 Y-36.623 F9000
+G1 X36.623 Y11.874 F4800
+G0 X35.880 Y13.960 F9000
+G1 X-13.960 Y-35.880 F4800
+G0 X-15.949 Y-35.041 F9000
+G1 X35.041 Y15.949 F4800
+G0 X34.112 Y17.849 F9000
+G1 X-17.849 Y-34.112 F4800
+G0 X-19.664 Y-33.099 F9000
+G1 X33.099 Y19.664 F4800
+G0 X32.005 Y21.399 F9000
+G1 X-21.399 Y-32.005 F4800
+G0 X-23.055 Y-30.833 F9000
+G1 X30.833 Y23.055 F4800
+G0 X29.586 Y24.636 F9000
+G1 X-24.636 Y-29.586 F4800
+G0 X-26.142 Y-28.264 F9000
+G1 X28.264 Y26.142 F4800
+G0 X26.868 Y27.575 F9000
+G1 X-27.575 Y-26.868 F4800
+G0 X-28.934 Y-25.398 F9000
+G1 X25.398 Y28.934 F4800
+G0 X23.855 Y30.219 F9000
+G1 X-30.219 Y-23.855 F4800
+G0 X-31.429 Y-22.237 F9000
+G1 X22.237 Y31.429 F4800
+G0 X20.541 Y32.562 F9000
+G1 X-32.562 Y-20.541 F4800
+G0 X-33.616 Y-18.767 F9000
+G1 X18.767 Y33.616 F4800
+G0 X16.910 Y34.588 F9000
+G1 X-34.588 Y-16.910 F4800
+G0 X-35.472 Y-14.966 F9000
+G1 X14.966 Y35.472 F4800
+G0 X12.929 Y36.264 F9000
+G1 X-36.264 Y-12.929 F4800
+G0 X-36.956 Y-10.793 F9000
+G1 X10.793 Y36.956 F4800
+G0 X8.548 Y37.539 F9000
+G1 X-37.539 Y-8.548 F4800
+G0 X-38.001 Y-6.181 F9000
+G1 X6.181 Y38.001 F4800
+G0 X3.676 Y38.324 F9000
+G1 X-38.324 Y-3.676 F4800
+G0 X-38.487 Y-1.010 F9000
+G1 X1.010 Y38.487 F4800
+G0 X-1.850 Y38.456 F9000
+G1 X-38.456 Y1.850 F4800
+G0 X-38.180 Y4.954 F9000
+G1 X-4.954 Y38.180 F4800
+G0 X-8.386 Y37.575 F9000
+G1 X-37.575 Y8.386 F4800
+G0 X-36.478 Y12.312 F9000
+G1 X-12.312 Y36.478 F4800
+G0 X-17.149 Y34.470 F9000
+G1 X-34.470 Y17.149 F4800
+G1 Z0.60 F6000
+G0 X40.000 Y0 F9000
+G1 F2400
+G1 X39.987 Y1.001
+G1 X39.950 Y2.002
+G1 X39.887 Y3.001
+G1 X39.800 Y3.999
+G1 X39.687 Y4.993
+G1 X39.550 Y5.985
+G1 X39.387 Y6.973
+G1 X39.201 Y7.957
+G1 X38.989 Y8.936
+G1 X38.753 Y9.909
+G1 X38.493 Y10.876
+G1 X38.209 Y11.836
+G1 X37.901 Y12.788
+G1 X37.569 Y13.733
+G1 X37.213 Y14.669
+G1 X36.834 Y15.596
+G1 X36.432 Y16.513
+G1 X36.008 Y17.420
+G1 X35.560 Y18.316
+G1 X35.091 Y19.200
+G1 X34.599 Y20.072
+G1 X34.086 Y20.932
+G1 X33.551 Y21.779
+G1 X32.996 Y22.612
+G1 X32.419 Y23.430
+G1 X31.823 Y24.234
+G1 X31.206 Y25.023
+G1 X30.570 Y25.797
+G1 X29.915 Y26.554
+G1 X29.241 Y27.294
+G1 X28.549 Y28.018
+G1 X27.838 Y28.723
+G1 X27.111 Y29.411
+G1 X26.366 Y30.080
+G1 X25.605 Y30.731
+G1 X24.828 Y31.362
+G1 X24.035 Y31.974
+G1 X23.227 Y32.565
+G1 X22.405 Y33.137
+G1 X21.568 Y33.687
+G1 X20.718 Y34.216
+G1 X19.855 Y34.724
+G1 X18.980 Y35.210
+G1 X18.093 Y35.674
+G1 X17.194 Y36.116
+G1 X16.285 Y36.535
+G1 X15.365 Y36.931
+G1 X14.436 Y37.304
+G1 X13.498 Y37.654
+G1 X12.551 Y37.980
+G1 X11.596 Y38.282
+G1 X10.635 Y38.560
+G1 X9.666 Y38.815
+G1 X8.692 Y39.044
+G1 X7.712 Y39.250
+G1 X6.727 Y39.430
+G1 X5.738 Y39.586
+G1 X4.745 Y39.718
+G1 X3.749 Y39.824
+G1 X2.751 Y39.905
+G1 X1.752 Y39.962
+G1 X0.751 Y39.993
+G1 X-0.250 Y39.999
+G1 X-1.251 Y39.980
+G1 X-2.252 Y39.937
+G1 X-3.251 Y39.868
+G1 X-4.248 Y39.774
+G1 X-5.242 Y39.655
+G1 X-6.233 Y39.511
+G1 X-7.220 Y39.343
+G1 X-8.202 Y39.150
+G1 X-9.180 Y38.932
+G1 X-10.151 Y38.690
+G1 X-11.116 Y38.424
+G1 X-12.075 Y38.134
+G1 X-13.025 Y37.820
+G1 X-13.968 Y37.482
+G1 X-14.902 Y37.121
+G1 X-15.826 Y36.736
+G1 X-16.741 Y36.328
+G1 X-17.645 Y35.898
+G1 X-18.538 Y35.445
+G1 X-19.419 Y34.970
+G1 X-20.288 Y34.473
+G1 X-21.145 Y33.954
+G1 X-21.988 Y33.414
+G1 X-22.818 Y32.854
+G1 X-23.633 Y32.272
+G1 X-24.433 Y31.671
+G1 X-25.218 Y31.049
+G1 X-25.987 Y30.408
+G1 X-26.740 Y29.748
+G1 X-27.477 Y29.069
+G1 X-28.196 Y28.373
+G1 X-28.897 Y27.658
+G1 X-29.580 Y26.926
+G1 X-30.245 Y26.177
+G1 X-30.891 Y25.412
+G1 X-31.517 Y24.631
+G1 X-32.124 Y23.834
+G1 X-32.710 Y23.023
+G1 X-33.276 Y22.197
+G1 X-33.821 Y21.357
+G1 X-34.345 Y20.504
+G1 X-34.848 Y19.638
+G1 X-35.328 Y18.759
+G1 X-35.787 Y17.869
+G1 X-36.223 Y16.968
+G1 X-36.636 Y16.056
+G1 X-37.027 Y15.134
+G1 X-37.394 Y14.202
+G1 X-37.738 Y13.262
+G1 X-38.058 Y12.313
+G1 X-38.354 Y11.357
+G1 X-38.626 Y10.393
+G1 X-38.874 Y9.423
+G1 X-39.098 Y8.447
+G1 X-39.297 Y7.466
+G1 X-39.472 Y6.480
+G1 X-39.621 Y5.490
+G1 X-39.746 Y4.496
+G1 X-39.847 Y3.500
+G1 X-39.922 Y2.502
+G1 X-39.972 Y1.502
+G1 X-39.997 Y0.501
+G1 X-39.997 Y-0.501
+G1 X-39.972 Y-1.502
+G1 X-39.922 Y-2.502
+G1 X-39.847 Y-3.500
+G1 X-39.746 Y-4.496
+G1 X-39.621 Y-5.490
+G1 X-39.472 Y-6.480
+G1 X-39.297 Y-7.466
+G1 X-39.098 Y-8.447
+G1 X-38.874 Y-9.423
+G1 X-38.626 Y-10.393
+G1 X-38.354 Y-11.357
+G1 X-38.058 Y-12.313
+G1 X-37.738 Y-13.262
+G1 X-37.394 Y-14.202
+G1 X-37.027 Y-15.134
+G1 X-36.636 Y-16.056
+G1 X-36.223 Y-16.968
+G1 X-35.787 Y-17.869
+G1 X-35.328 Y-18.759
+G1 X-34.848 Y-19.638
+G1 X-34.345 Y-20.504
+G1 X-33.821 Y-21.357
+G1 X-33.276 Y-22.197
+G1 X-32.710 Y-23.023
+G1 X-32.124 Y-23.834
+G1 X-31.517 Y-24.631
+G1 X-30.891 Y-25.412
+G1 X-30.245 Y-26.177
+G1 X-29.580 Y-26.926
+G1 X-28.897 Y-27.658
+G1 X-28.196 Y-28.373
+G1 X-27.477 Y-29.069
+G1 X-26.740 Y-29.748
+G1 X-25.987 Y-30.408
+G1 X-25.218 Y-31.049
+G1 X-24.433 Y-31.671
+G1 X-23.633 Y-32.272
+G1 X-22.818 Y-32.854
+G1 X-21.988 Y-33.414
+G1 X-21.145 Y-33.954
+G1 X-20.288 Y-34.473
+G1 X-19.419 Y-34.970
+G1 X-18.538 Y-35.445
+G1 X-17.645 Y-35.898
+G1 X-16.741 Y-36.328
+G1 X-15.826 Y-36.736
+G1 X-14.902 Y-37.121
+G1 X-13.968 Y-37.482
+G1 X-13.025 Y-37.820
+G1 X-12.075 Y-38.134
+G1 X-11.116 Y-38.424
+G1 X-10.151 Y-38.690
+G1 X-9.180 Y-38.932
+G1 X-8.202 Y-39.150
+G1 X-7.220 Y-39.343
+G1 X-6.233 Y-39.511
+G1 X-5.242 Y-39.655
+G1 X-4.248 Y-39.774
+G1 X-3.251 Y-39.868
+G1 X-2.252 Y-39.937
+G1 X-1.251 Y-39.980
+G1 X-0.250 Y-39.999
+G1 X0.751 Y-39.993
+G1 X1.752 Y-39.962
+G1 X2.751 Y-39.905
+G1 X3.749 Y-39.824
+G1 X4.745 Y-39.718
+G1 X5.738 Y-39.586
+G1 X6.727 Y-39.430
+G1 X7.712 Y-39.250
+G1 X8.692 Y-39.044
+G1 X9.666 Y-38.815
+G1 X10.635 Y-38.560
+G1 X11.596 Y-38.282
+G1 X12.551 Y-37.980
+G1 X13.498 Y-37.654
+G1 X14.436 Y-37.304
+G1 X15.365 Y-36.931
+G1 X16.285 Y-36.535
+G1 X17.194 Y-36.116
+G1 X18.093 Y-35.674
+G1 X18.980 Y-35.210
+G1 X19.855 Y-34.724
+G1 X20.718 Y-34.216
+G1 X21.568 Y-33.687
+G1 X22.405 Y-33.137
+G1 X23.227 Y-32.565
+G1 X24.035 Y-31.974
+G1 X24.828 Y-31.362
+G1 X25.605 Y-30.731
+G1 X26.366 Y-30.080
+G1 X27.111 Y-29.411
+G1 X27.838 Y-28.723
+G1 X28.549 Y-28.018
+G1 X29.241 Y-27.294
+G1 X29.915 Y-26.554
+G1 X30.570 Y-25.797
+G1 X31.206 Y-25.023
+G1 X31.823 Y-24.234
+G1 X32.419 Y-23.430
+G1 X32.996 Y-22.612
+G1 X33.551 Y-21.779
+G1 X34.086 Y-20.932
+G1 X34.599 Y-20.072
+G1 X35.091 Y-19.200
+G1 X35.560 Y-18.316
+G1 X36.008 Y-17.420
+G1 X36.432 Y-16.513
+G1 X36.834 Y-15.596
+G1 X37.213 Y-14.669
+G1 X37.569 Y-13.733
+G1 X37.901 Y-12.788
+G1 X38.209 Y-11.836
+G1 X38.493 Y-10.876
+G1 X38.753 Y-9.909
+G1 X38.989 Y-8.936
+G1 X39.201 Y-7.957
+G1 X39.387 Y-6.973
+G1 X39.550 Y-5.985
+G1 X39.687 Y-4.993
+G1 X39.800 Y-3.999
+G1 X39.887 Y-3.001
+G1 X39.950 Y-2.002
+G1 X39.987 Y-1.001
+G1 X40.000 Y-0.000
+G0 X39.550 Y0 F9000
+G1 F2400
+G1 X39.537 Y1.002
+G1 X39.499 Y2.003
+G1 X39.436 Y3.003
+G1 X39.347 Y4.001
+G1 X39.233 Y4.997
+G1 X39.094 Y5.989
+G1 X38.930 Y6.977
+G1 X38.740 Y7.961
+G1 X38.526 Y8.940
+G1 X38.287 Y9.913
+G1 X38.024 Y10.880
+G1 X37.736 Y11.840
+G1 X37.424 Y12.792
+G1 X37.088 Y13.736
+G1 X36.728 Y14.671
+G1 X36.345 Y15.597
+G1 X35.938 Y16.512
+G1 X35.508 Y17.418
+G1 X35.056 Y18.312
+G1 X34.580 Y19.194
+G1 X34.083 Y20.064
+G1 X33.564 Y20.921
+G1 X33.023 Y21.764
+G1 X32.461 Y22.594
+G1 X31.878 Y23.409
+G1 X31.275 Y24.209
+G1 X30.652 Y24.993
+G1 X30.009 Y25.762
+G1 X29.347 Y26.514
+G1 X28.666 Y27.249
+G1 X27.966 Y27.966
+G1 X27.249 Y28.666
+G1 X26.514 Y29.347
+G1 X25.762 Y30.009
+G1 X24.993 Y30.652
+G1 X24.209 Y31.275
+G1 X23.409 Y31.878
+G1 X22.594 Y32.461
+G1 X21.764 Y33.023
+G1 X20.921 Y33.564
+G1 X20.064 Y34.083
+G1 X19.194 Y34.580
+G1 X18.312 Y35.056
+G1 X17.418 Y35.508
+G1 X16.512 Y35.938
+G1 X15.597 Y36.345
+G1 X14.671 Y36.728
+G1 X13.736 Y37.088
+G1 X12.792 Y37.424
+G1 X11.840 Y37.736
+G1 X10.880 Y38.024
+G1 X9.913 Y38.287
+G1 X8.940 Y38.526
+G1 X7.961 Y38.740
+G1 X6.977 Y38.930
+G1 X5.989 Y39.094
+G1 X4.997 Y39.233
+G1 X4.001 Y39.347
+G1 X3.003 Y39.436
+G1 X2.003 Y39.499
+G1 X1.002 Y39.537
+G1 X0.000 Y39.550
+G1 X-1.002 Y39.537
+G1 X-2.003 Y39.499
+G1 X-3.003 Y39.436
+G1 X-4.001 Y39.347
+G1 X-4.997 Y39.233
+G1 X-5.989 Y39.094
+G1 X-6.977 Y38.930
+G1 X-7.961 Y38.740
+G1 X-8.940 Y38.526
+G1 X-9.913 Y38.287
+G1 X-10.880 Y38.024
+G1 X-11.840 Y37.736
+G1 X-12.792 Y37.424
+G1 X-13.736 Y37.088
+G1 X-14.671 Y36.728
+G1 X-15.597 Y36.345
+G1 X-16.512 Y35.938
+G1 X-17.418 Y35.508
+G1 X-18.312 Y35.056
+G1 X-19.194 Y34.580
+G1 X-20.064 Y34.083
+G1 X-20.921 Y33.564
+G1 X-21.764 Y33.023
+G1 X-22.594 Y32.461
+G1 X-23.409 Y31.878
+G1 X-24.209 Y31.275
+G1 X-24.993 Y30.652
+G1 X-25.762 Y30.009
+G1 X-26.514 Y29.347
+G1 X-27.249 Y28.666
+G1 X-27.966 Y27.966
+G1 X-28.666 Y27.249
+G1 X-29.347 Y26.514
+G1 X-30.009 Y25.762
+G1 X-30.652 Y24.993
+G1 X-31.275 Y24.209
+G1 X-31.878 Y23.409
+G1 X-32.461 Y22.594
+G1 X-33.023 Y21.764
+G1 X-33.564 Y20.921
+G1 X-34.083 Y20.064
+G1 X-34.580 Y19.194
+G1 X-35.056 Y18.312
+G1 X-35.508 Y17.418
+G1 X-35.938 Y16.512
+G1 X-36.345 Y15.597
+G1 X-36.728 Y14.671
+G1 X-37.088 Y13.736
+G1 X-37.424 Y12.792
+G1 X-37.736 Y11.840
+G1 X-38.024 Y10.880
+G1 X-38.287 Y9.913
+G1 X-38.526 Y8.940
+G1 X-38.740 Y7.961
+G1 X-38.930 Y6.977
+G1 X-39.094 Y5.989
+G1 X-39.233 Y4.997
+G1 X-39.347 Y4.001
+G1 X-39.436 Y3.003
+G1 X-39.499 Y2.003
+G1 X-39.537 Y1.002
+G1 X-39.550 Y0.000
+G1 X-39.537 Y-1.002
+G1 X-39.499 Y-2.003
+G1 X-39.436 Y-3.003
+G1 X-39.347 Y-4.001
+G1 X-39.233 Y-4.997
+G1 X-39.094 Y-5.989
+G1 X-38.930 Y-6.977
+G1 X-38.740 Y-7.961
+G1 X-38.526 Y-8.940
+G1 X-38.287 Y-9.913
+G1 X-38.024 Y-10.880
+G1 X-37.736 Y-11.840
+G1 X-37.424 Y-12.792
+G1 X-37.088 Y-13.736
+G1 X-36.728 Y-14.671
+G1 X-36.345 Y-15.597
+G1 X-35.938 Y-16.512
+G1 X-35.508 Y-17.418
+G1 X-35.056 Y-18.312
+G1 X-34.580 Y-19.194
+G1 X-34.083 Y-20.064
+G1 X-33.564 Y-20.921
+G1 X-33.023 Y-21.764
+G1 X-32.461 Y-22.594
+G1 X-31.878 Y-23.409
+G1 X-31.275 Y-24.209
+G1 X-30.652 Y-24.993
+G1 X-30.009 Y-25.762
+G1 X-29.347 Y-26.514
+G1 X-28.666 Y-27.249
+G1 X-27.966 Y-27.966
+G1 X-27.249 Y-28.666
+G1 X-26.514 Y-29.347
+G1 X-25.762 Y-30.009
+G1 X-24.993 Y-30.652
+G1 X-24.209 Y-31.275
+G1 X-23.409 Y-31.878
+G1 X-22.594 Y-32.461
+G1 X-21.764 Y-33.023
+G1 X-20.921 Y-33.564
+G1 X-20.064 Y-34.083
+G1 X-19.194 Y-34.580
+G1 X-18.312 Y-35.056
+G1 X-17.418 Y-35.508
+G1 X-16.512 Y-35.938
+G1 X-15.597 Y-36.345
+G1 X-14.671 Y-36.728
+G1 X-13.736 Y-37.088
+G1 X-12.792 Y-37.424
+G1 X-11.840 Y-37.736
+G1 X-10.880 Y-38.024
+G1 X-9.913 Y-38.287
+G1 X-8.940 Y-38.526
+G1 X-7.961 Y-38.740
+G1 X-6.977 Y-38.930
+G1 X-5.989 Y-39.094
+G1 X-4.997 Y-39.233
+G1 X-4.001 Y-39.347
+G1 X-3.003 Y-39.436
+G1 X-2.003 Y-39.499
+G1 X-1.002 Y-39.537
+G1 X-0.000 Y-39.550
+G1 X1.002 Y-39.537
+G1 X2.003 Y-39.499
+G1 X3.003 Y-39.436
+G1 X4.001 Y-39.347
+G1 X4.997 Y-39.233
+G1 X5.989 Y-39.094
+G1 X6.977 Y-38.930
+G1 X7.961 Y-38.740
+G1 X8.940 Y-38.526
+G1 X9.913 Y-38.287
+G1 X10.880 Y-38.024
+G1 X11.840 Y-37.736
+G1 X12.792 Y-37.424
+G1 X13.736 Y-37.088
+G1 X14.671 Y-36.728
+G1 X15.597 Y-36.345
+G1 X16.512 Y-35.938
+G1 X17.418 Y-35.508
+G1 X18.312 Y-35.056
+G1 X19.194 Y-34.580
+G1 X20.064 Y-34.083
+G1 X20.921 Y-33.564
+G1 X21.764 Y-33.023
+G1 X22.594 Y-32.461
+G1 X23.409 Y-31.878
+G1 X24.209 Y-31.275
+G1 X24.993 Y-30.652
+G1 X25.762 Y-30.009
+G1 X26.514 Y-29.347
+G1 X27.249 Y-28.666
+G1 X27.966 Y-27.966
+G1 X28.666 Y-27.249
+G1 X29.347 Y-26.514
+G1 X30.009 Y-25.762
+G1 X30.652 Y-24.993
+G1 X31.275 Y-24.209
+G1 X31.878 Y-23.409
+G1 X32.461 Y-22.594
+G1 X33.023 Y-21.764
+G1 X33.564 Y-20.921
+G1 X34.083 Y-20.064
+G1 X34.580 Y-19.194
+G1 X35.056 Y-18.312
+G1 X35.508 Y-17.418
+G1 X35.938 Y-16.512
+G1 X36.345 Y-15.597
+G1 X36.728 Y-14.671
+G1 X37.088 Y-13.736
+G1 X37.424 Y-12.792
+G1 X37.736 Y-11.840
+G1 X38.024 Y-10.880
+G1 X38.287 Y-9.913
+G1 X38.526 Y-8.940
+G1 X38.740 Y-7.961
+G1 X38.930 Y-6.977
+G1 X39.094 Y-5.989
+G1 X39.233 Y-4.997
+G1 X39.347 Y-4.001
+G1 X39.436 Y-3.003
+G1 X39.499 Y-2.003
+G1 X39.537 Y-1.002
+G1 X39.550 Y-0.000
+G0 X39.100 Y0 F9000
+G1 F2400
+G1 X39.087 Y1.003
+G1 X39.049 Y2.005
+G1 X38.984 Y3.005
+G1 X38.894 Y4.004
+G1 X38.779 Y5.000
+G1 X38.638 Y5.993
+G1 X38.472 Y6.982
+G1 X38.280 Y7.966
+G1 X38.063 Y8.945
+G1 X37.821 Y9.918
+G1 X37.554 Y10.884
+G1 X37.263 Y11.844
+G1 X36.947 Y12.796
+G1 X36.607 Y13.739
+G1 X36.242 Y14.673
+G1 X35.854 Y15.597
+G1 X35.443 Y16.512
+G1 X35.007 Y17.415
+G1 X34.549 Y18.307
+G1 X34.069 Y19.187
+G1 X33.565 Y20.054
+G1 X33.040 Y20.908
+G1 X32.493 Y21.749
+G1 X31.925 Y22.575
+G1 X31.335 Y23.386
+G1 X30.725 Y24.182
+G1 X30.095 Y24.962
+G1 X29.445 Y25.725
+G1 X28.776 Y26.472
+G1 X28.087 Y27.201
+G1 X27.381 Y27.912
+G1 X26.656 Y28.605
+G1 X25.914 Y29.280
+G1 X25.154 Y29.934
+G1 X24.378 Y30.570
+G1 X23.587 Y31.185
+G1 X22.779 Y31.779
+G1 X21.957 Y32.353
+G1 X21.120 Y32.905
+G1 X20.269 Y33.436
+G1 X19.405 Y33.945
+G1 X18.528 Y34.431
+G1 X17.639 Y34.895
+G1 X16.739 Y35.336
+G1 X15.827 Y35.754
+G1 X14.905 Y36.148
+G1 X13.973 Y36.518
+G1 X13.032 Y36.864
+G1 X12.083 Y37.186
+G1 X11.125 Y37.484
+G1 X10.160 Y37.757
+G1 X9.189 Y38.005
+G1 X8.211 Y38.228
+G1 X7.228 Y38.426
+G1 X6.240 Y38.599
+G1 X5.249 Y38.746
+G1 X4.253 Y38.868
+G1 X3.255 Y38.964
+G1 X2.255 Y39.035
+G1 X1.253 Y39.080
+G1 X0.251 Y39.099
+G1 X-0.752 Y39.093
+G1 X-1.754 Y39.061
+G1 X-2.755 Y39.003
+G1 X-3.755 Y38.919
+G1 X-4.751 Y38.810
+G1 X-5.745 Y38.676
+G1 X-6.735 Y38.516
+G1 X-7.720 Y38.330
+G1 X-8.701 Y38.120
+G1 X-9.675 Y37.884
+G1 X-10.643 Y37.623
+G1 X-11.605 Y37.338
+G1 X-12.558 Y37.028
+G1 X-13.504 Y36.694
+G1 X-14.440 Y36.336
+G1 X-15.367 Y35.954
+G1 X-16.284 Y35.548
+G1 X-17.190 Y35.118
+G1 X-18.085 Y34.666
+G1 X-18.968 Y34.191
+G1 X-19.839 Y33.693
+G1 X-20.696 Y33.173
+G1 X-21.540 Y32.632
+G1 X-22.370 Y32.069
+G1 X-23.185 Y31.485
+G1 X-23.984 Y30.880
+G1 X-24.768 Y30.255
+G1 X-25.536 Y29.609
+G1 X-26.287 Y28.945
+G1 X-27.021 Y28.261
+G1 X-27.736 Y27.559
+G1 X-28.434 Y26.839
+G1 X-29.113 Y26.101
+G1 X-29.773 Y25.346
+G1 X-30.413 Y24.574
+G1 X-31.033 Y23.786
+G1 X-31.633 Y22.982
+G1 X-32.211 Y22.164
+G1 X-32.769 Y21.330
+G1 X-33.305 Y20.483
+G1 X-33.820 Y19.622
+G1 X-34.312 Y18.749
+G1 X-34.781 Y17.863
+G1 X-35.228 Y16.965
+G1 X-35.651 Y16.056
+G1 X-36.051 Y15.136
+G1 X-36.428 Y14.207
+G1 X-36.780 Y13.268
+G1 X-37.108 Y12.321
+G1 X-37.412 Y11.365
+G1 X-37.691 Y10.402
+G1 X-37.945 Y9.432
+G1 X-38.175 Y8.456
+G1 X-38.379 Y7.474
+G1 X-38.558 Y6.488
+G1 X-38.712 Y5.497
+G1 X-38.840 Y4.502
+G1 X-38.943 Y3.505
+G1 X-39.020 Y2.505
+G1 X-39.071 Y1.504
+G1 X-39.097 Y0.501
+G1 X-39.097 Y-0.501
+G1 X-39.071 Y-1.504
+G1 X-39.020 Y-2.505
+G1 X-38.943 Y-3.505
+G1 X-38.840 Y-4.502
+G1 X-38.712 Y-5.497
+G1 X-38.558 Y-6.488
+G1 X-38.379 Y-7.474
+G1 X-38.175 Y-8.456
+G1 X-37.945 Y-9.432
+G1 X-37.691 Y-10.402
+G1 X-37.412 Y-11.365
+G1 X-37.108 Y-12.321
+G1 X-36.780 Y-13.268
+G1 X-36.428 Y-14.207
+G1 X-36.051 Y-15.136
+G1 X-35.651 Y-16.056
+G1 X-35.228 Y-16.965
+G1 X-34.781 Y-17.863
+G1 X-34.312 Y-18.749
+G1 X-33.820 Y-19.622
+G1 X-33.305 Y-20.483
+G1 X-32.769 Y-21.330
+G1 X-32.211 Y-22.164
+G1 X-31.633 Y-22.982
+G1 X-31.033 Y-23.786
+G1 X-30.413 Y-24.574
+G1 X-29.773 Y-25.346
+G1 X-29.113 Y-26.101
+G1 X-28.434 Y-26.839
+G1 X-27.736 Y-27.559
+G1 X-27.021 Y-28.261
+G1 X-26.287 Y-28.945
+G1 X-25.536 Y-29.609
+G1 X-24.768 Y-30.255
+G1 X-23.984 Y-30.880
+G1 X-23.185 Y-31.485
+G1 X-22.370 Y-32.069
+G1 X-21.540 Y-32.632
+G1 X-20.696 Y-33.173
+G1 X-19.839 Y-33.693
+G1 X-18.968 Y-34.191
+G1 X-18.085 Y-34.666
+G1 X-17.190 Y-35.118
+G1 X-16.284 Y-35.548
+G1 X-15.367 Y-35.954
+G1 X-14.440 Y-36.336
+G1 X-13.504 Y-36.694
+G1 X-12.558 Y-37.028
+G1 X-11.605 Y-37.338
+G1 X-10.643 Y-37.623
+G1 X-9.675 Y-37.884
+G1 X-8.701 Y-38.120
+G1 X-7.720 Y-38.330
+G1 X-6.735 Y-38.516
+G1 X-5.745 Y-38.676
+G1 X-4.751 Y-38.810
+G1 X-3.755 Y-38.919
+G1 X-2.755 Y-39.003
+G1 X-1.754 Y-39.061
+G1 X-0.752 Y-39.093
+G1 X0.251 Y-39.099
+G1 X1.253 Y-39.080
+G1 X2.255 Y-39.035
+G1 X3.255 Y-38.964
+G1 X4.253 Y-38.868
+G1 X5.249 Y-38.746
+G1 X6.240 Y-38.599
+G1 X7.228 Y-38.426
+G1 X8.211 Y-38.228
+G1 X9.189 Y-38.005
+G1 X10.160 Y-37.757
+G1 X11.125 Y-37.484
+G1 X12.083 Y-37.186
+G1 X13.032 Y-36.864
+G1 X13.973 Y-36.518
+G1 X14.905 Y-36.148
+G1 X15.827 Y-35.754
+G1 X16.739 Y-35.336
+G1 X17.639 Y-34.895
+G1 X18.528 Y-34.431
+G1 X19.405 Y-33.945
+G1 X20.269 Y-33.436
+G1 X21.120 Y-32.905
+G1 X21.957 Y-32.353
+G1 X22.779 Y-31.779
+G1 X23.587 Y-31.185
+G1 X24.378 Y-30.570
+G1 X25.154 Y-29.934
+G1 X25.914 Y-29.280
+G1 X26.656 Y-28.605
+G1 X27.381 Y-27.912
+G1 X28.087 Y-27.201
+G1 X28.776 Y-26.472
+G1 X29.445 Y-25.725
+G1 X30.095 Y-24.962
+G1 X30.725 Y-24.182
+G1 X31.335 Y-23.386
+G1 X31.925 Y-22.575
+G1 X32.493 Y-21.749
+G1 X33.040 Y-20.908
+G1 X33.565 Y-20.054
+G1 X34.069 Y-19.187
+G1 X34.549 Y-18.307
+G1 X35.007 Y-17.415
+G1 X35.443 Y-16.512
+G1 X35.854 Y-15.597
+G1 X36.242 Y-14.673
+G1 X36.607 Y-13.739
+G1 X36.947 Y-12.796
+G1 X37.263 Y-11.844
+G1 X37.554 Y-10.884
+G1 X37.821 Y-9.918
+G1 X38.063 Y-8.945
+G1 X38.280 Y-7.966
+G1 X38.472 Y-6.982
+G1 X38.638 Y-5.993
+G1 X38.779 Y-5.000
+G1 X38.894 Y-4.004
+G1 X38.984 Y-3.005
+G1 X39.049 Y-2.005
+G1 X39.087 Y-1.003
+G1 X39.100 Y-0.000
+G1 F4800
+G0 X20.352 Y-32.681 F9000
+G1 X32.681 Y-20.352 F4800
+G0 X35.638 Y-14.567 F9000
+G1 X14.567 Y-35.638 F4800
+G0 X10.272 Y-37.104 F9000
+G1 X37.104 Y-10.272 F4800
+G0 X37.926 Y-6.621 F9000
+G1 X6.621 Y-37.926 F4800
+G0 X3.367 Y-38.353 F9000
+G1 X38.353 Y-3.367 F4800
+G0 X38.498 Y-0.393 F9000
+G1 X0.393 Y-38.498 F4800
+G0 X-2.365 Y-38.427 F9000
+G1 X38.427 Y2.365 F4800
+G0 X38.181 Y4.947 F9000
+G1 X-4.947 Y-38.181 F4800
+G0 X-7.380 Y-37.786 F9000
+G1 X37.786 Y7.380 F4800
+G0 X37.262 Y9.685 F9000
+G1 X-9.685 Y-37.262 F4800
+G0 X-11.874 Y-36.623 F9000
+G1 X36.623 Y11.874 F4800
+G0 X35.880 Y13.960 F9000
+G1 X-13.960 Y-35.880 F4800
+G0 X-15.949 Y-35.041 F9000
+G1 X35.041 Y15.949 F4800
+G0 X34.112 Y17.849 F9000
+G1 X-17.849 Y-34.112 F4800
+G0 X-19.664 Y-33.099 F9000
+G1 X33.099 Y19.664 F4800
+G0 X32.005 Y21.399 F9000
+G1 X-21.399 Y-32.005 F4800
+G0 X-23.055 Y-30.833 F9000
+G1 X30.833 Y23.055 F4800
+G0 X29.586 Y24.636 F9000
+G1 X-24.636 Y-29.586 F4800
+G0 X-26.142 Y-28.264 F9000
+G1 X28.264 Y26.142 F4800
+G0 X26.868 Y27.575 F9000
+G1 X-27.575 Y-26.868 F4800
+G0 X-28.934 Y-25.398 F9000
+G1 X25.398 Y28.934 F4800
+G0 X23.855 Y30.219 F9000
+G1 X-30.219 Y-23.855 F4800
+G0 X-31.429 Y-22.237 F9000
+G1 X22.237 Y31.429 F4800
+G0 X20.541 Y32.562 F9000
+G1 X-32.562 Y-20.541 F4800
+G0 X-33.616 Y-18.767 F9000
+G1 X18.767 Y33.616 F4800
+G0 X16.910 Y34.588 F9000
+G1 X-34.588 Y-16.910 F4800
+G0 X-35.472 Y-14.966 F9000
+G1 X14.966 Y35.472 F4800
+G0 X12.929 Y36.264 F9000
+G1 X-36.264 Y-12.929 F4800
+G0 X-36.956 Y-10.793 F9000
+G1 X10.793 Y36.956 F4800
+G0 X8.548 Y37.539 F9000
+G1 X-37.539 Y-8.548 F4800
+G0 X-38.001 Y-6.181 F9000
+G1 X6.181 Y38.001 F4800
+G0 X3.676 Y38.324 F9000
+G1 X-38.324 Y-3.676 F4800
+G0 X-38.487 Y-1.010 F9000
+G1 X1.010 Y38.487 F4800
+G0 X-1.850 Y38.456 F9000
+G1 X-38.456 Y1.850 F4800
+G0 X-38.180 Y4.954 F9000
+G1 X-4.954 Y38.180 F4800
+G0 X-8.386 Y37.575 F9000
+G1 X-37.575 Y8.386 F4800
+G0 X-36.478 Y12.312 F9000
+G1 X-12.312 Y36.478 F4800
+G0 X-17.149 Y34.470 F9000
+G1 X-34.470 Y17.149 F4800
+G1 Z0.80 F6000
+G0 X40.000 Y0 F9000
+G1 F2400
+G1 X39.987 Y1.001
+G1 X39.950 Y2.002
+G1 X39.887 Y3.001
+G1 X39.800 Y3.999
+G1 X39.687 Y4.993
+G1 X39.550 Y5.985
+G1 X39.387 Y6.973
+G1 X39.201 Y7.957
+G1 X38.989 Y8.936
+G1 X38.753 Y9.909
+G1 X38.493 Y10.876
+G1 X38.209 Y11.836
+G1 X37.901 Y12.788
+G1 X37.569 Y13.733
+G1 X37.213 Y14.669
+G1 X36.834 Y15.596
+G1 X36.432 Y16.513
+G1 X36.008 Y17.420
+G1 X35.560 Y18.316
+G1 X35.091 Y19.200
+G1 X34.599 Y20.072
+G1 X34.086 Y20.932
+G1 X33.551 Y21.779
+G1 X32.996 Y22.612
+G1 X32.419 Y23.430
+G1 X31.823 Y24.234
+G1 X31.206 Y25.023
+G1 X30.570 Y25.797
+G1 X29.915 Y26.554
+G1 X29.241 Y27.294
+G1 X28.549 Y28.018
+G1 X27.838 Y28.723
+G1 X27.111 Y29.411
+G1 X26.366 Y30.080
+G1 X25.605 Y30.731
+G1 X24.828 Y31.362
+G1 X24.035 Y31.974
+G1 X23.227 Y32.565
+G1 X22.405 Y33.137
+G1 X21.568 Y33.687
+G1 X20.718 Y34.216
+G1 X19.855 Y34.724
+G1 X18.980 Y35.210
+G1 X18.093 Y35.674
+G1 X17.194 Y36.116
+G1 X16.285 Y36.535
+G1 X15.365 Y36.931
+G1 X14.436 Y37.304
+G1 X13.498 Y37.654
+G1 X12.551 Y37.980
+G1 X11.596 Y38.282
+G1 X10.635 Y38.560
+G1 X9.666 Y38.815
+G1 X8.692 Y39.044
+G1 X7.712 Y39.250
+G1 X6.727 Y39.430
+G1 X5.738 Y39.586
+G1 X4.745 Y39.718
+G1 X3.749 Y39.824
+G1 X2.751 Y39.905
+G1 X1.752 Y39.962
+G1 X0.751 Y39.993
+G1 X-0.250 Y39.999
+G1 X-1.251 Y39.980
+G1 X-2.252 Y39.937
+G1 X-3.251 Y39.868
+G1 X-4.248 Y39.774
+G1 X-5.242 Y39.655
+G1 X-6.233 Y39.511
+G1 X-7.220 Y39.343
+G1 X-8.202 Y39.150
+G1 X-9.180 Y38.932
+G1 X-10.151 Y38.690
+G1 X-11.116 Y38.424
+G1 X-12.075 Y38.134
+G1 X-13.025 Y37.820
+G1 X-13.968 Y37.482
+G1 X-14.902 Y37.121
+G1 X-15.826 Y36.736
+G1 X-16.741 Y36.328
+G1 X-17.645 Y35.898
+G1 X-18.538 Y35.445
+G1 X-19.419 Y34.970
+G1 X-20.288 Y34.473
+G1 X-21.145 Y33.954
+G1 X-21.988 Y33.414
+G1 X-22.818 Y32.854
+G1 X-23.633 Y32.272
+G1 X-24.433 Y31.671
+G1 X-25.218 Y31.049
+G1 X-25.987 Y30.408
+G1 X-26.740 Y29.748
+G1 X-27.477 Y29.069
+G1 X-28.196 Y28.373
+G1 X-28.897 Y27.658
+G1 X-29.580 Y26.926
+G1 X-30.245 Y26.177
+G1 X-30.891 Y25.412
+G1 X-31.517 Y24.631
+G1 X-32.124 Y23.834
+G1 X-32.710 Y23.023
+G1 X-33.276 Y22.197
+G1 X-33.821 Y21.357
+G1 X-34.345 Y20.504
+G1 X-34.848 Y19.638
+G1 X-35.328 Y18.759
+G1 X-35.787 Y17.869
+G1 X-36.223 Y16.968
+G1 X-36.636 Y16.056
+G1 X-37.027 Y15.134
+G1 X-37.394 Y14.202
+G1 X-37.738 Y13.262
+G1 X-38.058 Y12.313
+G1 X-38.354 Y11.357
+G1 X-38.626 Y10.393
+G1 X-38.874 Y9.423
+G1 X-39.098 Y8.447
+G1 X-39.297 Y7.466
+G1 X-39.472 Y6.480
+G1 X-39.621 Y5.490
+G1 X-39.746 Y4.496
+G1 X-39.847 Y3.500
+G1 X-39.922 Y2.502
+G1 X-39.972 Y1.502
+G1 X-39.997 Y0.501
+G1 X-39.997 Y-0.501
+G1 X-39.972 Y-1.502
+G1 X-39.922 Y-2.502
+G1 X-39.847 Y-3.500
+G1 X-39.746 Y-4.496
+G1 X-39.621 Y-5.490
+G1 X-39.472 Y-6.480
+G1 X-39.297 Y-7.466
+G1 X-39.098 Y-8.447
+G1 X-38.874 Y-9.423
+G1 X-38.626 Y-10.393
+G1 X-38.354 Y-11.357
+G1 X-38.058 Y-12.313
+G1 X-37.738 Y-13.262
+G1 X-37.394 Y-14.202
+G1 X-37.027 Y-15.134
+G1 X-36.636 Y-16.056
+G1 X-36.223 Y-16.968
+G1 X-35.787 Y-17.869
+G1 X-35.328 Y-18.759
+G1 X-34.848 Y-19.638
+G1 X-34.345 Y-20.504
+G1 X-33.821 Y-21.357
+G1 X-33.276 Y-22.197
+G1 X-32.710 Y-23.023
+G1 X-32.124 Y-23.834
+G1 X-31.517 Y-24.631
+G1 X-30.891 Y-25.412
+G1 X-30.245 Y-26.177
+G1 X-29.580 Y-26.926
+G1 X-28.897 Y-27.658
+G1 X-28.196 Y-28.373
+G1 X-27.477 Y-29.069
+G1 X-26.740 Y-29.748
+G1 X-25.987 Y-30.408
+G1 X-25.218 Y-31.049
+G1 X-24.433 Y-31.671
+G1 X-23.633 Y-32.272
+G1 X-22.818 Y-32.854
+G1 X-21.988 Y-33.414
+G1 X-21.145 Y-33.954
+G1 X-20.288 Y-34.473
+G1 X-19.419 Y-34.970
+G1 X-18.538 Y-35.445
+G1 X-17.645 Y-35.898
+G1 X-16.741 Y-36.328
+G1 X-15.826 Y-36.736
+G1 X-14.902 Y-37.121
+G1 X-13.968 Y-37.482
+G1 X-13.025 Y-37.820
+G1 X-12.075 Y-38.134
+G1 X-11.116 Y-38.424
+G1 X-10.151 Y-38.690
+G1 X-9.180 Y-38.932
+G1 X-8.202 Y-39.150
+G1 X-7.220 Y-39.343
+G1 X-6.233 Y-39.511
+G1 X-5.242 Y-39.655
+G1 X-4.248 Y-39.774
+G1 X-3.251 Y-39.868
+G1 X-2.252 Y-39.937
+G1 X-1.251 Y-39.980
+G1 X-0.250 Y-39.999
+G1 X0.751 Y-39.993
+G1 X1.752 Y-39.962
+G1 X2.751 Y-39.905
+G1 X3.749 Y-39.824
+G1 X4.745 Y-39.718
+G1 X5.738 Y-39.586
+G1 X6.727 Y-39.430
+G1 X7.712 Y-39.250
+G1 X8.692 Y-39.044
+G1 X9.666 Y-38.815
+G1 X10.635 Y-38.560
+G1 X11.596 Y-38.282
+G1 X12.551 Y-37.980
+G1 X13.498 Y-37.654
+G1 X14.436 Y-37.304
+G1 X15.365 Y-36.931
+G1 X16.285 Y-36.535
+G1 X17.194 Y-36.116
+G1 X18.093 Y-35.674
+G1 X18.980 Y-35.210
+G1 X19.855 Y-34.724
+G1 X20.718 Y-34.216
+G1 X21.568 Y-33.687
+G1 X22.405 Y-33.137
+G1 X23.227 Y-32.565
+G1 X24.035 Y-31.974
+G1 X24.828 Y-31.362
+G1 X25.605 Y-30.731
+G1 X26.366 Y-30.080
+G1 X27.111 Y-29.411
+G1 X27.838 Y-28.723
+G1 X28.549 Y-28.018
+G1 X29.241 Y-27.294
+G1 X29.915 Y-26.554
+G1 X30.570 Y-25.797
+G1 X31.206 Y-25.023
+G1 X31.823 Y-24.234
+G1 X32.419 Y-23.430
+G1 X32.996 Y-22.612
+G1 X33.551 Y-21.779
+G1 X34.086 Y-20.932
+G1 X34.599 Y-20.072
+G1 X35.091 Y-19.200
+G1 X35.560 Y-18.316
+G1 X36.008 Y-17.420
+G1 X36.432 Y-16.513
+G1 X36.834 Y-15.596
+G1 X37.213 Y-14.669
+G1 X37.569 Y-13.733
+G1 X37.901 Y-12.788
+G1 X38.209 Y-11.836
+G1 X38.493 Y-10.876
+G1 X38.753 Y-9.909
+G1 X38.989 Y-8.936
+G1 X39.201 Y-7.957
+G1 X39.387 Y-6.973
+G1 X39.550 Y-5.985
+G1 X39.687 Y-4.993
+G1 X39.800 Y-3.999
+G1 X39.887 Y-3.001
+G1 X39.950 Y-2.002
+G1 X39.987 Y-1.001
+G1 X40.000 Y-0.000
+G0 X39.550 Y0 F9000
+G1 F2400
+G1 X39.537 Y1.002
+G1 X39.499 Y2.003
+G1 X39.436 Y3.003
+G1 X39.347 Y4.001
+G1 X39.233 Y4.997
+G1 X39.094 Y5.989
+G1 X38.930 Y6.977
+G1 X38.740 Y7.961
+G1 X38.526 Y8.940
+G1 X38.287 Y9.913
+G1 X38.024 Y10.880
+G1 X37.736 Y11.840
+G1 X37.424 Y12.792
+G1 X37.088 Y13.736
+G1 X36.728 Y14.671
+G1 X36.345 Y15.597
+G1 X35.938 Y16.512
+G1 X35.508 Y17.418
+G1 X35.056 Y18.312
+G1 X34.580 Y19.194
+G1 X34.083 Y20.064
+G1 X33.564 Y20.921
+G1 X33.023 Y21.764
+G1 X32.461 Y22.594
+G1 X31.878 Y23.409
+G1 X31.275 Y24.209
+G1 X30.652 Y24.993
+G1 X30.009 Y25.762
+G1 X29.347 Y26.514
+G1 X28.666 Y27.249
+G1 X27.966 Y27.966
+G1 X27.249 Y28.666
+G1 X26.514 Y29.347
+G1 X25.762 Y30.009
+G1 X24.993 Y30.652
+G1 X24.209 Y31.275
+G1 X23.409 Y31.878
+G1 X22.594 Y32.461
+G1 X21.764 Y33.023
+G1 X20.921 Y33.564
+G1 X20.064 Y34.083
+G1 X19.194 Y34.580
+G1 X18.312 Y35.056
+G1 X17.418 Y35.508
+G1 X16.512 Y35.938
+G1 X15.597 Y36.345
+G1 X14.671 Y36.728
+G1 X13.736 Y37.088
+G1 X12.792 Y37.424
+G1 X11.840 Y37.736
+G1 X10.880 Y38.024
+G1 X9.913 Y38.287
+G1 X8.940 Y38.526
+G1 X7.961 Y38.740
+G1 X6.977 Y38.930
+G1 X5.989 Y39.094
+G1 X4.997 Y39.233
+G1 X4.001 Y39.347
+G1 X3.003 Y39.436
+G1 X2.003 Y39.499
+G1 X1.002 Y39.537
+G1 X0.000 Y39.550
+G1 X-1.002 Y39.537
+G1 X-2.003 Y39.499
+G1 X-3.003 Y39.436
+G1 X-4.001 Y39.347
+G1 X-4.997 Y39.233
+G1 X-5.989 Y39.094
+G1 X-6.977 Y38.930
+G1 X-7.961 Y38.740
+G1 X-8.940 Y38.526
+G1 X-9.913 Y38.287
+G1 X-10.880 Y38.024
+G1 X-11.840 Y37.736
+G1 X-12.792 Y37.424
+G1 X-13.736 Y37.088
+G1 X-14.671 Y36.728
+G1 X-15.597 Y36.345
+G1 X-16.512 Y35.938
+G1 X-17.418 Y35.508
+G1 X-18.312 Y35.056
+G1 X-19.194 Y34.580
+G1 X-20.064 Y34.083
+G1 X-20.921 Y33.564
+G1 X-21.764 Y33.023
+G1 X-22.594 Y32.461
+G1 X-23.409 Y31.878
+G1 X-24.209 Y31.275
+G1 X-24.993 Y30.652
+G1 X-25.762 Y30.009
+G1 X-26.514 Y29.347
+G1 X-27.249 Y28.666
+G1 X-27.966 Y27.966
+G1 X-28.666 Y27.249
+G1 X-29.347 Y26.514
+G1 X-30.009 Y25.762
+G1 X-30.652 Y24.993
+G1 X-31.275 Y24.209
+G1 X-31.878 Y23.409
+G1 X-32.461 Y22.594
+G1 X-33.023 Y21.764
+G1 X-33.564 Y20.921
+G1 X-34.083 Y20.064
+G1 X-34.580 Y19.194
+G1 X-35.056 Y18.312
+G1 X-35.508 Y17.418
+G1 X-35.938 Y16.512
+G1 X-36.345 Y15.597
+G1 X-36.728 Y14.671
+G1 X-37.088 Y13.736
+G1 X-37.424 Y12.792
+G1 X-37.736 Y11.840
+G1 X-38.024 Y10.880
+G1 X-38.287 Y9.913
+G1 X-38.526 Y8.940
+G1 X-38.740 Y7.961
+G1 X-38.930 Y6.977
+G1 X-39.094 Y5.989
+G1 X-39.233 Y4.997
+G1 X-39.347 Y4.001
+G1 X-39.436 Y3.003
+G1 X-39.499 Y2.003
+G1 X-39.537 Y1.002
+G1 X-39.550 Y0.000
+G1 X-39.537 Y-1.002
+G1 X-39.499 Y-2.003
+G1 X-39.436 Y-3.003
+G1 X-39.347 Y-4.001
+G1 X-39.233 Y-4.997
+G1 X-39.094 Y-5.989
+G1 X-38.930 Y-6.977
+G1 X-38.740 Y-7.961
+G1 X-38.526 Y-8.940
+G1 X-38.287 Y-9.913
+G1 X-38.024 Y-10.880
+G1 X-37.736 Y-11.840
+G1 X-37.424 Y-12.792
+G1 X-37.088 Y-13.736
+G1 X-36.728 Y-14.671
+G1 X-36.345 Y-15.597
+G1 X-35.938 Y-16.512
+G1 X-35.508 Y-17.418
+G1 X-35.056 Y-18.312
+G1 X-34.580 Y-19.194
+G1 X-34.083 Y-20.064
+G1 X-33.564 Y-20.921
+G1 X-33.023 Y-21.764
+G1 X-32.461 Y-22.594
+G1 X-31.878 Y-23.409
+G1 X-31.275 Y-24.209
+G1 X-30.652 Y-24.993
+G1 X-30.009 Y-25.762
+G1 X-29.347 Y-26.514
+G1 X-28.666 Y-27.249
+G1 X-27.966 Y-27.966
+G1 X-27.249 Y-28.666
+G1 X-26.514 Y-29.347
+G1 X-25.762 Y-30.009
+G1 X-24.993 Y-30.652
+G1 X-24.209 Y-31.275
+G1 X-23.409 Y-31.878
+G1 X-22.594 Y-32.461
+G1 X-21.764 Y-33.023
+G1 X-20.921 Y-33.564
+G1 X-20.064 Y-34.083
+G1 X-19.194 Y-34.580
+G1 X-18.312 Y-35.056
+G1 X-17.418 Y-35.508
+G1 X-16.512 Y-35.938
+G1 X-15.597 Y-36.345
+G1 X-14.671 Y-36.728
+G1 X-13.736 Y-37.088
+G1 X-12.792 Y-37.424
+G1 X-11.840 Y-37.736
+G1 X-10.880 Y-38.024
+G1 X-9.913 Y-38.287
+G1 X-8.940 Y-38.526
+G1 X-7.961 Y-38.740
+G1 X-6.977 Y-38.930
+G1 X-5.989 Y-39.094
+G1 X-4.997 Y-39.233
+G1 X-4.001 Y-39.347
+G1 X-3.003 Y-39.436
+G1 X-2.003 Y-39.499
+G1 X-1.002 Y-39.537
+G1 X-0.000 Y-39.550
+G1 X1.002 Y-39.537
+G1 X2.003 Y-39.499
+G1 X3.003 Y-39.436
+G1 X4.001 Y-39.347
+G1 X4.997 Y-39.233
+G1 X5.989 Y-39.094
+G1 X6.977 Y-38.930
+G1 X7.961 Y-38.740
+G1 X8.940 Y-38.526
+G1 X9.913 Y-38.287
+G1 X10.880 Y-38.024
+G1 X11.840 Y-37.736
+G1 X12.792 Y-37.424
+G1 X13.736 Y-37.088
+G1 X14.671 Y-36.728
+G1 X15.597 Y-36.345
+G1 X16.512 Y-35.938
+G1 X17.418 Y-35.508
+G1 X18.312 Y-35.056
+G1 X19.194 Y-34.580
+G1 X20.064 Y-34.083
+G1 X20.921 Y-33.564
+G1 X21.764 Y-33.023
+G1 X22.594 Y-32.461
+G1 X23.409 Y-31.878
+G1 X24.209 Y-31.275
+G1 X24.993 Y-30.652
+G1 X25.762 Y-30.009
+G1 X26.514 Y-29.347
+G1 X27.249 Y-28.666
+G1 X27.966 Y-27.966
+G1 X28.666 Y-27.249
+G1 X29.347 Y-26.514
+G1 X30.009 Y-25.762
+G1 X30.652 Y-24.993
+G1 X31.275 Y-24.209
+G1 X31.878 Y-23.409
+G1 X32.461 Y-22.594
+G1 X33.023 Y-21.764
+G1 X33.564 Y-20.921
+G1 X34.083 Y-20.064
+G1 X34.580 Y-19.194
+G1 X35.056 Y-18.312
+G1 X35.508 Y-17.418
+G1 X35.938 Y-16.512
+G1 X36.345 Y-15.597
+G1 X36.728 Y-14.671
+G1 X37.088 Y-13.736
+G1 X37.424 Y-12.792
+G1 X37.736 Y-11.840
+G1 X38.024 Y-10.880
+G1 X38.287 Y-9.913
+G1 X38.526 Y-8.940
+G1 X38.740 Y-7.961
+G1 X38.930 Y-6.977
+G1 X39.094 Y-5.989
+G1 X39.233 Y-4.997
+G1 X39.347 Y-4.001
+G1 X39.436 Y-3.003
+G1 X39.499 Y-2.003
+G1 X39.537 Y-1.002
+G1 X39.550 Y-0.000
+G0 X39.100 Y0 F9000
+G1 F2400
+G1 X39.087 Y1.003
+G1 X39.049 Y2.005
+G1 X38.984 Y3.005
+G1 X38.894 Y4.004
+G1 X38.779 Y5.000
+G1 X38.638 Y5.993
+G1 X38.472 Y6.982
+G1 X38.280 Y7.966
+G1 X38.063 Y8.945
+G1 X37.821 Y9.918
+G1 X37.554 Y10.884
+G1 X37.263 Y11.844
+G1 X36.947 Y12.796
+G1 X36.607 Y13.739
+G1 X36.242 Y14.673
+G1 X35.854 Y15.597
+G1 X35.443 Y16.512
+G1 X35.007 Y17.415
+G1 X34.549 Y18.307
+G1 X34.069 Y19.187
+G1 X33.565 Y20.054
+G1 X33.040 Y20.908
+G1 X32.493 Y21.749
+G1 X31.925 Y22.575
+G1 X31.335 Y23.386
+G1 X30.725 Y24.182
+G1 X30.095 Y24.962
+G1 X29.445 Y25.725
+G1 X28.776 Y26.472
+G1 X28.087 Y27.201
+G1 X27.381 Y27.912
+G1 X26.656 Y28.605
+G1 X25.914 Y29.280
+G1 X25.154 Y29.934
+G1 X24.378 Y30.570
+G1 X23.587 Y31.185
+G1 X22.779 Y31.779
+G1 X21.957 Y32.353
+G1 X21.120 Y32.905
+G1 X20.269 Y33.436
+G1 X19.405 Y33.945
+G1 X18.528 Y34.431
+G1 X17.639 Y34.895
+G1 X16.739 Y35.336
+G1 X15.827 Y35.754
+G1 X14.905 Y36.148
+G1 X13.973 Y36.518
+G1 X13.032 Y36.864
+G1 X12.083 Y37.186
+G1 X11.125 Y37.484
+G1 X10.160 Y37.757
+G1 X9.189 Y38.005
+G1 X8.211 Y38.228
+G1 X7.228 Y38.426
+G1 X6.240 Y38.599
+G1 X5.249 Y38.746
+G1 X4.253 Y38.868
+G1 X3.255 Y38.964
+G1 X2.255 Y39.035
+G1 X1.253 Y39.080
+G1 X0.251 Y39.099
+G1 X-0.752 Y39.093
+G1 X-1.754 Y39.061
+G1 X-2.755 Y39.003
+G1 X-3.755 Y38.919
+G1 X-4.751 Y38.810
+G1 X-5.745 Y38.676
+G1 X-6.735 Y38.516
+G1 X-7.720 Y38.330
+G1 X-8.701 Y38.120
+G1 X-9.675 Y37.884
+G1 X-10.643 Y37.623
+G1 X-11.605 Y37.338
+G1 X-12.558 Y37.028
+G1 X-13.504 Y36.694
+G1 X-14.440 Y36.336
+G1 X-15.367 Y35.954
+G1 X-16.284 Y35.548
+G1 X-17.190 Y35.118
+G1 X-18.085 Y34.666
+G1 X-18.968 Y34.191
+G1 X-19.839 Y33.693
+G1 X-20.696 Y33.173
+G1 X-21.540 Y32.632
+G1 X-22.370 Y32.069
+G1 X-23.185 Y31.485
+G1 X-23.984 Y30.880
+G1 X-24.768 Y30.255
+G1 X-25.536 Y29.609
+G1 X-26.287 Y28.945
+G1 X-27.021 Y28.261
+G1 X-27.736 Y27.559
+G1 X-28.434 Y26.839
+G1 X-29.113 Y26.101
+G1 X-29.773 Y25.346
+G1 X-30.413 Y24.574
+G1 X-31.033 Y23.786
+G1 X-31.633 Y22.982
+G1 X-32.211 Y22.164
+G1 X-32.769 Y21.330
+G1 X-33.305 Y20.483
+G1 X-33.820 Y19.622
+G1 X-34.312 Y18.749
+G1 X-34.781 Y17.863
+G1 X-35.228 Y16.965
+G1 X-35.651 Y16.056
+G1 X-36.051 Y15.136
+G1 X-36.428 Y14.207
+G1 X-36.780 Y13.268
+G1 X-37.108 Y12.321
+G1 X-37.412 Y11.365
+G1 X-37.691 Y10.402
+G1 X-37.945 Y9.432
+G1 X-38.175 Y8.456
+G1 X-38.379 Y7.474
+G1 X-38.558 Y6.488
+G1 X-38.712 Y5.497
+G1 X-38.840 Y4.502
+G1 X-38.943 Y3.505
+G1 X-39.020 Y2.505
+G1 X-39.071 Y1.504
+G1 X-39.097 Y0.501
+G1 X-39.097 Y-0.501
+G1 X-39.071 Y-1.504
+G1 X-39.020 Y-2.505
+G1 X-38.943 Y-3.505
+G1 X-38.840 Y-4.502
+G1 X-38.712 Y-5.497
+G1 X-38.558 Y-6.488
+G1 X-38.379 Y-7.474
+G1 X-38.175 Y-8.456
+G1 X-37.945 Y-9.432
+G1 X-37.691 Y-10.402
+G1 X-37.412 Y-11.365
+G1 X-37.108 Y-12.321
+G1 X-36.780 Y-13.268
+G1 X-36.428 Y-14.207
+G1 X-36.051 Y-15.136
+G1 X-35.651 Y-16.056
+G1 X-35.228 Y-16.965
+G1 X-34.781 Y-17.863
+G1 X-34.312 Y-18.749
+G1 X-33.820 Y-19.622
+G1 X-33.305 Y-20.483
+G1 X-32.769 Y-21.330
+G1 X-32.211 Y-22.164
+G1 X-31.633 Y-22.982
+G1 X-31.033 Y-23.786
+G1 X-30.413 Y-24.574
+G1 X-29.773 Y-25.346
+G1 X-29.113 Y-26.101
+G1 X-28.434 Y-26.839
+G1 X-27.736 Y-27.559
+G1 X-27.021 Y-28.261
+G1 X-26.287 Y-28.945
+G1 X-25.536 Y-29.609
+G1 X-24.768 Y-30.255
+G1 X-23.984 Y-30.880
+G1 X-23.185 Y-31.485
+G1 X-22.370 Y-32.069
+G1 X-21.540 Y-32.632
+G1 X-20.696 Y-33.173
+G1 X-19.839 Y-33.693
+G1 X-18.968 Y-34.191
+G1 X-18.085 Y-34.666
+G1 X-17.190 Y-35.118
+G1 X-16.284 Y-35.548
+G1 X-15.367 Y-35.954
+G1 X-14.440 Y-36.336
+G1 X-13.504 Y-36.694
+G1 X-12.558 Y-37.028
+G1 X-11.605 Y-37.338
+G1 X-10.643 Y-37.623
+G1 X-9.675 Y-37.884
+G1 X-8.701 Y-38.120
+G1 X-7.720 Y-38.330
+G1 X-6.735 Y-38.516
+G1 X-5.745 Y-38.676
+G1 X-4.751 Y-38.810
+G1 X-3.755 Y-38.919
+G1 X-2.755 Y-39.003
+G1 X-1.754 Y-39.061
+G1 X-0.752 Y-39.093
+G1 X0.251 Y-39.099
+G1 X1.253 Y-39.080
+G1 X2.255 Y-39.035
+G1 X3.255 Y-38.964
+G1 X4.253 Y-38.868
+G1 X5.249 Y-38.746
+G1 X6.240 Y-38.599
+G1 X7.228 Y-38.426
+G1 X8.211 Y-38.228
+G1 X9.189 Y-38.005
+G1 X10.160 Y-37.757
+G1 X11.125 Y-37.484
+G1 X12.083 Y-37.186
+G1 X13.032 Y-36.864
+G1 X13.973 Y-36.518
+G1 X14.905 Y-36.148
+G1 X15.827 Y-35.754
+G1 X16.739 Y-35.336
+G1 X17.639 Y-34.895
+G1 X18.528 Y-34.431
+G1 X19.405 Y-33.945
+G1 X20.269 Y-33.436
+G1 X21.120 Y-32.905
+G1 X21.957 Y-32.353
+G1 X22.779 Y-31.779
+G1 X23.587 Y-31.185
+G1 X24.378 Y-30.570
+G1 X25.154 Y-29.934
+G1 X25.914 Y-29.280
+G1 X26.656 Y-28.605
+G1 X27.381 Y-27.912
+G1 X28.087 Y-27.201
+G1 X28.776 Y-26.472
+G1 X29.445 Y-25.725
+G1 X30.095 Y-24.962
+G1 X30.725 Y-24.182
+G1 X31.335 Y-23.386
+G1 X31.925 Y-22.575
+G1 X32.493 Y-21.749
+G1 X33.040 Y-20.908
+G1 X33.565 Y-20.054
+G1 X34.069 Y-19.187
+G1 X34.549 Y-18.307
+G1 X35.007 Y-17.415
+G1 X35.443 Y-16.512
+G1 X35.854 Y-15.597
+G1 X36.242 Y-14.673
+G1 X36.607 Y-13.739
+G1 X36.947 Y-12.796
+G1 X37.263 Y-11.844
+G1 X37.554 Y-10.884
+G1 X37.821 Y-9.918
+G1 X38.063 Y-8.945
+G1 X38.280 Y-7.966
+G1 X38.472 Y-6.982
+G1 X38.638 Y-5.993
+G1 X38.779 Y-5.000
+G1 X38.894 Y-4.004
+G1 X38.984 Y-3.005
+G1 X39.049 Y-2.005
+G1 X39.087 Y-1.003
+G1 X39.100 Y-0.000
+G1 F4800
+G0 X20.352 Y-32.681 F9000
+G1 X32.681 Y-20.352 F4800
+G0 X35.638 Y-14.567 F9000
+G1 X14.567 Y-35.638 F4800
+G0 X10.272 Y-37.104 F9000
+G1 X37.104 Y-10.272 F4800
+G0 X37.926 Y-6.621 F9000
+G1 X6.621 Y-37.926 F4800
+G0 X3.367 Y-38.353 F9000
+G1 X38.353 Y-3.367 F4800
+G0 X38.498 Y-0.393 F9000
+G1 X0.393 Y-38.498 F4800
+G0 X-2.365 Y-38.427 F9000
+G1 X38.427 Y2.365 F4800
+G0 X38.181 Y4.947 F9000
+G1 X-4.947 Y-38.181 F4800
+G0 X-7.380 Y-37.786 F9000
+G1 X37.786 Y7.380 F4800
+G0 X37.262 Y9.685 F9000
+G1 X-9.685 Y-37.262 F4800
+G0 X-11.874 Y-36.623 F9000
+G1 X36.623 Y11.874 F4800
+G0 X35.880 Y13.960 F9000
+G1 X-13.960 Y-35.880 F4800
+G0 X-15.949 Y-35.041 F9000
+G1 X35.041 Y15.949 F4800
+G0 X34.112 Y17.849 F9000
+G1 X-17.849 Y-34.112 F4800
+G0 X-19.664 Y-33.099 F9000
+G1 X33.099 Y19.664 F4800
+G0 X32.005 Y21.399 F9000
+G1 X-21.399 Y-32.005 F4800
+G0 X-23.055 Y-30.833 F9000
+G1 X30.833 Y23.055 F4800
+G0 X29.586 Y24.636 F9000
+G1 X-24.636 Y-29.586 F4800
+G0 X-26.142 Y-28.264 F9000
+G1 X28.264 Y26.142 F4800
+G0 X26.868 Y27.575 F9000
+G1 X-27.575 Y-26.868 F4800
+G0 X-28.934 Y-25.398 F9000
+G1 X25.398 Y28.934 F4800
+G0 X23.855 Y30.219 F9000
+G1 X-30.219 Y-23.855 F4800
+G0 X-31.429 Y-22.237 F9000
+G1 X22.237 Y31.429 F4800
+G0 X20.541 Y32.562 F9000
+G1 X-32.562 Y-20.541 F4800
+G0 X-33.616 Y-18.767 F9000
+G1 X18.767 Y33.616 F4800
+G0 X16.910 Y34.588 F9000
+G1 X-34.588 Y-16.910 F4800
+G0 X-35.472 Y-14.966 F9000
+G1 X14.966 Y35.472 F4800
+G0 X12.929 Y36.264 F9000
+G1 X-36.264 Y-12.929 F4800
+G0 X-36.956 Y-10.793 F9000
+G1 X10.793 Y36.956 F4800
+G0 X8.548 Y37.539 F9000
+G1 X-37.539 Y-8.548 F4800
+G0 X-38.001 Y-6.181 F9000
+G1 X6.181 Y38.001 F4800
+G0 X3.676 Y38.324 F9000
+G1 X-38.324 Y-3.676 F4800
+G0 X-38.487 Y-1.010 F9000
+G1 X1.010 Y38.487 F4800
+G0 X-1.850 Y38.456 F9000
+G1 X-38.456 Y1.850 F4800
+G0 X-38.180 Y4.954 F9000
+G1 X-4.954 Y38.180 F4800
+G0 X-8.386 Y37.575 F9000
+G1 X-37.575 Y8.386 F4800
+G0 X-36.478 Y12.312 F9000
+G1 X-12.312 Y36.478 F4800
+G0 X-17.149 Y34.470 F9000
+G1 X-34.470 Y17.149 F4800
+G0 X0 Y0 Z10 F9000
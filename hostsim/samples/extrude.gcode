@@ -0,0 +1,282 @@
+; two layers of a small print with relative extrusion, perimeters, short arc segments, retracts and travels, see make advance
+G21
+G90
+M83
+G1 Z0.20 F6000
+G1 Z0.20 F6000
+G0 X-20.000 Y-20.000 F9000
+G1 E0.8 F1800
+G1 F1800
+G1 X20.000 Y-20.000 E1.32000
+G1 X20.000 Y20.000 E1.32000
+G1 X-20.000 Y20.000 E1.32000
+G1 X-20.000 Y-20.000 E1.32000
+G1 E-0.8 F2700
+G0 X-16.000 Y-16.000 F9000
+G1 E0.8 F1800
+G1 F2400
+G1 X16.000 Y-16.000 E1.05600
+G1 X16.000 Y16.000 E1.05600
+G1 X-16.000 Y16.000 E1.05600
+G1 X-16.000 Y-16.000 E1.05600
+G1 E-0.8 F2700
+G0 X-12.000 Y-12.000 F9000
+G1 E0.8 F1800
+G1 F3600
+G1 X12.000 Y-12.000 E0.79200
+G1 X12.000 Y12.000 E0.79200
+G1 X-12.000 Y12.000 E0.79200
+G1 X-12.000 Y-12.000 E0.79200
+G1 E-0.8 F2700
+G0 X6.000 Y0 F9000
+G1 E0.8 F1800
+G1 F3000
+G1 X5.977 Y0.523 E0.01727
+G1 X5.909 Y1.042 E0.01727
+G1 X5.796 Y1.553 E0.01727
+G1 X5.638 Y2.052 E0.01727
+G1 X5.438 Y2.536 E0.01727
+G1 X5.196 Y3.000 E0.01727
+G1 X4.915 Y3.441 E0.01727
+G1 X4.596 Y3.857 E0.01727
+G1 X4.243 Y4.243 E0.01727
+G1 X3.857 Y4.596 E0.01727
+G1 X3.441 Y4.915 E0.01727
+G1 X3.000 Y5.196 E0.01727
+G1 X2.536 Y5.438 E0.01727
+G1 X2.052 Y5.638 E0.01727
+G1 X1.553 Y5.796 E0.01727
+G1 X1.042 Y5.909 E0.01727
+G1 X0.523 Y5.977 E0.01727
+G1 X0.000 Y6.000 E0.01727
+G1 X-0.523 Y5.977 E0.01727
+G1 X-1.042 Y5.909 E0.01727
+G1 X-1.553 Y5.796 E0.01727
+G1 X-2.052 Y5.638 E0.01727
+G1 X-2.536 Y5.438 E0.01727
+G1 X-3.000 Y5.196 E0.01727
+G1 X-3.441 Y4.915 E0.01727
+G1 X-3.857 Y4.596 E0.01727
+G1 X-4.243 Y4.243 E0.01727
+G1 X-4.596 Y3.857 E0.01727
+G1 X-4.915 Y3.441 E0.01727
+G1 X-5.196 Y3.000 E0.01727
+G1 X-5.438 Y2.536 E0.01727
+G1 X-5.638 Y2.052 E0.01727
+G1 X-5.796 Y1.553 E0.01727
+G1 X-5.909 Y1.042 E0.01727
+G1 X-5.977 Y0.523 E0.01727
+G1 X-6.000 Y0.000 E0.01727
+G1 X-5.977 Y-0.523 E0.01727
+G1 X-5.909 Y-1.042 E0.01727
+G1 X-5.796 Y-1.553 E0.01727
+G1 X-5.638 Y-2.052 E0.01727
+G1 X-5.438 Y-2.536 E0.01727
+G1 X-5.196 Y-3.000 E0.01727
+G1 X-4.915 Y-3.441 E0.01727
+G1 X-4.596 Y-3.857 E0.01727
+G1 X-4.243 Y-4.243 E0.01727
+G1 X-3.857 Y-4.596 E0.01727
+G1 X-3.441 Y-4.915 E0.01727
+G1 X-3.000 Y-5.196 E0.01727
+G1 X-2.536 Y-5.438 E0.01727
+G1 X-2.052 Y-5.638 E0.01727
+G1 X-1.553 Y-5.796 E0.01727
+G1 X-1.042 Y-5.909 E0.01727
+G1 X-0.523 Y-5.977 E0.01727
+G1 X-0.000 Y-6.000 E0.01727
+G1 X0.523 Y-5.977 E0.01727
+G1 X1.042 Y-5.909 E0.01727
+G1 X1.553 Y-5.796 E0.01727
+G1 X2.052 Y-5.638 E0.01727
+G1 X2.536 Y-5.438 E0.01727
+G1 X3.000 Y-5.196 E0.01727
+G1 X3.441 Y-4.915 E0.01727
+G1 X3.857 Y-4.596 E0.01727
+G1 X4.243 Y-4.243 E0.01727
+G1 X4.596 Y-3.857 E0.01727
+G1 X4.915 Y-3.441 E0.01727
+G1 X5.196 Y-3.000 E0.01727
+G1 X5.438 Y-2.536 E0.01727
+G1 X5.638 Y-2.052 E0.01727
+G1 X5.796 Y-1.553 E0.01727
+G1 X5.909 Y-1.042 E0.01727
+G1 X5.977 Y-0.523 E0.01727
+G1 X6.000 Y-0.000 E0.01727
+G1 E-0.8 F2700
+G1 F4800
+G0 X-10 Y-8.0 F9000
+G1 E0.8 F1800
+G1 X10 Y-8.0 E0.66000 F4800
+G1 E-0.8 F2700
+G0 X-10 Y-6.0 F9000
+G1 E0.8 F1800
+G1 X10 Y-6.0 E0.66000 F4800
+G1 E-0.8 F2700
+G0 X-10 Y-4.0 F9000
+G1 E0.8 F1800
+G1 X10 Y-4.0 E0.66000 F4800
+G1 E-0.8 F2700
+G0 X-10 Y-2.0 F9000
+G1 E0.8 F1800
+G1 X10 Y-2.0 E0.66000 F4800
+G1 E-0.8 F2700
+G0 X-10 Y0.0 F9000
+G1 E0.8 F1800
+G1 X10 Y0.0 E0.66000 F4800
+G1 E-0.8 F2700
+G0 X-10 Y2.0 F9000
+G1 E0.8 F1800
+G1 X10 Y2.0 E0.66000 F4800
+G1 E-0.8 F2700
+G0 X-10 Y4.0 F9000
+G1 E0.8 F1800
+G1 X10 Y4.0 E0.66000 F4800
+G1 E-0.8 F2700
+G0 X-10 Y6.0 F9000
+G1 E0.8 F1800
+G1 X10 Y6.0 E0.66000 F4800
+G1 E-0.8 F2700
+G0 X-10 Y8.0 F9000
+G1 E0.8 F1800
+G1 X10 Y8.0 E0.66000 F4800
+G1 E-0.8 F2700
+G1 Z0.40 F6000
+G0 X-20.000 Y-20.000 F9000
+G1 E0.8 F1800
+G1 F1800
+G1 X20.000 Y-20.000 E1.32000
+G1 X20.000 Y20.000 E1.32000
+G1 X-20.000 Y20.000 E1.32000
+G1 X-20.000 Y-20.000 E1.32000
+G1 E-0.8 F2700
+G0 X-16.000 Y-16.000 F9000
+G1 E0.8 F1800
+G1 F2400
+G1 X16.000 Y-16.000 E1.05600
+G1 X16.000 Y16.000 E1.05600
+G1 X-16.000 Y16.000 E1.05600
+G1 X-16.000 Y-16.000 E1.05600
+G1 E-0.8 F2700
+G0 X-12.000 Y-12.000 F9000
+G1 E0.8 F1800
+G1 F3600
+G1 X12.000 Y-12.000 E0.79200
+G1 X12.000 Y12.000 E0.79200
+G1 X-12.000 Y12.000 E0.79200
+G1 X-12.000 Y-12.000 E0.79200
+G1 E-0.8 F2700
+G0 X6.000 Y0 F9000
+G1 E0.8 F1800
+G1 F3000
+G1 X5.977 Y0.523 E0.01727
+G1 X5.909 Y1.042 E0.01727
+G1 X5.796 Y1.553 E0.01727
+G1 X5.638 Y2.052 E0.01727
+G1 X5.438 Y2.536 E0.01727
+G1 X5.196 Y3.000 E0.01727
+G1 X4.915 Y3.441 E0.01727
+G1 X4.596 Y3.857 E0.01727
+G1 X4.243 Y4.243 E0.01727
+G1 X3.857 Y4.596 E0.01727
+G1 X3.441 Y4.915 E0.01727
+G1 X3.000 Y5.196 E0.01727
+G1 X2.536 Y5.438 E0.01727
+G1 X2.052 Y5.638 E0.01727
+G1 X1.553 Y5.796 E0.01727
+G1 X1.042 Y5.909 E0.01727
+G1 X0.523 Y5.977 E0.01727
+G1 X0.000 Y6.000 E0.01727
+G1 X-0.523 Y5.977 E0.01727
+G1 X-1.042 Y5.909 E0.01727
+G1 X-1.553 Y5.796 E0.01727
+G1 X-2.052 Y5.638 E0.01727
+G1 X-2.536 Y5.438 E0.01727
+G1 X-3.000 Y5.196 E0.01727
+G1 X-3.441 Y4.915 E0.01727
+G1 X-3.857 Y4.596 E0.01727
+G1 X-4.243 Y4.243 E0.01727
+G1 X-4.596 Y3.857 E0.01727
+G1 X-4.915 Y3.441 E0.01727
+G1 X-5.196 Y3.000 E0.01727
+G1 X-5.438 Y2.536 E0.01727
+G1 X-5.638 Y2.052 E0.01727
+G1 X-5.796 Y1.553 E0.01727
+G1 X-5.909 Y1.042 E0.01727
+G1 X-5.977 Y0.523 E0.01727
+G1 X-6.000 Y0.000 E0.01727
+G1 X-5.977 Y-0.523 E0.01727
+G1 X-5.909 Y-1.042 E0.01727
+G1 X-5.796 Y-1.553 E0.01727
+G1 X-5.638 Y-2.052 E0.01727
+G1 X-5.438 Y-2.536 E0.01727
+G1 X-5.196 Y-3.000 E0.01727
+G1 X-4.915 Y-3.441 E0.01727
+G1 X-4.596 Y-3.857 E0.01727
+G1 X-4.243 Y-4.243 E0.01727
+G1 X-3.857 Y-4.596 E0.01727
+G1 X-3.441 Y-4.915 E0.01727
+G1 X-3.000 Y-5.196 E0.01727
+G1 X-2.536 Y-5.438 E0.01727
+G1 X-2.052 Y-5.638 E0.01727
+G1 X-1.553 Y-5.796 E0.01727
+G1 X-1.042 Y-5.909 E0.01727
+G1 X-0.523 Y-5.977 E0.01727
+G1 X-0.000 Y-6.000 E0.01727
+G1 X0.523 Y-5.977 E0.01727
+G1 X1.042 Y-5.909 E0.01727
+G1 X1.553 Y-5.796 E0.01727
+G1 X2.052 Y-5.638 E0.01727
+G1 X2.536 Y-5.438 E0.01727
+G1 X3.000 Y-5.196 E0.01727
+G1 X3.441 Y-4.915 E0.01727
+G1 X3.857 Y-4.596 E0.01727
+G1 X4.243 Y-4.243 E0.01727
+G1 X4.596 Y-3.857 E0.01727
+G1 X4.915 Y-3.441 E0.01727
+G1 X5.196 Y-3.000 E0.01727
+G1 X5.438 Y-2.536 E0.01727
+G1 X5.638 Y-2.052 E0.01727
+G1 X5.796 Y-1.553 E0.01727
+G1 X5.909 Y-1.042 E0.01727
+G1 X5.977 Y-0.523 E0.01727
+G1 X6.000 Y-0.000 E0.01727
+G1 E-0.8 F2700
+G1 F4800
+G0 X-10 Y-8.0 F9000
+G1 E0.8 F1800
+G1 X10 Y-8.0 E0.66000 F4800
+G1 E-0.8 F2700
+G0 X-10 Y-6.0 F9000
+G1 E0.8 F1800
+G1 X10 Y-6.0 E0.66000 F4800
+G1 E-0.8 F2700
+G0 X-10 Y-4.0 F9000
+G1 E0.8 F1800
+G1 X10 Y-4.0 E0.66000 F4800
+G1 E-0.8 F2700
+G0 X-10 Y-2.0 F9000
+G1 E0.8 F1800
+G1 X10 Y-2.0 E0.66000 F4800
+G1 E-0.8 F2700
+G0 X-10 Y0.0 F9000
+G1 E0.8 F1800
+G1 X10 Y0.0 E0.66000 F4800
+G1 E-0.8 F2700
+G0 X-10 Y2.0 F9000
+G1 E0.8 F1800
+G1 X10 Y2.0 E0.66000 F4800
+G1 E-0.8 F2700
+G0 X-10 Y4.0 F9000
+G1 E0.8 F1800
+G1 X10 Y4.0 E0.66000 F4800
+G1 E-0.8 F2700
+G0 X-10 Y6.0 F9000
+G1 E0.8 F1800
+G1 X10 Y6.0 E0.66000 F4800
+G1 E-0.8 F2700
+G0 X-10 Y8.0 F9000
+G1 E0.8 F1800
+G1 X10 Y8.0 E0.66000 F4800
+G1 E-0.8 F2700
+G0 X0 Y0 F9000
@@ -0,0 +1,24 @@
+G21
+G90
+G1 F12000
+G1 X40 Y0
+G4 P200
+G1 X40 Y30
+G4 P200
+G1 X0 Y30
+G4 P200
+G1 X0 Y0
+G4 P200
+G1 X20 Y20
+G4 P200
+G1 X40 Y0 F6000
+G4 P200
+G0 X10 Y10
+G4 P200
+G1 X10 Y30 F12000
+G1 X30 Y30
+G1 X30 Y10
+G1 X10 Y10
+G4 P200
+G1 X0 Y0
+G4 P200
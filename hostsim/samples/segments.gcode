@@ -0,0 +1,1891 @@
+; 0.1 mm segments on circles of 10 mm radius, for the streaming benchmark (make stream)
+G21
+G90
+G0 X10 Y0 F6000
+G1 F6000
+G1 X9.999 Y0.100
+G1 X9.998 Y0.200
+G1 X9.995 Y0.300
+G1 X9.992 Y0.400
+G1 X9.987 Y0.500
+G1 X9.982 Y0.600
+G1 X9.975 Y0.700
+G1 X9.968 Y0.800
+G1 X9.959 Y0.899
+G1 X9.950 Y0.999
+G1 X9.939 Y1.098
+G1 X9.928 Y1.198
+G1 X9.916 Y1.297
+G1 X9.902 Y1.396
+G1 X9.888 Y1.495
+G1 X9.872 Y1.594
+G1 X9.856 Y1.693
+G1 X9.838 Y1.791
+G1 X9.820 Y1.890
+G1 X9.800 Y1.988
+G1 X9.780 Y2.086
+G1 X9.759 Y2.183
+G1 X9.736 Y2.281
+G1 X9.713 Y2.378
+G1 X9.689 Y2.475
+G1 X9.664 Y2.572
+G1 X9.637 Y2.669
+G1 X9.610 Y2.765
+G1 X9.582 Y2.861
+G1 X9.553 Y2.957
+G1 X9.523 Y3.052
+G1 X9.492 Y3.147
+G1 X9.460 Y3.242
+G1 X9.427 Y3.336
+G1 X9.393 Y3.431
+G1 X9.358 Y3.524
+G1 X9.323 Y3.618
+G1 X9.286 Y3.711
+G1 X9.248 Y3.804
+G1 X9.210 Y3.896
+G1 X9.170 Y3.988
+G1 X9.130 Y4.080
+G1 X9.089 Y4.171
+G1 X9.047 Y4.261
+G1 X9.003 Y4.352
+G1 X8.959 Y4.442
+G1 X8.915 Y4.531
+G1 X8.869 Y4.620
+G1 X8.822 Y4.708
+G1 X8.775 Y4.796
+G1 X8.726 Y4.884
+G1 X8.677 Y4.971
+G1 X8.627 Y5.058
+G1 X8.576 Y5.144
+G1 X8.524 Y5.229
+G1 X8.471 Y5.314
+G1 X8.417 Y5.399
+G1 X8.363 Y5.483
+G1 X8.308 Y5.566
+G1 X8.252 Y5.649
+G1 X8.195 Y5.731
+G1 X8.137 Y5.813
+G1 X8.078 Y5.894
+G1 X8.019 Y5.975
+G1 X7.959 Y6.054
+G1 X7.898 Y6.134
+G1 X7.836 Y6.213
+G1 X7.774 Y6.291
+G1 X7.710 Y6.368
+G1 X7.646 Y6.445
+G1 X7.581 Y6.521
+G1 X7.516 Y6.597
+G1 X7.449 Y6.671
+G1 X7.382 Y6.746
+G1 X7.314 Y6.819
+G1 X7.246 Y6.892
+G1 X7.176 Y6.964
+G1 X7.106 Y7.036
+G1 X7.036 Y7.106
+G1 X6.964 Y7.176
+G1 X6.892 Y7.246
+G1 X6.819 Y7.314
+G1 X6.746 Y7.382
+G1 X6.671 Y7.449
+G1 X6.597 Y7.516
+G1 X6.521 Y7.581
+G1 X6.445 Y7.646
+G1 X6.368 Y7.710
+G1 X6.291 Y7.774
+G1 X6.213 Y7.836
+G1 X6.134 Y7.898
+G1 X6.054 Y7.959
+G1 X5.975 Y8.019
+G1 X5.894 Y8.078
+G1 X5.813 Y8.137
+G1 X5.731 Y8.195
+G1 X5.649 Y8.252
+G1 X5.566 Y8.308
+G1 X5.483 Y8.363
+G1 X5.399 Y8.417
+G1 X5.314 Y8.471
+G1 X5.229 Y8.524
+G1 X5.144 Y8.576
+G1 X5.058 Y8.627
+G1 X4.971 Y8.677
+G1 X4.884 Y8.726
+G1 X4.796 Y8.775
+G1 X4.708 Y8.822
+G1 X4.620 Y8.869
+G1 X4.531 Y8.915
+G1 X4.442 Y8.959
+G1 X4.352 Y9.003
+G1 X4.261 Y9.047
+G1 X4.171 Y9.089
+G1 X4.080 Y9.130
+G1 X3.988 Y9.170
+G1 X3.896 Y9.210
+G1 X3.804 Y9.248
+G1 X3.711 Y9.286
+G1 X3.618 Y9.323
+G1 X3.524 Y9.358
+G1 X3.431 Y9.393
+G1 X3.336 Y9.427
+G1 X3.242 Y9.460
+G1 X3.147 Y9.492
+G1 X3.052 Y9.523
+G1 X2.957 Y9.553
+G1 X2.861 Y9.582
+G1 X2.765 Y9.610
+G1 X2.669 Y9.637
+G1 X2.572 Y9.664
+G1 X2.475 Y9.689
+G1 X2.378 Y9.713
+G1 X2.281 Y9.736
+G1 X2.183 Y9.759
+G1 X2.086 Y9.780
+G1 X1.988 Y9.800
+G1 X1.890 Y9.820
+G1 X1.791 Y9.838
+G1 X1.693 Y9.856
+G1 X1.594 Y9.872
+G1 X1.495 Y9.888
+G1 X1.396 Y9.902
+G1 X1.297 Y9.916
+G1 X1.198 Y9.928
+G1 X1.098 Y9.939
+G1 X0.999 Y9.950
+G1 X0.899 Y9.959
+G1 X0.800 Y9.968
+G1 X0.700 Y9.975
+G1 X0.600 Y9.982
+G1 X0.500 Y9.987
+G1 X0.400 Y9.992
+G1 X0.300 Y9.995
+G1 X0.200 Y9.998
+G1 X0.100 Y9.999
+G1 X0.000 Y10.000
+G1 X-0.100 Y9.999
+G1 X-0.200 Y9.998
+G1 X-0.300 Y9.995
+G1 X-0.400 Y9.992
+G1 X-0.500 Y9.987
+G1 X-0.600 Y9.982
+G1 X-0.700 Y9.975
+G1 X-0.800 Y9.968
+G1 X-0.899 Y9.959
+G1 X-0.999 Y9.950
+G1 X-1.098 Y9.939
+G1 X-1.198 Y9.928
+G1 X-1.297 Y9.916
+G1 X-1.396 Y9.902
+G1 X-1.495 Y9.888
+G1 X-1.594 Y9.872
+G1 X-1.693 Y9.856
+G1 X-1.791 Y9.838
+G1 X-1.890 Y9.820
+G1 X-1.988 Y9.800
+G1 X-2.086 Y9.780
+G1 X-2.183 Y9.759
+G1 X-2.281 Y9.736
+G1 X-2.378 Y9.713
+G1 X-2.475 Y9.689
+G1 X-2.572 Y9.664
+G1 X-2.669 Y9.637
+G1 X-2.765 Y9.610
+G1 X-2.861 Y9.582
+G1 X-2.957 Y9.553
+G1 X-3.052 Y9.523
+G1 X-3.147 Y9.492
+G1 X-3.242 Y9.460
+G1 X-3.336 Y9.427
+G1 X-3.431 Y9.393
+G1 X-3.524 Y9.358
+G1 X-3.618 Y9.323
+G1 X-3.711 Y9.286
+G1 X-3.804 Y9.248
+G1 X-3.896 Y9.210
+G1 X-3.988 Y9.170
+G1 X-4.080 Y9.130
+G1 X-4.171 Y9.089
+G1 X-4.261 Y9.047
+G1 X-4.352 Y9.003
+G1 X-4.442 Y8.959
+G1 X-4.531 Y8.915
+G1 X-4.620 Y8.869
+G1 X-4.708 Y8.822
+G1 X-4.796 Y8.775
+G1 X-4.884 Y8.726
+G1 X-4.971 Y8.677
+G1 X-5.058 Y8.627
+G1 X-5.144 Y8.576
+G1 X-5.229 Y8.524
+G1 X-5.314 Y8.471
+G1 X-5.399 Y8.417
+G1 X-5.483 Y8.363
+G1 X-5.566 Y8.308
+G1 X-5.649 Y8.252
+G1 X-5.731 Y8.195
+G1 X-5.813 Y8.137
+G1 X-5.894 Y8.078
+G1 X-5.975 Y8.019
+G1 X-6.054 Y7.959
+G1 X-6.134 Y7.898
+G1 X-6.213 Y7.836
+G1 X-6.291 Y7.774
+G1 X-6.368 Y7.710
+G1 X-6.445 Y7.646
+G1 X-6.521 Y7.581
+G1 X-6.597 Y7.516
+G1 X-6.671 Y7.449
+G1 X-6.746 Y7.382
+G1 X-6.819 Y7.314
+G1 X-6.892 Y7.246
+G1 X-6.964 Y7.176
+G1 X-7.036 Y7.106
+G1 X-7.106 Y7.036
+G1 X-7.176 Y6.964
+G1 X-7.246 Y6.892
+G1 X-7.314 Y6.819
+G1 X-7.382 Y6.746
+G1 X-7.449 Y6.671
+G1 X-7.516 Y6.597
+G1 X-7.581 Y6.521
+G1 X-7.646 Y6.445
+G1 X-7.710 Y6.368
+G1 X-7.774 Y6.291
+G1 X-7.836 Y6.213
+G1 X-7.898 Y6.134
+G1 X-7.959 Y6.054
+G1 X-8.019 Y5.975
+G1 X-8.078 Y5.894
+G1 X-8.137 Y5.813
+G1 X-8.195 Y5.731
+G1 X-8.252 Y5.649
+G1 X-8.308 Y5.566
+G1 X-8.363 Y5.483
+G1 X-8.417 Y5.399
+G1 X-8.471 Y5.314
+G1 X-8.524 Y5.229
+G1 X-8.576 Y5.144
+G1 X-8.627 Y5.058
+G1 X-8.677 Y4.971
+G1 X-8.726 Y4.884
+G1 X-8.775 Y4.796
+G1 X-8.822 Y4.708
+G1 X-8.869 Y4.620
+G1 X-8.915 Y4.531
+G1 X-8.959 Y4.442
+G1 X-9.003 Y4.352
+G1 X-9.047 Y4.261
+G1 X-9.089 Y4.171
+G1 X-9.130 Y4.080
+G1 X-9.170 Y3.988
+G1 X-9.210 Y3.896
+G1 X-9.248 Y3.804
+G1 X-9.286 Y3.711
+G1 X-9.323 Y3.618
+G1 X-9.358 Y3.524
+G1 X-9.393 Y3.431
+G1 X-9.427 Y3.336
+G1 X-9.460 Y3.242
+G1 X-9.492 Y3.147
+G1 X-9.523 Y3.052
+G1 X-9.553 Y2.957
+G1 X-9.582 Y2.861
+G1 X-9.610 Y2.765
+G1 X-9.637 Y2.669
+G1 X-9.664 Y2.572
+G1 X-9.689 Y2.475
+G1 X-9.713 Y2.378
+G1 X-9.736 Y2.281
+G1 X-9.759 Y2.183
+G1 X-9.780 Y2.086
+G1 X-9.800 Y1.988
+G1 X-9.820 Y1.890
+G1 X-9.838 Y1.791
+G1 X-9.856 Y1.693
+G1 X-9.872 Y1.594
+G1 X-9.888 Y1.495
+G1 X-9.902 Y1.396
+G1 X-9.916 Y1.297
+G1 X-9.928 Y1.198
+G1 X-9.939 Y1.098
+G1 X-9.950 Y0.999
+G1 X-9.959 Y0.899
+G1 X-9.968 Y0.800
+G1 X-9.975 Y0.700
+G1 X-9.982 Y0.600
+G1 X-9.987 Y0.500
+G1 X-9.992 Y0.400
+G1 X-9.995 Y0.300
+G1 X-9.998 Y0.200
+G1 X-9.999 Y0.100
+G1 X-10.000 Y0.000
+G1 X-9.999 Y-0.100
+G1 X-9.998 Y-0.200
+G1 X-9.995 Y-0.300
+G1 X-9.992 Y-0.400
+G1 X-9.987 Y-0.500
+G1 X-9.982 Y-0.600
+G1 X-9.975 Y-0.700
+G1 X-9.968 Y-0.800
+G1 X-9.959 Y-0.899
+G1 X-9.950 Y-0.999
+G1 X-9.939 Y-1.098
+G1 X-9.928 Y-1.198
+G1 X-9.916 Y-1.297
+G1 X-9.902 Y-1.396
+G1 X-9.888 Y-1.495
+G1 X-9.872 Y-1.594
+G1 X-9.856 Y-1.693
+G1 X-9.838 Y-1.791
+G1 X-9.820 Y-1.890
+G1 X-9.800 Y-1.988
+G1 X-9.780 Y-2.086
+G1 X-9.759 Y-2.183
+G1 X-9.736 Y-2.281
+G1 X-9.713 Y-2.378
+G1 X-9.689 Y-2.475
+G1 X-9.664 Y-2.572
+G1 X-9.637 Y-2.669
+G1 X-9.610 Y-2.765
+G1 X-9.582 Y-2.861
+G1 X-9.553 Y-2.957
+G1 X-9.523 Y-3.052
+G1 X-9.492 Y-3.147
+G1 X-9.460 Y-3.242
+G1 X-9.427 Y-3.336
+G1 X-9.393 Y-3.431
+G1 X-9.358 Y-3.524
+G1 X-9.323 Y-3.618
+G1 X-9.286 Y-3.711
+G1 X-9.248 Y-3.804
+G1 X-9.210 Y-3.896
+G1 X-9.170 Y-3.988
+G1 X-9.130 Y-4.080
+G1 X-9.089 Y-4.171
+G1 X-9.047 Y-4.261
+G1 X-9.003 Y-4.352
+G1 X-8.959 Y-4.442
+G1 X-8.915 Y-4.531
+G1 X-8.869 Y-4.620
+G1 X-8.822 Y-4.708
+G1 X-8.775 Y-4.796
+G1 X-8.726 Y-4.884
+G1 X-8.677 Y-4.971
+G1 X-8.627 Y-5.058
+G1 X-8.576 Y-5.144
+G1 X-8.524 Y-5.229
+G1 X-8.471 Y-5.314
+G1 X-8.417 Y-5.399
+G1 X-8.363 Y-5.483
+G1 X-8.308 Y-5.566
+G1 X-8.252 Y-5.649
+G1 X-8.195 Y-5.731
+G1 X-8.137 Y-5.813
+G1 X-8.078 Y-5.894
+G1 X-8.019 Y-5.975
+G1 X-7.959 Y-6.054
+G1 X-7.898 Y-6.134
+G1 X-7.836 Y-6.213
+G1 X-7.774 Y-6.291
+G1 X-7.710 Y-6.368
+G1 X-7.646 Y-6.445
+G1 X-7.581 Y-6.521
+G1 X-7.516 Y-6.597
+G1 X-7.449 Y-6.671
+G1 X-7.382 Y-6.746
+G1 X-7.314 Y-6.819
+G1 X-7.246 Y-6.892
+G1 X-7.176 Y-6.964
+G1 X-7.106 Y-7.036
+G1 X-7.036 Y-7.106
+G1 X-6.964 Y-7.176
+G1 X-6.892 Y-7.246
+G1 X-6.819 Y-7.314
+G1 X-6.746 Y-7.382
+G1 X-6.671 Y-7.449
+G1 X-6.597 Y-7.516
+G1 X-6.521 Y-7.581
+G1 X-6.445 Y-7.646
+G1 X-6.368 Y-7.710
+G1 X-6.291 Y-7.774
+G1 X-6.213 Y-7.836
+G1 X-6.134 Y-7.898
+G1 X-6.054 Y-7.959
+G1 X-5.975 Y-8.019
+G1 X-5.894 Y-8.078
+G1 X-5.813 Y-8.137
+G1 X-5.731 Y-8.195
+G1 X-5.649 Y-8.252
+G1 X-5.566 Y-8.308
+G1 X-5.483 Y-8.363
+G1 X-5.399 Y-8.417
+G1 X-5.314 Y-8.471
+G1 X-5.229 Y-8.524
+G1 X-5.144 Y-8.576
+G1 X-5.058 Y-8.627
+G1 X-4.971 Y-8.677
+G1 X-4.884 Y-8.726
+G1 X-4.796 Y-8.775
+G1 X-4.708 Y-8.822
+G1 X-4.620 Y-8.869
+G1 X-4.531 Y-8.915
+G1 X-4.442 Y-8.959
+G1 X-4.352 Y-9.003
+G1 X-4.261 Y-9.047
+G1 X-4.171 Y-9.089
+G1 X-4.080 Y-9.130
+G1 X-3.988 Y-9.170
+G1 X-3.896 Y-9.210
+G1 X-3.804 Y-9.248
+G1 X-3.711 Y-9.286
+G1 X-3.618 Y-9.323
+G1 X-3.524 Y-9.358
+G1 X-3.431 Y-9.393
+G1 X-3.336 Y-9.427
+G1 X-3.242 Y-9.460
+G1 X-3.147 Y-9.492
+G1 X-3.052 Y-9.523
+G1 X-2.957 Y-9.553
+G1 X-2.861 Y-9.582
+G1 X-2.765 Y-9.610
+G1 X-2.669 Y-9.637
+G1 X-2.572 Y-9.664
+G1 X-2.475 Y-9.689
+G1 X-2.378 Y-9.713
+G1 X-2.281 Y-9.736
+G1 X-2.183 Y-9.759
+G1 X-2.086 Y-9.780
+G1 X-1.988 Y-9.800
+G1 X-1.890 Y-9.820
+G1 X-1.791 Y-9.838
+G1 X-1.693 Y-9.856
+G1 X-1.594 Y-9.872
+G1 X-1.495 Y-9.888
+G1 X-1.396 Y-9.902
+G1 X-1.297 Y-9.916
+G1 X-1.198 Y-9.928
+G1 X-1.098 Y-9.939
+G1 X-0.999 Y-9.950
+G1 X-0.899 Y-9.959
+G1 X-0.800 Y-9.968
+G1 X-0.700 Y-9.975
+G1 X-0.600 Y-9.982
+G1 X-0.500 Y-9.987
+G1 X-0.400 Y-9.992
+G1 X-0.300 Y-9.995
+G1 X-0.200 Y-9.998
+G1 X-0.100 Y-9.999
+G1 X-0.000 Y-10.000
+G1 X0.100 Y-9.999
+G1 X0.200 Y-9.998
+G1 X0.300 Y-9.995
+G1 X0.400 Y-9.992
+G1 X0.500 Y-9.987
+G1 X0.600 Y-9.982
+G1 X0.700 Y-9.975
+G1 X0.800 Y-9.968
+G1 X0.899 Y-9.959
+G1 X0.999 Y-9.950
+G1 X1.098 Y-9.939
+G1 X1.198 Y-9.928
+G1 X1.297 Y-9.916
+G1 X1.396 Y-9.902
+G1 X1.495 Y-9.888
+G1 X1.594 Y-9.872
+G1 X1.693 Y-9.856
+G1 X1.791 Y-9.838
+G1 X1.890 Y-9.820
+G1 X1.988 Y-9.800
+G1 X2.086 Y-9.780
+G1 X2.183 Y-9.759
+G1 X2.281 Y-9.736
+G1 X2.378 Y-9.713
+G1 X2.475 Y-9.689
+G1 X2.572 Y-9.664
+G1 X2.669 Y-9.637
+G1 X2.765 Y-9.610
+G1 X2.861 Y-9.582
+G1 X2.957 Y-9.553
+G1 X3.052 Y-9.523
+G1 X3.147 Y-9.492
+G1 X3.242 Y-9.460
+G1 X3.336 Y-9.427
+G1 X3.431 Y-9.393
+G1 X3.524 Y-9.358
+G1 X3.618 Y-9.323
+G1 X3.711 Y-9.286
+G1 X3.804 Y-9.248
+G1 X3.896 Y-9.210
+G1 X3.988 Y-9.170
+G1 X4.080 Y-9.130
+G1 X4.171 Y-9.089
+G1 X4.261 Y-9.047
+G1 X4.352 Y-9.003
+G1 X4.442 Y-8.959
+G1 X4.531 Y-8.915
+G1 X4.620 Y-8.869
+G1 X4.708 Y-8.822
+G1 X4.796 Y-8.775
+G1 X4.884 Y-8.726
+G1 X4.971 Y-8.677
+G1 X5.058 Y-8.627
+G1 X5.144 Y-8.576
+G1 X5.229 Y-8.524
+G1 X5.314 Y-8.471
+G1 X5.399 Y-8.417
+G1 X5.483 Y-8.363
+G1 X5.566 Y-8.308
+G1 X5.649 Y-8.252
+G1 X5.731 Y-8.195
+G1 X5.813 Y-8.137
+G1 X5.894 Y-8.078
+G1 X5.975 Y-8.019
+G1 X6.054 Y-7.959
+G1 X6.134 Y-7.898
+G1 X6.213 Y-7.836
+G1 X6.291 Y-7.774
+G1 X6.368 Y-7.710
+G1 X6.445 Y-7.646
+G1 X6.521 Y-7.581
+G1 X6.597 Y-7.516
+G1 X6.671 Y-7.449
+G1 X6.746 Y-7.382
+G1 X6.819 Y-7.314
+G1 X6.892 Y-7.246
+G1 X6.964 Y-7.176
+G1 X7.036 Y-7.106
+G1 X7.106 Y-7.036
+G1 X7.176 Y-6.964
+G1 X7.246 Y-6.892
+G1 X7.314 Y-6.819
+G1 X7.382 Y-6.746
+G1 X7.449 Y-6.671
+G1 X7.516 Y-6.597
+G1 X7.581 Y-6.521
+G1 X7.646 Y-6.445
+G1 X7.710 Y-6.368
+G1 X7.774 Y-6.291
+G1 X7.836 Y-6.213
+G1 X7.898 Y-6.134
+G1 X7.959 Y-6.054
+G1 X8.019 Y-5.975
+G1 X8.078 Y-5.894
+G1 X8.137 Y-5.813
+G1 X8.195 Y-5.731
+G1 X8.252 Y-5.649
+G1 X8.308 Y-5.566
+G1 X8.363 Y-5.483
+G1 X8.417 Y-5.399
+G1 X8.471 Y-5.314
+G1 X8.524 Y-5.229
+G1 X8.576 Y-5.144
+G1 X8.627 Y-5.058
+G1 X8.677 Y-4.971
+G1 X8.726 Y-4.884
+G1 X8.775 Y-4.796
+G1 X8.822 Y-4.708
+G1 X8.869 Y-4.620
+G1 X8.915 Y-4.531
+G1 X8.959 Y-4.442
+G1 X9.003 Y-4.352
+G1 X9.047 Y-4.261
+G1 X9.089 Y-4.171
+G1 X9.130 Y-4.080
+G1 X9.170 Y-3.988
+G1 X9.210 Y-3.896
+G1 X9.248 Y-3.804
+G1 X9.286 Y-3.711
+G1 X9.323 Y-3.618
+G1 X9.358 Y-3.524
+G1 X9.393 Y-3.431
+G1 X9.427 Y-3.336
+G1 X9.460 Y-3.242
+G1 X9.492 Y-3.147
+G1 X9.523 Y-3.052
+G1 X9.553 Y-2.957
+G1 X9.582 Y-2.861
+G1 X9.610 Y-2.765
+G1 X9.637 Y-2.669
+G1 X9.664 Y-2.572
+G1 X9.689 Y-2.475
+G1 X9.713 Y-2.378
+G1 X9.736 Y-2.281
+G1 X9.759 Y-2.183
+G1 X9.780 Y-2.086
+G1 X9.800 Y-1.988
+G1 X9.820 Y-1.890
+G1 X9.838 Y-1.791
+G1 X9.856 Y-1.693
+G1 X9.872 Y-1.594
+G1 X9.888 Y-1.495
+G1 X9.902 Y-1.396
+G1 X9.916 Y-1.297
+G1 X9.928 Y-1.198
+G1 X9.939 Y-1.098
+G1 X9.950 Y-0.999
+G1 X9.959 Y-0.899
+G1 X9.968 Y-0.800
+G1 X9.975 Y-0.700
+G1 X9.982 Y-0.600
+G1 X9.987 Y-0.500
+G1 X9.992 Y-0.400
+G1 X9.995 Y-0.300
+G1 X9.998 Y-0.200
+G1 X9.999 Y-0.100
+G1 X10.000 Y-0.000
+G1 X20.000 Y0
+G1 X19.999 Y0.100
+G1 X19.998 Y0.200
+G1 X19.995 Y0.300
+G1 X19.992 Y0.400
+G1 X19.987 Y0.500
+G1 X19.982 Y0.600
+G1 X19.975 Y0.700
+G1 X19.968 Y0.800
+G1 X19.959 Y0.899
+G1 X19.950 Y0.999
+G1 X19.939 Y1.098
+G1 X19.928 Y1.198
+G1 X19.916 Y1.297
+G1 X19.902 Y1.396
+G1 X19.888 Y1.495
+G1 X19.872 Y1.594
+G1 X19.856 Y1.693
+G1 X19.838 Y1.791
+G1 X19.820 Y1.890
+G1 X19.800 Y1.988
+G1 X19.780 Y2.086
+G1 X19.759 Y2.183
+G1 X19.736 Y2.281
+G1 X19.713 Y2.378
+G1 X19.689 Y2.475
+G1 X19.664 Y2.572
+G1 X19.637 Y2.669
+G1 X19.610 Y2.765
+G1 X19.582 Y2.861
+G1 X19.553 Y2.957
+G1 X19.523 Y3.052
+G1 X19.492 Y3.147
+G1 X19.460 Y3.242
+G1 X19.427 Y3.336
+G1 X19.393 Y3.431
+G1 X19.358 Y3.524
+G1 X19.323 Y3.618
+G1 X19.286 Y3.711
+G1 X19.248 Y3.804
+G1 X19.210 Y3.896
+G1 X19.170 Y3.988
+G1 X19.130 Y4.080
+G1 X19.089 Y4.171
+G1 X19.047 Y4.261
+G1 X19.003 Y4.352
+G1 X18.959 Y4.442
+G1 X18.915 Y4.531
+G1 X18.869 Y4.620
+G1 X18.822 Y4.708
+G1 X18.775 Y4.796
+G1 X18.726 Y4.884
+G1 X18.677 Y4.971
+G1 X18.627 Y5.058
+G1 X18.576 Y5.144
+G1 X18.524 Y5.229
+G1 X18.471 Y5.314
+G1 X18.417 Y5.399
+G1 X18.363 Y5.483
+G1 X18.308 Y5.566
+G1 X18.252 Y5.649
+G1 X18.195 Y5.731
+G1 X18.137 Y5.813
+G1 X18.078 Y5.894
+G1 X18.019 Y5.975
+G1 X17.959 Y6.054
+G1 X17.898 Y6.134
+G1 X17.836 Y6.213
+G1 X17.774 Y6.291
+G1 X17.710 Y6.368
+G1 X17.646 Y6.445
+G1 X17.581 Y6.521
+G1 X17.516 Y6.597
+G1 X17.449 Y6.671
+G1 X17.382 Y6.746
+G1 X17.314 Y6.819
+G1 X17.246 Y6.892
+G1 X17.176 Y6.964
+G1 X17.106 Y7.036
+G1 X17.036 Y7.106
+G1 X16.964 Y7.176
+G1 X16.892 Y7.246
+G1 X16.819 Y7.314
+G1 X16.746 Y7.382
+G1 X16.671 Y7.449
+G1 X16.597 Y7.516
+G1 X16.521 Y7.581
+G1 X16.445 Y7.646
+G1 X16.368 Y7.710
+G1 X16.291 Y7.774
+G1 X16.213 Y7.836
+G1 X16.134 Y7.898
+G1 X16.054 Y7.959
+G1 X15.975 Y8.019
+G1 X15.894 Y8.078
+G1 X15.813 Y8.137
+G1 X15.731 Y8.195
+G1 X15.649 Y8.252
+G1 X15.566 Y8.308
+G1 X15.483 Y8.363
+G1 X15.399 Y8.417
+G1 X15.314 Y8.471
+G1 X15.229 Y8.524
+G1 X15.144 Y8.576
+G1 X15.058 Y8.627
+G1 X14.971 Y8.677
+G1 X14.884 Y8.726
+G1 X14.796 Y8.775
+G1 X14.708 Y8.822
+G1 X14.620 Y8.869
+G1 X14.531 Y8.915
+G1 X14.442 Y8.959
+G1 X14.352 Y9.003
+G1 X14.261 Y9.047
+G1 X14.171 Y9.089
+G1 X14.080 Y9.130
+G1 X13.988 Y9.170
+G1 X13.896 Y9.210
+G1 X13.804 Y9.248
+G1 X13.711 Y9.286
+G1 X13.618 Y9.323
+G1 X13.524 Y9.358
+G1 X13.431 Y9.393
+G1 X13.336 Y9.427
+G1 X13.242 Y9.460
+G1 X13.147 Y9.492
+G1 X13.052 Y9.523
+G1 X12.957 Y9.553
+G1 X12.861 Y9.582
+G1 X12.765 Y9.610
+G1 X12.669 Y9.637
+G1 X12.572 Y9.664
+G1 X12.475 Y9.689
+G1 X12.378 Y9.713
+G1 X12.281 Y9.736
+G1 X12.183 Y9.759
+G1 X12.086 Y9.780
+G1 X11.988 Y9.800
+G1 X11.890 Y9.820
+G1 X11.791 Y9.838
+G1 X11.693 Y9.856
+G1 X11.594 Y9.872
+G1 X11.495 Y9.888
+G1 X11.396 Y9.902
+G1 X11.297 Y9.916
+G1 X11.198 Y9.928
+G1 X11.098 Y9.939
+G1 X10.999 Y9.950
+G1 X10.899 Y9.959
+G1 X10.800 Y9.968
+G1 X10.700 Y9.975
+G1 X10.600 Y9.982
+G1 X10.500 Y9.987
+G1 X10.400 Y9.992
+G1 X10.300 Y9.995
+G1 X10.200 Y9.998
+G1 X10.100 Y9.999
+G1 X10.000 Y10.000
+G1 X9.900 Y9.999
+G1 X9.800 Y9.998
+G1 X9.700 Y9.995
+G1 X9.600 Y9.992
+G1 X9.500 Y9.987
+G1 X9.400 Y9.982
+G1 X9.300 Y9.975
+G1 X9.200 Y9.968
+G1 X9.101 Y9.959
+G1 X9.001 Y9.950
+G1 X8.902 Y9.939
+G1 X8.802 Y9.928
+G1 X8.703 Y9.916
+G1 X8.604 Y9.902
+G1 X8.505 Y9.888
+G1 X8.406 Y9.872
+G1 X8.307 Y9.856
+G1 X8.209 Y9.838
+G1 X8.110 Y9.820
+G1 X8.012 Y9.800
+G1 X7.914 Y9.780
+G1 X7.817 Y9.759
+G1 X7.719 Y9.736
+G1 X7.622 Y9.713
+G1 X7.525 Y9.689
+G1 X7.428 Y9.664
+G1 X7.331 Y9.637
+G1 X7.235 Y9.610
+G1 X7.139 Y9.582
+G1 X7.043 Y9.553
+G1 X6.948 Y9.523
+G1 X6.853 Y9.492
+G1 X6.758 Y9.460
+G1 X6.664 Y9.427
+G1 X6.569 Y9.393
+G1 X6.476 Y9.358
+G1 X6.382 Y9.323
+G1 X6.289 Y9.286
+G1 X6.196 Y9.248
+G1 X6.104 Y9.210
+G1 X6.012 Y9.170
+G1 X5.920 Y9.130
+G1 X5.829 Y9.089
+G1 X5.739 Y9.047
+G1 X5.648 Y9.003
+G1 X5.558 Y8.959
+G1 X5.469 Y8.915
+G1 X5.380 Y8.869
+G1 X5.292 Y8.822
+G1 X5.204 Y8.775
+G1 X5.116 Y8.726
+G1 X5.029 Y8.677
+G1 X4.942 Y8.627
+G1 X4.856 Y8.576
+G1 X4.771 Y8.524
+G1 X4.686 Y8.471
+G1 X4.601 Y8.417
+G1 X4.517 Y8.363
+G1 X4.434 Y8.308
+G1 X4.351 Y8.252
+G1 X4.269 Y8.195
+G1 X4.187 Y8.137
+G1 X4.106 Y8.078
+G1 X4.025 Y8.019
+G1 X3.946 Y7.959
+G1 X3.866 Y7.898
+G1 X3.787 Y7.836
+G1 X3.709 Y7.774
+G1 X3.632 Y7.710
+G1 X3.555 Y7.646
+G1 X3.479 Y7.581
+G1 X3.403 Y7.516
+G1 X3.329 Y7.449
+G1 X3.254 Y7.382
+G1 X3.181 Y7.314
+G1 X3.108 Y7.246
+G1 X3.036 Y7.176
+G1 X2.964 Y7.106
+G1 X2.894 Y7.036
+G1 X2.824 Y6.964
+G1 X2.754 Y6.892
+G1 X2.686 Y6.819
+G1 X2.618 Y6.746
+G1 X2.551 Y6.671
+G1 X2.484 Y6.597
+G1 X2.419 Y6.521
+G1 X2.354 Y6.445
+G1 X2.290 Y6.368
+G1 X2.226 Y6.291
+G1 X2.164 Y6.213
+G1 X2.102 Y6.134
+G1 X2.041 Y6.054
+G1 X1.981 Y5.975
+G1 X1.922 Y5.894
+G1 X1.863 Y5.813
+G1 X1.805 Y5.731
+G1 X1.748 Y5.649
+G1 X1.692 Y5.566
+G1 X1.637 Y5.483
+G1 X1.583 Y5.399
+G1 X1.529 Y5.314
+G1 X1.476 Y5.229
+G1 X1.424 Y5.144
+G1 X1.373 Y5.058
+G1 X1.323 Y4.971
+G1 X1.274 Y4.884
+G1 X1.225 Y4.796
+G1 X1.178 Y4.708
+G1 X1.131 Y4.620
+G1 X1.085 Y4.531
+G1 X1.041 Y4.442
+G1 X0.997 Y4.352
+G1 X0.953 Y4.261
+G1 X0.911 Y4.171
+G1 X0.870 Y4.080
+G1 X0.830 Y3.988
+G1 X0.790 Y3.896
+G1 X0.752 Y3.804
+G1 X0.714 Y3.711
+G1 X0.677 Y3.618
+G1 X0.642 Y3.524
+G1 X0.607 Y3.431
+G1 X0.573 Y3.336
+G1 X0.540 Y3.242
+G1 X0.508 Y3.147
+G1 X0.477 Y3.052
+G1 X0.447 Y2.957
+G1 X0.418 Y2.861
+G1 X0.390 Y2.765
+G1 X0.363 Y2.669
+G1 X0.336 Y2.572
+G1 X0.311 Y2.475
+G1 X0.287 Y2.378
+G1 X0.264 Y2.281
+G1 X0.241 Y2.183
+G1 X0.220 Y2.086
+G1 X0.200 Y1.988
+G1 X0.180 Y1.890
+G1 X0.162 Y1.791
+G1 X0.144 Y1.693
+G1 X0.128 Y1.594
+G1 X0.112 Y1.495
+G1 X0.098 Y1.396
+G1 X0.084 Y1.297
+G1 X0.072 Y1.198
+G1 X0.061 Y1.098
+G1 X0.050 Y0.999
+G1 X0.041 Y0.899
+G1 X0.032 Y0.800
+G1 X0.025 Y0.700
+G1 X0.018 Y0.600
+G1 X0.013 Y0.500
+G1 X0.008 Y0.400
+G1 X0.005 Y0.300
+G1 X0.002 Y0.200
+G1 X0.001 Y0.100
+G1 X0.000 Y0.000
+G1 X0.001 Y-0.100
+G1 X0.002 Y-0.200
+G1 X0.005 Y-0.300
+G1 X0.008 Y-0.400
+G1 X0.013 Y-0.500
+G1 X0.018 Y-0.600
+G1 X0.025 Y-0.700
+G1 X0.032 Y-0.800
+G1 X0.041 Y-0.899
+G1 X0.050 Y-0.999
+G1 X0.061 Y-1.098
+G1 X0.072 Y-1.198
+G1 X0.084 Y-1.297
+G1 X0.098 Y-1.396
+G1 X0.112 Y-1.495
+G1 X0.128 Y-1.594
+G1 X0.144 Y-1.693
+G1 X0.162 Y-1.791
+G1 X0.180 Y-1.890
+G1 X0.200 Y-1.988
+G1 X0.220 Y-2.086
+G1 X0.241 Y-2.183
+G1 X0.264 Y-2.281
+G1 X0.287 Y-2.378
+G1 X0.311 Y-2.475
+G1 X0.336 Y-2.572
+G1 X0.363 Y-2.669
+G1 X0.390 Y-2.765
+G1 X0.418 Y-2.861
+G1 X0.447 Y-2.957
+G1 X0.477 Y-3.052
+G1 X0.508 Y-3.147
+G1 X0.540 Y-3.242
+G1 X0.573 Y-3.336
+G1 X0.607 Y-3.431
+G1 X0.642 Y-3.524
+G1 X0.677 Y-3.618
+G1 X0.714 Y-3.711
+G1 X0.752 Y-3.804
+G1 X0.790 Y-3.896
+G1 X0.830 Y-3.988
+G1 X0.870 Y-4.080
+G1 X0.911 Y-4.171
+G1 X0.953 Y-4.261
+G1 X0.997 Y-4.352
+G1 X1.041 Y-4.442
+G1 X1.085 Y-4.531
+G1 X1.131 Y-4.620
+G1 X1.178 Y-4.708
+G1 X1.225 Y-4.796
+G1 X1.274 Y-4.884
+G1 X1.323 Y-4.971
+G1 X1.373 Y-5.058
+G1 X1.424 Y-5.144
+G1 X1.476 Y-5.229
+G1 X1.529 Y-5.314
+G1 X1.583 Y-5.399
+G1 X1.637 Y-5.483
+G1 X1.692 Y-5.566
+G1 X1.748 Y-5.649
+G1 X1.805 Y-5.731
+G1 X1.863 Y-5.813
+G1 X1.922 Y-5.894
+G1 X1.981 Y-5.975
+G1 X2.041 Y-6.054
+G1 X2.102 Y-6.134
+G1 X2.164 Y-6.213
+G1 X2.226 Y-6.291
+G1 X2.290 Y-6.368
+G1 X2.354 Y-6.445
+G1 X2.419 Y-6.521
+G1 X2.484 Y-6.597
+G1 X2.551 Y-6.671
+G1 X2.618 Y-6.746
+G1 X2.686 Y-6.819
+G1 X2.754 Y-6.892
+G1 X2.824 Y-6.964
+G1 X2.894 Y-7.036
+G1 X2.964 Y-7.106
+G1 X3.036 Y-7.176
+G1 X3.108 Y-7.246
+G1 X3.181 Y-7.314
+G1 X3.254 Y-7.382
+G1 X3.329 Y-7.449
+G1 X3.403 Y-7.516
+G1 X3.479 Y-7.581
+G1 X3.555 Y-7.646
+G1 X3.632 Y-7.710
+G1 X3.709 Y-7.774
+G1 X3.787 Y-7.836
+G1 X3.866 Y-7.898
+G1 X3.946 Y-7.959
+G1 X4.025 Y-8.019
+G1 X4.106 Y-8.078
+G1 X4.187 Y-8.137
+G1 X4.269 Y-8.195
+G1 X4.351 Y-8.252
+G1 X4.434 Y-8.308
+G1 X4.517 Y-8.363
+G1 X4.601 Y-8.417
+G1 X4.686 Y-8.471
+G1 X4.771 Y-8.524
+G1 X4.856 Y-8.576
+G1 X4.942 Y-8.627
+G1 X5.029 Y-8.677
+G1 X5.116 Y-8.726
+G1 X5.204 Y-8.775
+G1 X5.292 Y-8.822
+G1 X5.380 Y-8.869
+G1 X5.469 Y-8.915
+G1 X5.558 Y-8.959
+G1 X5.648 Y-9.003
+G1 X5.739 Y-9.047
+G1 X5.829 Y-9.089
+G1 X5.920 Y-9.130
+G1 X6.012 Y-9.170
+G1 X6.104 Y-9.210
+G1 X6.196 Y-9.248
+G1 X6.289 Y-9.286
+G1 X6.382 Y-9.323
+G1 X6.476 Y-9.358
+G1 X6.569 Y-9.393
+G1 X6.664 Y-9.427
+G1 X6.758 Y-9.460
+G1 X6.853 Y-9.492
+G1 X6.948 Y-9.523
+G1 X7.043 Y-9.553
+G1 X7.139 Y-9.582
+G1 X7.235 Y-9.610
+G1 X7.331 Y-9.637
+G1 X7.428 Y-9.664
+G1 X7.525 Y-9.689
+G1 X7.622 Y-9.713
+G1 X7.719 Y-9.736
+G1 X7.817 Y-9.759
+G1 X7.914 Y-9.780
+G1 X8.012 Y-9.800
+G1 X8.110 Y-9.820
+G1 X8.209 Y-9.838
+G1 X8.307 Y-9.856
+G1 X8.406 Y-9.872
+G1 X8.505 Y-9.888
+G1 X8.604 Y-9.902
+G1 X8.703 Y-9.916
+G1 X8.802 Y-9.928
+G1 X8.902 Y-9.939
+G1 X9.001 Y-9.950
+G1 X9.101 Y-9.959
+G1 X9.200 Y-9.968
+G1 X9.300 Y-9.975
+G1 X9.400 Y-9.982
+G1 X9.500 Y-9.987
+G1 X9.600 Y-9.992
+G1 X9.700 Y-9.995
+G1 X9.800 Y-9.998
+G1 X9.900 Y-9.999
+G1 X10.000 Y-10.000
+G1 X10.100 Y-9.999
+G1 X10.200 Y-9.998
+G1 X10.300 Y-9.995
+G1 X10.400 Y-9.992
+G1 X10.500 Y-9.987
+G1 X10.600 Y-9.982
+G1 X10.700 Y-9.975
+G1 X10.800 Y-9.968
+G1 X10.899 Y-9.959
+G1 X10.999 Y-9.950
+G1 X11.098 Y-9.939
+G1 X11.198 Y-9.928
+G1 X11.297 Y-9.916
+G1 X11.396 Y-9.902
+G1 X11.495 Y-9.888
+G1 X11.594 Y-9.872
+G1 X11.693 Y-9.856
+G1 X11.791 Y-9.838
+G1 X11.890 Y-9.820
+G1 X11.988 Y-9.800
+G1 X12.086 Y-9.780
+G1 X12.183 Y-9.759
+G1 X12.281 Y-9.736
+G1 X12.378 Y-9.713
+G1 X12.475 Y-9.689
+G1 X12.572 Y-9.664
+G1 X12.669 Y-9.637
+G1 X12.765 Y-9.610
+G1 X12.861 Y-9.582
+G1 X12.957 Y-9.553
+G1 X13.052 Y-9.523
+G1 X13.147 Y-9.492
+G1 X13.242 Y-9.460
+G1 X13.336 Y-9.427
+G1 X13.431 Y-9.393
+G1 X13.524 Y-9.358
+G1 X13.618 Y-9.323
+G1 X13.711 Y-9.286
+G1 X13.804 Y-9.248
+G1 X13.896 Y-9.210
+G1 X13.988 Y-9.170
+G1 X14.080 Y-9.130
+G1 X14.171 Y-9.089
+G1 X14.261 Y-9.047
+G1 X14.352 Y-9.003
+G1 X14.442 Y-8.959
+G1 X14.531 Y-8.915
+G1 X14.620 Y-8.869
+G1 X14.708 Y-8.822
+G1 X14.796 Y-8.775
+G1 X14.884 Y-8.726
+G1 X14.971 Y-8.677
+G1 X15.058 Y-8.627
+G1 X15.144 Y-8.576
+G1 X15.229 Y-8.524
+G1 X15.314 Y-8.471
+G1 X15.399 Y-8.417
+G1 X15.483 Y-8.363
+G1 X15.566 Y-8.308
+G1 X15.649 Y-8.252
+G1 X15.731 Y-8.195
+G1 X15.813 Y-8.137
+G1 X15.894 Y-8.078
+G1 X15.975 Y-8.019
+G1 X16.054 Y-7.959
+G1 X16.134 Y-7.898
+G1 X16.213 Y-7.836
+G1 X16.291 Y-7.774
+G1 X16.368 Y-7.710
+G1 X16.445 Y-7.646
+G1 X16.521 Y-7.581
+G1 X16.597 Y-7.516
+G1 X16.671 Y-7.449
+G1 X16.746 Y-7.382
+G1 X16.819 Y-7.314
+G1 X16.892 Y-7.246
+G1 X16.964 Y-7.176
+G1 X17.036 Y-7.106
+G1 X17.106 Y-7.036
+G1 X17.176 Y-6.964
+G1 X17.246 Y-6.892
+G1 X17.314 Y-6.819
+G1 X17.382 Y-6.746
+G1 X17.449 Y-6.671
+G1 X17.516 Y-6.597
+G1 X17.581 Y-6.521
+G1 X17.646 Y-6.445
+G1 X17.710 Y-6.368
+G1 X17.774 Y-6.291
+G1 X17.836 Y-6.213
+G1 X17.898 Y-6.134
+G1 X17.959 Y-6.054
+G1 X18.019 Y-5.975
+G1 X18.078 Y-5.894
+G1 X18.137 Y-5.813
+G1 X18.195 Y-5.731
+G1 X18.252 Y-5.649
+G1 X18.308 Y-5.566
+G1 X18.363 Y-5.483
+G1 X18.417 Y-5.399
+G1 X18.471 Y-5.314
+G1 X18.524 Y-5.229
+G1 X18.576 Y-5.144
+G1 X18.627 Y-5.058
+G1 X18.677 Y-4.971
+G1 X18.726 Y-4.884
+G1 X18.775 Y-4.796
+G1 X18.822 Y-4.708
+G1 X18.869 Y-4.620
+G1 X18.915 Y-4.531
+G1 X18.959 Y-4.442
+G1 X19.003 Y-4.352
+G1 X19.047 Y-4.261
+G1 X19.089 Y-4.171
+G1 X19.130 Y-4.080
+G1 X19.170 Y-3.988
+G1 X19.210 Y-3.896
+G1 X19.248 Y-3.804
+G1 X19.286 Y-3.711
+G1 X19.323 Y-3.618
+G1 X19.358 Y-3.524
+G1 X19.393 Y-3.431
+G1 X19.427 Y-3.336
+G1 X19.460 Y-3.242
+G1 X19.492 Y-3.147
+G1 X19.523 Y-3.052
+G1 X19.553 Y-2.957
+G1 X19.582 Y-2.861
+G1 X19.610 Y-2.765
+G1 X19.637 Y-2.669
+G1 X19.664 Y-2.572
+G1 X19.689 Y-2.475
+G1 X19.713 Y-2.378
+G1 X19.736 Y-2.281
+G1 X19.759 Y-2.183
+G1 X19.780 Y-2.086
+G1 X19.800 Y-1.988
+G1 X19.820 Y-1.890
+G1 X19.838 Y-1.791
+G1 X19.856 Y-1.693
+G1 X19.872 Y-1.594
+G1 X19.888 Y-1.495
+G1 X19.902 Y-1.396
+G1 X19.916 Y-1.297
+G1 X19.928 Y-1.198
+G1 X19.939 Y-1.098
+G1 X19.950 Y-0.999
+G1 X19.959 Y-0.899
+G1 X19.968 Y-0.800
+G1 X19.975 Y-0.700
+G1 X19.982 Y-0.600
+G1 X19.987 Y-0.500
+G1 X19.992 Y-0.400
+G1 X19.995 Y-0.300
+G1 X19.998 Y-0.200
+G1 X19.999 Y-0.100
+G1 X20.000 Y-0.000
+G1 X30.000 Y0
+G1 X29.999 Y0.100
+G1 X29.998 Y0.200
+G1 X29.995 Y0.300
+G1 X29.992 Y0.400
+G1 X29.987 Y0.500
+G1 X29.982 Y0.600
+G1 X29.975 Y0.700
+G1 X29.968 Y0.800
+G1 X29.959 Y0.899
+G1 X29.950 Y0.999
+G1 X29.939 Y1.098
+G1 X29.928 Y1.198
+G1 X29.916 Y1.297
+G1 X29.902 Y1.396
+G1 X29.888 Y1.495
+G1 X29.872 Y1.594
+G1 X29.856 Y1.693
+G1 X29.838 Y1.791
+G1 X29.820 Y1.890
+G1 X29.800 Y1.988
+G1 X29.780 Y2.086
+G1 X29.759 Y2.183
+G1 X29.736 Y2.281
+G1 X29.713 Y2.378
+G1 X29.689 Y2.475
+G1 X29.664 Y2.572
+G1 X29.637 Y2.669
+G1 X29.610 Y2.765
+G1 X29.582 Y2.861
+G1 X29.553 Y2.957
+G1 X29.523 Y3.052
+G1 X29.492 Y3.147
+G1 X29.460 Y3.242
+G1 X29.427 Y3.336
+G1 X29.393 Y3.431
+G1 X29.358 Y3.524
+G1 X29.323 Y3.618
+G1 X29.286 Y3.711
+G1 X29.248 Y3.804
+G1 X29.210 Y3.896
+G1 X29.170 Y3.988
+G1 X29.130 Y4.080
+G1 X29.089 Y4.171
+G1 X29.047 Y4.261
+G1 X29.003 Y4.352
+G1 X28.959 Y4.442
+G1 X28.915 Y4.531
+G1 X28.869 Y4.620
+G1 X28.822 Y4.708
+G1 X28.775 Y4.796
+G1 X28.726 Y4.884
+G1 X28.677 Y4.971
+G1 X28.627 Y5.058
+G1 X28.576 Y5.144
+G1 X28.524 Y5.229
+G1 X28.471 Y5.314
+G1 X28.417 Y5.399
+G1 X28.363 Y5.483
+G1 X28.308 Y5.566
+G1 X28.252 Y5.649
+G1 X28.195 Y5.731
+G1 X28.137 Y5.813
+G1 X28.078 Y5.894
+G1 X28.019 Y5.975
+G1 X27.959 Y6.054
+G1 X27.898 Y6.134
+G1 X27.836 Y6.213
+G1 X27.774 Y6.291
+G1 X27.710 Y6.368
+G1 X27.646 Y6.445
+G1 X27.581 Y6.521
+G1 X27.516 Y6.597
+G1 X27.449 Y6.671
+G1 X27.382 Y6.746
+G1 X27.314 Y6.819
+G1 X27.246 Y6.892
+G1 X27.176 Y6.964
+G1 X27.106 Y7.036
+G1 X27.036 Y7.106
+G1 X26.964 Y7.176
+G1 X26.892 Y7.246
+G1 X26.819 Y7.314
+G1 X26.746 Y7.382
+G1 X26.671 Y7.449
+G1 X26.597 Y7.516
+G1 X26.521 Y7.581
+G1 X26.445 Y7.646
+G1 X26.368 Y7.710
+G1 X26.291 Y7.774
+G1 X26.213 Y7.836
+G1 X26.134 Y7.898
+G1 X26.054 Y7.959
+G1 X25.975 Y8.019
+G1 X25.894 Y8.078
+G1 X25.813 Y8.137
+G1 X25.731 Y8.195
+G1 X25.649 Y8.252
+G1 X25.566 Y8.308
+G1 X25.483 Y8.363
+G1 X25.399 Y8.417
+G1 X25.314 Y8.471
+G1 X25.229 Y8.524
+G1 X25.144 Y8.576
+G1 X25.058 Y8.627
+G1 X24.971 Y8.677
+G1 X24.884 Y8.726
+G1 X24.796 Y8.775
+G1 X24.708 Y8.822
+G1 X24.620 Y8.869
+G1 X24.531 Y8.915
+G1 X24.442 Y8.959
+G1 X24.352 Y9.003
+G1 X24.261 Y9.047
+G1 X24.171 Y9.089
+G1 X24.080 Y9.130
+G1 X23.988 Y9.170
+G1 X23.896 Y9.210
+G1 X23.804 Y9.248
+G1 X23.711 Y9.286
+G1 X23.618 Y9.323
+G1 X23.524 Y9.358
+G1 X23.431 Y9.393
+G1 X23.336 Y9.427
+G1 X23.242 Y9.460
+G1 X23.147 Y9.492
+G1 X23.052 Y9.523
+G1 X22.957 Y9.553
+G1 X22.861 Y9.582
+G1 X22.765 Y9.610
+G1 X22.669 Y9.637
+G1 X22.572 Y9.664
+G1 X22.475 Y9.689
+G1 X22.378 Y9.713
+G1 X22.281 Y9.736
+G1 X22.183 Y9.759
+G1 X22.086 Y9.780
+G1 X21.988 Y9.800
+G1 X21.890 Y9.820
+G1 X21.791 Y9.838
+G1 X21.693 Y9.856
+G1 X21.594 Y9.872
+G1 X21.495 Y9.888
+G1 X21.396 Y9.902
+G1 X21.297 Y9.916
+G1 X21.198 Y9.928
+G1 X21.098 Y9.939
+G1 X20.999 Y9.950
+G1 X20.899 Y9.959
+G1 X20.800 Y9.968
+G1 X20.700 Y9.975
+G1 X20.600 Y9.982
+G1 X20.500 Y9.987
+G1 X20.400 Y9.992
+G1 X20.300 Y9.995
+G1 X20.200 Y9.998
+G1 X20.100 Y9.999
+G1 X20.000 Y10.000
+G1 X19.900 Y9.999
+G1 X19.800 Y9.998
+G1 X19.700 Y9.995
+G1 X19.600 Y9.992
+G1 X19.500 Y9.987
+G1 X19.400 Y9.982
+G1 X19.300 Y9.975
+G1 X19.200 Y9.968
+G1 X19.101 Y9.959
+G1 X19.001 Y9.950
+G1 X18.902 Y9.939
+G1 X18.802 Y9.928
+G1 X18.703 Y9.916
+G1 X18.604 Y9.902
+G1 X18.505 Y9.888
+G1 X18.406 Y9.872
+G1 X18.307 Y9.856
+G1 X18.209 Y9.838
+G1 X18.110 Y9.820
+G1 X18.012 Y9.800
+G1 X17.914 Y9.780
+G1 X17.817 Y9.759
+G1 X17.719 Y9.736
+G1 X17.622 Y9.713
+G1 X17.525 Y9.689
+G1 X17.428 Y9.664
+G1 X17.331 Y9.637
+G1 X17.235 Y9.610
+G1 X17.139 Y9.582
+G1 X17.043 Y9.553
+G1 X16.948 Y9.523
+G1 X16.853 Y9.492
+G1 X16.758 Y9.460
+G1 X16.664 Y9.427
+G1 X16.569 Y9.393
+G1 X16.476 Y9.358
+G1 X16.382 Y9.323
+G1 X16.289 Y9.286
+G1 X16.196 Y9.248
+G1 X16.104 Y9.210
+G1 X16.012 Y9.170
+G1 X15.920 Y9.130
+G1 X15.829 Y9.089
+G1 X15.739 Y9.047
+G1 X15.648 Y9.003
+G1 X15.558 Y8.959
+G1 X15.469 Y8.915
+G1 X15.380 Y8.869
+G1 X15.292 Y8.822
+G1 X15.204 Y8.775
+G1 X15.116 Y8.726
+G1 X15.029 Y8.677
+G1 X14.942 Y8.627
+G1 X14.856 Y8.576
+G1 X14.771 Y8.524
+G1 X14.686 Y8.471
+G1 X14.601 Y8.417
+G1 X14.517 Y8.363
+G1 X14.434 Y8.308
+G1 X14.351 Y8.252
+G1 X14.269 Y8.195
+G1 X14.187 Y8.137
+G1 X14.106 Y8.078
+G1 X14.025 Y8.019
+G1 X13.946 Y7.959
+G1 X13.866 Y7.898
+G1 X13.787 Y7.836
+G1 X13.709 Y7.774
+G1 X13.632 Y7.710
+G1 X13.555 Y7.646
+G1 X13.479 Y7.581
+G1 X13.403 Y7.516
+G1 X13.329 Y7.449
+G1 X13.254 Y7.382
+G1 X13.181 Y7.314
+G1 X13.108 Y7.246
+G1 X13.036 Y7.176
+G1 X12.964 Y7.106
+G1 X12.894 Y7.036
+G1 X12.824 Y6.964
+G1 X12.754 Y6.892
+G1 X12.686 Y6.819
+G1 X12.618 Y6.746
+G1 X12.551 Y6.671
+G1 X12.484 Y6.597
+G1 X12.419 Y6.521
+G1 X12.354 Y6.445
+G1 X12.290 Y6.368
+G1 X12.226 Y6.291
+G1 X12.164 Y6.213
+G1 X12.102 Y6.134
+G1 X12.041 Y6.054
+G1 X11.981 Y5.975
+G1 X11.922 Y5.894
+G1 X11.863 Y5.813
+G1 X11.805 Y5.731
+G1 X11.748 Y5.649
+G1 X11.692 Y5.566
+G1 X11.637 Y5.483
+G1 X11.583 Y5.399
+G1 X11.529 Y5.314
+G1 X11.476 Y5.229
+G1 X11.424 Y5.144
+G1 X11.373 Y5.058
+G1 X11.323 Y4.971
+G1 X11.274 Y4.884
+G1 X11.225 Y4.796
+G1 X11.178 Y4.708
+G1 X11.131 Y4.620
+G1 X11.085 Y4.531
+G1 X11.041 Y4.442
+G1 X10.997 Y4.352
+G1 X10.953 Y4.261
+G1 X10.911 Y4.171
+G1 X10.870 Y4.080
+G1 X10.830 Y3.988
+G1 X10.790 Y3.896
+G1 X10.752 Y3.804
+G1 X10.714 Y3.711
+G1 X10.677 Y3.618
+G1 X10.642 Y3.524
+G1 X10.607 Y3.431
+G1 X10.573 Y3.336
+G1 X10.540 Y3.242
+G1 X10.508 Y3.147
+G1 X10.477 Y3.052
+G1 X10.447 Y2.957
+G1 X10.418 Y2.861
+G1 X10.390 Y2.765
+G1 X10.363 Y2.669
+G1 X10.336 Y2.572
+G1 X10.311 Y2.475
+G1 X10.287 Y2.378
+G1 X10.264 Y2.281
+G1 X10.241 Y2.183
+G1 X10.220 Y2.086
+G1 X10.200 Y1.988
+G1 X10.180 Y1.890
+G1 X10.162 Y1.791
+G1 X10.144 Y1.693
+G1 X10.128 Y1.594
+G1 X10.112 Y1.495
+G1 X10.098 Y1.396
+G1 X10.084 Y1.297
+G1 X10.072 Y1.198
+G1 X10.061 Y1.098
+G1 X10.050 Y0.999
+G1 X10.041 Y0.899
+G1 X10.032 Y0.800
+G1 X10.025 Y0.700
+G1 X10.018 Y0.600
+G1 X10.013 Y0.500
+G1 X10.008 Y0.400
+G1 X10.005 Y0.300
+G1 X10.002 Y0.200
+G1 X10.001 Y0.100
+G1 X10.000 Y0.000
+G1 X10.001 Y-0.100
+G1 X10.002 Y-0.200
+G1 X10.005 Y-0.300
+G1 X10.008 Y-0.400
+G1 X10.013 Y-0.500
+G1 X10.018 Y-0.600
+G1 X10.025 Y-0.700
+G1 X10.032 Y-0.800
+G1 X10.041 Y-0.899
+G1 X10.050 Y-0.999
+G1 X10.061 Y-1.098
+G1 X10.072 Y-1.198
+G1 X10.084 Y-1.297
+G1 X10.098 Y-1.396
+G1 X10.112 Y-1.495
+G1 X10.128 Y-1.594
+G1 X10.144 Y-1.693
+G1 X10.162 Y-1.791
+G1 X10.180 Y-1.890
+G1 X10.200 Y-1.988
+G1 X10.220 Y-2.086
+G1 X10.241 Y-2.183
+G1 X10.264 Y-2.281
+G1 X10.287 Y-2.378
+G1 X10.311 Y-2.475
+G1 X10.336 Y-2.572
+G1 X10.363 Y-2.669
+G1 X10.390 Y-2.765
+G1 X10.418 Y-2.861
+G1 X10.447 Y-2.957
+G1 X10.477 Y-3.052
+G1 X10.508 Y-3.147
+G1 X10.540 Y-3.242
+G1 X10.573 Y-3.336
+G1 X10.607 Y-3.431
+G1 X10.642 Y-3.524
+G1 X10.677 Y-3.618
+G1 X10.714 Y-3.711
+G1 X10.752 Y-3.804
+G1 X10.790 Y-3.896
+G1 X10.830 Y-3.988
+G1 X10.870 Y-4.080
+G1 X10.911 Y-4.171
+G1 X10.953 Y-4.261
+G1 X10.997 Y-4.352
+G1 X11.041 Y-4.442
+G1 X11.085 Y-4.531
+G1 X11.131 Y-4.620
+G1 X11.178 Y-4.708
+G1 X11.225 Y-4.796
+G1 X11.274 Y-4.884
+G1 X11.323 Y-4.971
+G1 X11.373 Y-5.058
+G1 X11.424 Y-5.144
+G1 X11.476 Y-5.229
+G1 X11.529 Y-5.314
+G1 X11.583 Y-5.399
+G1 X11.637 Y-5.483
+G1 X11.692 Y-5.566
+G1 X11.748 Y-5.649
+G1 X11.805 Y-5.731
+G1 X11.863 Y-5.813
+G1 X11.922 Y-5.894
+G1 X11.981 Y-5.975
+G1 X12.041 Y-6.054
+G1 X12.102 Y-6.134
+G1 X12.164 Y-6.213
+G1 X12.226 Y-6.291
+G1 X12.290 Y-6.368
+G1 X12.354 Y-6.445
+G1 X12.419 Y-6.521
+G1 X12.484 Y-6.597
+G1 X12.551 Y-6.671
+G1 X12.618 Y-6.746
+G1 X12.686 Y-6.819
+G1 X12.754 Y-6.892
+G1 X12.824 Y-6.964
+G1 X12.894 Y-7.036
+G1 X12.964 Y-7.106
+G1 X13.036 Y-7.176
+G1 X13.108 Y-7.246
+G1 X13.181 Y-7.314
+G1 X13.254 Y-7.382
+G1 X13.329 Y-7.449
+G1 X13.403 Y-7.516
+G1 X13.479 Y-7.581
+G1 X13.555 Y-7.646
+G1 X13.632 Y-7.710
+G1 X13.709 Y-7.774
+G1 X13.787 Y-7.836
+G1 X13.866 Y-7.898
+G1 X13.946 Y-7.959
+G1 X14.025 Y-8.019
+G1 X14.106 Y-8.078
+G1 X14.187 Y-8.137
+G1 X14.269 Y-8.195
+G1 X14.351 Y-8.252
+G1 X14.434 Y-8.308
+G1 X14.517 Y-8.363
+G1 X14.601 Y-8.417
+G1 X14.686 Y-8.471
+G1 X14.771 Y-8.524
+G1 X14.856 Y-8.576
+G1 X14.942 Y-8.627
+G1 X15.029 Y-8.677
+G1 X15.116 Y-8.726
+G1 X15.204 Y-8.775
+G1 X15.292 Y-8.822
+G1 X15.380 Y-8.869
+G1 X15.469 Y-8.915
+G1 X15.558 Y-8.959
+G1 X15.648 Y-9.003
+G1 X15.739 Y-9.047
+G1 X15.829 Y-9.089
+G1 X15.920 Y-9.130
+G1 X16.012 Y-9.170
+G1 X16.104 Y-9.210
+G1 X16.196 Y-9.248
+G1 X16.289 Y-9.286
+G1 X16.382 Y-9.323
+G1 X16.476 Y-9.358
+G1 X16.569 Y-9.393
+G1 X16.664 Y-9.427
+G1 X16.758 Y-9.460
+G1 X16.853 Y-9.492
+G1 X16.948 Y-9.523
+G1 X17.043 Y-9.553
+G1 X17.139 Y-9.582
+G1 X17.235 Y-9.610
+G1 X17.331 Y-9.637
+G1 X17.428 Y-9.664
+G1 X17.525 Y-9.689
+G1 X17.622 Y-9.713
+G1 X17.719 Y-9.736
+G1 X17.817 Y-9.759
+G1 X17.914 Y-9.780
+G1 X18.012 Y-9.800
+G1 X18.110 Y-9.820
+G1 X18.209 Y-9.838
+G1 X18.307 Y-9.856
+G1 X18.406 Y-9.872
+G1 X18.505 Y-9.888
+G1 X18.604 Y-9.902
+G1 X18.703 Y-9.916
+G1 X18.802 Y-9.928
+G1 X18.902 Y-9.939
+G1 X19.001 Y-9.950
+G1 X19.101 Y-9.959
+G1 X19.200 Y-9.968
+G1 X19.300 Y-9.975
+G1 X19.400 Y-9.982
+G1 X19.500 Y-9.987
+G1 X19.600 Y-9.992
+G1 X19.700 Y-9.995
+G1 X19.800 Y-9.998
+G1 X19.900 Y-9.999
+G1 X20.000 Y-10.000
+G1 X20.100 Y-9.999
+G1 X20.200 Y-9.998
+G1 X20.300 Y-9.995
+G1 X20.400 Y-9.992
+G1 X20.500 Y-9.987
+G1 X20.600 Y-9.982
+G1 X20.700 Y-9.975
+G1 X20.800 Y-9.968
+G1 X20.899 Y-9.959
+G1 X20.999 Y-9.950
+G1 X21.098 Y-9.939
+G1 X21.198 Y-9.928
+G1 X21.297 Y-9.916
+G1 X21.396 Y-9.902
+G1 X21.495 Y-9.888
+G1 X21.594 Y-9.872
+G1 X21.693 Y-9.856
+G1 X21.791 Y-9.838
+G1 X21.890 Y-9.820
+G1 X21.988 Y-9.800
+G1 X22.086 Y-9.780
+G1 X22.183 Y-9.759
+G1 X22.281 Y-9.736
+G1 X22.378 Y-9.713
+G1 X22.475 Y-9.689
+G1 X22.572 Y-9.664
+G1 X22.669 Y-9.637
+G1 X22.765 Y-9.610
+G1 X22.861 Y-9.582
+G1 X22.957 Y-9.553
+G1 X23.052 Y-9.523
+G1 X23.147 Y-9.492
+G1 X23.242 Y-9.460
+G1 X23.336 Y-9.427
+G1 X23.431 Y-9.393
+G1 X23.524 Y-9.358
+G1 X23.618 Y-9.323
+G1 X23.711 Y-9.286
+G1 X23.804 Y-9.248
+G1 X23.896 Y-9.210
+G1 X23.988 Y-9.170
+G1 X24.080 Y-9.130
+G1 X24.171 Y-9.089
+G1 X24.261 Y-9.047
+G1 X24.352 Y-9.003
+G1 X24.442 Y-8.959
+G1 X24.531 Y-8.915
+G1 X24.620 Y-8.869
+G1 X24.708 Y-8.822
+G1 X24.796 Y-8.775
+G1 X24.884 Y-8.726
+G1 X24.971 Y-8.677
+G1 X25.058 Y-8.627
+G1 X25.144 Y-8.576
+G1 X25.229 Y-8.524
+G1 X25.314 Y-8.471
+G1 X25.399 Y-8.417
+G1 X25.483 Y-8.363
+G1 X25.566 Y-8.308
+G1 X25.649 Y-8.252
+G1 X25.731 Y-8.195
+G1 X25.813 Y-8.137
+G1 X25.894 Y-8.078
+G1 X25.975 Y-8.019
+G1 X26.054 Y-7.959
+G1 X26.134 Y-7.898
+G1 X26.213 Y-7.836
+G1 X26.291 Y-7.774
+G1 X26.368 Y-7.710
+G1 X26.445 Y-7.646
+G1 X26.521 Y-7.581
+G1 X26.597 Y-7.516
+G1 X26.671 Y-7.449
+G1 X26.746 Y-7.382
+G1 X26.819 Y-7.314
+G1 X26.892 Y-7.246
+G1 X26.964 Y-7.176
+G1 X27.036 Y-7.106
+G1 X27.106 Y-7.036
+G1 X27.176 Y-6.964
+G1 X27.246 Y-6.892
+G1 X27.314 Y-6.819
+G1 X27.382 Y-6.746
+G1 X27.449 Y-6.671
+G1 X27.516 Y-6.597
+G1 X27.581 Y-6.521
+G1 X27.646 Y-6.445
+G1 X27.710 Y-6.368
+G1 X27.774 Y-6.291
+G1 X27.836 Y-6.213
+G1 X27.898 Y-6.134
+G1 X27.959 Y-6.054
+G1 X28.019 Y-5.975
+G1 X28.078 Y-5.894
+G1 X28.137 Y-5.813
+G1 X28.195 Y-5.731
+G1 X28.252 Y-5.649
+G1 X28.308 Y-5.566
+G1 X28.363 Y-5.483
+G1 X28.417 Y-5.399
+G1 X28.471 Y-5.314
+G1 X28.524 Y-5.229
+G1 X28.576 Y-5.144
+G1 X28.627 Y-5.058
+G1 X28.677 Y-4.971
+G1 X28.726 Y-4.884
+G1 X28.775 Y-4.796
+G1 X28.822 Y-4.708
+G1 X28.869 Y-4.620
+G1 X28.915 Y-4.531
+G1 X28.959 Y-4.442
+G1 X29.003 Y-4.352
+G1 X29.047 Y-4.261
+G1 X29.089 Y-4.171
+G1 X29.130 Y-4.080
+G1 X29.170 Y-3.988
+G1 X29.210 Y-3.896
+G1 X29.248 Y-3.804
+G1 X29.286 Y-3.711
+G1 X29.323 Y-3.618
+G1 X29.358 Y-3.524
+G1 X29.393 Y-3.431
+G1 X29.427 Y-3.336
+G1 X29.460 Y-3.242
+G1 X29.492 Y-3.147
+G1 X29.523 Y-3.052
+G1 X29.553 Y-2.957
+G1 X29.582 Y-2.861
+G1 X29.610 Y-2.765
+G1 X29.637 Y-2.669
+G1 X29.664 Y-2.572
+G1 X29.689 Y-2.475
+G1 X29.713 Y-2.378
+G1 X29.736 Y-2.281
+G1 X29.759 Y-2.183
+G1 X29.780 Y-2.086
+G1 X29.800 Y-1.988
+G1 X29.820 Y-1.890
+G1 X29.838 Y-1.791
+G1 X29.856 Y-1.693
+G1 X29.872 Y-1.594
+G1 X29.888 Y-1.495
+G1 X29.902 Y-1.396
+G1 X29.916 Y-1.297
+G1 X29.928 Y-1.198
+G1 X29.939 Y-1.098
+G1 X29.950 Y-0.999
+G1 X29.959 Y-0.899
+G1 X29.968 Y-0.800
+G1 X29.975 Y-0.700
+G1 X29.982 Y-0.600
+G1 X29.987 Y-0.500
+G1 X29.992 Y-0.400
+G1 X29.995 Y-0.300
+G1 X29.998 Y-0.200
+G1 X29.999 Y-0.100
+G1 X30.000 Y-0.000
@@ -0,0 +1,446 @@
+G21
+G90
+G1 F6000
+G1 X50 Y0
+G1 X50 Y50
+G1 X0 Y50
+G1 X0 Y0
+G1 X50 Y0
+G1 X50 Y50
+G1 X0 Y50
+G1 X0 Y0
+G1 X50 Y0
+G1 X50 Y50
+G1 X0 Y50
+G1 X0 Y0
+G1 X50 Y0
+G1 X50 Y50
+G1 X0 Y50
+G1 X0 Y0
+G1 X50 Y0
+G1 X50 Y50
+G1 X0 Y50
+G1 X0 Y0
+G1 X50 Y0
+G1 X50 Y50
+G1 X0 Y50
+G1 X0 Y0
+G1 X50 Y0
+G1 X50 Y50
+G1 X0 Y50
+G1 X0 Y0
+G1 X50 Y0
+G1 X50 Y50
+G1 X0 Y50
+G1 X0 Y0
+G1 X50 Y0
+G1 X50 Y50
+G1 X0 Y50
+G1 X0 Y0
+G1 X50 Y0
+G1 X50 Y50
+G1 X0 Y50
+G1 X0 Y0
+G1 X50 Y0
+G1 X50 Y50
+G1 X0 Y50
+G1 X0 Y0
+G1 X50 Y0
+G1 X50 Y50
+G1 X0 Y50
+G1 X0 Y0
+G1 X50 Y0
+G1 X50 Y50
+G1 X0 Y50
+G1 X0 Y0
+G1 X50 Y0
+G1 X50 Y50
+G1 X0 Y50
+G1 X0 Y0
+G1 X50 Y0
+G1 X50 Y50
+G1 X0 Y50
+G1 X0 Y0
+G1 X50 Y0
+G1 X50 Y50
+G1 X0 Y50
+G1 X0 Y0
+G1 X50 Y0
+G1 X50 Y50
+G1 X0 Y50
+G1 X0 Y0
+G1 X50 Y0
+G1 X50 Y50
+G1 X0 Y50
+G1 X0 Y0
+G1 X50 Y0
+G1 X50 Y50
+G1 X0 Y50
+G1 X0 Y0
+G1 X50 Y0
+G1 X50 Y50
+G1 X0 Y50
+G1 X0 Y0
+G1 Z1 F300
+G1 X45.000 Y25.000 F3000
+G1 X44.997 Y25.349 F3000
+G1 X44.988 Y25.698 F3000
+G1 X44.973 Y26.047 F3000
+G1 X44.951 Y26.395 F3000
+G1 X44.924 Y26.743 F3000
+G1 X44.890 Y27.091 F3000
+G1 X44.851 Y27.437 F3000
+G1 X44.805 Y27.783 F3000
+G1 X44.754 Y28.129 F3000
+G1 X44.696 Y28.473 F3000
+G1 X44.633 Y28.816 F3000
+G1 X44.563 Y29.158 F3000
+G1 X44.487 Y29.499 F3000
+G1 X44.406 Y29.838 F3000
+G1 X44.319 Y30.176 F3000
+G1 X44.225 Y30.513 F3000
+G1 X44.126 Y30.847 F3000
+G1 X44.021 Y31.180 F3000
+G1 X43.910 Y31.511 F3000
+G1 X43.794 Y31.840 F3000
+G1 X43.672 Y32.167 F3000
+G1 X43.544 Y32.492 F3000
+G1 X43.410 Y32.815 F3000
+G1 X43.271 Y33.135 F3000
+G1 X43.126 Y33.452 F3000
+G1 X42.976 Y33.767 F3000
+G1 X42.820 Y34.080 F3000
+G1 X42.659 Y34.389 F3000
+G1 X42.492 Y34.696 F3000
+G1 X42.321 Y35.000 F3000
+G1 X42.143 Y35.301 F3000
+G1 X41.961 Y35.598 F3000
+G1 X41.773 Y35.893 F3000
+G1 X41.581 Y36.184 F3000
+G1 X41.383 Y36.472 F3000
+G1 X41.180 Y36.756 F3000
+G1 X40.973 Y37.036 F3000
+G1 X40.760 Y37.313 F3000
+G1 X40.543 Y37.586 F3000
+G1 X40.321 Y37.856 F3000
+G1 X40.094 Y38.121 F3000
+G1 X39.863 Y38.383 F3000
+G1 X39.627 Y38.640 F3000
+G1 X39.387 Y38.893 F3000
+G1 X39.142 Y39.142 F3000
+G1 X38.893 Y39.387 F3000
+G1 X38.640 Y39.627 F3000
+G1 X38.383 Y39.863 F3000
+G1 X38.121 Y40.094 F3000
+G1 X37.856 Y40.321 F3000
+G1 X37.586 Y40.543 F3000
+G1 X37.313 Y40.760 F3000
+G1 X37.036 Y40.973 F3000
+G1 X36.756 Y41.180 F3000
+G1 X36.472 Y41.383 F3000
+G1 X36.184 Y41.581 F3000
+G1 X35.893 Y41.773 F3000
+G1 X35.598 Y41.961 F3000
+G1 X35.301 Y42.143 F3000
+G1 X35.000 Y42.321 F3000
+G1 X34.696 Y42.492 F3000
+G1 X34.389 Y42.659 F3000
+G1 X34.080 Y42.820 F3000
+G1 X33.767 Y42.976 F3000
+G1 X33.452 Y43.126 F3000
+G1 X33.135 Y43.271 F3000
+G1 X32.815 Y43.410 F3000
+G1 X32.492 Y43.544 F3000
+G1 X32.167 Y43.672 F3000
+G1 X31.840 Y43.794 F3000
+G1 X31.511 Y43.910 F3000
+G1 X31.180 Y44.021 F3000
+G1 X30.847 Y44.126 F3000
+G1 X30.513 Y44.225 F3000
+G1 X30.176 Y44.319 F3000
+G1 X29.838 Y44.406 F3000
+G1 X29.499 Y44.487 F3000
+G1 X29.158 Y44.563 F3000
+G1 X28.816 Y44.633 F3000
+G1 X28.473 Y44.696 F3000
+G1 X28.129 Y44.754 F3000
+G1 X27.783 Y44.805 F3000
+G1 X27.437 Y44.851 F3000
+G1 X27.091 Y44.890 F3000
+G1 X26.743 Y44.924 F3000
+G1 X26.395 Y44.951 F3000
+G1 X26.047 Y44.973 F3000
+G1 X25.698 Y44.988 F3000
+G1 X25.349 Y44.997 F3000
+G1 X25.000 Y45.000 F3000
+G1 X24.651 Y44.997 F3000
+G1 X24.302 Y44.988 F3000
+G1 X23.953 Y44.973 F3000
+G1 X23.605 Y44.951 F3000
+G1 X23.257 Y44.924 F3000
+G1 X22.909 Y44.890 F3000
+G1 X22.563 Y44.851 F3000
+G1 X22.217 Y44.805 F3000
+G1 X21.871 Y44.754 F3000
+G1 X21.527 Y44.696 F3000
+G1 X21.184 Y44.633 F3000
+G1 X20.842 Y44.563 F3000
+G1 X20.501 Y44.487 F3000
+G1 X20.162 Y44.406 F3000
+G1 X19.824 Y44.319 F3000
+G1 X19.487 Y44.225 F3000
+G1 X19.153 Y44.126 F3000
+G1 X18.820 Y44.021 F3000
+G1 X18.489 Y43.910 F3000
+G1 X18.160 Y43.794 F3000
+G1 X17.833 Y43.672 F3000
+G1 X17.508 Y43.544 F3000
+G1 X17.185 Y43.410 F3000
+G1 X16.865 Y43.271 F3000
+G1 X16.548 Y43.126 F3000
+G1 X16.233 Y42.976 F3000
+G1 X15.920 Y42.820 F3000
+G1 X15.611 Y42.659 F3000
+G1 X15.304 Y42.492 F3000
+G1 X15.000 Y42.321 F3000
+G1 X14.699 Y42.143 F3000
+G1 X14.402 Y41.961 F3000
+G1 X14.107 Y41.773 F3000
+G1 X13.816 Y41.581 F3000
+G1 X13.528 Y41.383 F3000
+G1 X13.244 Y41.180 F3000
+G1 X12.964 Y40.973 F3000
+G1 X12.687 Y40.760 F3000
+G1 X12.414 Y40.543 F3000
+G1 X12.144 Y40.321 F3000
+G1 X11.879 Y40.094 F3000
+G1 X11.617 Y39.863 F3000
+G1 X11.360 Y39.627 F3000
+G1 X11.107 Y39.387 F3000
+G1 X10.858 Y39.142 F3000
+G1 X10.613 Y38.893 F3000
+G1 X10.373 Y38.640 F3000
+G1 X10.137 Y38.383 F3000
+G1 X9.906 Y38.121 F3000
+G1 X9.679 Y37.856 F3000
+G1 X9.457 Y37.586 F3000
+G1 X9.240 Y37.313 F3000
+G1 X9.027 Y37.036 F3000
+G1 X8.820 Y36.756 F3000
+G1 X8.617 Y36.472 F3000
+G1 X8.419 Y36.184 F3000
+G1 X8.227 Y35.893 F3000
+G1 X8.039 Y35.598 F3000
+G1 X7.857 Y35.301 F3000
+G1 X7.679 Y35.000 F3000
+G1 X7.508 Y34.696 F3000
+G1 X7.341 Y34.389 F3000
+G1 X7.180 Y34.080 F3000
+G1 X7.024 Y33.767 F3000
+G1 X6.874 Y33.452 F3000
+G1 X6.729 Y33.135 F3000
+G1 X6.590 Y32.815 F3000
+G1 X6.456 Y32.492 F3000
+G1 X6.328 Y32.167 F3000
+G1 X6.206 Y31.840 F3000
+G1 X6.090 Y31.511 F3000
+G1 X5.979 Y31.180 F3000
+G1 X5.874 Y30.847 F3000
+G1 X5.775 Y30.513 F3000
+G1 X5.681 Y30.176 F3000
+G1 X5.594 Y29.838 F3000
+G1 X5.513 Y29.499 F3000
+G1 X5.437 Y29.158 F3000
+G1 X5.367 Y28.816 F3000
+G1 X5.304 Y28.473 F3000
+G1 X5.246 Y28.129 F3000
+G1 X5.195 Y27.783 F3000
+G1 X5.149 Y27.437 F3000
+G1 X5.110 Y27.091 F3000
+G1 X5.076 Y26.743 F3000
+G1 X5.049 Y26.395 F3000
+G1 X5.027 Y26.047 F3000
+G1 X5.012 Y25.698 F3000
+G1 X5.003 Y25.349 F3000
+G1 X5.000 Y25.000 F3000
+G1 X5.003 Y24.651 F3000
+G1 X5.012 Y24.302 F3000
+G1 X5.027 Y23.953 F3000
+G1 X5.049 Y23.605 F3000
+G1 X5.076 Y23.257 F3000
+G1 X5.110 Y22.909 F3000
+G1 X5.149 Y22.563 F3000
+G1 X5.195 Y22.217 F3000
+G1 X5.246 Y21.871 F3000
+G1 X5.304 Y21.527 F3000
+G1 X5.367 Y21.184 F3000
+G1 X5.437 Y20.842 F3000
+G1 X5.513 Y20.501 F3000
+G1 X5.594 Y20.162 F3000
+G1 X5.681 Y19.824 F3000
+G1 X5.775 Y19.487 F3000
+G1 X5.874 Y19.153 F3000
+G1 X5.979 Y18.820 F3000
+G1 X6.090 Y18.489 F3000
+G1 X6.206 Y18.160 F3000
+G1 X6.328 Y17.833 F3000
+G1 X6.456 Y17.508 F3000
+G1 X6.590 Y17.185 F3000
+G1 X6.729 Y16.865 F3000
+G1 X6.874 Y16.548 F3000
+G1 X7.024 Y16.233 F3000
+G1 X7.180 Y15.920 F3000
+G1 X7.341 Y15.611 F3000
+G1 X7.508 Y15.304 F3000
+G1 X7.679 Y15.000 F3000
+G1 X7.857 Y14.699 F3000
+G1 X8.039 Y14.402 F3000
+G1 X8.227 Y14.107 F3000
+G1 X8.419 Y13.816 F3000
+G1 X8.617 Y13.528 F3000
+G1 X8.820 Y13.244 F3000
+G1 X9.027 Y12.964 F3000
+G1 X9.240 Y12.687 F3000
+G1 X9.457 Y12.414 F3000
+G1 X9.679 Y12.144 F3000
+G1 X9.906 Y11.879 F3000
+G1 X10.137 Y11.617 F3000
+G1 X10.373 Y11.360 F3000
+G1 X10.613 Y11.107 F3000
+G1 X10.858 Y10.858 F3000
+G1 X11.107 Y10.613 F3000
+G1 X11.360 Y10.373 F3000
+G1 X11.617 Y10.137 F3000
+G1 X11.879 Y9.906 F3000
+G1 X12.144 Y9.679 F3000
+G1 X12.414 Y9.457 F3000
+G1 X12.687 Y9.240 F3000
+G1 X12.964 Y9.027 F3000
+G1 X13.244 Y8.820 F3000
+G1 X13.528 Y8.617 F3000
+G1 X13.816 Y8.419 F3000
+G1 X14.107 Y8.227 F3000
+G1 X14.402 Y8.039 F3000
+G1 X14.699 Y7.857 F3000
+G1 X15.000 Y7.679 F3000
+G1 X15.304 Y7.508 F3000
+G1 X15.611 Y7.341 F3000
+G1 X15.920 Y7.180 F3000
+G1 X16.233 Y7.024 F3000
+G1 X16.548 Y6.874 F3000
+G1 X16.865 Y6.729 F3000
+G1 X17.185 Y6.590 F3000
+G1 X17.508 Y6.456 F3000
+G1 X17.833 Y6.328 F3000
+G1 X18.160 Y6.206 F3000
+G1 X18.489 Y6.090 F3000
+G1 X18.820 Y5.979 F3000
+G1 X19.153 Y5.874 F3000
+G1 X19.487 Y5.775 F3000
+G1 X19.824 Y5.681 F3000
+G1 X20.162 Y5.594 F3000
+G1 X20.501 Y5.513 F3000
+G1 X20.842 Y5.437 F3000
+G1 X21.184 Y5.367 F3000
+G1 X21.527 Y5.304 F3000
+G1 X21.871 Y5.246 F3000
+G1 X22.217 Y5.195 F3000
+G1 X22.563 Y5.149 F3000
+G1 X22.909 Y5.110 F3000
+G1 X23.257 Y5.076 F3000
+G1 X23.605 Y5.049 F3000
+G1 X23.953 Y5.027 F3000
+G1 X24.302 Y5.012 F3000
+G1 X24.651 Y5.003 F3000
+G1 X25.000 Y5.000 F3000
+G1 X25.349 Y5.003 F3000
+G1 X25.698 Y5.012 F3000
+G1 X26.047 Y5.027 F3000
+G1 X26.395 Y5.049 F3000
+G1 X26.743 Y5.076 F3000
+G1 X27.091 Y5.110 F3000
+G1 X27.437 Y5.149 F3000
+G1 X27.783 Y5.195 F3000
+G1 X28.129 Y5.246 F3000
+G1 X28.473 Y5.304 F3000
+G1 X28.816 Y5.367 F3000
+G1 X29.158 Y5.437 F3000
+G1 X29.499 Y5.513 F3000
+G1 X29.838 Y5.594 F3000
+G1 X30.176 Y5.681 F3000
+G1 X30.513 Y5.775 F3000
+G1 X30.847 Y5.874 F3000
+G1 X31.180 Y5.979 F3000
+G1 X31.511 Y6.090 F3000
+G1 X31.840 Y6.206 F3000
+G1 X32.167 Y6.328 F3000
+G1 X32.492 Y6.456 F3000
+G1 X32.815 Y6.590 F3000
+G1 X33.135 Y6.729 F3000
+G1 X33.452 Y6.874 F3000
+G1 X33.767 Y7.024 F3000
+G1 X34.080 Y7.180 F3000
+G1 X34.389 Y7.341 F3000
+G1 X34.696 Y7.508 F3000
+G1 X35.000 Y7.679 F3000
+G1 X35.301 Y7.857 F3000
+G1 X35.598 Y8.039 F3000
+G1 X35.893 Y8.227 F3000
+G1 X36.184 Y8.419 F3000
+G1 X36.472 Y8.617 F3000
+G1 X36.756 Y8.820 F3000
+G1 X37.036 Y9.027 F3000
+G1 X37.313 Y9.240 F3000
+G1 X37.586 Y9.457 F3000
+G1 X37.856 Y9.679 F3000
+G1 X38.121 Y9.906 F3000
+G1 X38.383 Y10.137 F3000
+G1 X38.640 Y10.373 F3000
+G1 X38.893 Y10.613 F3000
+G1 X39.142 Y10.858 F3000
+G1 X39.387 Y11.107 F3000
+G1 X39.627 Y11.360 F3000
+G1 X39.863 Y11.617 F3000
+G1 X40.094 Y11.879 F3000
+G1 X40.321 Y12.144 F3000
+G1 X40.543 Y12.414 F3000
+G1 X40.760 Y12.687 F3000
+G1 X40.973 Y12.964 F3000
+G1 X41.180 Y13.244 F3000
+G1 X41.383 Y13.528 F3000
+G1 X41.581 Y13.816 F3000
+G1 X41.773 Y14.107 F3000
+G1 X41.961 Y14.402 F3000
+G1 X42.143 Y14.699 F3000
+G1 X42.321 Y15.000 F3000
+G1 X42.492 Y15.304 F3000
+G1 X42.659 Y15.611 F3000
+G1 X42.820 Y15.920 F3000
+G1 X42.976 Y16.233 F3000
+G1 X43.126 Y16.548 F3000
+G1 X43.271 Y16.865 F3000
+G1 X43.410 Y17.185 F3000
+G1 X43.544 Y17.508 F3000
+G1 X43.672 Y17.833 F3000
+G1 X43.794 Y18.160 F3000
+G1 X43.910 Y18.489 F3000
+G1 X44.021 Y18.820 F3000
+G1 X44.126 Y19.153 F3000
+G1 X44.225 Y19.487 F3000
+G1 X44.319 Y19.824 F3000
+G1 X44.406 Y20.162 F3000
+G1 X44.487 Y20.501 F3000
+G1 X44.563 Y20.842 F3000
+G1 X44.633 Y21.184 F3000
+G1 X44.696 Y21.527 F3000
+G1 X44.754 Y21.871 F3000
+G1 X44.805 Y22.217 F3000
+G1 X44.851 Y22.563 F3000
+G1 X44.890 Y22.909 F3000
+G1 X44.924 Y23.257 F3000
+G1 X44.951 Y23.605 F3000
+G1 X44.973 Y23.953 F3000
+G1 X44.988 Y24.302 F3000
+G1 X44.997 Y24.651 F3000
+G1 X45.000 Y25.000 F3000
+G0 X0 Y0 Z0
@@ -0,0 +1,193 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Checks the Scheduler runs posted tasks once after they are posted and not from inside themselves, that tasks sharing
+// the last ready flag all get to run, and that the time a task takes does not include the tasks run from inside it.
+//
+// Then compares the idle loop with modules that check a flag an interrupt sets in on_idle, as the endstops, kill
+// button, motor drivers, autopid, dfu and second tick did, called on every ON_IDLE, with the same modules as posted
+// tasks that only run when the flag is set, and reports idle loops per second each way.
+//
+// usage: schedbench [-c config] [-n loops]
+
+#include "HostSim.h"
+
+#include "libs/Kernel.h"
+#include "libs/Module.h"
+#include "libs/Scheduler.h"
+#include "wait_api.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <chrono>
+#include <vector>
+
+class Worker : public Module {
+    public:
+        Worker() : runs(0), depth(0), max_depth(0), flag(false), task(0), wait(0), nested(false), repost(false), then(nullptr) {}
+
+        void on_idle(void *)
+        {
+            ++runs;
+            if(++depth > max_depth) max_depth= depth;
+            if(flag) {
+                flag= false;
+                if(wait > 0) wait_us(wait);
+            }
+            if(then != nullptr) THEKERNEL->scheduler->post_task(then->task);
+            if(nested) THEKERNEL->call_event(ON_IDLE);
+            if(repost) {
+                repost= false;
+                THEKERNEL->scheduler->post_task(task);
+            }
+            --depth;
+        }
+
+        int runs, depth, max_depth;
+        volatile bool flag;
+        uint32_t task;
+        int wait;
+        bool nested, repost;
+        Worker *then;
+};
+
+static const Scheduler::task_t *find_task(Module *m)
+{
+    for (auto &t : THEKERNEL->scheduler->get_tasks()) {
+        if(t.module == m) return &t;
+    }
+    return nullptr;
+}
+
+static void idle(int n)
+{
+    for (int i = 0; i < n; ++i) THEKERNEL->call_event(ON_IDLE);
+}
+
+static bool check(bool ok, const char *what)
+{
+    if(!ok) printf("FAILED: %s\n", what);
+    return ok;
+}
+
+static bool checks()
+{
+    bool ok = true;
+
+    // tasks can not be removed, so these are never deleted
+    Worker &a= *new Worker, &outer= *new Worker, &inner= *new Worker;
+    a.task= THEKERNEL->scheduler->add_task("a", &a, &Module::on_idle);
+    outer.task= THEKERNEL->scheduler->add_task("outer", &outer, &Module::on_idle);
+    inner.task= THEKERNEL->scheduler->add_task("inner", &inner, &Module::on_idle);
+    idle(3);
+    ok &= check(a.runs == 0, "a task that was not posted ran");
+    THEKERNEL->scheduler->post_task(a.task);
+    THEKERNEL->scheduler->post_task(a.task);
+    idle(1);
+    ok &= check(a.runs == 1, "a task posted twice did not run once");
+    idle(2);
+    ok &= check(a.runs == 1, "a task ran again without being posted");
+
+    // posts itself and calls ON_IDLE, it must not run inside itself but on the next idle loop
+    a.nested= true;
+    a.repost= true;
+    THEKERNEL->scheduler->post_task(a.task);
+    idle(1);
+    a.nested= false;
+    ok &= check(a.runs == 2 && a.max_depth == 1, "a task ran from inside itself");
+    idle(1);
+    ok &= check(a.runs == 3, "a task posted while it ran did not run after it");
+
+    // the outer task waits 100us then posts the inner one and runs it from its ON_IDLE, which waits 50us
+    outer.flag= inner.flag= true;
+    outer.wait= 100;
+    inner.wait= 50;
+    outer.nested= true;
+    outer.then= &inner;
+    THEKERNEL->scheduler->post_task(outer.task);
+    THEKERNEL->scheduler->reset_stats();
+    idle(1);
+    const Scheduler::task_t *to= find_task(&outer), *ti= find_task(&inner);
+    printf("outer task %lu us, inner task %lu us\n", (unsigned long)to->us, (unsigned long)ti->us);
+    ok &= check(inner.depth == 0 && inner.runs == 1 && outer.runs == 1, "a task posted by another did not run from inside it");
+    ok &= check(to->us == 100 && ti->us == 50, "the time of a task included the tasks it ran");
+    outer.nested= false;
+    outer.then= nullptr;
+
+    // more tasks than there are flags, those after the 31st share the last one
+    std::vector<Worker> &many= *new std::vector<Worker>(40);
+    for (auto &w : many) w.task= THEKERNEL->scheduler->add_task("many", &w, &Module::on_idle);
+    size_t first_shared= 0;
+    while(many[first_shared].task != (1UL << 31)) ++first_shared;
+    bool all= true;
+    for (auto &w : many) {
+        w.flag= true;
+        THEKERNEL->scheduler->post_task(w.task);
+        idle(1);
+        if(w.flag || w.runs == 0) all= false;
+    }
+    ok &= check(all, "a posted task did not run");
+    ok &= check(many.front().runs == 1 && many[first_shared - 1].runs == 1, "a task with a flag of its own ran when another was posted");
+
+    return ok;
+}
+
+// the workers flags are set as often as an interrupt would set them, one in every 1000 loops
+static double rate(std::vector<Worker> &workers, bool posted, int n)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < n; ++i) {
+        if(i % 1000 == 0) {
+            Worker &w= workers[(i / 1000) % workers.size()];
+            w.flag= true;
+            if(posted) THEKERNEL->scheduler->post_task(w.task);
+        }
+        THEKERNEL->call_event(ON_IDLE);
+    }
+    return n / std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char *argv[])
+{
+    int n = 2000000;
+    int c;
+    while((c = getopt(argc, argv, "c:n:")) != -1) {
+        if(c == 'c') sim_config_file = optarg;
+        else if(c == 'n') n = atoi(optarg);
+        else {
+            fprintf(stderr, "usage: %s [-c config] [-n loops]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    new Kernel();
+    // the time is only moved on by the tasks themselves
+    sim_idle_quantum= 0;
+
+    bool ok = true;
+    std::vector<Worker> polled(12), posted(12);
+    for (auto &w : polled) w.register_for_event(ON_IDLE);
+    double polled_rate = rate(polled, false, n);
+    for (auto &w : polled) THEKERNEL->unregister_for_event(ON_IDLE, &w);
+
+    for (auto &w : posted) w.task= THEKERNEL->scheduler->add_task("posted", &w, &Module::on_idle);
+    double posted_rate = rate(posted, true, n);
+
+    int polled_runs= 0, posted_runs= 0;
+    for (auto &w : polled) polled_runs += w.runs;
+    for (auto &w : posted) posted_runs += w.runs;
+    ok &= check(posted_runs == (n + 999) / 1000, "a posted task did not run once for each time it was posted");
+
+    // after the benchmark so its tasks have flags of their own
+    ok &= checks();
+
+    printf("%u modules: %d on_idle calls polled, %d posted\n", (unsigned)polled.size(), polled_runs, posted_runs);
+    printf("polled %1.0f idle loops/s, posted %1.0f idle loops/s, %1.1f times faster\n", polled_rate, posted_rate, posted_rate / polled_rate);
+    printf(ok ? "PASS\n" : "FAIL\n");
+    return ok ? 0 : 1;
+}
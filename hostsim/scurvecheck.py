@@ -0,0 +1,156 @@
+#!/usr/bin/env python
+"""Checks that s-curve ramps (s_curve_jerk) make the same moves as trapezoid ramps and keep the speed continuous.
+
+Runs each gcode file through hostsim twice, once with the given config and once with s_curve_jerk added, then compares
+the step timelines. Every block must issue the same number of steps on every motor in both runs. For each run the path
+speed at the end of every block is compared with the speed at the start of the next one, both are measured over the
+last and first few steps of the motor with the most steps in the block. The speed may only differ by what the
+acceleration can change it by over those steps, plus a small fraction for the step quantization. The speed is worked
+out for a straight line on a cartesian machine, so blocks that follow a path (native arcs, deferred segmentation) are
+only checked for their step counts, arccheck.py checks their path.
+
+usage: scurvecheck.py [-c config] [--jerk mm/s^3] [--random lines] hostsim [file.gcode ...]
+
+e.g.
+    make && ./scurvecheck.py --random 2000 build/hostsim samples/square.gcode
+"""
+
+from __future__ import print_function
+import argparse
+import math
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+
+from equivalence import random_corpus
+
+
+def read_config(fn):
+    config = {}
+    with open(fn) as f:
+        for line in f:
+            words = line.split('#', 1)[0].split()
+            if len(words) >= 2:
+                config[words[0]] = words[1]
+    return config
+
+
+def read_blocks(fn):
+    """returns a list of (start tick, {motor: [step ticks]}) for each block"""
+    blocks = []
+    with open(fn) as f:
+        f.readline()
+        for line in f:
+            tick, motor, edge, level = line.strip().split(',')
+            if edge == 'B':
+                blocks.append((int(tick), {}))
+            elif edge == 'S' and level == '1' and blocks:
+                blocks[-1][1].setdefault(int(motor), []).append(int(tick))
+    return blocks
+
+
+def junction_speeds(blocks, steps_per_mm, window, frequency):
+    """yields (block, speed at the end of it, speed at the start of the next one, seconds measured over) for every
+    junction between two blocks that both have enough steps. The speed is measured on the motor with the most steps,
+    each of its steps is the same distance along a straight block"""
+    def primary(b):
+        steps = b[1]
+        m = max(steps, key=lambda k: len(steps[k]))
+        mm = math.sqrt(sum((len(s) / steps_per_mm[k]) ** 2 for k, s in steps.items() if k < len(steps_per_mm)))
+        return steps[m], mm / len(steps[m])
+
+    for i in range(len(blocks) - 1):
+        if not blocks[i][1] or not blocks[i + 1][1]:
+            continue
+        (a, a_mm), (b, b_mm) = primary(blocks[i]), primary(blocks[i + 1])
+        if len(a) <= window or len(b) <= window:
+            continue
+        end_t = float(a[-1] - a[-1 - window]) / frequency
+        start_t = float(b[window] - b[0]) / frequency
+        if end_t <= 0 or start_t <= 0:
+            continue
+        yield i, window * a_mm / end_t, window * b_mm / start_t, end_t + start_t
+
+
+def check_run(name, blocks, steps_per_mm, acceleration, window, frequency):
+    worst, worst_at, bad = 0, None, 0
+    for i, v_end, v_start, t in junction_speeds(blocks, steps_per_mm, window, frequency):
+        jump = abs(v_end - v_start)
+        # the peak acceleration of an s-curve is up to twice the configured one
+        allowed = 2 * acceleration * t + 0.05 * max(v_end, v_start)
+        if jump > worst:
+            worst, worst_at = jump, i
+        if jump > allowed:
+            bad += 1
+    last = blocks[-1][0] if blocks else 0
+    print("  %s: %d blocks, last block starts at tick %d, largest speed change at a junction %1.2f mm/s (block %s)" % (name, len(blocks), last, worst, worst_at))
+    if bad > 0:
+        print("  %s: %d junctions change speed by more than the acceleration allows" % (name, bad))
+    return bad == 0
+
+
+def compare_steps(ref, test):
+    if len(ref) != len(test):
+        print("  block count differs %d != %d" % (len(ref), len(test)))
+        return False
+    for i, ((_, r), (_, t)) in enumerate(zip(ref, test)):
+        for m in set(r) | set(t):
+            if len(r.get(m, [])) != len(t.get(m, [])):
+                print("  block %d motor %d: step count differs %d != %d" % (i, m, len(r.get(m, [])), len(t.get(m, []))))
+                return False
+    print("  every block issues the same steps on every motor")
+    return True
+
+
+def run(sim, config, gcode, out):
+    subprocess.check_call([sim, '-c', config, '-o', out, gcode], stdout=open(os.devnull, 'w'))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='compare s-curve ramps with trapezoid ramps in hostsim')
+    parser.add_argument('-c', '--config', default='../ConfigSamples/Smoothieboard/config')
+    parser.add_argument('--jerk', type=float, default=50000, help='s_curve_jerk to test in mm/s^3')
+    parser.add_argument('--window', type=int, default=4, help='steps either side of a junction the speed is measured over')
+    parser.add_argument('--random', type=int, default=0, help='also check a random corpus of this many lines')
+    parser.add_argument('--seed', type=int, default=1)
+    parser.add_argument('sim')
+    parser.add_argument('gcode', nargs='*')
+    args = parser.parse_args()
+
+    config = read_config(args.config)
+    steps_per_mm = [float(config.get(k, 1)) for k in ('alpha_steps_per_mm', 'beta_steps_per_mm', 'gamma_steps_per_mm')]
+    acceleration = float(config.get('acceleration', 100))
+    frequency = float(config.get('base_stepping_frequency', 100000))
+
+    tmp = tempfile.mkdtemp()
+    s_curve_config = os.path.join(tmp, 'config')
+    with open(s_curve_config, 'w') as f:
+        f.write(open(args.config).read())
+        f.write("\ns_curve_jerk %f\n" % args.jerk)
+
+    files = list(args.gcode)
+    if args.random > 0:
+        fn = os.path.join(tmp, 'random.gcode')
+        random_corpus(fn, args.random, args.seed)
+        files.append(fn)
+
+    ok = True
+    for g in files:
+        print("%s:" % g)
+        trap_out, s_out = os.path.join(tmp, 'trapezoid.csv'), os.path.join(tmp, 's-curve.csv')
+        run(args.sim, args.config, g, trap_out)
+        run(args.sim, s_curve_config, g, s_out)
+        trap, s_curve = read_blocks(trap_out), read_blocks(s_out)
+        ok = compare_steps(trap, s_curve) and ok
+        ok = check_run('trapezoid', trap, steps_per_mm, acceleration, args.window, frequency) and ok
+        ok = check_run('s-curve', s_curve, steps_per_mm, acceleration, args.window, frequency) and ok
+
+    shutil.rmtree(tmp)
+    print("PASS" if ok else "FAIL")
+    sys.exit(0 if ok else 1)
+
+
+if __name__ == '__main__':
+    main()
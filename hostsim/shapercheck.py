@@ -0,0 +1,177 @@
+#!/usr/bin/env python
+"""Checks that the input shaper cancels the ringing it is tuned for and still ends every move in the same place.
+
+Runs each gcode file through hostsim without an input shaper and then with each shaper type at the given frequency
+and damping ratio. The X and Y position is rebuilt from each step timeline and sampled at a fixed interval, then fed
+to a damped mass on a spring with that natural frequency and damping ratio, which stands in for the frame and belts.
+The residual vibration is the distance between the mass and the commanded position once the commanded position has
+stopped, so the gcode should dwell after its moves (see samples/ringing.gcode). For every shaper the RMS and peak of
+the residual vibration are reported, along with how far the shaped path strays from the unshaped one as the corners
+are rounded by the shaping. Each shaped run must end in the same place as the unshaped one and its RMS residual
+vibration must be below --limit times the unshaped one.
+
+usage: shapercheck.py [-c config] [-f Hz] [-d damping] [--type zv,zvd,mzv] hostsim file.gcode ...
+
+e.g.
+    make && ./shapercheck.py build/hostsim samples/ringing.gcode
+"""
+
+from __future__ import print_function
+import argparse
+import math
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+
+
+def read_config(fn):
+    config = {}
+    with open(fn) as f:
+        for line in f:
+            words = line.split('#', 1)[0].split()
+            if len(words) >= 2:
+                config[words[0]] = words[1]
+    return config
+
+
+def read_trace(fn, steps_per_mm, interval, settle):
+    """returns the X and Y position in mm sampled every interval ticks, with settle samples after the last step, and
+    the final position in steps"""
+    pos = [0, 0]
+    dirs = [1, 1]
+    xs, ys = [], []
+    next_sample = 0
+    with open(fn) as f:
+        f.readline()
+        for line in f:
+            tick, motor, edge, level = line.strip().split(',')
+            tick, motor = int(tick), int(motor)
+            if edge == 'B' or motor > 1:
+                continue
+            while next_sample < tick:
+                xs.append(pos[0] / steps_per_mm[0])
+                ys.append(pos[1] / steps_per_mm[1])
+                next_sample += interval
+            if edge == 'D':
+                dirs[motor] = -1 if level == '1' else 1
+            elif level == '1':
+                pos[motor] += dirs[motor]
+    # let the ringing die out after the last move
+    for _ in range(settle):
+        xs.append(pos[0] / steps_per_mm[0])
+        ys.append(pos[1] / steps_per_mm[1])
+    return xs, ys, tuple(pos)
+
+
+def vibration(commanded, dt, frequency, damping):
+    """the distance of a damped mass on a spring from the commanded position, at each sample"""
+    w = 2 * math.pi * frequency
+    x, v = commanded[0], 0.0
+    prev = commanded[0]
+    out = []
+    for c in commanded:
+        cv = (c - prev) / dt
+        prev = c
+        # semi implicit euler, the spring and damper pull the mass towards the commanded position and speed
+        v += (-w * w * (x - c) - 2 * damping * w * (v - cv)) * dt
+        x += v * dt
+        out.append(x - c)
+    return out
+
+
+def report(name, xs, ys, dt, frequency, damping, hold):
+    """the rms and peak vibration while the commanded position has not moved for hold samples, there is no lag from
+    following the commanded acceleration then so all that is left is ringing"""
+    ex, ey = vibration(xs, dt, frequency, damping), vibration(ys, dt, frequency, damping)
+    d = [math.hypot(ex[i], ey[i]) for i in range(hold, len(xs)) if xs[i] == xs[i - hold] and ys[i] == ys[i - hold]]
+    rms = math.sqrt(sum(v * v for v in d) / len(d)) if d else 0
+    peak = max(d) if d else 0
+    print("  %-5s residual vibration rms %1.4f mm, peak %1.4f mm" % (name, rms, peak), end='')
+    return rms
+
+
+def path_deviation(ref, test, cell=0.5):
+    """the largest distance from a point of test to the nearest point of ref"""
+    grid = {}
+    for p in set(zip(*ref)):
+        grid.setdefault((int(p[0] // cell), int(p[1] // cell)), []).append(p)
+    worst = 0
+    for p in set(zip(*test)):
+        cx, cy = int(p[0] // cell), int(p[1] // cell)
+        best = None
+        r = 1
+        while best is None or best > (r - 1) * cell:
+            for gx in range(cx - r, cx + r + 1):
+                for gy in range(cy - r, cy + r + 1):
+                    for q in grid.get((gx, gy), ()):
+                        dist = math.hypot(p[0] - q[0], p[1] - q[1])
+                        if best is None or dist < best:
+                            best = dist
+            r += 1
+        worst = max(worst, best)
+    return worst
+
+
+def run(sim, config, gcode, out):
+    subprocess.check_call([sim, '-c', config, '-o', out, gcode], stdout=open(os.devnull, 'w'))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='compare input shaped motion with unshaped motion in hostsim')
+    parser.add_argument('-c', '--config', default='../ConfigSamples/Smoothieboard/config')
+    parser.add_argument('-f', '--frequency', type=float, default=40, help='ringing frequency in Hz')
+    parser.add_argument('-d', '--damping', type=float, default=0.1, help='damping ratio')
+    parser.add_argument('--type', default='zv,zvd,mzv', help='comma separated shaper types to check')
+    parser.add_argument('--interval', type=int, default=10, help='ticks between samples')
+    parser.add_argument('--limit', type=float, default=0.5, help='largest shaped rms vibration as a fraction of the unshaped one')
+    parser.add_argument('sim')
+    parser.add_argument('gcode', nargs='+')
+    args = parser.parse_args()
+
+    config = read_config(args.config)
+    steps_per_mm = [float(config.get(k, 1)) for k in ('alpha_steps_per_mm', 'beta_steps_per_mm')]
+    dt = args.interval / float(config.get('base_stepping_frequency', 100000))
+    settle = int(0.5 / dt)
+    hold = int(0.005 / dt)
+
+    tmp = tempfile.mkdtemp()
+    types = args.type.split(',')
+    configs = {}
+    for t in types:
+        configs[t] = os.path.join(tmp, 'config-' + t)
+        with open(configs[t], 'w') as f:
+            f.write(open(args.config).read())
+            f.write("\ninput_shaper %s\ninput_shaper_frequency %f\ninput_shaper_damping %f\n" % (t, args.frequency, args.damping))
+
+    ok = True
+    for g in args.gcode:
+        print("%s: ringing at %1.1f Hz, damping %1.3f" % (g, args.frequency, args.damping))
+        out = os.path.join(tmp, 'none.csv')
+        run(args.sim, args.config, g, out)
+        ref_x, ref_y, ref_end = read_trace(out, steps_per_mm, args.interval, settle)
+        ref_rms = report('none', ref_x, ref_y, dt, args.frequency, args.damping, hold)
+        print()
+
+        for t in types:
+            out = os.path.join(tmp, t + '.csv')
+            run(args.sim, configs[t], g, out)
+            xs, ys, end = read_trace(out, steps_per_mm, args.interval, settle)
+            rms = report(t, xs, ys, dt, args.frequency, args.damping, hold)
+            print(", %1.1f%% of unshaped, path deviation %1.3f mm, %1.3f s longer" %
+                  (100 * rms / ref_rms if ref_rms > 0 else 0, path_deviation((ref_x, ref_y), (xs, ys)), (len(xs) - len(ref_x)) * dt))
+            if end != ref_end:
+                print("  %s: ends at %s steps, unshaped ends at %s" % (t, end, ref_end))
+                ok = False
+            if ref_rms > 0 and rms > args.limit * ref_rms:
+                print("  %s: does not reduce the vibration enough" % t)
+                ok = False
+
+    shutil.rmtree(tmp)
+    print("PASS" if ok else "FAIL")
+    sys.exit(0 if ok else 1)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,85 @@
+#!/usr/bin/env python
+"""Checks the underrun telemetry of the conveyor and step ticker against how fast the host sends.
+
+Runs each gcode file through hostsim fed as fast as the main loop takes it, where the queue never runs dry and there
+must be no underruns or forced decelerations, then streamed over the simulated serial link with more and more latency.
+Once the host sends slower than the moves take to execute the step ticker has to run out of blocks, every underrun
+follows a block that had to decelerate to a stop, and the first block after the queue ran dry is held back no longer
+than queue_delay_time_ms. It prints the counters against the lines per second, as M461 S would show them.
+
+usage: starvecheck.py [-c config] hostsim file.gcode ...
+
+e.g.
+    make && ./starvecheck.py build/hostsim samples/segments.gcode
+"""
+
+from __future__ import print_function
+import argparse
+import re
+import subprocess
+import sys
+
+
+LATENCIES = [0, 1000, 5000, 10000, 30000]
+
+
+def read_config(fn):
+    config = {}
+    with open(fn) as f:
+        for line in f:
+            words = line.split('#', 1)[0].split()
+            if len(words) >= 2:
+                config[words[0]] = words[1]
+    return config
+
+
+def run(sim, config, gcode, latency=None):
+    """returns the lines per second, underruns, seconds waiting, forced decels and max fetch delay"""
+    args = [sim, '-c', config] + ([] if latency is None else ['-s', str(latency)]) + [gcode]
+    report = subprocess.check_output(args).decode()
+    m = re.search(r'(\d+) lines/s', report)
+    rate = int(m.group(1)) if m else 0
+    m = re.search(r'underruns: (\d+), ([\d.]+) s waiting, (\d+) forced decels, .* (\d+) ms max fetch delay', report)
+    if m is None:
+        return rate, 0, 0.0, 0, 0
+    return rate, int(m.group(1)), float(m.group(2)), int(m.group(3)), int(m.group(4))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='check the underrun counters in hostsim against the stream rate')
+    parser.add_argument('-c', '--config', default='../ConfigSamples/Smoothieboard/config')
+    parser.add_argument('sim')
+    parser.add_argument('gcode', nargs='+')
+    args = parser.parse_args()
+
+    delay = int(read_config(args.config).get('queue_delay_time_ms', 100))
+    ok = True
+    for g in args.gcode:
+        print("%s:" % g)
+        _, underruns, _, forced, _ = run(args.sim, args.config, g)
+        print("  %-16s %d underruns, %d forced decels" % ('not streamed:', underruns, forced))
+        if underruns != 0 or forced != 0:
+            print("FAILED: the queue ran dry when fed as fast as it takes lines")
+            ok = False
+
+        underruns = 0
+        for l in LATENCIES:
+            rate, underruns, waiting, forced, fetch = run(args.sim, args.config, g, l)
+            print("  %6d us latency: %5d lines/s, %4d underruns %8.3f s waiting, %4d forced decels, %3d ms max fetch delay" %
+                  (l, rate, underruns, waiting, forced, fetch))
+            if forced < underruns:
+                print("FAILED: an underrun did not follow a forced deceleration")
+                ok = False
+            if fetch > delay:
+                print("FAILED: a block was held back longer than queue_delay_time_ms")
+                ok = False
+        if underruns == 0:
+            print("FAILED: the step ticker never ran out of blocks streaming with %d us latency" % LATENCIES[-1])
+            ok = False
+
+    print("PASS" if ok else "FAIL")
+    sys.exit(0 if ok else 1)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,246 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Checks the temperature the Thermistor reads from its table is within 0.1 °C of the beta or Steinhart-Hart formula,
+// worked out in doubles, at every ADC value from the hottest the table covers to the coldest that is not taken as an
+// open circuit. It does this for the hotend in the config, every predefined thermistor, a beta set with M305 and
+// coefficients from an rt_curve, and checks the ADC filter follows a reading with spikes in it.
+//
+// Then it reports the time each reading took the way it was done, sorting the last 32 samples, averaging the last 4
+// reads and working the formula out, and the way it is done now, from the filtered total and the table. This is on the
+// host, which has an FPU, the board has none so the formula costs it much more than here.
+//
+// usage: thermcheck [-c config] [-n readings]
+
+#include "HostSim.h"
+
+#include "libs/Kernel.h"
+#include "libs/Adc.h"
+#include "libs/Pin.h"
+#include "Thermistor.h"
+#include "predefined_thermistors.h"
+#include "checksumm.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <math.h>
+#include <fastmath.h>
+#include <algorithm>
+#include <chrono>
+
+// Adc.cpp needs the mbed ADC library, the thermistor reads whatever value is set here
+static unsigned int adc_value = 0;
+Adc *Adc::instance;
+Adc::Adc() { instance = this; }
+void Adc::enable_pin(Pin *) {}
+unsigned int Adc::read(Pin *) { return adc_value; }
+
+#define hottest 450.0
+
+// the temperature at an ADC value worked out in doubles, infinite where the firmware takes it as an open circuit
+struct curve_t {
+    bool shh;
+    double c1, c2, c3;
+    double beta, r0, t0;
+    int r1, r2;
+
+    double temperature(unsigned int adc) const
+    {
+        double max = THEKERNEL->adc->get_max_value();
+        if(adc == 0 || adc >= max) return INFINITY;
+        double r = r2 / (max / adc - 1.0);
+        if(r1 > 0) r = (r1 * r) / (r1 - r);
+        if(r > r0 * 8) return INFINITY;
+        if(shh) {
+            double l = log(r);
+            return 1.0 / (c1 + c2 * l + c3 * l * l * l) - 273.15;
+        }
+        return 1.0 / (1.0 / (t0 + 273.15) + log(r / r0) / beta) - 273.15;
+    }
+};
+
+static curve_t beta_curve(double beta, double r0, double t0, int r1, int r2)
+{
+    return {false, 0, 0, 0, beta, r0, t0, r1, r2};
+}
+
+static curve_t shh_curve(double c1, double c2, double c3, int r1, int r2)
+{
+    // the open circuit check uses r0, which the predefined S/H thermistors leave at 100k
+    return {true, c1, c2, c3, 0, 100000, 25, r1, r2};
+}
+
+static bool check(bool ok, const char *what)
+{
+    if(!ok) printf("FAILED: %s\n", what);
+    return ok;
+}
+
+// the largest difference from the curve at any reading it gives a temperature for up to the hottest
+static bool compare(Thermistor &t, const curve_t &c, const char *name)
+{
+    double worst = 0;
+    unsigned int worst_adc = 0, readings = 0, mismatched = 0;
+    for (unsigned int adc = 1; adc < (unsigned int)THEKERNEL->adc->get_max_value(); ++adc) {
+        double exact = c.temperature(adc);
+        adc_value = adc;
+        float got = t.get_temperature();
+        if(isinf(exact) || isnan(exact) || exact > hottest) {
+            // outside the table it is the formula in floats, only the open circuit must match
+            if(isinf(exact) && !isinf(got)) ++mismatched;
+            continue;
+        }
+        ++readings;
+        double d = fabs(got - exact);
+        if(d > worst) {
+            worst = d;
+            worst_adc = adc;
+        }
+    }
+    printf("%-22s %5u readings, at most %1.3f °C off at adc %u (%1.1f °C)\n", name, readings, worst, worst_adc, c.temperature(worst_adc));
+    return worst < 0.1 && mismatched == 0 && readings > 1000;
+}
+
+// as Adc did it, keeps the last 32 samples and a 4 read moving average
+struct old_adc_t {
+    uint16_t samples[32];
+    uint16_t ave_buf[4];
+
+    void add(uint16_t v)
+    {
+        memmove(&samples[0], &samples[1], sizeof(samples) - sizeof(samples[0]));
+        samples[31] = v;
+    }
+
+    unsigned int read()
+    {
+        uint16_t median_buffer[32];
+        memcpy(median_buffer, samples, sizeof(median_buffer));
+        std::sort(median_buffer, median_buffer + 32);
+        uint32_t sum = 0;
+        for (int i = 8; i < 24; ++i) sum += median_buffer[i];
+        ave_buf[3] = ave_buf[2];
+        ave_buf[2] = ave_buf[1];
+        ave_buf[1] = ave_buf[0];
+        ave_buf[0] = sum >> OVERSAMPLE;
+        return roundf((ave_buf[0] + ave_buf[1] + ave_buf[2] + ave_buf[3]) / 4.0F);
+    }
+};
+
+// as Thermistor did it, the EPCOS100K Steinhart-Hart formula in floats
+static float old_temperature(unsigned int adc)
+{
+    const thermistor_table_t &c = predefined_thermistors[0];
+    const uint32_t max_adc_value = THEKERNEL->adc->get_max_value();
+    if ((adc >= max_adc_value) || (adc == 0)) return infinityf();
+    float r = c.r2 / (((float)max_adc_value / adc) - 1.0F);
+    if(r > 100000 * 8) return infinityf();
+    float l = logf(r);
+    return (1.0F / (c.c1 + c.c2 * l + c.c3 * powf(l, 3))) - 273.15F;
+}
+
+// a reading with noise of a few counts and a spike every 50 samples
+static uint16_t sample(int i, uint16_t level)
+{
+    int noise = (int)((i * 2654435761U) >> 29) - 4;
+    if(i % 50 == 0) return 4095;
+    return level + noise;
+}
+
+int main(int argc, char *argv[])
+{
+    int n = 1000000;
+    int c;
+    while((c = getopt(argc, argv, "c:n:")) != -1) {
+        if(c == 'c') sim_config_file = optarg;
+        else if(c == 'n') n = atoi(optarg);
+        else {
+            fprintf(stderr, "usage: %s [-c config] [-n readings]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    new Kernel();
+    THEKERNEL->adc = new Adc();
+    bool ok = true;
+
+    // the hotend as configured, a predefined thermistor from its name
+    Thermistor t;
+    t.UpdateConfig(CHECKSUM("temperature_control"), CHECKSUM("hotend"));
+    const thermistor_table_t &epcos = predefined_thermistors[0];
+    ok &= check(compare(t, shh_curve(epcos.c1, epcos.c2, epcos.c3, epcos.r1, epcos.r2), "config hotend"), "the config hotend table is not within 0.1 °C");
+
+    // every predefined thermistor, as M305 P sets them
+    int p = 1;
+    for (auto &i : predefined_thermistors) {
+        ok &= check(t.set_optional({{'P', (float)p++}}), "a predefined thermistor was not set");
+        ok &= check(compare(t, shh_curve(i.c1, i.c2, i.c3, i.r1, i.r2), i.name), "a predefined S/H thermistor table is not within 0.1 °C");
+    }
+    p = 129;
+    for (auto &i : predefined_thermistors_beta) {
+        ok &= check(t.set_optional({{'P', (float)p++}}), "a predefined thermistor was not set");
+        ok &= check(compare(t, beta_curve(i.beta, i.r0, i.t0, i.r1, i.r2), i.name), "a predefined beta thermistor table is not within 0.1 °C");
+    }
+
+    // a 10k beta as M305 B R X sets it, the resistors stay those of the last predefined one
+    const thermistor_beta_table_t &last = predefined_thermistors_beta[sizeof(predefined_thermistors_beta) / sizeof(predefined_thermistors_beta[0]) - 1];
+    ok &= check(t.set_optional({{'B', 3950}, {'R', 10000}, {'X', 25}}), "a beta was not set");
+    ok &= check(compare(t, beta_curve(3950, 10000, 25, last.r1, last.r2), "beta 3950 10k"), "the beta table is not within 0.1 °C");
+
+    // the Semitec 104GT-2 rt_curve, the coefficients are worked out as the config does
+    float c1, c2, c3;
+    std::tie(c1, c2, c3) = Thermistor::calculate_steinhart_hart_coefficients(25, 100000, 150, 1355, 240, 203);
+    ok &= check(t.set_optional({{'I', c1}, {'J', c2}, {'K', c3}}), "the coefficients were not set");
+    curve_t rt = shh_curve(c1, c2, c3, last.r1, last.r2);
+    rt.r0 = 10000;
+    ok &= check(compare(t, rt, "rt_curve 104GT-2"), "the rt_curve table is not within 0.1 °C");
+
+    // the filter follows a level through noise and spikes, and a step within 5 blocks of samples as the block the step
+    // is in is partly from before it
+    AdcFilter filter;
+    for (int i = 0; i < 200; ++i) filter.add(sample(i, 1000));
+    int held = filter.value();
+    for (int i = 200; i < 200 + 5 * 16; ++i) filter.add(sample(i, 3000));
+    int stepped = filter.value();
+    printf("filter: %d at 1000 with spikes, %d after a step to 3000\n", held, stepped);
+    ok &= check(abs(held - 4000) <= 8 && abs(stepped - 12000) <= 8, "the ADC filter did not follow the reading");
+
+    // the time for each reading, each way, with a new sample between reads as the ADC interrupt makes them
+    ok &= check(t.set_optional({{'P', 1}}), "the EPCOS100K was not set");
+    old_adc_t old_adc;
+    memset(&old_adc, 0, sizeof(old_adc));
+    AdcFilter bench;
+    // both full of samples before they are read
+    for (int i = 0; i < 128; ++i) {
+        old_adc.add(sample(i, 2000));
+        if(i % 16 == 0) old_adc.read();
+        bench.add(sample(i, 2000));
+    }
+    float sum_old = 0, sum_new = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < n; ++i) {
+        old_adc.add(sample(i, 2000 + (i >> 12) % 1000));
+        sum_old += old_temperature(old_adc.read());
+    }
+    double old_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / n;
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < n; ++i) {
+        bench.add(sample(i, 2000 + (i >> 12) % 1000));
+        adc_value = bench.value();
+        sum_new += t.get_temperature();
+    }
+    double new_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / n;
+    printf("sample and reading: sorted and formula %1.1f ns, filtered and table %1.1f ns, %1.1f times faster (mean %1.2f and %1.2f °C)\n",
+           old_ns, new_ns, old_ns / new_ns, sum_old / n, sum_new / n);
+    ok &= check(fabsf(sum_old / n - sum_new / n) < 0.5F, "the mean temperature read differs from the old way");
+
+    printf(ok ? "PASS\n" : "FAIL\n");
+    return ok ? 0 : 1;
+}
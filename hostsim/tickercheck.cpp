@@ -0,0 +1,187 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Runs the SlowTicker on a simulated TIMER2, the counter is moved on to the match that was set and the interrupt
+// handler is called, and each hook moves the counter on by the time it takes.
+//
+// The hooks are those of a typical board: three heater pwms, the thermistor reads, the endstops, a fan switch with its
+// sigma delta pwm, the play led and the panel. It checks each hook is called as often as it asked for while the counter
+// wraps, that hooks at frequencies that divide each other share an interrupt, that hooks due together are called
+// highest priority first and that the endstops are never late, that a hook attached while the timer runs is called on
+// multiples of its interval, that a hook that overruns skips the calls it missed rather than making them one after the
+// other, and that ON_SECOND_TICK is called once a second. Then it reports the interrupts taken and the hooks looked at
+// against one interrupt per tick of the fastest hook looking at every hook, as the fixed rate ticker did.
+//
+// usage: tickercheck [-c config] [-s seconds]
+
+#include "HostSim.h"
+
+#include "libs/Kernel.h"
+#include "libs/Module.h"
+#include "libs/SlowTicker.h"
+#include "libs/Hook.h"
+#include "gpio.h"
+#include "LPC17xx.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <vector>
+
+// gpio.cpp needs the NXP driver library, the ticker only flashes a led with these when leds are used
+GPIO::GPIO(uint8_t port, uint8_t pin) : port(port), pin(pin) {}
+int GPIO::operator=(int value) { return value; }
+GPIO leds[5] = { GPIO(1, 18), GPIO(1, 19), GPIO(1, 20), GPIO(1, 21), GPIO(4, 28) };
+
+extern "C" void TIMER2_IRQHandler(void);
+
+// the interrupt and the priority of each call, in the order they were made
+struct call_t {
+    uint32_t interrupt;
+    uint8_t priority;
+};
+static std::vector<call_t> calls;
+static bool recording = false;
+
+class Probe : public Module {
+    public:
+        Probe(uint32_t frequency, uint8_t priority, uint32_t cost) : frequency(frequency), cost(cost), overrun(0), seconds(0)
+        {
+            hook = THEKERNEL->slow_ticker->attach(frequency, this, &Probe::tick, priority);
+        }
+
+        uint32_t tick(uint32_t)
+        {
+            if(recording) calls.push_back({THEKERNEL->slow_ticker->get_interrupts(), hook->priority});
+            LPC_TIM2->TC += cost + overrun;
+            overrun = 0;
+            return 0;
+        }
+
+        void on_second_tick(void *) { ++seconds; }
+
+        uint32_t frequency, cost, overrun;
+        int seconds;
+        Hook *hook;
+};
+
+static bool check(bool ok, const char *what)
+{
+    if(!ok) printf("FAILED: %s\n", what);
+    return ok;
+}
+
+// moves the counter on to each match and takes the interrupt until the time has passed, the idle loop runs after each
+static void run(uint64_t counts)
+{
+    uint64_t elapsed = 0;
+    uint32_t last = LPC_TIM2->TC;
+    while(elapsed < counts) {
+        LPC_TIM2->TC = LPC_TIM2->MR0;
+        LPC_TIM2->IR |= 1;
+        TIMER2_IRQHandler();
+        elapsed += (uint32_t)(LPC_TIM2->TC - last);
+        last = LPC_TIM2->TC;
+        THEKERNEL->call_event(ON_IDLE);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    int seconds = 10;
+    int c;
+    while((c = getopt(argc, argv, "c:s:")) != -1) {
+        if(c == 'c') sim_config_file = optarg;
+        else if(c == 's') seconds = atoi(optarg);
+        else {
+            fprintf(stderr, "usage: %s [-c config] [-s seconds]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    new Kernel();
+    // the time is only moved on by the timer
+    sim_idle_quantum = 0;
+    // the ISP button is not pressed
+    sim_gpio[2].FIOPIN |= 1 << 10;
+
+    const uint32_t per_second = SystemCoreClock >> 2;
+    // so the counter wraps half way through
+    LPC_TIM2->TC = 0 - (uint32_t)(per_second * (uint64_t)seconds / 2);
+    THEKERNEL->add_module(THEKERNEL->slow_ticker = new SlowTicker());
+
+    std::vector<Probe *> probes;
+    for (int i = 0; i < 3; ++i) probes.push_back(new Probe(2000, SlowTicker::OUTPUT_PRIORITY, 50));
+    for (int i = 0; i < 3; ++i) probes.push_back(new Probe(20, SlowTicker::NORMAL_PRIORITY, 2000));
+    Probe *endstops = new Probe(1000, SlowTicker::SAFETY_PRIORITY, 100);
+    probes.push_back(endstops);
+    probes.push_back(new Probe(100, SlowTicker::NORMAL_PRIORITY, 200));
+    Probe *sigmadelta = new Probe(1000, SlowTicker::OUTPUT_PRIORITY, 50);
+    probes.push_back(sigmadelta);
+    probes.push_back(new Probe(12, SlowTicker::NORMAL_PRIORITY, 100));
+    Probe *panel = new Probe(1000, SlowTicker::NORMAL_PRIORITY, 500);
+    probes.push_back(panel);
+    endstops->register_for_event(ON_SECOND_TICK);
+
+    bool ok = true;
+    SlowTicker *st = THEKERNEL->slow_ticker;
+    st->start();
+    recording = true;
+    run((uint64_t)per_second * seconds);
+    recording = false;
+
+    bool counts = true;
+    for (auto p : probes) {
+        int32_t d = (int32_t)p->hook->calls - (int32_t)(p->frequency * seconds);
+        if(d < -1 || d > 1) {
+            printf("%lu Hz hook called %lu times\n", (unsigned long)p->frequency, (unsigned long)p->hook->calls);
+            counts = false;
+        }
+    }
+    ok &= check(counts, "a hook was not called as often as it asked for while the counter wrapped");
+    ok &= check(endstops->seconds >= seconds - 1 && endstops->seconds <= seconds, "ON_SECOND_TICK was not called once a second");
+
+    // the 12Hz led is the only hook not due on a tick of the 2000Hz pwms
+    uint32_t interrupts = st->get_interrupts();
+    ok &= check(interrupts <= (2000 + 12) * (uint32_t)seconds + 1, "hooks at frequencies that divide each other did not share an interrupt");
+
+    bool order = true;
+    for (size_t i = 1; i < calls.size(); ++i) {
+        if(calls[i].interrupt == calls[i - 1].interrupt && calls[i].priority > calls[i - 1].priority) order = false;
+    }
+    ok &= check(order, "a hook was called before a hook of a higher priority due at the same time");
+    ok &= check(endstops->hook->max_late == 0 && panel->hook->max_late > 0, "the endstops were called late");
+
+    uint32_t hooks_called = 0;
+    for (auto h : st->get_hooks()) hooks_called += h->calls;
+    printf("%d hooks for %d s: %lu interrupts, %lu hooks called, the fixed rate ticker took %lu interrupts and looked at %lu hooks\n",
+           (int)st->get_hooks().size(), seconds, (unsigned long)interrupts, (unsigned long)hooks_called,
+           (unsigned long)(2000 * seconds), (unsigned long)(2000 * seconds * st->get_hooks().size()));
+    printf("endstops late %1.1f us at most, panel late %1.1f us on average and %1.1f us at most\n",
+           (float)endstops->hook->max_late / st->get_counts_per_us(),
+           (float)panel->hook->total_late / panel->hook->calls / st->get_counts_per_us(),
+           (float)panel->hook->max_late / st->get_counts_per_us());
+
+    // attached while the timer runs, it is due with the hooks it divides and takes no interrupts of its own
+    Probe *late = new Probe(250, SlowTicker::NORMAL_PRIORITY, 100);
+    st->reset_stats();
+    run(per_second);
+    ok &= check(late->hook->next % late->hook->interval == 0, "a hook attached while the timer ran was not called on multiples of its interval");
+    ok &= check(late->hook->calls >= 249 && late->hook->calls <= 251, "a hook attached while the timer ran was not called as often as it asked for");
+    ok &= check(st->get_interrupts() <= 2000 + 12 + 1, "a hook attached while the timer ran took interrupts of its own");
+
+    // takes 5.5ms once, the 5 calls it missed are skipped
+    st->reset_stats();
+    sigmadelta->overrun = per_second / 1000 * 11 / 2;
+    run(per_second);
+    ok &= check(sigmadelta->hook->missed == 5, "a hook that overran did not count the calls it missed");
+    ok &= check(sigmadelta->hook->calls >= 994 && sigmadelta->hook->calls <= 996, "a hook that overran made the calls it missed");
+    printf("overran 5.5 ms: %lu calls, %lu missed\n", (unsigned long)sigmadelta->hook->calls, (unsigned long)sigmadelta->hook->missed);
+
+    printf(ok ? "PASS\n" : "FAIL\n");
+    return ok ? 0 : 1;
+}
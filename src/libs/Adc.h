@@ -13,6 +13,8 @@
 #include "PinNames.h" // mbed.h lib
 
 #include <cmath>
+#include <stdint.h>
+#include <algorithm>
 
 class Pin;
 namespace mbed {
@@ -23,6 +25,63 @@ namespace mbed {
 // 2 bits means the 12bit ADC is 14 bits of resolution
 #define OVERSAMPLE 2
 
+// Filters the samples of one channel as they come in from the ADC interrupt, so reading it is a single load.
+// Each sample is replaced by the median of it and the two before it, which drops single sample spikes, 4^OVERSAMPLE
+// of those are added up for each oversampled reading, and the reading is the average of the last 4 of those.
+class AdcFilter
+{
+public:
+    AdcFilter() { reset(); }
+    void reset()
+    {
+        prev[0]= prev[1]= 0;
+        block_sum= 0;
+        block_count= 0;
+        for (auto &b : blocks) b= 0;
+        block_index= 0;
+        total= 0;
+    }
+
+    // called from the ADC interrupt
+    void add(uint16_t sample)
+    {
+        uint16_t a= prev[0], b= prev[1], m;
+        if(a > b) std::swap(a, b);
+        m= sample < a ? a : (sample > b ? b : sample);
+        prev[0]= prev[1];
+        prev[1]= sample;
+
+        block_sum += m;
+        if(++block_count == block_samples) {
+            total += block_sum - blocks[block_index];
+            blocks[block_index]= block_sum;
+            block_index= (block_index + 1) % num_blocks;
+            block_sum= 0;
+            block_count= 0;
+        }
+    }
+
+    unsigned int value() const { return (total + (1 << (shift - 1))) >> shift; }
+
+private:
+#ifdef OVERSAMPLE
+    static const int block_samples= 1 << (2 * OVERSAMPLE);
+    static const int shift= OVERSAMPLE + 2;
+#else
+    static const int block_samples= 1;
+    static const int shift= 2;
+#endif
+    static const int num_blocks= 4;
+
+    uint16_t prev[2];
+    uint32_t block_sum;
+    uint32_t blocks[num_blocks];
+    uint8_t block_count;
+    uint8_t block_index;
+    // the sum of the blocks, updated in one store so it can be read without disabling interrupts
+    volatile uint32_t total;
+};
+
 class Adc
 {
 public:
@@ -44,14 +103,7 @@ private:
     mbed::ADC *adc;
 
     static const int num_channels= 6;
-#ifdef OVERSAMPLE
-    // we need 4^n sample to oversample and we get double that to filter out spikes
-    static const int num_samples= powf(4, OVERSAMPLE)*2;
-#else
-    static const int num_samples= 8;
-#endif
-    // buffers storing the last num_samples readings for each channel
-    uint16_t sample_buffers[num_channels][num_samples];
+    AdcFilter filters[num_channels];
 };
 
 #endif
@@ -20,6 +20,16 @@ using namespace std;
 #include "libs/ConfigSources/FileConfigSource.h"
 #include "libs/ConfigSources/FirmConfigSource.h"
 #include "StreamOutputPool.h"
+#include "checksumm.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#define config_snapshot_checksum CHECKSUM("config_snapshot")
+
+// the snapshot is the cache as it was after the text was read: the hash of each source, then each value, then a hash
+// of all that so a snapshot that was not written to the end is not used
+#define SNAPSHOT_MAGIC "SMCFG01"
 
 // Add various config sources. Config can be fetched from several places.
 // All values are read into a cache, that is then used by modules to read their configuration
@@ -40,18 +50,22 @@ Config::Config()
         this->config_sources.push_back( fcs );
         fcs = NULL;
     }
-    if( file_exists("/sd/config") )
+    if( file_exists("/sd/config") ) {
         fcs = new FileConfigSource("/sd/config", "sd");
-    else if( file_exists("/sd/config.txt") )
+        this->snapshot_file = "/sd/config.bin";
+    } else if( file_exists("/sd/config.txt") ) {
         fcs = new FileConfigSource("/sd/config.txt", "sd");
+        this->snapshot_file = "/sd/config.bin";
+    }
     if( fcs != NULL )
         this->config_sources.push_back( fcs );
 }
 
-Config::Config(ConfigSource *cs)
+Config::Config(ConfigSource *cs, const char *snapshot_file)
 {
     this->config_cache = NULL;
     this->config_sources.push_back( cs );
+    if(snapshot_file != NULL) this->snapshot_file = snapshot_file;
 }
 
 Config::~Config()
@@ -76,10 +90,132 @@ void Config::config_cache_load(bool parse)
 
     this->config_cache= new ConfigCache;
     if(parse) {
+        // the values as they were last read if none of the sources have changed since
+        if(load_snapshot()) return;
+
         // For each ConfigSource in our stack
         for( ConfigSource *source : this->config_sources ) {
             source->transfer_values_to_cache(this->config_cache);
         }
+
+        if(!snapshot_file.empty()) {
+            if(this->value(config_snapshot_checksum)->by_default(false)->as_bool()) save_snapshot();
+            else remove(snapshot_file.c_str());
+        }
+    }
+}
+
+// these read and write the snapshot and keep a hash of what they read and wrote
+static bool read_data(FILE *fp, void *data, size_t size, uint32_t &h)
+{
+    if(fread(data, 1, size, fp) != size) return false;
+    h= ConfigSource::hash_data(data, size, h);
+    return true;
+}
+
+static bool write_data(FILE *fp, const void *data, size_t size, uint32_t &h)
+{
+    h= ConfigSource::hash_data(data, size, h);
+    return fwrite(data, 1, size, fp) == size;
+}
+
+static bool read_string(FILE *fp, string &str, uint32_t &h)
+{
+    uint8_t len;
+    char buf[256];
+    if(!read_data(fp, &len, 1, h) || !read_data(fp, buf, len, h)) return false;
+    str.assign(buf, len);
+    return true;
+}
+
+static bool write_string(FILE *fp, const string &str, uint32_t &h)
+{
+    uint8_t len= str.size() < 255 ? str.size() : 255;
+    return write_data(fp, &len, 1, h) && write_data(fp, str.data(), len, h);
+}
+
+// Fills the cache from the snapshot if it is there and every source still has the hash it had when it was written
+bool Config::load_snapshot()
+{
+    if(snapshot_file.empty()) return false;
+    FILE *fp= fopen(snapshot_file.c_str(), "r");
+    if(fp == NULL) return false;
+
+    uint32_t h= 2166136261U;
+    char magic[sizeof(SNAPSHOT_MAGIC)];
+    uint16_t n;
+    bool ok= read_data(fp, magic, sizeof(magic), h) && memcmp(magic, SNAPSHOT_MAGIC, sizeof(magic)) == 0 &&
+             read_data(fp, &n, sizeof(n), h) && n == config_sources.size();
+
+    for (size_t i = 0; ok && i < config_sources.size(); ++i) {
+        uint16_t name;
+        uint32_t hash;
+        uint8_t ninc;
+        ok= read_data(fp, &name, sizeof(name), h) && name == config_sources[i]->get_name_checksum() &&
+            read_data(fp, &hash, sizeof(hash), h) && read_data(fp, &ninc, 1, h);
+        vector<string> included(ok ? ninc : 0);
+        for (auto &f : included) {
+            if(ok) ok= read_string(fp, f, h);
+        }
+        if(ok) ok= config_sources[i]->get_hash(included) == hash;
+    }
+
+    uint32_t nvalues;
+    ok= ok && read_data(fp, &nvalues, sizeof(nvalues), h);
+    for (uint32_t i = 0; ok && i < nvalues; ++i) {
+        ConfigValue *cv= new ConfigValue;
+        if(read_data(fp, cv->check_sums, sizeof(cv->check_sums), h) && read_string(fp, cv->value, h)) {
+            cv->found= true;
+            this->config_cache->add(cv);
+        }else{
+            delete cv;
+            ok= false;
+        }
+    }
+
+    uint32_t check;
+    uint32_t end= h;
+    ok= ok && fread(&check, sizeof(check), 1, fp) == 1 && check == end;
+    fclose(fp);
+
+    if(!ok) {
+        // start again from the text
+        this->config_cache->clear();
+        return false;
+    }
+    return true;
+}
+
+// Writes the cache as it is after the sources were read, with the hash of each source
+void Config::save_snapshot()
+{
+    FILE *fp= fopen(snapshot_file.c_str(), "w");
+    if(fp == NULL) return;
+
+    uint32_t h= 2166136261U;
+    uint16_t n= config_sources.size();
+    bool ok= write_data(fp, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC), h) && write_data(fp, &n, sizeof(n), h);
+    for (auto source : config_sources) {
+        uint16_t name= source->get_name_checksum();
+        const vector<string> &included= source->get_included();
+        uint32_t hash= source->get_hash(included);
+        uint8_t ninc= included.size();
+        ok= ok && write_data(fp, &name, sizeof(name), h) && write_data(fp, &hash, sizeof(hash), h) && write_data(fp, &ninc, 1, h);
+        for (auto &f : included) ok= ok && write_string(fp, f, h);
+    }
+
+    const vector<ConfigValue*> &values= this->config_cache->values();
+    uint32_t nvalues= values.size();
+    ok= ok && write_data(fp, &nvalues, sizeof(nvalues), h);
+    for (auto cv : values) {
+        ok= ok && write_data(fp, cv->check_sums, sizeof(cv->check_sums), h) && write_string(fp, cv->value, h);
+    }
+    ok= ok && fwrite(&h, sizeof(h), 1, fp) == 1;
+    fclose(fp);
+
+    if(!ok) {
+        printf("WARNING: could not write the config snapshot %s\n", snapshot_file.c_str());
+        remove(snapshot_file.c_str());
     }
 }
 
@@ -20,7 +20,7 @@ class ConfigCache;
 class Config  {
     public:
         Config();
-        Config(ConfigSource*);
+        Config(ConfigSource*, const char *snapshot_file= NULL);
         ~Config();
 
         void config_cache_load(bool parse= true);
@@ -37,9 +37,12 @@ class Config  {
 
     private:
         bool   has_characters(uint16_t check_sum, string str );
+        bool   load_snapshot();
+        void   save_snapshot();
 
         ConfigCache* config_cache;            // A cache in which ConfigValues are kept
         vector<ConfigSource*> config_sources; // A list of all possible coniguration sources
+        string snapshot_file;                 // Where the cache is saved when config_snapshot is set, empty if nowhere
 };
 
 #endif
@@ -3,6 +3,17 @@
 
 #include "libs/StreamOutput.h"
 
+#include <string.h>
+
+// the index is kept at most 3/4 full so the runs of used slots stay short
+#define min_slots 64
+
+static uint32_t hash_checksums(const uint16_t *check_sums)
+{
+    uint32_t h= (check_sums[0] * 0x9E3779B1U) ^ (check_sums[1] * 0x85EBCA77U) ^ (check_sums[2] * 0xC2B2AE3DU);
+    return h ^ (h >> 16);
+}
+
 ConfigCache::ConfigCache()
 {
 }
@@ -19,11 +30,51 @@ void ConfigCache::clear()
     }
     store.clear();
     storage_t().swap(store);   //  makes sure the vector releases its memory
+    vector<uint16_t>().swap(index);
+}
+
+// returns where in store the value with these checksums is, or -1
+int ConfigCache::find(const uint16_t *check_sums) const
+{
+    if(index.empty()) return -1;
+    uint32_t mask= index.size() - 1;
+    for (uint32_t s = hash_checksums(check_sums) & mask; index[s] != 0; s = (s + 1) & mask) {
+        const ConfigValue *cv= store[index[s] - 1];
+        if(memcmp(check_sums, cv->check_sums, sizeof(cv->check_sums)) == 0)
+            return index[s] - 1;
+    }
+    return -1;
+}
+
+void ConfigCache::rebuild_index(size_t slots)
+{
+    vector<uint16_t>(slots, 0).swap(index);
+    for (size_t i = 0; i < store.size(); ++i) {
+        // the first of values with the same checksums is the one found, as it was when they were searched in order
+        if(find(store[i]->check_sums) < 0) index_value(i);
+    }
+}
+
+// adds the value at i in store to the index, which must not already have its checksums
+void ConfigCache::index_value(uint16_t i)
+{
+    if((store.size() + 1) * 4 > index.size() * 3) {
+        size_t slots= min_slots;
+        while((store.size() + 1) * 4 > slots * 3) slots *= 2;
+        rebuild_index(slots);
+        // the rebuild indexed it if it was already in store
+        if(find(store[i]->check_sums) >= 0) return;
+    }
+    uint32_t mask= index.size() - 1;
+    uint32_t s= hash_checksums(store[i]->check_sums) & mask;
+    while(index[s] != 0) s= (s + 1) & mask;
+    index[s]= i + 1;
 }
 
 void ConfigCache::add(ConfigValue *v)
 {
     store.push_back(v);
+    if(find(v->check_sums) < 0) index_value(store.size() - 1);
 }
 
 void ConfigCache::pop()
@@ -31,35 +82,30 @@ void ConfigCache::pop()
     auto cv= store.back();
     store.pop_back();
     delete cv;
+    // the slots after a removed one may belong to other values, so it is simpler to index them all again
+    rebuild_index(index.size());
 }
 
 // If we find an existing value, replace it, otherwise, push it at the back of the list
 void ConfigCache::replace_or_push_back(ConfigValue *new_value)
 {
-    // For each already existing element
-    for(auto &cv : store) {
-        // If this configvalue matches the checksum
-        if(memcmp(new_value->check_sums, cv->check_sums, sizeof(cv->check_sums)) == 0) {
-            // Replace with the provided value
-            delete cv; // free up old one
-            cv =  new_value;
-            printf("WARNING: duplicate config line replaced\n");
-            return;
-        }
+    int i= find(new_value->check_sums);
+    if(i >= 0) {
+        // Replace with the provided value
+        delete store[i]; // free up old one
+        store[i]= new_value;
+        printf("WARNING: duplicate config line replaced\n");
+        return;
     }
 
     // Value does not already exists, add to the list
-    store.push_back(new_value);
+    add(new_value);
 }
 
 ConfigValue *ConfigCache::lookup(const uint16_t *check_sums) const
 {
-    for( auto &cv : store) {
-        if(memcmp(check_sums, cv->check_sums, sizeof(cv->check_sums)) == 0)
-            return cv;
-    }
-
-    return NULL;
+    int i= find(check_sums);
+    return i < 0 ? NULL : store[i];
 }
 
 void ConfigCache::collect(uint16_t family, uint16_t cs, vector<uint16_t> *list)
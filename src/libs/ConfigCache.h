@@ -16,6 +16,8 @@ using namespace std;
 class ConfigValue;
 class StreamOutput;
 
+// The values in the order they were read, with an open addressed hash index on their three checksums so a lookup does
+// not have to compare every value, modules make a lot of them while loading.
 class ConfigCache {
     public:
         ConfigCache();
@@ -37,9 +39,18 @@ class ConfigCache {
         // used for debugging, dumps the cache to a stream
         void dump(StreamOutput *stream);
 
+        // in the order they were read, for the config snapshot
+        const vector<ConfigValue*>& values() const { return store; }
+
     private:
+        int find(const uint16_t *check_sums) const;
+        void index_value(uint16_t i);
+        void rebuild_index(size_t slots);
+
         typedef vector<ConfigValue*> storage_t;
         storage_t store;
+        // the index in store + 1 of the value whose checksums hash to each slot or the slots after it, 0 if empty
+        vector<uint16_t> index;
 };
 
 
@@ -71,3 +71,13 @@ string ConfigSource::process_line_from_ascii_config(const string &buffer, uint16
     }
     return value;
 }
+
+uint32_t ConfigSource::hash_data(const void *data, size_t size, uint32_t h)
+{
+    const uint8_t *p= (const uint8_t *)data;
+    for (size_t i = 0; i < size; ++i) {
+        h ^= p[i];
+        h *= 16777619U;
+    }
+    return h;
+}
@@ -9,6 +9,8 @@
 #define CONFIGSOURCE_H
 
 #include <string>
+#include <vector>
+#include <stdint.h>
 
 class ConfigValue;
 class ConfigCache;
@@ -24,10 +26,20 @@ class ConfigSource {
         virtual bool write( std::string setting, std::string value ) = 0;
         virtual std::string read( uint16_t check_sums[3] ) = 0;
 
+        // a hash of the text the values come from, with the files it included, so a config snapshot can tell it
+        // has not changed. The files included are those of the last transfer_values_to_cache
+        virtual uint32_t get_hash(const std::vector<std::string> &included) { return 0; }
+        const std::vector<std::string>& get_included() const { return included; }
+        uint16_t get_name_checksum() const { return name_checksum; }
+
+        // FNV-1a, carries on from h
+        static uint32_t hash_data(const void *data, size_t size, uint32_t h= 2166136261U);
+
     protected:
         virtual ConfigValue* process_line_from_ascii_config(const std::string& line, ConfigCache* cache);
         virtual std::string process_line_from_ascii_config(const std::string& line, uint16_t line_checksums[3]);
         uint16_t name_checksum;
+        std::vector<std::string> included;
 
     private:
         ConfigValue* process_line(const std::string &buffer);
@@ -52,6 +52,7 @@ bool FileConfigSource::readLine(string& line, int lineno, FILE *fp)
 // Transfer all values found in the file to the passed cache
 void FileConfigSource::transfer_values_to_cache( ConfigCache *cache )
 {
+    included.clear();
     if( !this->has_config_file() ) {
         return;
     }
@@ -96,6 +97,7 @@ void FileConfigSource::transfer_values_to_cache( ConfigCache *cache, const char
                 }
                 if(file_exists(inc_file_name)) {
                     printf("Including config file: %s\n", inc_file_name.c_str());
+                    included.push_back(inc_file_name);
 
                     // save position in current config file
                     fpos_t pos;
@@ -120,6 +122,29 @@ void FileConfigSource::transfer_values_to_cache( ConfigCache *cache, const char
     fclose(lp);
 }
 
+// hashes the file in sector sized reads, a file that is not there hashes as its name alone
+uint32_t FileConfigSource::hash_file(const char *file_name, uint32_t h)
+{
+    h= hash_data(file_name, strlen(file_name) + 1, h);
+    FILE *fp= fopen(file_name, "r");
+    if(fp == NULL) return h;
+    char buf[512];
+    size_t n;
+    while((n= fread(buf, 1, sizeof(buf), fp)) > 0) h= hash_data(buf, n, h);
+    fclose(fp);
+    return h;
+}
+
+uint32_t FileConfigSource::get_hash(const vector<string> &included)
+{
+    if( !this->has_config_file() ) {
+        return 0;
+    }
+    uint32_t h= hash_file(this->config_file.c_str(), 2166136261U);
+    for(auto &i : included) h= hash_file(i.c_str(), h);
+    return h;
+}
+
 // Return true if the check_sums match
 bool FileConfigSource::is_named( uint16_t check_sum )
 {
@@ -25,12 +25,14 @@ public:
     bool is_named( uint16_t check_sum );
     bool write( string setting, string value );
     string read( uint16_t check_sums[3] );
+    uint32_t get_hash(const vector<string> &included);
     bool has_config_file();
     void try_config_file(string candidate);
     string get_config_file();
 
 private:
     bool readLine(string& line, int lineno, FILE *fp);
+    static uint32_t hash_file(const char *file_name, uint32_t h);
     string config_file;         // Path to the config file
     bool   config_file_found;   // Wether or not the config file's location is known
 };
@@ -50,6 +50,12 @@ void FirmConfigSource::transfer_values_to_cache( ConfigCache* cache ){
     }
 }
 
+// the built in config changes with the firmware
+uint32_t FirmConfigSource::get_hash(const vector<string> &included)
+{
+    return hash_data(this->start, this->end - this->start);
+}
+
 // Return true if the check_sums match
 bool FirmConfigSource::is_named( uint16_t check_sum ){
     return check_sum == this->name_checksum;
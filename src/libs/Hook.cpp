@@ -5,4 +5,14 @@ extern "C"{
 
 // Hook is just a glorified FPointer
 
-Hook::Hook(){}
+Hook::Hook()
+{
+    interval= 0;
+    next= 0;
+    priority= 0;
+    calls= 0;
+    max_late= 0;
+    total_late= 0;
+    missed= 0;
+    busy= 0;
+}
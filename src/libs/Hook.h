@@ -2,13 +2,23 @@
 #define HOOK_H
 #include "libs/FPointer.h"
 
-// Hook is just a glorified FPointer
+// Hook is just a glorified FPointer, with what SlowTicker needs to call it on time
 
 class Hook : public FPointer {
     public:
         Hook();
-        int     interval;
-        int     countdown;
+        uint32_t interval;      // timer counts between calls
+        uint64_t next;          // timer count it is due at, counted from when the timer started
+        uint8_t  priority;      // of hooks due at the same time the highest is called first
+
+        // how late it was called, in timer counts
+        uint32_t calls;
+        uint32_t max_late;
+        uint64_t total_late;
+        // calls dropped because it fell more than an interval behind
+        uint32_t missed;
+        // timer counts spent in the call
+        uint64_t busy;
 };
 
 #endif
@@ -10,6 +10,7 @@
 #include "libs/Config.h"
 #include "libs/nuts_bolts.h"
 #include "libs/SlowTicker.h"
+#include "libs/Scheduler.h"
 #include "libs/Adc.h"
 #include "libs/StreamOutputPool.h"
 #include <mri.h>
@@ -49,6 +50,7 @@
 #define grbl_mode_checksum                          CHECKSUM("grbl_mode")
 #define feed_hold_enable_checksum                   CHECKSUM("enable_feed_hold")
 #define ok_per_line_checksum                        CHECKSUM("ok_per_line")
+#define ahb_slabs_enable_checksum                   CHECKSUM("ahb_slabs_enable")
 
 Kernel* Kernel::instance;
 
@@ -63,6 +65,9 @@ Kernel::Kernel()
 
     instance = this; // setup the Singleton instance of the kernel
 
+    // modules add their tasks when they are loaded, so this comes before any of them
+    this->scheduler = new Scheduler();
+
     // serial first at fixed baud rate (DEFAULT_SERIAL_BAUD_RATE) so config can report errors to serial
     // Set to UART0, this will be changed to use the same UART as MRI if it's enabled
     this->serial = new SerialConsole(0);
@@ -78,6 +83,12 @@ Kernel::Kernel()
     delete this->serial;
     this->serial = NULL;
 
+    // before anything else comes from AHB0 or AHB1 so small objects start out in slabs
+    if(this->config->value( ahb_slabs_enable_checksum )->by_default(false)->as_bool()) {
+        AHB0.set_slabs(true);
+        AHB1.set_slabs(true);
+    }
+
     this->streams = new StreamOutputPool();
 
     this->current_path   = "/";
@@ -354,7 +365,14 @@ void Kernel::call_event(_EVENT_ENUM id_event, void * argument)
         (m->*kernel_callback_functions[id_event])(argument);
     }
 
-    if(id_event == ON_HALT) {
+    // then the tasks that run on this event, see Scheduler.h
+    if(id_event == ON_IDLE) {
+        this->scheduler->run(Scheduler::IDLE);
+
+    } else if(id_event == ON_MAIN_LOOP) {
+        this->scheduler->run(Scheduler::MAIN_LOOP);
+
+    } else if(id_event == ON_HALT) {
         if(!this->halted || !was_idle) {
             // if we were running and this is a HALT
             // or if we are clearing the halt with $X or M999
@@ -22,6 +22,7 @@ class Config;
 class Module;
 class Conveyor;
 class SlowTicker;
+class Scheduler;
 class SerialConsole;
 class StreamOutputPool;
 class GcodeDispatch;
@@ -74,6 +75,7 @@ class Kernel {
         Configurator*     configurator;
         SimpleShell*      simpleshell;
 
+        Scheduler*        scheduler;
         SlowTicker*       slow_ticker;
         StepTicker*       step_ticker;
         Adc*              adc;
@@ -36,12 +36,46 @@ typedef struct __attribute__ ((packed))
     uint8_t data[];
 } _poolregion;
 
+#define at(o) ((void*) (((uint8_t*) this->base) + (o)))
+
+// the largest allocation each slab class takes, its slots are one header word more
+static const uint16_t slab_sizes[MemoryPool::n_slab_classes] = { 12, 28, 60, 124 };
+
+// a page of a class holds as many slots as fit in this
+#define slab_page_bytes 512
+
+// a page is the data of a used region
+typedef struct __attribute__ ((packed))
+{
+    uint16_t next;  // pages of the class with free slots, as offsets from base, 0 for none
+    uint16_t prev;
+    uint16_t free;  // offset of the first free slot, each free slot holds the offset of the next in its data
+    uint8_t  cls;
+    uint8_t  used;
+
+    uint8_t slots[];
+} _slabpage;
+
+typedef struct __attribute__ ((packed))
+{
+    // always set, where it overlaps the low bit of a used region's next which is always clear as regions are whole words
+    uint32_t slab :1;
+    uint32_t      :15;
+    uint32_t page :16;
+
+    uint8_t data[];
+} _slabslot;
+
 MemoryPool* MemoryPool::first = NULL;
 
 MemoryPool::MemoryPool(void* base, uint16_t size)
 {
     this->base = base;
     this->size = size;
+    this->slabs = false;
+    for (auto &k : classes)
+        k = {0, 0, 0, 0, 0};
+    fallbacks = 0;
 
     ((_poolregion*) base)->used = 0;
     ((_poolregion*) base)->next = size;
@@ -76,6 +110,180 @@ MemoryPool::~MemoryPool()
 }
 
 void* MemoryPool::alloc(size_t nbytes)
+{
+    if (slabs)
+    {
+        for (int c = 0; c < n_slab_classes; c++)
+        {
+            if (nbytes <= slab_sizes[c])
+            {
+                void* d = slab_alloc(c);
+                if (d)
+                    return d;
+                // no page could be made, there may still be a hole big enough for this alone
+                fallbacks++;
+                break;
+            }
+        }
+    }
+
+    void* d = first_fit(nbytes);
+    if (d == NULL)
+    {
+        // empty pages kept for the next allocation of their class may be in the way
+        release_empty_pages();
+        d = first_fit(nbytes);
+    }
+    return d;
+}
+
+void* MemoryPool::slab_alloc(int cls)
+{
+    slab_class& k = classes[cls];
+
+    if (k.partial == 0)
+    {
+        uint16_t slot = slab_sizes[cls] + sizeof(_slabslot);
+        int n = slab_page_bytes / slot;
+        _slabpage* p = (_slabpage*) last_fit(sizeof(_slabpage) + n * slot);
+        if (p == NULL)
+            return NULL;
+
+        MDEBUG("\tnew %d byte slab page at %p (%+d)\n", slab_sizes[cls], p, offset(p));
+        p->next = 0;
+        p->prev = 0;
+        p->cls = cls;
+        p->used = 0;
+        // the first slot is the first free
+        p->free = 0;
+        for (int i = n - 1; i >= 0; i--)
+        {
+            _slabslot* s = (_slabslot*) &p->slots[i * slot];
+            *(uint32_t*) s = 0;
+            s->slab = 1;
+            s->page = offset(p);
+            *(uint16_t*) s->data = p->free;
+            p->free = offset(s);
+        }
+        k.partial = offset(p);
+        k.pages++;
+    }
+
+    _slabpage* p = (_slabpage*) at(k.partial);
+    _slabslot* s = (_slabslot*) at(p->free);
+    p->free = *(uint16_t*) s->data;
+    p->used++;
+
+    if (p->free == 0)
+    {   // full, so it leaves the list
+        k.partial = p->next;
+        if (p->next)
+            ((_slabpage*) at(p->next))->prev = 0;
+        p->next = 0;
+    }
+
+    if (++k.used > k.peak)
+        k.peak = k.used;
+    k.allocs++;
+
+    return &s->data;
+}
+
+void MemoryPool::slab_free(void* d)
+{
+    _slabslot* s = (_slabslot*) (((uint8_t*) d) - sizeof(_slabslot));
+    _slabpage* p = (_slabpage*) at(s->page);
+    slab_class& k = classes[p->cls];
+
+    bool was_full = (p->free == 0);
+    *(uint16_t*) s->data = p->free;
+    p->free = offset(s);
+    p->used--;
+    k.used--;
+
+    if (was_full)
+    {   // has a free slot again, goes to the front of the list
+        p->prev = 0;
+        p->next = k.partial;
+        if (k.partial)
+            ((_slabpage*) at(k.partial))->prev = offset(p);
+        k.partial = offset(p);
+    }
+
+    // an empty page goes back to the pool unless it is the only one with free slots
+    if (p->used == 0 && (p->prev || p->next))
+    {
+        if (p->prev)
+            ((_slabpage*) at(p->prev))->next = p->next;
+        else
+            k.partial = p->next;
+        if (p->next)
+            ((_slabpage*) at(p->next))->prev = p->prev;
+        k.pages--;
+        MDEBUG("\treleasing %d byte slab page at %p (%+d)\n", slab_sizes[p->cls], p, offset(p));
+        dealloc(p);
+    }
+}
+
+void MemoryPool::release_empty_pages()
+{
+    for (auto& k : classes)
+    {
+        uint16_t o = k.partial;
+        while (o)
+        {
+            _slabpage* p = (_slabpage*) at(o);
+            o = p->next;
+            if (p->used)
+                continue;
+            if (p->prev)
+                ((_slabpage*) at(p->prev))->next = p->next;
+            else
+                k.partial = p->next;
+            if (p->next)
+                ((_slabpage*) at(p->next))->prev = p->prev;
+            k.pages--;
+            dealloc(p);
+        }
+    }
+}
+
+// takes the end of the last free region big enough, so slab pages gather at the top of the pool and leave the
+// bottom in larger pieces for first fit
+void* MemoryPool::last_fit(size_t nbytes)
+{
+    if (nbytes & 3)
+        nbytes += 4 - (nbytes & 3);
+    uint16_t nsize = nbytes + sizeof(_poolregion);
+
+    _poolregion* p = (_poolregion*) base;
+    _poolregion* found = NULL;
+    do {
+        // a piece too small for a header is not left behind
+        if ((p->used == 0) && ((p->next == nsize) || (p->next > nsize + sizeof(_poolregion))))
+            found = p;
+        if ((offset(p) + p->next >= size) || (p->next <= sizeof(_poolregion)))
+            break;
+        p = (_poolregion*) (((uint8_t*) p) + p->next);
+    } while (1);
+
+    if (found == NULL)
+        return NULL;
+
+    if (found->next == nsize)
+    {
+        found->used = 1;
+        return &found->data;
+    }
+
+    _poolregion* q = (_poolregion*) (((uint8_t*) found) + found->next - nsize);
+    q->used = 1;
+    q->next = nsize;
+    found->next -= nsize;
+    return &q->data;
+}
+
+void* MemoryPool::first_fit(size_t nbytes)
 {
     // nbytes = ceil(nbytes / 4) * 4
     if (nbytes & 3)
@@ -137,19 +345,20 @@ void* MemoryPool::alloc(size_t nbytes)
 
 void MemoryPool::dealloc(void* d)
 {
+    if (((_slabslot*) (((uint8_t*) d) - sizeof(_slabslot)))->slab)
+    {
+        slab_free(d);
+        return;
+    }
+
     _poolregion* p = (_poolregion*) (((uint8_t*) d) - sizeof(_poolregion));
     p->used = 0;
 
     MDEBUG("\tdeallocating %p (%+d, %db)\n", p, offset(p), p->next);
 
-    // combine next block if it's free
+    // combine next block if it's free, there is none after the last block but it may still combine with the previous
     _poolregion* q = (_poolregion*) (((uint8_t*) p) + p->next);
-    if(q >= (_poolregion*) (((uint8_t*) base) + size)) {
-        // we are beyond the end of the pool, ie last block
-        return;
-    }
-
-    if (q->used == 0)
+    if ((q < (_poolregion*) (((uint8_t*) base) + size)) && (q->used == 0))
     {
         MDEBUG("\t\tCombining with next free region at %p, new size is %d\n", q, p->next + q->next);
 
@@ -247,3 +456,40 @@ uint32_t MemoryPool::free()
         p = (_poolregion*) (((uint8_t*) p) + p->next);
     } while (1);
 }
+
+uint32_t MemoryPool::largest_free()
+{
+    uint32_t largest = 0;
+
+    _poolregion* p = (_poolregion*) base;
+
+    do {
+        if (p->used == 0 && p->next > largest)
+            largest = p->next;
+        if (offset(p) + p->next >= size)
+            return largest;
+        if (p->next <= sizeof(_poolregion))
+            return largest;
+        p = (_poolregion*) (((uint8_t*) p) + p->next);
+    } while (1);
+}
+
+// the free space, how much of it is split into holes smaller than the largest, and how full each slab class is
+void MemoryPool::stats(StreamOutput* str, const char *name)
+{
+    uint32_t f = free();
+    uint32_t l = largest_free();
+    str->printf("%s: free %lu, largest free %lu, fragmentation %lu%%\n", name, f, l, f ? 100 - (l * 100) / f : 0UL);
+
+    for (int c = 0; c < n_slab_classes; c++)
+    {
+        slab_class& k = classes[c];
+        if (!slabs && k.pages == 0)
+            continue;
+        uint32_t per_page = slab_page_bytes / (slab_sizes[c] + sizeof(_slabslot));
+        str->printf("\tslab %3u: %u of %lu used in %u pages, peak %u, %lu allocs\n",
+                    slab_sizes[c], k.used, k.pages * per_page, k.pages, k.peak, k.allocs);
+    }
+    if (slabs)
+        str->printf("\t%lu allocs fell back to first fit\n", fallbacks);
+}
@@ -17,6 +17,10 @@ class StreamOutput;
  * with MUCH thanks to http://www.parashift.com/c++-faq-lite/memory-pools.html
  *
  * test framework at https://gist.github.com/triffid/5563987
+ *
+ * with slabs on, allocations of up to 124 bytes come from pages of same sized slots carved out of the pool, each
+ * size class keeps the pages that have free slots in a list so allocating and freeing one is a list push or pop,
+ * anything larger, or that no page can be made for, is found first fit as before
  */
 
 class MemoryPool
@@ -33,14 +37,38 @@ public:
     bool  has(void*);
 
     uint32_t free(void);
+    uint32_t largest_free(void);
+
+    void  set_slabs(bool on) { slabs = on; }
+    void  stats(StreamOutput*, const char *name);
 
     MemoryPool* next;
 
     static MemoryPool* first;
 
+    static const int n_slab_classes = 4;
+
+    struct slab_class {
+        uint16_t partial;   // offset of the first page with a free slot, 0 for none
+        uint16_t pages;
+        uint16_t used;
+        uint16_t peak;
+        uint32_t allocs;
+    };
+    slab_class classes[n_slab_classes];
+    // allocations that fit a slab but came first fit as no page could be made
+    uint32_t fallbacks;
+
 private:
+    void* first_fit(size_t);
+    void* last_fit(size_t);
+    void* slab_alloc(int cls);
+    void  slab_free(void*);
+    void  release_empty_pages(void);
+
     void* base;
     uint16_t size;
+    bool slabs;
 };
 
 // this overloads "placement new"
@@ -7,6 +7,7 @@
 
 #include "libs/Module.h"
 #include "libs/Kernel.h"
+#include "libs/PublicData.h"
 
 Module::Module(){}
 Module::~Module(){}
@@ -32,3 +33,7 @@ void Module::register_for_event(_EVENT_ENUM event_id){
     // You add things to Smoothie by making a new class that inherits the Module class. See http://smoothieware.org/moduleexample for a crude introduction
     THEKERNEL->register_for_event(event_id, this);
 }
+
+void Module::register_for_public_data(_EVENT_ENUM event_id, uint16_t csa){
+    PublicData::register_handler(event_id, csa, this);
+}
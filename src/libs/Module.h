@@ -8,6 +8,8 @@
 #ifndef MODULE_H
 #define MODULE_H
 
+#include <stdint.h>
+
 // See : http://smoothieware.org/listofevents
 // When adding a new event the virtual method needs to be defined in class Module and the method pointer need to be defined in
 // Module.cpp:16 in the same order
@@ -38,6 +40,8 @@ public:
     virtual void on_module_loaded() {};
 
     void register_for_event(_EVENT_ENUM event_id);
+    // ON_GET_PUBLIC_DATA or ON_SET_PUBLIC_DATA for just the requests that start with csa, see PublicData.h
+    void register_for_public_data(_EVENT_ENUM event_id, uint16_t csa);
 
     // event callbacks, not every module will implement all of these
     // there should be one for each _EVENT_ENUM
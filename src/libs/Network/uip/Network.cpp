@@ -7,6 +7,7 @@
 #include "Kernel.h"
 #include "Config.h"
 #include "SlowTicker.h"
+#include "Scheduler.h"
 
 #include "Network.h"
 #include "PublicDataRequest.h"
@@ -192,9 +193,9 @@ void Network::on_module_loaded()
     THEKERNEL->slow_ticker->attach( 100, this, &Network::tick );
 
     // Register for events
-    this->register_for_event(ON_IDLE);
-    this->register_for_event(ON_MAIN_LOOP);
-    this->register_for_event(ON_GET_PUBLIC_DATA);
+    THEKERNEL->scheduler->add_task("network", this, &Module::on_idle, Scheduler::IDLE);
+    THEKERNEL->scheduler->add_task("network", this, &Module::on_main_loop, Scheduler::MAIN_LOOP);
+    this->register_for_public_data(ON_GET_PUBLIC_DATA, network_checksum);
 
     this->init();
 }
@@ -0,0 +1,69 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Profiler.h"
+
+#ifdef PROFILE_PROBES
+
+#include "StreamOutput.h"
+
+#include <string.h>
+
+Profiler::probe_t Profiler::probes[Profiler::N_PROBES];
+volatile uint32_t Profiler::isr_cycles= 0;
+uint32_t Profiler::wait_cycles= 0;
+
+static const char *probe_names[Profiler::N_PROBES]= {"step_tick", "append_block", "recalculate", "append_milestone", "check_queue"};
+
+void Profiler::start()
+{
+    // the debug monitor may have the trace unit on already, the counter is only started here
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT= 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    reset();
+}
+
+const char *Profiler::name(PROBE p)
+{
+    return probe_names[p];
+}
+
+void Profiler::reset()
+{
+    // the step tick probe is recorded from its interrupt
+    __disable_irq();
+    memset(probes, 0, sizeof(probes));
+    for (auto &s : probes) s.min= UINT32_MAX;
+    __enable_irq();
+}
+
+void Profiler::report(StreamOutput *stream, bool histograms)
+{
+    stream->printf("%-16s %10s %10s %10s %10s\n", "probe", "calls", "min", "mean", "max");
+    for (int i = 0; i < N_PROBES; ++i) {
+        // a copy so the interrupt does not change it while it is printed
+        __disable_irq();
+        probe_t s= probes[i];
+        __enable_irq();
+
+        if(s.calls == 0) {
+            stream->printf("%-16s %10lu\n", probe_names[i], 0UL);
+            continue;
+        }
+        stream->printf("%-16s %10lu %10lu %10lu %10lu\n", probe_names[i], (unsigned long)s.calls, (unsigned long)s.min,
+                       (unsigned long)(s.total / s.calls), (unsigned long)s.max);
+        if(!histograms) continue;
+        for (int b = 0; b < n_buckets; ++b) {
+            if(s.histogram[b] == 0) continue;
+            stream->printf("  < %10lu %10lu %5.1f%%\n", b < n_buckets - 1 ? 1UL << b : 0xFFFFFFFFUL, (unsigned long)s.histogram[b],
+                           s.histogram[b] * 100.0F / s.calls);
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,104 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stdint.h>
+
+class StreamOutput;
+
+// Counts the core clock cycles the hot paths take, from the DWT cycle counter, hostsim counts host cpu cycles instead.
+// Each probe keeps its calls, min, max and total, and a histogram of the cycles with a bucket per power of two, so a
+// call now and then that takes much longer than the rest shows up. The table is fixed, a probe is added by adding it to
+// PROBE and its name to Profiler.cpp. The time of a probe includes the probes called from inside it, but not the step
+// tick interrupts taken while it runs or the time waiting for room in the queue, see PROFILE_WAIT().
+//
+// Only compiled in with PROFILE_PROBES=1 in src/makefile, otherwise PROFILE_SCOPE() is empty. The prof command and
+// M460 print the table, see SimpleShell.
+#ifdef PROFILE_PROBES
+
+#include "LPC17xx.h"
+
+class Profiler {
+    public:
+        enum PROBE : uint8_t { STEP_TICK, APPEND_BLOCK, RECALCULATE, APPEND_MILESTONE, CHECK_QUEUE, N_PROBES };
+        static const int n_buckets= 32;
+
+        struct probe_t {
+            uint32_t calls;
+            uint32_t min;
+            uint32_t max;
+            uint64_t total;
+            uint32_t histogram[n_buckets];  // bucket b counts the calls of 2^(b-1) to 2^b - 1 cycles, the last one any more
+        };
+
+        // starts the cycle counter
+        static void start();
+        static uint32_t cycles() { return DWT->CYCCNT; }
+
+        // called from the step ticker ISR as well, each probe is only recorded from one context
+        static void record(PROBE p, uint32_t cycles)
+        {
+            probe_t &s= probes[p];
+            ++s.calls;
+            s.total += cycles;
+            if(cycles < s.min) s.min= cycles;
+            if(cycles > s.max) s.max= cycles;
+            uint8_t b= cycles == 0 ? 0 : 32 - __builtin_clz(cycles);
+            ++s.histogram[b < n_buckets ? b : n_buckets - 1];
+        }
+
+        static const probe_t& get(PROBE p) { return probes[p]; }
+        static const char *name(PROBE p);
+        static void reset();
+        static void report(StreamOutput *stream, bool histograms);
+
+        // records the cycles from when it is made until it goes out of scope, the step tick is the interrupt and its
+        // cycles are taken off the probes it interrupted
+        class Scope {
+            public:
+                Scope(PROBE p) : probe(p), start(cycles()), excluded(isr_cycles + wait_cycles) {}
+                ~Scope()
+                {
+                    uint32_t c= cycles() - start - (isr_cycles + wait_cycles - excluded);
+                    record(probe, c);
+                    if(probe == STEP_TICK) isr_cycles += c;
+                }
+
+            private:
+                PROBE probe;
+                uint32_t start;
+                uint32_t excluded;
+        };
+
+        // the cycles from when it is made until it goes out of scope are not counted by the probes it is inside
+        class Wait {
+            public:
+                Wait() : start(cycles()), isr(isr_cycles) {}
+                ~Wait() { wait_cycles += cycles() - start - (isr_cycles - isr); }
+
+            private:
+                uint32_t start;
+                uint32_t isr;
+        };
+
+    private:
+        static probe_t probes[N_PROBES];
+        // only added to by the interrupt and by the main loop respectively
+        static volatile uint32_t isr_cycles;
+        static uint32_t wait_cycles;
+};
+
+#define PROFILE_SCOPE(p) Profiler::Scope profile_scope(Profiler::p)
+#define PROFILE_WAIT() Profiler::Wait profile_wait
+
+#else
+
+#define PROFILE_SCOPE(p)
+#define PROFILE_WAIT()
+
+#endif
@@ -2,12 +2,44 @@
 #include "PublicData.h"
 #include "PublicDataRequest.h"
 
+#include <algorithm>
+#include <vector>
+
+struct handler_t {
+    uint16_t csa;
+    Module *module;
+};
+
+// for get and set, sorted by checksum and in the order the modules registered for each
+static std::vector<handler_t> handlers[2];
+
+static bool below(const handler_t &h, uint16_t csa) { return h.csa < csa; }
+static bool above(uint16_t csa, const handler_t &h) { return csa < h.csa; }
+
+void PublicData::register_handler(_EVENT_ENUM event, uint16_t csa, Module *module)
+{
+    std::vector<handler_t> &v= handlers[event == ON_SET_PUBLIC_DATA];
+    auto i= std::upper_bound(v.begin(), v.end(), csa, above);
+    v.insert(i, {csa, module});
+}
+
+static void dispatch(_EVENT_ENUM event, PublicDataRequest &pdr, uint16_t csa)
+{
+    const std::vector<handler_t> &v= handlers[event == ON_SET_PUBLIC_DATA];
+    for (auto i= std::lower_bound(v.begin(), v.end(), csa, below); i != v.end() && i->csa == csa; ++i) {
+        (i->module->*kernel_callback_functions[event])(&pdr);
+    }
+
+    // modules that still register for the event get what no handler took
+    if(!pdr.is_taken()) THEKERNEL->call_event(event, &pdr);
+}
+
 bool PublicData::get_value(uint16_t csa, uint16_t csb, uint16_t csc, void *data) {
     PublicDataRequest pdr(csa, csb, csc);
     // the caller may have created the storage for the returned data so we clear the flag,
     // if it gets set by the callee setting the data ptr that means the data is a pointer to a pointer and is set to a pointer to the returned data
     pdr.set_data_ptr(data, false);
-    THEKERNEL->call_event(ON_GET_PUBLIC_DATA, &pdr );
+    dispatch(ON_GET_PUBLIC_DATA, pdr, csa);
     if(pdr.is_taken() && pdr.has_returned_data()) {
         // the callee set the returned data pointer
         *(void**)data= pdr.get_data_ptr();
@@ -18,6 +50,6 @@ bool PublicData::get_value(uint16_t csa, uint16_t csb, uint16_t csc, void *data)
 bool PublicData::set_value(uint16_t csa, uint16_t csb, uint16_t csc, void *data) {
     PublicDataRequest pdr(csa, csb, csc);
     pdr.set_data_ptr(data);
-    THEKERNEL->call_event(ON_SET_PUBLIC_DATA, &pdr );
+    dispatch(ON_SET_PUBLIC_DATA, pdr, csa);
     return pdr.is_taken();
 }
@@ -8,6 +8,13 @@
 #ifndef PUBLICDATA_H
 #define PUBLICDATA_H
 
+#include "Module.h"
+
+#include <stdint.h>
+
+// A request goes to the modules that registered for its first checksum with Module::register_for_public_data, found by
+// looking the checksum up rather than by calling every module, in the order they registered. A request none of them
+// takes is then sent as ON_GET_PUBLIC_DATA or ON_SET_PUBLIC_DATA to the modules that registered for the event
 class PublicData {
     public:
         // there are two ways to get data from a module
@@ -23,6 +30,9 @@ class PublicData {
         static bool set_value(uint16_t csa, uint16_t csb, void *data) { return set_value(csa, csb, 0, data); }
         static bool set_value(uint16_t cs[3], void *data) { return set_value(cs[0], cs[1], cs[2], data); }
         static bool set_value(uint16_t csa, uint16_t csb, uint16_t csc, void *data);
+
+        // event is ON_GET_PUBLIC_DATA or ON_SET_PUBLIC_DATA
+        static void register_handler(_EVENT_ENUM event, uint16_t csa, Module *module);
 };
 
 #endif
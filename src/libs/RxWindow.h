@@ -0,0 +1,52 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "StreamOutput.h"
+
+#include <stdint.h>
+
+// Windowed streaming.
+// Instead of waiting for the ok of each line, the host counts the bytes it has sent that have not yet been taken out of
+// the receive buffer, and sends the next line whenever there is room for it (grbl style character counting). M880 S1
+// turns this on for the stream it is sent on and replies with the size of the receive buffer as window:<bytes>, from
+// then on the stream tells the host how many more bytes have left the buffer, or never went into it, with freed:<bytes>.
+// The oks are still sent, so errors can be matched up with the line that caused them.
+//
+// The receive interrupt counts every byte the host sends, whatever happens to it, so the bytes freed are simply the bytes
+// received less the bytes still in the buffer, this covers control characters and buffer flushes too.
+class RxWindow {
+    public:
+        RxWindow() : received(0), reported(0), enabled(false) {}
+
+        // called from the receive interrupt for each byte the host sent
+        void add() { ++received; }
+        // read this before reading how much is in the buffer, a byte that arrives in between is then not counted as freed
+        uint32_t get_received() const { return received; }
+
+        // everything received before it was turned on has already been accounted for by the host
+        void enable(bool on, uint32_t received, uint32_t buffered) { reported= received - buffered; enabled= on; }
+        bool is_enabled() const { return enabled; }
+
+        // reports the bytes freed once there are a quarter of the buffer of them, or as soon as there are any when there
+        // is no whole line left in the buffer, so the host is not left waiting on a report
+        void report(StreamOutput *stream, uint32_t received, uint32_t buffered, uint32_t size, bool drained)
+        {
+            if(!enabled) return;
+            int32_t freed= (received - buffered) - reported;
+            if(freed > 0 && (drained || (uint32_t)freed >= size / 4)) {
+                reported += freed;
+                stream->printf("freed:%ld\n", (long)freed);
+            }
+        }
+
+    private:
+        volatile uint32_t received;
+        uint32_t reported;
+        bool enabled;
+};
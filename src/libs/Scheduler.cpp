@@ -0,0 +1,96 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Scheduler.h"
+
+#include "mbed.h" // for us_ticker_read()
+
+Scheduler::Scheduler() : ready(0)
+{
+    running= 0;
+    posted= 0;
+    nested_us= 0;
+    // the Kernel is not set up yet, the time starts from 0
+    last_us= 0;
+    elapsed_us= 0;
+    idle_loops= 0;
+}
+
+uint32_t Scheduler::add_task(const char *name, Module *module, ModuleCallback callback, RUN when)
+{
+    task_t t;
+    t.name= name;
+    t.module= module;
+    t.callback= callback;
+    t.when= when;
+    t.flag= 0;
+    if(when == POSTED) {
+        t.flag= 1UL << (posted < 31 ? posted : 31);
+        ++posted;
+    }
+    t.runs= 0;
+    t.max_us= 0;
+    t.us= 0;
+    tasks.push_back(t);
+    return t.flag;
+}
+
+// start is when the task started, it is set to when it finished for the next one
+void Scheduler::call(task_t &t, uint32_t &start)
+{
+    uint32_t outer= nested_us;
+    nested_us= 0;
+    (t.module->*t.callback)(nullptr);
+
+    uint32_t now= us_ticker_read();
+    uint32_t us= now - start;
+    uint32_t own= us > nested_us ? us - nested_us : 0;
+    t.us += own;
+    if(own > t.max_us) t.max_us= own;
+    ++t.runs;
+
+    // the enclosing task does not count the time this one took
+    nested_us= outer + us;
+    start= now;
+}
+
+void Scheduler::run(RUN when)
+{
+    uint32_t start= us_ticker_read();
+
+    uint32_t go= 0;
+    if(when == IDLE) {
+        elapsed_us += start - last_us;
+        last_us= start;
+        ++idle_loops;
+
+        // take the flags of the posted tasks that are not already running, they may be posted again while they run
+        go= ready.load() & ~running;
+        if(go != 0) {
+            ready.fetch_and(~go);
+            running |= go;
+        }
+    }
+
+    // in the order they were added, as modules registered for events are called
+    for (auto &t : tasks) {
+        if(t.when == when || (t.flag & go) != 0) call(t, start);
+    }
+
+    running &= ~go;
+}
+
+void Scheduler::reset_stats()
+{
+    for (auto &t : tasks) {
+        t.runs= 0;
+        t.max_us= 0;
+        t.us= 0;
+    }
+    elapsed_us= 0;
+    idle_loops= 0;
+}
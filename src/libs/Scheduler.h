@@ -0,0 +1,72 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include "Module.h"
+
+#include <stdint.h>
+#include <atomic>
+#include <vector>
+
+// Runs the work modules do outside of interrupts, from ON_IDLE and ON_MAIN_LOOP.
+//
+// A POSTED task only runs after post_task() was called for it, from an interrupt or from anywhere else, so a module that
+// has something to do now and then is not called on every idle loop to find out it has nothing to do. It runs once on
+// the next ON_IDLE however many times it was posted, and is not run again while it is running if it calls ON_IDLE
+// itself. There are 32 ready flags, tasks after the 31st share the last flag so they can also run when another of
+// them was posted, tasks must check they have work to do as on_idle does.
+//
+// IDLE and MAIN_LOOP tasks are run every time ON_IDLE or ON_MAIN_LOOP is called, as modules registered for those events
+// are, for work that has to be polled.
+//
+// The time each task takes, less the time taken by tasks run from inside it, is added up for the top command.
+class Scheduler {
+    public:
+        enum RUN { POSTED, IDLE, MAIN_LOOP };
+
+        struct task_t {
+            const char *name;
+            Module *module;
+            ModuleCallback callback;
+            uint32_t flag;
+            RUN when;
+            uint32_t runs;
+            uint32_t max_us;
+            uint64_t us;
+        };
+
+        Scheduler();
+
+        // returns the task to post, or 0 for IDLE and MAIN_LOOP tasks
+        uint32_t add_task(const char *name, Module *module, ModuleCallback callback, RUN when= POSTED);
+        // may be called from an ISR, posting 0 does nothing
+        void post_task(uint32_t task) { if(task != 0) ready.fetch_or(task); }
+
+        // IDLE runs the IDLE tasks and the posted tasks, MAIN_LOOP runs the MAIN_LOOP tasks
+        void run(RUN when);
+
+        const std::vector<task_t>& get_tasks() const { return tasks; }
+        uint64_t get_elapsed_us() const { return elapsed_us; }
+        uint32_t get_idle_loops() const { return idle_loops; }
+        void reset_stats();
+
+    private:
+        void call(task_t &t, uint32_t &start);
+
+        std::vector<task_t> tasks;
+        std::atomic<uint32_t> ready;
+        uint32_t running;
+        uint32_t posted;
+        uint32_t nested_us;
+        uint32_t last_us;
+        uint64_t elapsed_us;
+        uint32_t idle_loops;
+};
+
+#endif
@@ -9,6 +9,7 @@
 #include "libs/Module.h"
 #include "libs/Kernel.h"
 #include "SlowTicker.h"
+#include "Scheduler.h"
 #include "StepTicker.h"
 #include "libs/Hook.h"
 #include "modules/robot/Conveyor.h"
@@ -16,11 +17,22 @@
 
 #include <mri.h>
 
+#include <algorithm>
+
 // This module uses a Timer to periodically call hooks
 // Modules register with a function ( callback ) and a frequency, and we then call that function at the given frequency.
 
 SlowTicker* global_slow_ticker;
 
+// most hooks that can be due at once, any more are called on the next pass
+#define max_due 16
+
+// for the heap, a is after b if it is due later, or at the same time with a lower priority
+static bool after(const Hook *a, const Hook *b)
+{
+    return a->next > b->next || (a->next == b->next && a->priority < b->priority);
+}
+
 SlowTicker::SlowTicker(){
     global_slow_ticker = this;
 
@@ -28,57 +40,115 @@ SlowTicker::SlowTicker(){
     ispbtn.from_string("2.10")->as_input()->pull_up();
 
     LPC_SC->PCONP |= (1 << 22);     // Power Ticker ON
-    LPC_TIM2->MCR = 3;              // Match on MR0, reset on MR0
+    LPC_TIM2->MCR = 1;              // Interrupt on MR0, the counter runs on
     // do not enable interrupt until setup is complete
     LPC_TIM2->TCR = 0;              // Disable interrupt
 
-    max_frequency = 5;  // initial max frequency is set to 5Hz
-    set_frequency(max_frequency);
+    interrupts= 0;
+    last_tc= LPC_TIM2->TC;
+    wraps= 0;
     flag_1s_flag = 0;
+    second_task = 0;
+
+    // sets the flag for the second tick
+    attach(1, this, &SlowTicker::one_second);
 }
 
 void SlowTicker::start()
 {
+    __disable_irq();
+    set_match();
+    __enable_irq();
     LPC_TIM2->TCR = 1;              // Enable interrupt
     NVIC_EnableIRQ(TIMER2_IRQn);    // Enable interrupt handler
 }
 
 void SlowTicker::on_module_loaded(){
-    register_for_event(ON_IDLE);
+    // the led is flashed on every idle loop, the second tick only when the interrupt posts it
+    if(THEKERNEL->is_using_leds()) THEKERNEL->scheduler->add_task("leds", this, &Module::on_idle, Scheduler::IDLE);
+    second_task= THEKERNEL->scheduler->add_task("second tick", this, static_cast<ModuleCallback>(&SlowTicker::second_tick));
+}
+
+// the timer count extended to 64 bits, it must be called at least once every wrap which the second hook makes sure of
+uint64_t SlowTicker::now()
+{
+    uint32_t tc= LPC_TIM2->TC;
+    if(tc < last_tc) ++wraps;
+    last_tc= tc;
+    return ((uint64_t)wraps << 32) | tc;
+}
+
+void SlowTicker::add_hook(Hook *hook)
+{
+    // to avoid race conditions we must stop the interupts before updating these non thread safe vectors
+    __disable_irq();
+    // the first multiple of its interval from now, so it is due with the hooks whose intervals it is a multiple of
+    hook->next= (now() / hook->interval + 1) * hook->interval;
+    hooks.push_back(hook);
+    queue.push_back(hook);
+    std::push_heap(queue.begin(), queue.end(), after);
+    if(queue.front() == hook && (LPC_TIM2->TCR & 1)) {
+        // it is due before the match that is set
+        if(set_match()) NVIC_SetPendingIRQ(TIMER2_IRQn);
+    }
+    __enable_irq();
 }
 
-// Set the base frequency we use for all sub-frequencies
-void SlowTicker::set_frequency( int frequency ){
-    this->interval = (SystemCoreClock >> 2) / frequency;   // SystemCoreClock/4 = Timer increments in a second
-    LPC_TIM2->MR0 = this->interval;
-    LPC_TIM2->TCR = 3;  // Reset
-    LPC_TIM2->TCR = 1;  // Reset
-    flag_1s_count= SystemCoreClock>>2;
+// sets the match for the first hook due, returns true if that time has already passed so it will not match
+bool SlowTicker::set_match()
+{
+    if(queue.empty()) return false;
+    uint64_t next= queue.front()->next;
+    LPC_TIM2->MR0 = (uint32_t)next;
+    // the counter may have got there before the match was set
+    return next <= now();
 }
 
 // The actual interrupt being called by the timer, this is where work is done
 void SlowTicker::tick(){
+    ++interrupts;
+
+    do {
+        // take every hook that is due, the earliest first
+        Hook *due[max_due];
+        int n= 0;
+        uint64_t t= now();
+        while(n < max_due && !queue.empty() && queue.front()->next <= t) {
+            std::pop_heap(queue.begin(), queue.end(), after);
+            due[n++]= queue.back();
+            queue.pop_back();
+        }
 
-    // Call all hooks that need to be called
-    for (Hook* hook : this->hooks){
-        hook->countdown -= this->interval;
-        if (hook->countdown < 0)
-        {
-            hook->countdown += hook->interval;
-            hook->call();
+        // a hook that is late is called after those due at the same time as it with a higher priority, not before
+        for (int i = 1; i < n; ++i) {
+            Hook *h= due[i];
+            int j= i;
+            for (; j > 0 && due[j - 1]->priority < h->priority; --j) due[j]= due[j - 1];
+            due[j]= h;
         }
-    }
 
-    // deduct tick time from second counter
-    flag_1s_count -= this->interval;
-    // if a whole second has elapsed,
-    if (flag_1s_count < 0)
-    {
-        // add a second to our counter
-        flag_1s_count += SystemCoreClock >> 2;
-        // and set a flag for idle event to pick up
-        flag_1s_flag++;
-    }
+        for (int i = 0; i < n; ++i) {
+            Hook *h= due[i];
+            uint64_t start= now();
+            uint32_t late= start - h->next;
+            ++h->calls;
+            h->total_late += late;
+            if(late > h->max_late) h->max_late= late;
+
+            h->call();
+
+            uint64_t end= now();
+            h->busy += end - start;
+            h->next += h->interval;
+            if(h->next <= end) {
+                // it fell a whole interval behind, the calls it missed are dropped rather than made one after the other
+                h->missed += (end - h->next) / h->interval + 1;
+                h->next += ((end - h->next) / h->interval + 1) * h->interval;
+            }
+            queue.push_back(h);
+            std::push_heap(queue.begin(), queue.end(), after);
+        }
+    } while(set_match());
 
     // Enter MRI mode if the ISP button is pressed
     // TODO: This should have it's own module
@@ -87,6 +157,28 @@ void SlowTicker::tick(){
 
 }
 
+uint32_t SlowTicker::one_second(uint32_t)
+{
+    // and set a flag for idle event to pick up
+    flag_1s_flag++;
+    THEKERNEL->scheduler->post_task(second_task);
+    return 0;
+}
+
+void SlowTicker::reset_stats()
+{
+    __disable_irq();
+    for (auto h : hooks) {
+        h->calls= 0;
+        h->max_late= 0;
+        h->total_late= 0;
+        h->missed= 0;
+        h->busy= 0;
+    }
+    interrupts= 0;
+    __enable_irq();
+}
+
 bool SlowTicker::flag_1s(){
     // atomic flag check routine
     // first disable interrupts
@@ -115,9 +207,12 @@ void SlowTicker::on_idle(void*)
         // flash led 3 to show we are alive
         leds[2]= (ledcnt++ & 0x1000) ? 1 : 0;
     }
+}
 
+void SlowTicker::second_tick(void*)
+{
     // if interrupt has set the 1 second flag
-    if (flag_1s())
+    while (flag_1s())
         // fire the on_second_tick event
         THEKERNEL->call_event(ON_SECOND_TICK);
 }
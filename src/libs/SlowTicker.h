@@ -16,50 +16,61 @@
 
 #include "system_LPC17xx.h" // for SystemCoreClock
 #include <math.h>
+#include <vector>
 
+// Calls hooks at the frequency each asked for from the TIMER2 interrupt. The hooks are kept in order of when they are
+// next due and the match register is set for the first one, so the interrupt only happens when a hook is due and
+// only the hooks that are due are looked at. A hook's calls are on multiples of its interval counted from when the
+// timer started, so hooks at frequencies that divide each other, like 2000, 1000 and 100Hz, are due together and
+// share an interrupt, and hooks due together are called highest priority first.
 class SlowTicker : public Module{
     public:
         SlowTicker();
 
+        // of hooks that are due at the same time, the limit switches are read first, then outputs that need to be on time
+        enum PRIORITY { NORMAL_PRIORITY, OUTPUT_PRIORITY, SAFETY_PRIORITY };
+
         void on_module_loaded(void);
         void on_idle(void*);
+        void second_tick(void*);
         void start();
-        void set_frequency( int frequency );
         void tick();
         // For some reason this can't go in the .cpp, see :  http://mbed.org/forum/mbed/topic/2774/?page=1#comment-14221
         // TODO replace this with std::function()
-        template<typename T> Hook* attach( uint32_t frequency, T *optr, uint32_t ( T::*fptr )( uint32_t ) ){
+        template<typename T> Hook* attach( uint32_t frequency, T *optr, uint32_t ( T::*fptr )( uint32_t ), uint8_t priority= NORMAL_PRIORITY ){
             Hook* hook = new Hook();
             hook->interval = floorf((SystemCoreClock/4)/frequency);
+            hook->priority = priority;
             hook->attach(optr, fptr);
-            hook->countdown = hook->interval;
-
-            // to avoid race conditions we must stop the interupts before updating this non thread safe vector
-            __disable_irq();
-            if( frequency > this->max_frequency ){
-                this->max_frequency = frequency;
-                this->set_frequency(frequency);
-            }
-            this->hooks.push_back(hook);
-            __enable_irq();
+            add_hook(hook);
             return hook;
         }
 
+        // in the order they were attached, for the statistics
+        const std::vector<Hook*>& get_hooks() const { return hooks; }
+        uint32_t get_interrupts() const { return interrupts; }
+        uint32_t get_counts_per_us() const { return (SystemCoreClock >> 2) / 1000000; }
+        void reset_stats();
+
     private:
+        void add_hook(Hook *hook);
+        uint64_t now();
+        bool set_match();
+        uint32_t one_second(uint32_t);
         bool flag_1s();
 
         std::vector<Hook*> hooks;
-        uint32_t max_frequency;
-        uint32_t interval;
+        // a heap with the hook that is due first at the front
+        std::vector<Hook*> queue;
+        uint32_t second_task;
+        uint32_t interrupts;
+        // the timer counter is 32 bits, it wraps every 171 seconds
+        uint32_t last_tc;
+        uint32_t wraps;
 
         Pin ispbtn;
 protected:
-    int flag_1s_count;
     volatile int flag_1s_flag;
 };
 
-
-
-
-
 #endif
@@ -7,6 +7,7 @@
 
 
 #include "StepTicker.h"
+#include "Profiler.h"
 
 #include "libs/nuts_bolts.h"
 #include "libs/Module.h"
@@ -31,6 +32,55 @@ GPIO stepticker_debug_pin(STEPTICKER_DEBUG_PIN);
 
 StepTicker *StepTicker::instance;
 
+// a whole step of a followed position, see follow_tick(). The amplitudes of the input shaper impulses add up to it
+#define FOLLOW_ONE (1L<<16)
+
+// the step rate in 1/2^32 steps per tick, for working out the pressure advance, and how far the counter is into the
+// next step in followed position units
+#ifdef STEPTICKER_FP32
+#define ADVANCE_RATE(x) ((int64_t)(x) << 2)
+#define FOLLOW_FRACTION(x) ((x) >> 14)
+#else
+#define ADVANCE_RATE(x) ((x) >> 30)
+#define FOLLOW_FRACTION(x) ((int32_t)((x) >> 46))
+#endif
+
+// an impulse of the input shaper, it moves the shaped motors of the block it started. Only the shaped motor with the
+// most steps in the block is timed, the other shaped motors step along with it (bresenham). The first impulse runs the
+// ramp of the lead, the others step it on the ticks the first impulse did their delay earlier, so there is one ramp
+// whatever the number of impulses and motors
+struct StepTicker::shaper_copy_t {
+    Block *block;                   // nullptr when the impulse is waiting for its next block
+    unsigned int next_i;            // queue index of the next block this impulse starts, except for the first impulse
+    uint32_t tick;                  // the phase of the block, only the first impulse runs the ramp
+    uint32_t next_phase_tick;
+    uint8_t phase;
+    uint8_t lead;                   // the motor that runs the ramp
+    uint8_t motors;                 // bit set for each shaped motor with steps in the block, except the lead
+    Block::tickinfo_t tick_info;
+    Block::jerkinfo_t jerk_info;
+    std::array<uint32_t, k_max_actuators> steps;
+    std::array<uint32_t, k_max_actuators> error;
+    std::array<int32_t, k_max_actuators> move; // the amplitude of the impulse, signed for the direction of each motor
+    uint32_t lead_steps;            // steps of the lead so far
+};
+
+// the pressure advance of a motor stepping at the rate in ti, k is the advance in ticks * 256. The part of a step the
+// counter is into the next step is added, so the followed position moves on smoothly rather than a whole step at a
+// time, otherwise the motor would step back and forth while the advance falls slower than it steps
+static inline int32_t advance_for(const Block::tickinfo_t &ti, int32_t k, int32_t amplitude)
+{
+    int64_t a= ((ADVANCE_RATE(ti.steps_per_tick) * k) >> 24) + FOLLOW_FRACTION(ti.counter);
+    return (a * amplitude) >> 16;
+}
+
+// the motors of a block that get pressure advance, they have to be extruding on a print move
+static inline uint8_t advanced_motors(const Block *b, uint8_t advance_motors)
+{
+    if(!b->is_g123 || !b->primary_axis) return 0;
+    return advance_motors & b->active_motors & ~b->direction_bits.to_ulong();
+}
+
 StepTicker::StepTicker()
 {
     instance = this; // setup the Singleton instance of the stepticker
@@ -54,6 +104,31 @@ StepTicker::StepTicker()
 
     this->running = false;
     this->current_block = nullptr;
+    this->active_motors = 0;
+
+    this->follow_motors = 0;
+    this->follow_in_place = 0;
+    this->follow_due = 0;
+    this->follow_error.fill(0);
+
+    this->shaper_copies = nullptr;
+    this->shaper_history = nullptr;
+    this->shaper_history_mask = 0;
+    this->shaper_impulses = 0;
+    this->shaper_motors = 0;
+    this->shaper_idle = 0;
+    this->shaper_pending = 0;
+    this->shaper_now = 0;
+    this->shaper_lead_i = 0;
+
+    this->advance_motors = 0;
+    this->advance_in_place = 0;
+    this->advance_k.fill(0);
+    this->advance.fill(0);
+
+    this->starved = false;
+    this->starved_ticks = 0;
+    this->stats = {0, 0};
 
     #ifdef STEPTICKER_DEBUG_PIN
     // setup debug pin if defined
@@ -66,6 +141,13 @@ StepTicker::~StepTicker()
 {
 }
 
+void StepTicker::reset_stats()
+{
+    __disable_irq();
+    stats = {0, 0};
+    __enable_irq();
+}
+
 //called when everything is setup and interrupts can start
 void StepTicker::start()
 {
@@ -93,6 +175,59 @@ void StepTicker::set_unstep_time( float microseconds )
     // TODO check that the unstep time is less than the step period, if not slow down step ticker
 }
 
+// only called from the main loop while the queue is idle
+bool StepTicker::set_input_shaper(uint8_t n, const float amplitude[], const float delay[], uint8_t motors)
+{
+    // turn it off first so the ISR does not use it while it changes
+    shaper_impulses= 0;
+    if(n < 2) return true;
+    if(n > max_shaper_impulses) return false;
+
+    if(shaper_copies == nullptr) {
+        shaper_copies= new shaper_copy_t[max_shaper_impulses];
+        if(shaper_copies == nullptr) return false;
+    }
+
+    int32_t sum= 0;
+    for (uint8_t i = 0; i < n; ++i) {
+        shaper_amplitude[i]= lroundf(amplitude[i] * FOLLOW_ONE);
+        shaper_delay[i]= lroundf(delay[i] * frequency);
+        // the impulses have to start their blocks in order
+        if(i > 0 && shaper_delay[i] <= shaper_delay[i - 1]) return false;
+        sum += shaper_amplitude[i];
+    }
+    // the last impulse takes the rounding so a whole step of the block is a whole step of the shaped motion
+    shaper_amplitude[n - 1] += FOLLOW_ONE - sum;
+
+    // the last impulse looks back the furthest, the history is in words of 32 ticks
+    uint32_t words= 1;
+    while(words * 32 <= shaper_delay[n - 1]) words <<= 1;
+    if(shaper_history == nullptr || words > shaper_history_mask + 1) {
+        delete [] shaper_history;
+        shaper_history= new uint32_t[words];
+        if(shaper_history == nullptr) return false;
+        shaper_history_mask= words - 1;
+    }
+
+    for (uint8_t j = 0; j < n; ++j) shaper_copies[j].block= nullptr;
+    shaper_pending= 0;
+    shaper_motors= motors;
+    shaper_idle= (1 << n) - 1;
+    shaper_impulses= n;
+    return true;
+}
+
+// k is in seconds, the motor is moved ahead of where it should be by k times its step rate while it extrudes, 0 turns
+// it off. Only called from the main loop while the queue is idle
+bool StepTicker::set_pressure_advance(uint8_t m, float k)
+{
+    if(m >= k_max_actuators || k < 0 || k > 1.0F) return false;
+    advance_k[m]= lroundf(k * frequency * 256);
+    if(advance_k[m] != 0) advance_motors |= (1 << m);
+    else advance_motors &= ~(1 << m);
+    return true;
+}
+
 // Reset step pins on any motor that was stepped
 void StepTicker::unstep_tick()
 {
@@ -130,18 +265,135 @@ void StepTicker::handle_finish (void)
     if(finished_fnc) finished_fnc();
 }
 
+static inline stepticker_fp_t select_jerk(const Block::jerkinfo_t &ji, uint8_t jerk)
+{
+    switch(jerk) {
+        case Block::JERK_ACCELERATE: return ji.accelerate;
+        case Block::JERK_ACCELERATE_END: return -ji.accelerate;
+        case Block::JERK_DECELERATE: return -ji.decelerate;
+        case Block::JERK_DECELERATE_END: return ji.decelerate;
+        default: return 0;
+    }
+}
+
+// adds the acceleration for this tick to the rate and the rate to the counter, returns true if it is time for a step
+// ji is only set for s-curve blocks, where the jerk is added to the acceleration first
+static inline bool tick_rate(Block::tickinfo_t &ti, Block::jerkinfo_t *ji, const Block::phase_t *phase_change)
+{
+    if(ji != nullptr) ti.acceleration_change += ji->jerk;
+    ti.steps_per_tick += ti.acceleration_change;
+
+    if(phase_change != nullptr) {
+        ti.acceleration_change = phase_change->decelerate ? ti.deceleration_change : 0;
+        if(ji != nullptr) {
+            if(phase_change->accelerate) ti.acceleration_change = ji->peak_acceleration;
+            ji->jerk = select_jerk(*ji, phase_change->jerk);
+        }
+        if(phase_change->plateau) {
+            // steps/sec / tick frequency to get steps per tick
+            ti.steps_per_tick = ti.plateau_rate;
+        }
+    }
+
+    // protect against rounding errors and such
+    if(ti.steps_per_tick <= 0) {
+        ti.counter = STEPTICKER_FPSCALE; // we force completion this step by setting to 1.0
+        ti.steps_per_tick = 0;
+    }
+
+    ti.counter += ti.steps_per_tick;
+
+    if(ti.counter >= STEPTICKER_FPSCALE) { // >= 1.0 step time
+        ti.counter -= STEPTICKER_FPSCALE; // -= 1.0F;
+        ++ti.step_count;
+        return true;
+    }
+
+    return false;
+}
+
+// moves the followed position of motor m, follow_tick() only looks at it once it is more than half a step away
+inline void StepTicker::follow_move(uint8_t m, int32_t delta)
+{
+    int32_t e= follow_error[m] += delta;
+    if((uint32_t)(e + FOLLOW_ONE / 2) > FOLLOW_ONE) follow_due |= (1 << m);
+}
+
+// a step of the lead motor on the copy of an impulse, the other shaped motors step along with it when they are due.
+// Returns false once the impulse is done with the block
+inline bool StepTicker::shaper_copy_step(shaper_copy_t &c)
+{
+    follow_move(c.lead, c.move[c.lead]);
+    uint32_t most= c.steps[c.lead];
+    for (uint32_t pending = c.motors; pending != 0; pending &= pending - 1) {
+        uint8_t m = __builtin_ctz(pending);
+        c.error[m] += c.steps[m];
+        if(c.error[m] >= most) {
+            c.error[m] -= most;
+            follow_move(m, c.move[m]);
+        }
+    }
+
+    if(++c.lead_steps < most) return true;
+    c.block= nullptr;
+    return false;
+}
+
 // step clock
 void StepTicker::step_tick (void)
 {
+    PROFILE_SCOPE(STEP_TICK);
     //SET_STEPTICKER_DEBUG_PIN(running ? 1 : 0);
 
+    if(shaper_impulses > 1) {
+        // the impulses of the input shaper move the shaped motors of the shaped blocks, which only has to look at the
+        // queue while one of them waits for its next block
+        ++shaper_now;
+        if(shaper_idle != 0 || THEKERNEL->is_halted() || THECONVEYOR->is_flushing()) shaper_tick();
+
+        bool lead_step= false;
+        if((shaper_idle & 1) == 0) {
+            shaper_copy_t &c= shaper_copies[0];
+            const Block::phase_t *phase_change= nullptr;
+            if(c.tick == c.next_phase_tick) {
+                phase_change= &c.block->phases[c.phase++];
+                c.next_phase_tick= c.phase < Block::n_phases ? c.block->phases[c.phase].tick : UINT32_MAX;
+            }
+            ++c.tick;
+            lead_step= tick_rate(c.tick_info, c.block->s_curve ? &c.jerk_info : nullptr, phase_change);
+            if(lead_step && !shaper_copy_step(c)) shaper_idle |= 1;
+        }
+
+        // the other impulses started their block their delay after the first impulse did, so they step the lead on
+        // the ticks it stepped then
+        uint32_t bit= 1 << (shaper_now & 31);
+        uint32_t &word= shaper_history[(shaper_now >> 5) & shaper_history_mask];
+        word= lead_step ? word | bit : word & ~bit;
+        for (uint32_t pending = shaper_all() & ~shaper_idle & ~1; pending != 0; pending &= pending - 1) {
+            uint8_t j = __builtin_ctz(pending);
+            uint32_t then= shaper_now - shaper_delay[j];
+            if((shaper_history[(then >> 5) & shaper_history_mask] & (1 << (then & 31))) == 0) continue;
+            if(!shaper_copy_step(shaper_copies[j])) shaper_idle |= (1 << j);
+        }
+    }
+    // while the input shaper has blocks in hand there is nothing to do until a followed position moves
+    if(follow_motors != 0 && (follow_due != 0 || shaper_pending == 0)) follow_tick();
+
     // if nothing has been setup we ignore the ticks
     if(!running){
         // check if anything new available
-        if(THECONVEYOR->get_next_block(&current_block)) { // returns false if no new block is available
+        if(fetch_next_block()) { // returns false if no new block is available
+            // running out of blocks is an underrun unless the conveyor expected the queue to run dry
+            if(!THECONVEYOR->take_idle_expected() && starved) {
+                ++stats.underruns;
+                stats.underrun_ticks += starved_ticks;
+            }
+            starved= false;
+            starved_ticks= 0;
             running= start_next_block(); // returns true if there is at least one motor with steps to issue
             if(!running) return;
         }else{
+            if(starved) ++starved_ticks;
             return;
         }
     }
@@ -153,56 +405,72 @@ void StepTicker::step_tick (void)
         return;
     }
 
+    // see if this tick starts a new phase of the block, this applies to all the active motors
+    const Block::phase_t *phase_change= nullptr;
+    if(current_tick == next_phase_tick) {
+        phase_change= &current_block->phases[current_phase++];
+        next_phase_tick= current_phase < Block::n_phases ? current_block->phases[current_phase].tick : UINT32_MAX;
+    }
+
+    Block::jerkinfo_t *jerk_info= current_block->s_curve ? current_block->jerk_info : nullptr;
     bool still_moving= false;
-    // foreach motor, if it is active see if time to issue a step to that motor
-    for (uint8_t m = 0; m < num_motors; m++) {
-        if(current_block->tick_info[m].steps_to_move == 0) continue; // not active
-
-        current_block->tick_info[m].steps_per_tick += current_block->tick_info[m].acceleration_change;
-
-        if(current_tick == current_block->tick_info[m].next_accel_event) {
-            if(current_tick == current_block->accelerate_until) { // We are done accelerating, deceleration becomes 0 : plateau
-                current_block->tick_info[m].acceleration_change = 0;
-                if(current_block->decelerate_after < current_block->total_move_ticks) {
-                    current_block->tick_info[m].next_accel_event = current_block->decelerate_after;
-                    if(current_tick != current_block->decelerate_after) { // We are plateauing
-                        // steps/sec / tick frequency to get steps per tick
-                        current_block->tick_info[m].steps_per_tick = current_block->tick_info[m].plateau_rate;
-                    }
+    if(current_block->follows_path) {
+        // the path axis has the speed profile, the motors follow it along the chords
+        still_moving= !tick_rate(current_block->tick_info[0], jerk_info, phase_change) || path_step();
+
+    } else {
+        // foreach motor that still has steps to issue in this block see if it is time to issue a step to that motor
+        for (uint32_t pending = active_motors & ~follow_in_place; pending != 0; pending &= pending - 1) {
+            uint8_t m = __builtin_ctz(pending);
+            Block::tickinfo_t &ti = current_block->tick_info[m];
+
+            if(tick_rate(ti, jerk_info != nullptr ? &jerk_info[m] : nullptr, phase_change)) {
+                // step the motor
+                bool ismoving= motor[m]->step(); // returns false if the moving flag was set to false externally (probes, endstops etc)
+                // we stepped so schedule an unstep
+                unstep.set(m);
+
+                if(!ismoving || ti.step_count == ti.steps_to_move) {
+                    // done
+                    ti.steps_to_move = 0;
+                    active_motors &= ~(1 << m);
+                    motor[m]->stop_moving(); // let motor know it is no longer moving
                 }
             }
 
-            if(current_tick == current_block->decelerate_after) { // We start decelerating
-                current_block->tick_info[m].acceleration_change = current_block->tick_info[m].deceleration_change;
-            }
-        }
-
-        // protect against rounding errors and such
-        if(current_block->tick_info[m].steps_per_tick <= 0) {
-            current_block->tick_info[m].counter = STEPTICKER_FPSCALE; // we force completion this step by setting to 1.0
-            current_block->tick_info[m].steps_per_tick = 0;
+            // see if any motors are still moving after this tick
+            if(motor[m]->is_moving()) still_moving= true;
         }
 
-        current_block->tick_info[m].counter += current_block->tick_info[m].steps_per_tick;
-
-        if(current_block->tick_info[m].counter >= STEPTICKER_FPSCALE) { // >= 1.0 step time
-            current_block->tick_info[m].counter -= STEPTICKER_FPSCALE; // -= 1.0F;
-            ++current_block->tick_info[m].step_count;
-
-            // step the motor
-            bool ismoving= motor[m]->step(); // returns false if the moving flag was set to false externally (probes, endstops etc)
-            // we stepped so schedule an unstep
-            unstep.set(m);
+        // pressure advance moves the followed position of its motors instead, follow_tick() steps them
+        for (uint32_t pending = follow_in_place; pending != 0; pending &= pending - 1) {
+            uint8_t m = __builtin_ctz(pending);
+            Block::tickinfo_t &ti = current_block->tick_info[m];
+            int32_t amplitude= FOLLOW_ONE;
 
-            if(!ismoving || current_block->tick_info[m].step_count == current_block->tick_info[m].steps_to_move) {
+            bool step= tick_rate(ti, jerk_info != nullptr ? &jerk_info[m] : nullptr, phase_change);
+            if(step) {
+                follow_move(m, current_block->direction_bits[m] ? -amplitude : amplitude);
+            }
+            if(advance_in_place & (1 << m)) {
+                // the advance falls as the extrusion slows down, but no faster than the extruder moves on so it never
+                // steps back while extruding. It is kept at the end of the block, the next block carries on from it if
+                // it extrudes too
+                int32_t target= advance_for(ti, advance_k[m], amplitude);
+                int32_t least= step ? advance[m] - amplitude : advance[m];
+                advance_to(advance[m], m, target > least ? target : least);
+            }
+            if(step && ti.step_count == ti.steps_to_move) {
                 // done
-                current_block->tick_info[m].steps_to_move = 0;
-                motor[m]->stop_moving(); // let motor know it is no longer moving
+                ti.steps_to_move = 0;
+                active_motors &= ~(1 << m);
+                follow_in_place &= ~(1 << m);
             }
         }
+        if(follow_in_place != 0) still_moving= true;
 
-        // see if any motors are still moving after this tick
-        if(motor[m]->is_moving()) still_moving= true;
+        // the block lasts until the last impulse of the input shaper is done with its shaped motors
+        if(shaper_impulses > 1 && shaper_copies[shaper_impulses - 1].block == current_block) still_moving= true;
     }
 
     // do this after so we start at tick 0
@@ -227,14 +495,19 @@ void StepTicker::step_tick (void)
 
         // get next block
         // do it here so there is no delay in ticks
+        if(current_block->is_shaped && shaper_pending > 0) --shaper_pending;
         THECONVEYOR->block_finished();
 
-        if(THECONVEYOR->get_next_block(&current_block)) { // returns false if no new block is available
+        if(fetch_next_block()) { // returns false if no new block is available
             running= start_next_block(); // returns true if there is at least one motor with steps to issue
 
         }else{
             current_block= nullptr;
             running= false;
+            // the input shaper holds the next block back until its impulses are due, that is not running out
+            starved= shaper_impulses < 2;
+            // the extruders stop here, so they let go of their pressure
+            if(shaper_pending == 0) advance_release(advance_motors);
         }
 
         // all moves finished
@@ -244,17 +517,308 @@ void StepTicker::step_tick (void)
     }
 }
 
+// the next block to execute in place, with the input shaper a shaped block has to wait for the last impulse and an
+// unshaped one for the shaped motion before it to finish
+bool StepTicker::fetch_next_block()
+{
+    if(shaper_impulses > 1 && !THECONVEYOR->is_flushing() && !THEKERNEL->is_halted()) {
+        const Block *b= THECONVEYOR->peek_next_block();
+        if(b != nullptr && b->is_shaped) {
+            if(shaper_lead_i == THECONVEYOR->get_isr_tail() || shaper_now - b->shaper_start < shaper_delay[shaper_impulses - 1]) return false;
+        } else if(b != nullptr && (shaper_pending > 0 || !follow_settled())) {
+            return false;
+        }
+    }
+
+    return THECONVEYOR->get_next_block(&current_block);
+}
+
+// starts the next shaped block on the impulses of the input shaper that are waiting for one, called from step_tick()
+// while any of them is. The first impulse starts each shaped block as soon as the conveyor lets it, the others start it
+// when their delay has passed since then, the last one as the block starts executing in place. Each impulse moves the
+// followed position of the motors by its amplitude for every step of the block, and follow_tick() steps the motors to it
+void StepTicker::shaper_tick()
+{
+    if(THEKERNEL->is_halted() || THECONVEYOR->is_flushing()) {
+        shaper_reset();
+        return;
+    }
+
+    if(shaper_pending == 0) {
+        // nothing is ahead of the block executed in place, so the impulses start from the next block it will execute
+        shaper_lead_i= THECONVEYOR->get_isr_tail();
+        for (uint8_t j = 1; j < shaper_impulses; ++j) shaper_copies[j].next_i= shaper_lead_i;
+    }
+
+    for (uint32_t pending = shaper_idle; pending != 0; pending &= pending - 1) {
+        uint8_t j = __builtin_ctz(pending);
+        shaper_copy_t &c= shaper_copies[j];
+        Block *b;
+        if(j == 0) {
+            if(!THECONVEYOR->get_block_ahead(shaper_lead_i, &b)) continue;
+            b->shaper_start= shaper_now;
+            shaper_lead_i= THECONVEYOR->next_index(shaper_lead_i);
+            ++shaper_pending;
+
+        } else {
+            // only blocks the first impulse has started, once their delay has passed
+            if(c.next_i == shaper_lead_i) continue;
+            b= THECONVEYOR->block_at(c.next_i);
+            if(shaper_now - b->shaper_start < shaper_delay[j]) continue;
+            c.next_i= THECONVEYOR->next_index(c.next_i);
+        }
+        // a block with nothing shaped leaves the impulse waiting for the next one
+        shaper_start_copy(c, b, shaper_amplitude[j]);
+        if(c.block != nullptr) shaper_idle &= ~(1 << j);
+    }
+}
+
+void StepTicker::shaper_start_copy(shaper_copy_t &c, Block *b, int32_t amplitude)
+{
+    uint8_t motors= b->active_motors & shaper_motors;
+    if(motors == 0) {
+        // nothing in the block is shaped, the impulse moves on to the next one
+        c.block= nullptr;
+        return;
+    }
+
+    uint32_t most= 0;
+    for (uint32_t pending = motors; pending != 0; pending &= pending - 1) {
+        uint8_t m = __builtin_ctz(pending);
+        c.steps[m]= b->tick_info[m].steps_to_move;
+        if(c.steps[m] > most) {
+            most= c.steps[m];
+            c.lead= m;
+        }
+    }
+    for (uint32_t pending = motors; pending != 0; pending &= pending - 1) {
+        uint8_t m = __builtin_ctz(pending);
+        // starting half way puts the steps in the middle of the lead steps they are spread over
+        c.error[m]= most / 2;
+        c.move[m]= b->direction_bits[m] ? -amplitude : amplitude;
+    }
+
+    c.block= b;
+    c.lead_steps= 0;
+    c.tick= 0;
+    c.phase= 0;
+    c.next_phase_tick= b->phases[0].tick;
+    c.motors= motors & ~(1 << c.lead);
+    c.tick_info= b->tick_info[c.lead];
+    if(b->s_curve) {
+        c.jerk_info= b->jerk_info[c.lead];
+        c.jerk_info.jerk= select_jerk(c.jerk_info, b->start_jerk);
+    }
+    follow_start(motors);
+}
+
+// drops everything the shaper was doing, on a halt or when the queue is flushed
+void StepTicker::shaper_reset()
+{
+    for (uint8_t j = 0; j < shaper_impulses; ++j) shaper_copies[j].block= nullptr;
+    shaper_pending= 0;
+    shaper_idle= shaper_all();
+    follow_reset();
+
+    // a shaped block executing in place ends now too
+    if(running && current_block != nullptr && current_block->is_shaped) active_motors= 0;
+}
+
+// moves the pressure advance of motor m, applied is what has been added to its followed position so far
+inline void StepTicker::advance_to(int32_t &applied, uint8_t m, int32_t target)
+{
+    follow_move(m, target - applied);
+    applied= target;
+}
+
+// lets go of the pressure advance of the motors, when a block does not extrude with them or when they stop
+void StepTicker::advance_release(uint8_t motors)
+{
+    uint8_t released= 0;
+    for (uint32_t pending = motors; pending != 0; pending &= pending - 1) {
+        uint8_t m = __builtin_ctz(pending);
+        if(advance[m] == 0) continue;
+        advance_to(advance[m], m, 0);
+        released |= (1 << m);
+    }
+    follow_start(released);
+}
+
+// the motors the input shaper or pressure advance move start following their followed position
+void StepTicker::follow_start(uint8_t motors)
+{
+    for (uint32_t pending = motors & ~follow_motors; pending != 0; pending &= pending - 1) {
+        motor[__builtin_ctz(pending)]->start_moving();
+    }
+    follow_motors |= motors;
+}
+
+// steps each motor the input shaper or pressure advance moves towards its followed position, at most one step a tick.
+// Called at the start of every step tick while there are any
+void StepTicker::follow_tick()
+{
+    if(THEKERNEL->is_halted()) {
+        follow_reset();
+        return;
+    }
+
+    bool stepped= false;
+    for (uint32_t pending = follow_due; pending != 0; pending &= pending - 1) {
+        uint8_t m = __builtin_ctz(pending);
+        int32_t e= follow_error[m];
+        if(e <= FOLLOW_ONE / 2 && e >= -FOLLOW_ONE / 2) {
+            follow_due &= ~(1 << m);
+            continue;
+        }
+
+        bool dir= e < 0;
+        if(motor[m]->which_direction() != dir) {
+            // the step is on the next tick so the driver sees the direction change first
+            motor[m]->set_direction(dir);
+            continue;
+        }
+        motor[m]->step();
+        unstep.set(m);
+        e += dir ? FOLLOW_ONE : -FOLLOW_ONE;
+        follow_error[m]= e;
+        // most of the time the step is all it needed, so it is not looked at again until it moves
+        if(e <= FOLLOW_ONE / 2 && e >= -FOLLOW_ONE / 2) follow_due &= ~(1 << m);
+        stepped= true;
+    }
+
+    // a motor is done once it is where it should be and nothing is going to move it any more
+    uint8_t done= shaper_pending > 0 ? 0 : follow_motors & ~follow_due & ~follow_in_place;
+    for (uint32_t pending = done; pending != 0; pending &= pending - 1) {
+        motor[__builtin_ctz(pending)]->stop_moving();
+    }
+    follow_motors &= ~done;
+
+    if(stepped) {
+        LPC_TIM1->TCR = 3;
+        LPC_TIM1->TCR = 1;
+    }
+}
+
+// drops the followed positions, on a halt
+void StepTicker::follow_reset()
+{
+    for (uint32_t pending = follow_motors; pending != 0; pending &= pending - 1) {
+        motor[__builtin_ctz(pending)]->stop_moving();
+    }
+    follow_motors= 0;
+    follow_in_place= 0;
+    follow_due= 0;
+    advance_in_place= 0;
+    follow_error.fill(0);
+    advance.fill(0);
+}
+
+// true when the motors are at their followed position
+bool StepTicker::follow_settled() const
+{
+    for (uint32_t pending = follow_due; pending != 0; pending &= pending - 1) {
+        int32_t e= follow_error[__builtin_ctz(pending)];
+        if(e > FOLLOW_ONE / 2 || e < -FOLLOW_ONE / 2) return false;
+    }
+    return true;
+}
+
+// one step of the path axis, each motor in the current chord steps when it is due (bresenham)
+// returns false once the last chord is done
+bool StepTicker::path_step()
+{
+    const Block::chord_t &chord = current_block->chords[current_chord];
+    for (uint32_t pending = chord.motors; pending != 0; pending &= pending - 1) {
+        uint8_t m = __builtin_ctz(pending);
+        chord_error[m] += chord.steps[m];
+        if(chord_error[m] >= chord.path_steps) {
+            chord_error[m] -= chord.path_steps;
+            unstep.set(m);
+            if(!motor[m]->step()) {
+                // stopped externally (probes, endstops etc), that ends the whole block
+                chord_step= chord.path_steps;
+                current_chord= current_block->path->n_chords;
+            }
+        }
+    }
+
+    if(++chord_step >= chord.path_steps) {
+        if(++current_chord < current_block->path->n_chords) {
+            start_chord();
+            return true;
+        }
+
+        // done
+        for (uint32_t pending = path_motors; pending != 0; pending &= pending - 1) {
+            motor[__builtin_ctz(pending)]->stop_moving();
+        }
+        return false;
+    }
+
+    return true;
+}
+
+// set the directions for the next chord, its first step is on a later tick
+void StepTicker::start_chord()
+{
+    const Block::chord_t &chord = current_block->chords[current_chord];
+    chord_step= 0;
+    for (uint32_t pending = chord.motors; pending != 0; pending &= pending - 1) {
+        uint8_t m = __builtin_ctz(pending);
+        // starting half way puts the steps in the middle of the path steps they are spread over
+        chord_error[m]= chord.path_steps / 2;
+        motor[m]->set_direction((chord.direction_bits >> m) & 1);
+        motor[m]->start_moving();
+    }
+    path_motors |= chord.motors;
+}
+
 // only called from the step tick ISR (single consumer)
 bool StepTicker::start_next_block()
 {
     if(current_block == nullptr) return false;
 
-    bool ok= false;
+    if(current_block->s_curve) {
+        // the jerk is the only part of the ramp that is not restored with tick_info, so it starts here
+        for (uint8_t m = 0; m < Block::n_actuators; ++m) {
+            Block::jerkinfo_t &ji= current_block->jerk_info[m];
+            ji.jerk= select_jerk(ji, current_block->start_jerk);
+        }
+    }
+
+    if(current_block->follows_path) {
+        active_motors= 0;
+        follow_in_place= 0;
+        advance_in_place= 0;
+        current_phase= 0;
+        next_phase_tick= current_block->phases[0].tick;
+        current_chord= 0;
+        path_motors= 0;
+        start_chord();
+        current_tick= 0;
+        return true;
+    }
+
+    active_motors= current_block->active_motors;
+    current_phase= 0;
+    next_phase_tick= current_block->phases[0].tick;
+
+    // the input shaper moves the shaped motors of a shaped block, pressure advance the motors it is set for
+    uint8_t shaped= current_block->is_shaped ? active_motors & shaper_motors : 0;
+    active_motors &= ~shaped;
+    follow_in_place= active_motors & advance_motors;
+    advance_in_place= advanced_motors(current_block, advance_motors);
+    advance_release(advance_motors & ~advance_in_place);
+    follow_start(follow_in_place);
+
+    bool ok= shaped != 0;
     // need to prepare each active motor
-    for (uint8_t m = 0; m < num_motors; m++) {
-        if(current_block->tick_info[m].steps_to_move == 0) continue;
+    for (uint32_t pending = active_motors; pending != 0; pending &= pending - 1) {
+        uint8_t m = __builtin_ctz(pending);
 
         ok= true; // mark at least one motor is moving
+        // follow_tick() sets the direction of the motors it steps
+        if(follow_in_place & (1 << m)) continue;
         // set direction bit here
         // NOTE this would be at least 10us before first step pulse.
         // TODO does this need to be done sooner, if so how without delaying next tick
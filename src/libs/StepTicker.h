@@ -21,8 +21,16 @@
 class StepperMotor;
 class Block;
 
+#ifdef STEPTICKER_FP32
+// handle 2.30 Fixed point, everything the step ticker accumulates fits in 32 bits which is much cheaper on the M3
+// NOTE the counter must stay below 2.0 so a motor can not be stepped faster than once per tick
+#define STEPTICKER_FPSCALE (1L<<30)
+typedef int32_t stepticker_fp_t;
+#else
 // handle 2.62 Fixed point
 #define STEPTICKER_FPSCALE (1LL<<62)
+typedef int64_t stepticker_fp_t;
+#endif
 #define STEPTICKER_FROMFP(x) ((float)(x)/STEPTICKER_FPSCALE)
 
 class StepTicker{
@@ -36,6 +44,17 @@ class StepTicker{
         void unstep_tick();
         const Block *get_current_block() const { return current_block; }
 
+        // the motion of the given motors in shaped blocks is convolved with n impulses of the given amplitude, adding up
+        // to 1, and delay in seconds, in increasing order of delay. n less than 2 turns it off. Only change it when the
+        // queue is idle
+        static const uint8_t max_shaper_impulses= 3;
+        bool set_input_shaper(uint8_t n, const float amplitude[], const float delay[], uint8_t motors);
+        bool is_shaping() const { return shaper_impulses > 1; }
+        bool set_pressure_advance(uint8_t motor, float k);
+        // the motors of a block that follows a path are stepped directly, which can not be mixed with the input shaper
+        // or pressure advance
+        bool can_follow_paths() const { return shaper_impulses < 2 && advance_motors == 0; }
+
         void step_tick (void);
         void handle_finish (void);
         void start();
@@ -45,10 +64,39 @@ class StepTicker{
 
         static StepTicker *getInstance() { return instance; }
 
+        // how often the step ticker ran out of blocks during a job since the last reset_stats(), see M461
+        using stats_t= struct {
+            uint32_t underruns;
+            uint32_t underrun_ticks; // ticks spent waiting for the next block after those
+        };
+        const stats_t& get_stats() const { return stats; }
+        void reset_stats();
+
     private:
         static StepTicker *instance;
 
         bool start_next_block();
+        bool fetch_next_block();
+        bool path_step();
+        void start_chord();
+
+        // each impulse of the input shaper moves the shaped motors of the blocks it started
+        struct shaper_copy_t;
+        void shaper_tick();
+        void shaper_start_copy(shaper_copy_t &copy, Block *block, int32_t amplitude);
+        inline bool shaper_copy_step(shaper_copy_t &copy);
+        void shaper_reset();
+        uint8_t shaper_all() const { return (1 << shaper_impulses) - 1; } // bit set for each impulse
+
+        // the input shaper and pressure advance move a followed position for each of their motors, which the motors
+        // are then stepped to
+        void follow_start(uint8_t motors);
+        void follow_tick();
+        void follow_reset();
+        inline void follow_move(uint8_t m, int32_t delta);
+        bool follow_settled() const;
+        inline void advance_to(int32_t &applied, uint8_t m, int32_t target);
+        void advance_release(uint8_t motors);
 
         float frequency;
         uint32_t period;
@@ -57,9 +105,47 @@ class StepTicker{
 
         Block *current_block;
         uint32_t current_tick{0};
+        uint32_t next_phase_tick; // tick the current block changes phase on
+        uint8_t current_phase; // index into the phase table of the current block
+        uint8_t active_motors; // bit set for each motor that still has steps to issue in the current block
+
+        // state of a block that follows a path, see Block::path_t
+        uint8_t current_chord;
+        uint8_t path_motors; // bit set for each motor that has moved in the block so far
+        uint32_t chord_step;
+        std::array<uint32_t, k_max_actuators> chord_error;
+
+        // followed positions are in steps with FOLLOW_ONE for a whole step
+        std::array<int32_t, k_max_actuators> follow_error; // followed position less the motor position
+        uint8_t follow_motors; // bit set for each motor that is following its followed position
+        uint8_t follow_in_place; // bit set for each motor of the current block that moves its followed position
+        uint8_t follow_due; // bit set for each motor that may be more than half a step from its followed position
+
+        // state of the input shaper
+        shaper_copy_t *shaper_copies;
+        uint32_t *shaper_history; // a bit for each tick the first impulse stepped its lead motor on, for the others
+        uint32_t shaper_history_mask; // words in the history - 1
+        std::array<int32_t, max_shaper_impulses> shaper_amplitude;
+        std::array<uint32_t, max_shaper_impulses> shaper_delay; // ticks
+        uint32_t shaper_now; // ticks, free running while shaping
+        unsigned int shaper_lead_i; // queue index of the next block the first impulse starts
+        uint8_t shaper_pending; // blocks started by the first impulse that have not been executed in place yet
+        uint8_t shaper_impulses;
+        uint8_t shaper_motors; // bit set for each motor that is shaped
+        uint8_t shaper_idle; // bit set for each impulse that is waiting for its next block
+
+        // state of pressure advance
+        std::array<int32_t, k_max_actuators> advance_k; // ticks * 256
+        std::array<int32_t, k_max_actuators> advance; // advance added to the followed position, kept between blocks
+        uint8_t advance_motors; // bit set for each motor with pressure advance
+        uint8_t advance_in_place; // bit set for each motor of the current block that gets pressure advance
+
+        stats_t stats;
+        uint32_t starved_ticks; // ticks since the step ticker ran out of blocks
 
         struct {
             volatile bool running:1;
+            bool starved:1; // ran out of blocks, see step_tick()
             uint8_t num_motors:4;
         };
 };
@@ -28,6 +28,8 @@ class StreamOutput {
         virtual int _getc(void) { return -1; }
         virtual int puts(const char* str) = 0;
         virtual bool ready() { return true; };
+        // turns windowed streaming on or off, returns the size of the receive buffer or 0 if it is off or not supported, see RxWindow.h
+        virtual int set_windowed(bool on) { return 0; }
 
         static NullStreamOutput NullStream;
 };
@@ -35,6 +35,12 @@ public:
         return (next(m_wIndex) == m_rIndex);
     }
 
+    // how many are in the buffer
+    size_t size() const
+    {
+        return (m_wIndex + m_size - m_rIndex) % m_size;
+    }
+
     bool put(const T &value)
     {
         if (full())
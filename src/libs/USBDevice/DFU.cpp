@@ -3,6 +3,9 @@
 // #include <LPC17xx.h>
 #include "lpc17xx_wdt.h"
 
+#include "Kernel.h"
+#include "Scheduler.h"
+
 #include <stdio.h>
 #include <mri.h>
 #include <cstring>
@@ -52,6 +55,7 @@ bool DFU::USBEvent_Request(CONTROL_TRANSFER &control)
         {
 //             usb->disconnect();
             prep_for_detach = 128;
+            THEKERNEL->scheduler->post_task(idle_task);
             WDT_Init(WDT_CLKSRC_IRC, WDT_MODE_RESET);
             WDT_Start(250000); // 0.25 seconds
             //             for (;;);
@@ -98,7 +102,7 @@ bool DFU::USBEvent_RequestComplete(CONTROL_TRANSFER &control, uint8_t *buf, uint
 
 void DFU::on_module_loaded()
 {
-    register_for_event(ON_IDLE);
+    idle_task= THEKERNEL->scheduler->add_task("dfu", this, &Module::on_idle);
 }
 
 void DFU::on_idle(void* argument)
@@ -111,5 +115,7 @@ void DFU::on_idle(void* argument)
             usb->disconnect();
             for (;;);
         }
+        // count down one idle loop at a time
+        THEKERNEL->scheduler->post_task(idle_task);
     }
 }
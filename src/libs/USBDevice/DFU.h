@@ -84,6 +84,7 @@ protected:
     DFU_Status_Response         dfu_status;
 
     int prep_for_detach;
+    uint32_t idle_task;
 };
 
 #endif /* _DFU_H */
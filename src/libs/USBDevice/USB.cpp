@@ -5,6 +5,9 @@
 #include "descriptor_cdc.h"
 #include "descriptor_msc.h"
 
+#include "Kernel.h"
+#include "Scheduler.h"
+
 #define iprintf(...) do { } while (0)
 
 usbdesc_base *USB::descriptors[N_DESCRIPTORS];
@@ -663,7 +666,7 @@ void USB::dumpDescriptors() {
 
 void USB::on_module_loaded()
 {
-    register_for_event(ON_IDLE);
+    THEKERNEL->scheduler->add_task("usb", this, &Module::on_idle, Scheduler::IDLE);
     connect();
 }
 
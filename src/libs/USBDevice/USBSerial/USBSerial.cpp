@@ -23,6 +23,7 @@
 
 #include "libs/Kernel.h"
 #include "libs/SerialMessage.h"
+#include "libs/Scheduler.h"
 #include "StreamOutputPool.h"
 #include "utils.h"
 
@@ -33,7 +34,7 @@
 
 #define iprintf(...) do { } while (0)
 
-USBSerial::USBSerial(USB *u): USBCDC(u), rxbuf(256), txbuf(128 + 8)
+USBSerial::USBSerial(USB *u): USBCDC(u), rxbuf(rxbuf_size), txbuf(128 + 8)
 {
     usb = u;
     nl_in_rx = 0;
@@ -194,6 +195,7 @@ bool USBSerial::USBEvent_EPOut(uint8_t bEP, uint8_t bEPStatus)
     iprintf("Read %ld bytes:\n\t", size);
     for (uint8_t i = 0; i < size; i++) {
         char b= c[i];
+        window.add();
 
         // handle backspace and delete by deleting the last character in the buffer if there is one
         if(b == 0x08 || b == 0x7F) {
@@ -295,12 +297,14 @@ bool USBSerial::ready()
 
 void USBSerial::on_module_loaded()
 {
-    this->register_for_event(ON_MAIN_LOOP);
-    this->register_for_event(ON_IDLE);
+    THEKERNEL->scheduler->add_task("usbserial", this, &Module::on_main_loop, Scheduler::MAIN_LOOP);
+    THEKERNEL->scheduler->add_task("usbserial", this, &Module::on_idle, Scheduler::IDLE);
 }
 
 void USBSerial::on_idle(void *argument)
 {
+    report_window();
+
     if(halt_flag) {
         halt_flag = false;
         THEKERNEL->call_event(ON_HALT, nullptr);
@@ -348,24 +352,38 @@ void USBSerial::on_main_loop(void *argument)
     //if(THEKERNEL->get_feed_hold()) return;
 
     if (nl_in_rx) {
-        string received;
+        // built in place in the reused message, see SerialConsole::on_main_loop
+        received.message.clear();
+        received.stream = this;
         while (available()) {
             int c = _getc();
             if(c == -1) break;
             if( c == '\n' || c == '\r') {
-                struct SerialMessage message;
-                message.message = received;
-                message.stream = this;
-                iprintf("USBSerial Received: %s\n", message.message.c_str());
-                THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &message );
+                iprintf("USBSerial Received: %s\n", received.message.c_str());
+                // the line is out of the buffer, so the host can be told before it is dispatched which may take a while
+                report_window();
+                THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &received );
                 return;
             } else {
-                received += c;
+                received.message += c;
             }
         }
     }
 }
 
+// windowed streaming, see RxWindow.h
+int USBSerial::set_windowed(bool on)
+{
+    window.enable(on, window.get_received(), rxbuf.available());
+    return on ? rxbuf_size - 1 : 0;
+}
+
+void USBSerial::report_window()
+{
+    uint32_t received= window.get_received();
+    window.report(this, received, rxbuf.available(), rxbuf_size - 1, nl_in_rx == 0);
+}
+
 void USBSerial::on_attach()
 {
     attach = true;
@@ -25,6 +25,8 @@
 
 #include "Module.h"
 #include "StreamOutput.h"
+#include "libs/SerialMessage.h"
+#include "libs/RxWindow.h"
 
 class USBSerial_Receiver {
 protected:
@@ -38,6 +40,7 @@ public:
     int _putc(int c);
     int _getc();
     int puts(const char *);
+    int set_windowed(bool on);
 
     uint8_t available();
     bool ready();
@@ -67,6 +70,12 @@ protected:
     // this makes it trivial to detect if there's a new line available
     volatile int nl_in_rx;
 
+    // the last line received, reused for every line
+    SerialMessage received;
+
+    static const int rxbuf_size = 256;
+    RxWindow window;
+    void report_window();
 
     volatile struct {
         volatile bool attach:1;
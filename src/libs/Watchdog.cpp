@@ -1,5 +1,6 @@
 #include "Watchdog.h"
 #include "Kernel.h"
+#include "Scheduler.h"
 
 #include <lpc17xx_wdt.h>
 
@@ -30,7 +31,7 @@ void Watchdog::feed()
 
 void Watchdog::on_module_loaded()
 {
-    register_for_event(ON_IDLE);
+    THEKERNEL->scheduler->add_task("watchdog", this, &Module::on_idle, Scheduler::IDLE);
     feed();
 }
 
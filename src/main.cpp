@@ -35,6 +35,7 @@
 #include "ConfigValue.h"
 #include "StepTicker.h"
 #include "SlowTicker.h"
+#include "Profiler.h"
 #include "Robot.h"
 
 // #include "libs/ChaNFSSD/SDFileSystem.h"
@@ -256,6 +257,9 @@ void init() {
     THEKERNEL->conveyor->start(THEROBOT->get_number_registered_motors());
     THEKERNEL->step_ticker->start();
     THEKERNEL->slow_ticker->start();
+#ifdef PROFILE_PROBES
+    Profiler::start();
+#endif
 }
 
 int main()
@@ -10,6 +10,7 @@
 #include "libs/Kernel.h"
 #include "Robot.h"
 #include "utils/Gcode.h"
+#include "utils/GcodeFrame.h"
 #include "libs/nuts_bolts.h"
 #include "modules/robot/Conveyor.h"
 #include "libs/SerialMessage.h"
@@ -39,6 +40,34 @@ static bool is_allowed_mcode(int m) {
     return false;
 }
 
+// the first character in [p, end) that is in set, or end
+static const char *find_first_of(const char *p, const char *end, const char *set)
+{
+    for (; p < end; ++p) {
+        for (const char *s = set; *s; ++s) {
+            if(*p == *s) return p;
+        }
+    }
+    return end;
+}
+
+// the first character in [p, end) that is not in set, or end
+static const char *find_first_not_of(const char *p, const char *end, const char *set)
+{
+    for (; p < end; ++p) {
+        const char *s = set;
+        while(*s && *s != *p) ++s;
+        if(*s == '\0') return p;
+    }
+    return end;
+}
+
+// n characters into a command of the given length, or its end if it is shorter
+static const char *skip(const char *p, const char *end, size_t n)
+{
+    return (size_t)(end - p) > n ? p + n : end;
+}
+
 GcodeDispatch::GcodeDispatch()
 {
     uploading = false;
@@ -53,26 +82,34 @@ void GcodeDispatch::on_module_loaded()
 }
 
 // When a command is received, if it is a Gcode, dispatch it as an object via an event
+// The line is only borrowed from the stream that received it until this returns, so it is parsed where it is: the line
+// number, checksum and comments are stripped by moving the ends of the part being looked at, and each command on it is
+// tokenized by Gcode straight from the line
 void GcodeDispatch::on_console_line_received(void *line)
 {
-    SerialMessage new_message = *static_cast<SerialMessage *>(line);
-    string possible_command = new_message.message;
+    SerialMessage &new_message = *static_cast<SerialMessage *>(line);
+    const char *possible_command = new_message.message.data();
+    const char *eol = possible_command + new_message.message.size();
 
     int ln = 0;
     int cs = 0;
 
     // just reply ok to empty lines
-    if(possible_command.empty()) {
+    if(possible_command == eol) {
         new_message.stream->printf("ok\n");
         return;
     }
 
 try_again:
 
-    char first_char = possible_command[0];
-    unsigned int n;
+    char first_char = *possible_command;
+    const char *n;
+
+    if(first_char == GCODE_FRAME_START && (!uploading || upload_stream != new_message.stream)) {
+        dispatch_frame(new_message.stream, possible_command + 1, eol - possible_command - 1);
+        return;
 
-    if(first_char == '$') {
+    }else if(first_char == '$') {
         // ignore as simpleshell will handle it
         return;
 
@@ -85,7 +122,7 @@ try_again:
 
         //Get linenumber
         if ( first_char == 'N' ) {
-            Gcode full_line = Gcode(possible_command, new_message.stream, false);
+            Gcode full_line(possible_command, eol - possible_command, new_message.stream, false);
             ln = (int) full_line.get_int('N');
             int chksum = (int) full_line.get_int('*');
 
@@ -99,25 +136,19 @@ try_again:
             }
 
             //Strip checksum value from possible_command
-            size_t chkpos = possible_command.find_first_of("*");
+            const char *chkpos = find_first_of(possible_command, eol, "*");
 
 			//Calculate checksum
-            if ( chkpos != string::npos ) {
-				possible_command = possible_command.substr(0, chkpos);
-                for (auto c = possible_command.cbegin(); *c != '*' && c != possible_command.cend(); c++)
+            if ( chkpos != eol ) {
+				eol = chkpos;
+                for (const char *c = possible_command; c != eol; c++)
                     cs = cs ^ *c;
                 cs &= 0xff;  // Defensive programming...
                 cs -= chksum;
 			}
 
-            //Strip line number value from possible_command
-			size_t lnsize = possible_command.find_first_not_of("N0123456789.,- ");
-			if(lnsize != string::npos) {
-				possible_command = possible_command.substr(lnsize);
-			}else{
-				// it is a blank line
-				possible_command.clear();
-			}
+            //Strip line number value from possible_command, it is a blank line if there is nothing after it
+			possible_command = find_first_not_of(possible_command, eol, "N0123456789.,- ");
 
         } else {
             //Assume checks succeeded
@@ -126,10 +157,7 @@ try_again:
         }
 
         //Remove comments
-        size_t comment = possible_command.find_first_of(";(");
-        if( comment != string::npos ) {
-            possible_command = possible_command.substr(0, comment);
-        }
+        eol = find_first_of(possible_command, eol, ";(");
 
         //If checksum passes then process message, else request resend
         int nextline = currentline + 1;
@@ -139,21 +167,14 @@ try_again:
             }
 
             bool sent_ok= false; // used for G1 optimization
-            while(possible_command.size() > 0) {
+            while(possible_command < eol) {
                 if(!uploading || upload_stream != new_message.stream) {
                     // assumes G or M are always the first on the line
-                    size_t nextcmd = possible_command.find_first_of("GM", 2);
-                    string single_command;
-                    if(nextcmd == string::npos) {
-                        single_command = possible_command;
-                        possible_command = "";
-                    } else {
-                        single_command = possible_command.substr(0, nextcmd);
-                        possible_command = possible_command.substr(nextcmd);
-                    }
+                    const char *single_command = possible_command;
+                    possible_command = eol - single_command > 2 ? find_first_of(single_command + 2, eol, "GM") : eol;
 
                     // Prepare gcode for dispatch
-                    Gcode *gcode = new Gcode(single_command, new_message.stream);
+                    Gcode *gcode = new Gcode(single_command, possible_command - single_command, new_message.stream);
 
                     if(THEKERNEL->is_halted()) {
                         // we ignore all commands until M999, unless it is in the exceptions list (like M105 get temp)
@@ -183,7 +204,7 @@ try_again:
                         if(gcode->g == 53) { // G53 makes next movement command use machine coordinates
                             // this is ugly to implement as there may or may not be a G0/G1 on the same line
                             // valid version seem to include G53 G0 X1 Y2 Z3 G53 X1 Y2
-                            if(possible_command.empty()) {
+                            if(possible_command == eol) {
                                 // use last gcode G1 or G0 if none on the line, and pass through as if it was a G0/G1
                                 // TODO it is really an error if the last is not G0 thru G3
                                 if(modal_group_1 > 3) {
@@ -197,8 +218,8 @@ try_again:
                             }else{
                                 delete gcode;
                                 // extract next G0/G1 from the rest of the line, ignore if it is not one of these
-                                gcode = new Gcode(possible_command, new_message.stream);
-                                possible_command= "";
+                                gcode = new Gcode(possible_command, eol - possible_command, new_message.stream);
+                                possible_command= eol;
                                 if(!gcode->has_g || gcode->g > 1) {
                                     // not G0 or G1 so ignore it as it is invalid
                                     delete gcode;
@@ -228,7 +249,7 @@ try_again:
                             case 28: // start upload command
                                 delete gcode;
 
-                                this->upload_filename = "/sd/" + single_command.substr(4); // rest of line is filename
+                                this->upload_filename.assign("/sd/").append(skip(single_command, possible_command, 4), possible_command); // rest of line is filename
                                 // open file
                                 upload_fd = fopen(this->upload_filename.c_str(), "w");
                                 if(upload_fd != NULL) {
@@ -290,9 +311,20 @@ try_again:
                                 return;
                             }
 
+                            case 880: // M880 S1 windowed streaming on the stream it is sent on, S0 back to waiting for each ok, see RxWindow.h
+                            {
+                                bool on= !gcode->has_letter('S') || gcode->get_int('S') != 0;
+                                new_message.stream->printf("window:%d\n", new_message.stream->set_windowed(on));
+                                break;
+                            }
+
+                            case 881: // M881 S1 accept binary framed moves on the stream it is sent on, S0 text only, see GcodeFrame.h
+                                frame_stream= (!gcode->has_letter('S') || gcode->get_int('S') != 0) ? new_message.stream : nullptr;
+                                break;
+
                             case 117: // M117 is a special non compliant Gcode as it allows arbitrary text on the line following the command
                             {    // concatenate the command again and send to panel if enabled
-                                string str= single_command.substr(4) + possible_command;
+                                string str(skip(single_command, possible_command, 4), eol);
                                 PublicData::set_value( panel_checksum, panel_display_message_checksum, &str );
                                 delete gcode;
                                 new_message.stream->printf("ok\n");
@@ -302,8 +334,9 @@ try_again:
                             case 1000: // M1000 is a special command that will pass thru the raw lowercased command to the simpleshell (for hosts that do not allow such things)
                             {
                                 // reconstruct entire command line again
-                                string str= single_command.substr(5) + possible_command;
-                                while(is_whitespace(str.front())){ str= str.substr(1); } // strip leading whitespace
+                                const char *p= skip(single_command, possible_command, 5);
+                                while(p < eol && is_whitespace(*p)) ++p; // strip leading whitespace
+                                string str(p, eol);
 
                                 delete gcode;
 
@@ -345,7 +378,7 @@ try_again:
                             case 501: // load config override
                             case 504: // save to specific config override file
                                 {
-                                    string arg= get_arguments(single_command + possible_command); // rest of line is filename
+                                    string arg= get_arguments(string(single_command, eol)); // rest of line is filename
                                     if(arg.empty()) arg= "/sd/config-override";
                                     else arg= "/sd/config-override." + arg;
                                     //new_message.stream->printf("args: <%s>\n", arg.c_str());
@@ -413,7 +446,7 @@ try_again:
                         } else {
                             if(THEKERNEL->is_ok_per_line() || THEKERNEL->is_grbl_mode()) {
                                 // only send ok once per line if this is a multi g code line send ok on the last one
-                                if(possible_command.empty())
+                                if(possible_command == eol)
                                     new_message.stream->printf("ok\n");
                             } else {
                                 // maybe should do the above for all hosts?
@@ -426,7 +459,7 @@ try_again:
 
                 } else {
                     // we are uploading and it is the upload stream so so save it
-                    if(possible_command.substr(0, 3) == "M29") {
+                    if(eol - possible_command >= 3 && strncmp(possible_command, "M29", 3) == 0) {
                         // done uploading, close file
                         fclose(upload_fd);
                         upload_fd = NULL;
@@ -443,8 +476,8 @@ try_again:
                         break;
                     }
 
-                    possible_command.append("\n");
-                    if(fwrite(possible_command.c_str(), 1, possible_command.size(), upload_fd) != possible_command.size()) {
+                    size_t len= eol - possible_command;
+                    if(fwrite(possible_command, 1, len, upload_fd) != len || fputc('\n', upload_fd) == EOF) {
                         // error writing to file
                         new_message.stream->printf("Error:error writing to file.\n");
                         fclose(upload_fd);
@@ -467,17 +500,20 @@ try_again:
         // Ignore comments and blank lines
         new_message.stream->printf("ok\n");
 
-    } else if( (n=possible_command.find_first_of("XYZF")) == 0 || (first_char == ' ' && n != string::npos) ) {
+    } else if( (n=find_first_of(possible_command, eol, "XYZF")) == possible_command || (first_char == ' ' && n != eol) ) {
         // handle pycam syntax, use last modal group 1 command and resubmit if an X Y Z or F is found on its own line
         char buf[6];
-        if(possible_command[n] == 'F') {
+        if(*n == 'F') {
             // F on its own always applies to G1
             strcpy(buf,"G1 ");
         }else{
             // use last modal command (G1 or G0 etc)
             snprintf(buf, sizeof(buf), "G%d ", modal_group_1);
         }
-        possible_command.insert(0, buf);
+        // the borrowed line cannot be changed, so the command is put in front of it in a buffer that is kept for this
+        rewritten.assign(buf).append(possible_command, eol);
+        possible_command = rewritten.data();
+        eol = possible_command + rewritten.size();
         goto try_again;
 
 
@@ -487,3 +523,56 @@ try_again:
     }
 }
 
+// A G0 to G3 that came as a binary frame, it is the only command on the line so it is dispatched and acknowledged like
+// a single text move. A frame that cannot be decoded is a lost move, so it halts as an error on a text move would
+void GcodeDispatch::dispatch_frame(StreamOutput *stream, const char *frame, size_t len)
+{
+    const char *error= "Binary frames are not enabled, send M881 S1 first";
+    Gcode *gcode= nullptr;
+    if(stream == frame_stream) {
+        gcode= GcodeFrame::decode(frame, len, stream, &error);
+    }
+
+    if(gcode != nullptr) {
+        dispatch_move(gcode);
+        return;
+    }
+
+    stream->printf(THEKERNEL->is_grbl_mode() ? "error:%s\n" : "Error: %s\n", error);
+    stream->printf("Entering Alarm/Halt state\n");
+    THEKERNEL->call_event(ON_HALT, nullptr);
+}
+
+// A G0 to G3 that did not come as text, from a binary frame or a compiled job, it is dispatched and acknowledged on its
+// stream like a single text move and deleted
+void GcodeDispatch::dispatch_move(Gcode *gcode)
+{
+    StreamOutput *stream= gcode->stream;
+    if(THEKERNEL->is_halted()) {
+        // moves are ignored until M999
+        stream->printf(THEKERNEL->is_grbl_mode() ? "error:Alarm lock\n" : "!!\n");
+        delete gcode;
+        return;
+    }
+
+    // optimize G1 to send ok immediately before it is planned
+    if(gcode->g == 1) stream->printf("ok\n");
+    modal_group_1= gcode->g;
+
+    THEKERNEL->call_event(ON_GCODE_RECEIVED, gcode);
+
+    if(!gcode->is_error) {
+        if(!gcode->txt_after_ok.empty()) {
+            stream->printf("ok %s\n", gcode->txt_after_ok.c_str());
+        } else if(gcode->g != 1) {
+            stream->printf("ok\n");
+        }
+        delete gcode;
+        return;
+    }
+
+    stream->printf(THEKERNEL->is_grbl_mode() ? "error:%s\n" : "Error: %s\n", gcode->txt_after_ok.empty() ? "unknown" : gcode->txt_after_ok.c_str());
+    stream->printf("Entering Alarm/Halt state\n");
+    delete gcode;
+    THEKERNEL->call_event(ON_HALT, nullptr);
+}
@@ -13,6 +13,7 @@
 #include <string>
 
 class StreamOutput;
+class Gcode;
 
 class GcodeDispatch : public Module
 {
@@ -23,11 +24,17 @@ public:
     virtual void on_console_line_received(void *line);
 
     uint8_t get_modal_command() const { return modal_group_1<4 ? modal_group_1 : 0; }
+    void dispatch_move(Gcode *gcode);
+
 private:
+    void dispatch_frame(StreamOutput *stream, const char *frame, size_t len);
+
     int currentline;
     std::string upload_filename;
+    std::string rewritten; // a received line with a command put in front of it, kept so it is only allocated once
     FILE *upload_fd;
     StreamOutput* upload_stream{nullptr};
+    StreamOutput* frame_stream{nullptr}; // the stream binary framed moves are accepted on
     uint8_t modal_group_1;
     struct {
         bool uploading: 1;
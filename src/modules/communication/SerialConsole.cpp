@@ -14,6 +14,7 @@
 #include "libs/StreamOutput.h"
 #include "libs/StreamOutputPool.h"
 #include "libs/Config.h"
+#include "libs/Scheduler.h"
 #include "checksumm.h"
 #include "ConfigValue.h"
 #include "utils.h"
@@ -29,6 +30,9 @@
 #define baud_rate_setting_checksum CHECKSUM("baud_rate")
 #define uart0_checksum             CHECKSUM("uart0")
 
+// the ring buffer holds one less than its size
+#define buffer_capacity 255
+
 static SerialConsole* instance = 0;
 static void *LPC_UART;
 
@@ -62,7 +66,8 @@ SerialConsole::~SerialConsole()
 
 /*----------------- INTERRUPT SERVICE ROUTINES --------------------------*/
 /*********************************************************************/
-static void UART_IRQHandler(void)
+// installed with NVIC_SetVector(), which the hostsim build stubs out
+static void __attribute__((used)) UART_IRQHandler(void)
 {
     uint32_t intsrc, tmp;
 
@@ -188,8 +193,8 @@ void SerialConsole::on_module_loaded()
     last_char_was_cr = false;
 
     // We only call the command dispatcher in the main loop, nowhere else
-    this->register_for_event(ON_MAIN_LOOP);
-    this->register_for_event(ON_IDLE);
+    THEKERNEL->scheduler->add_task("serial", this, &Module::on_main_loop, Scheduler::MAIN_LOOP);
+    THEKERNEL->scheduler->add_task("serial", this, &Module::on_idle, Scheduler::IDLE);
 
     // Add to the pack of streams kernel can call to, for example for broadcasting
     THEKERNEL->streams->append_stream(this);
@@ -198,6 +203,7 @@ void SerialConsole::on_module_loaded()
 // Called on interrupt, meaning we have received a char
 void SerialConsole::on_serial_char_received(char received)
 {
+    window.add();
     if(received == '?') {
         query_flag = true;
         return;
@@ -226,6 +232,7 @@ void SerialConsole::on_serial_char_received(char received)
 
 void SerialConsole::on_idle(void * argument)
 {
+    report_window();
     if(query_flag) {
         query_flag = false;
         puts(THEKERNEL->get_query_string().c_str());
@@ -249,8 +256,10 @@ void SerialConsole::on_idle(void * argument)
 void SerialConsole::on_main_loop(void * argument)
 {
     if(lf_count > 0) {
-        string received;
-        received.reserve(20);
+        // the line is built in place in the reused message and lent to the handlers for the duration of the event,
+        // so once it has grown to the longest line received no more memory is allocated for it
+        received.message.clear();
+        received.stream = this;
         while(1) {
             char c;
             if(!this->buffer.get(c)) {
@@ -259,18 +268,29 @@ void SerialConsole::on_main_loop(void * argument)
             }
             if(c == '\n') {
                 --lf_count;
-                struct SerialMessage message;
-                message.message = received;
-                message.stream = this;
-                THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &message );
+                // the line is out of the buffer, so the host can be told before it is dispatched which may take a while
+                report_window();
+                THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &received );
                 return;
             } else {
-                received += c;
+                received.message += c;
             }
         }
     }
 }
 
+int SerialConsole::set_windowed(bool on)
+{
+    window.enable(on, window.get_received(), buffer.size());
+    return on ? buffer_capacity : 0;
+}
+
+void SerialConsole::report_window()
+{
+    uint32_t received= window.get_received();
+    window.report(this, received, buffer.size(), buffer_capacity, lf_count == 0);
+}
+
 #pragma GCC diagnostic ignored "-Wcast-qual"
 int SerialConsole::puts(const char* s)
 {
@@ -15,6 +15,8 @@
 
 #include "libs/TSRingBuffer.h"
 #include "libs/StreamOutput.h"
+#include "libs/SerialMessage.h"
+#include "libs/RxWindow.h"
 
 class SerialConsole : public Module, public StreamOutput {
     public:
@@ -30,8 +32,11 @@ class SerialConsole : public Module, public StreamOutput {
         int _getc(void);
         bool ready();
         int puts(const char*);
+        int set_windowed(bool on);
 
         TSRingBuffer<char, 256> buffer;   // Receive buffer
+        SerialMessage received;           // the last line received, reused for every line
+        RxWindow window;
 
         struct {
           bool query_flag:1;
@@ -40,6 +45,9 @@ class SerialConsole : public Module, public StreamOutput {
           uint8_t uartn:2;
           uint8_t lf_count:8;
         };
+
+    private:
+        void report_window();
 };
 
 #endif
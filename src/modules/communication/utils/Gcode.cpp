@@ -10,87 +10,209 @@
 #include "libs/StreamOutput.h"
 #include "utils.h"
 #include <stdlib.h>
+#include <string.h>
 #include <algorithm>
 
+// a letter found on the line by tokenize()
+struct Gcode::letter_t {
+    float value;
+    uint16_t offset;
+    char letter;
+    bool has_value; // there is a number after the letter
+};
+
+// the most letters tokenize() looks at, lines with more (long messages, file names) are scanned for each lookup
+#define MAX_LETTERS 32
+
+// the slots new Gcodes are made in
+#define GCODE_SLOTS 3
+static void *slots[GCODE_SLOTS];
+static uint8_t slots_used;
+
+// the next place letter is in the string, lines that are not tokenized are looked up by scanning them
+static const char *scan_letter(const char *cs, char letter)
+{
+    for (; *cs; cs++) {
+        if(*cs == letter) return cs;
+    }
+    return nullptr;
+}
+
 // This is a gcode object. It represents a GCode string/command, and caches some important values about that command for the sake of performance.
 // It gets passed around in events, and attached to the queue ( that'll change )
-Gcode::Gcode(const string &command, StreamOutput *stream, bool strip)
+Gcode::Gcode(const string &command, StreamOutput *stream, bool strip) : Gcode(command.c_str(), command.size(), stream, strip)
+{
+}
+
+// made from part of a line that is not terminated, the dispatcher uses this to parse the received line where it is
+Gcode::Gcode(const char *line, size_t len, StreamOutput *stream, bool strip)
 {
-    this->command= strdup(command.c_str());
+    set_command(line, len);
     this->m= 0;
     this->g= 0;
     this->subcode= 0;
     this->add_nl= false;
     this->is_error= false;
+    this->framed= false;
     this->stream= stream;
     prepare_cached_values(strip);
     this->stripped= strip;
 }
 
+// a G0 to G3 that came as a binary frame (see GcodeFrame.h), values has the value of each letter set in letters in
+// letter order, which is the order of the table, so nothing needs parsing. It is as if the line was stripped
+Gcode::Gcode(unsigned int g, uint32_t letters, const float *values, StreamOutput *stream)
+{
+    set_command("", 0);
+    this->m= 0;
+    this->g= g;
+    this->subcode= 0;
+    this->add_nl= false;
+    this->is_error= false;
+    this->has_m= false;
+    this->has_g= true;
+    this->stripped= true;
+    this->framed= true;
+    this->stream= stream;
+    this->letters= letters;
+    this->valued= letters;
+    this->overflow= false;
+    uint8_t n= __builtin_popcount(letters);
+    for (uint8_t i = 0; i < n; ++i) {
+        words[i].value= values[i];
+        words[i].offset= 0;
+    }
+    this->num_args= __builtin_popcount(letters & ~(1 << ('T' - 'A')));
+}
+
 Gcode::~Gcode()
 {
-    if(command != nullptr) {
-        // TODO we can reference count this so we share copies, may save more ram than the extra count we need to store
+    if(command != buffer) {
         free(command);
     }
 }
 
 Gcode::Gcode(const Gcode &to_copy)
 {
-    this->command               = strdup(to_copy.command); // TODO we can reference count this so we share copies, may save more ram than the extra count we need to store
+    set_command(to_copy.command, strlen(to_copy.command));
     this->has_m                 = to_copy.has_m;
     this->has_g                 = to_copy.has_g;
     this->m                     = to_copy.m;
     this->g                     = to_copy.g;
     this->subcode               = to_copy.subcode;
     this->add_nl                = to_copy.add_nl;
+    this->stripped              = to_copy.stripped;
     this->is_error              = to_copy.is_error;
+    this->framed                = to_copy.framed;
     this->stream                = to_copy.stream;
+    this->letters               = to_copy.letters;
+    this->valued                = to_copy.valued;
+    this->num_args              = to_copy.num_args;
+    this->overflow              = to_copy.overflow;
+    memcpy(this->words, to_copy.words, sizeof(words));
     this->txt_after_ok.assign( to_copy.txt_after_ok );
 }
 
 Gcode &Gcode::operator= (const Gcode &to_copy)
 {
     if( this != &to_copy ) {
-        this->command               = strdup(to_copy.command); // TODO we can reference count this so we share copies, may save more ram than the extra count we need to store
+        if(command != buffer) free(command);
+        set_command(to_copy.command, strlen(to_copy.command));
         this->has_m                 = to_copy.has_m;
         this->has_g                 = to_copy.has_g;
         this->m                     = to_copy.m;
         this->g                     = to_copy.g;
         this->subcode               = to_copy.subcode;
         this->add_nl                = to_copy.add_nl;
+        this->stripped              = to_copy.stripped;
         this->is_error              = to_copy.is_error;
+        this->framed                = to_copy.framed;
         this->stream                = to_copy.stream;
+        this->letters               = to_copy.letters;
+        this->valued                = to_copy.valued;
+        this->num_args              = to_copy.num_args;
+        this->overflow              = to_copy.overflow;
+        memcpy(this->words, to_copy.words, sizeof(words));
         this->txt_after_ok.assign( to_copy.txt_after_ok );
     }
     return *this;
 }
 
+void *Gcode::operator new(size_t size)
+{
+    for (int i = 0; i < GCODE_SLOTS; ++i) {
+        if(slots_used & (1 << i)) continue;
+        if(slots[i] == nullptr) {
+            // made the first time it is needed and kept from then on
+            slots[i]= ::operator new(sizeof(Gcode));
+        }
+        slots_used |= (1 << i);
+        return slots[i];
+    }
+    // more Gcodes than slots at once, this only happens when a command makes other commands
+    return ::operator new(size);
+}
+
+void Gcode::operator delete(void *p)
+{
+    for (int i = 0; i < GCODE_SLOTS; ++i) {
+        if(slots[i] == p) {
+            slots_used &= ~(1 << i);
+            return;
+        }
+    }
+    ::operator delete(p);
+}
+
+// copy the line into the buffer, or the heap when it does not fit
+void Gcode::set_command(const char *line, size_t len)
+{
+    if(len < line_size) {
+        command= buffer;
+        memcpy(command, line, len);
+        command[len]= '\0';
+    } else {
+        command= strndup(line, len);
+    }
+}
+
+// the word for a letter in the table, nullptr if the letter does not have a number after it
+const Gcode::word_t *Gcode::find_word(char letter) const
+{
+    uint32_t bit= 1 << (letter - 'A');
+    if(!(valued & bit)) return nullptr;
+    return &words[__builtin_popcount(valued & (bit - 1))];
+}
 
 // Whether or not a Gcode has a letter
 bool Gcode::has_letter( char letter ) const
 {
-    for (size_t i = 0; i < strlen(this->command); ++i) {
-        if( command[i] == letter ) {
-            return true;
-        }
-    }
-    return false;
+    if(in_table(letter)) return letters & (1 << (letter - 'A'));
+    return scan_letter(command, letter) != nullptr;
 }
 
 // Retrieve the value for a given letter
 float Gcode::get_value( char letter, char **ptr ) const
 {
-    const char *cs = command;
-    char *cn = NULL;
-    for (; *cs; cs++) {
-        if( letter == *cs ) {
-            cs++;
-            float r = strtof(cs, &cn);
-            if(ptr != nullptr) *ptr= cn;
-            if (cn > cs)
-                return r;
+    if(in_table(letter)) {
+        const word_t *w= find_word(letter);
+        if(w != nullptr) {
+            if(ptr != nullptr) {
+                if(framed) *ptr= nullptr;
+                else strtof(command + w->offset + 1, ptr);
+            }
+            return w->value;
         }
+        if(ptr != nullptr) *ptr= nullptr;
+        return 0;
+    }
+
+    char *cn = NULL;
+    for (const char *cs = scan_letter(command, letter); cs != nullptr; cs = scan_letter(cs + 1, letter)) {
+        float r = strtof(cs + 1, &cn);
+        if(ptr != nullptr) *ptr= cn;
+        if (cn > cs + 1)
+            return r;
     }
     if(ptr != nullptr) *ptr= nullptr;
     return 0;
@@ -99,15 +221,23 @@ float Gcode::get_value( char letter, char **ptr ) const
 int Gcode::get_int( char letter, char **ptr ) const
 {
     const char *cs = command;
-    char *cn = NULL;
-    for (; *cs; cs++) {
-        if( letter == *cs ) {
-            cs++;
-            int r = strtol(cs, &cn, 10);
-            if(ptr != nullptr) *ptr= cn;
-            if (cn > cs)
-                return r;
+    if(in_table(letter)) {
+        // the first letter with a float after it is the first with an int too, unless it is something like X.5
+        const word_t *w= find_word(letter);
+        if(w == nullptr || framed) {
+            // there is no text to read a framed value from again, it is truncated as strtol would
+            if(ptr != nullptr) *ptr= nullptr;
+            return w == nullptr ? 0 : (int)w->value;
         }
+        cs= command + w->offset;
+    }
+
+    char *cn = NULL;
+    for (cs = scan_letter(cs, letter); cs != nullptr; cs = scan_letter(cs + 1, letter)) {
+        int r = strtol(cs + 1, &cn, 10);
+        if(ptr != nullptr) *ptr= cn;
+        if (cn > cs + 1)
+            return r;
     }
     if(ptr != nullptr) *ptr= nullptr;
     return 0;
@@ -116,37 +246,38 @@ int Gcode::get_int( char letter, char **ptr ) const
 uint32_t Gcode::get_uint( char letter, char **ptr ) const
 {
     const char *cs = command;
-    char *cn = NULL;
-    for (; *cs; cs++) {
-        if( letter == *cs ) {
-            cs++;
-            int r = strtoul(cs, &cn, 10);
-            if(ptr != nullptr) *ptr= cn;
-            if (cn > cs)
-                return r;
+    if(in_table(letter)) {
+        const word_t *w= find_word(letter);
+        if(w == nullptr || framed) {
+            // there is no text to read a framed value from again, it is truncated as strtol would
+            if(ptr != nullptr) *ptr= nullptr;
+            return w == nullptr ? 0 : (uint32_t)w->value;
         }
+        cs= command + w->offset;
     }
-    if(ptr != nullptr) *ptr= nullptr;
-    return 0;
-}
 
-int Gcode::get_num_args() const
-{
-    int count = 0;
-    for(size_t i = stripped?0:1; i < strlen(command); i++) {
-        if( this->command[i] >= 'A' && this->command[i] <= 'Z' ) {
-            if(this->command[i] == 'T') continue;
-            count++;
-        }
+    char *cn = NULL;
+    for (cs = scan_letter(cs, letter); cs != nullptr; cs = scan_letter(cs + 1, letter)) {
+        int r = strtoul(cs + 1, &cn, 10);
+        if(ptr != nullptr) *ptr= cn;
+        if (cn > cs + 1)
+            return r;
     }
-    return count;
+    if(ptr != nullptr) *ptr= nullptr;
+    return 0;
 }
 
 std::map<char,float> Gcode::get_args() const
 {
     std::map<char,float> m;
-    for(size_t i = stripped?0:1; i < strlen(command); i++) {
-        char c= this->command[i];
+    if(framed) {
+        for (char c = 'A'; c <= 'Z'; ++c) {
+            if(c != 'T' && has_letter(c)) m[c]= get_value(c);
+        }
+        return m;
+    }
+    for(const char *cs = stripped ? command : command + 1; *cs; cs++) {
+        char c= *cs;
         if( c >= 'A' && c <= 'Z' ) {
             if(c == 'T') continue;
             m[c]= get_value(c);
@@ -158,8 +289,14 @@ std::map<char,float> Gcode::get_args() const
 std::map<char,int> Gcode::get_args_int() const
 {
     std::map<char,int> m;
-    for(size_t i = stripped?0:1; i < strlen(command); i++) {
-        char c= this->command[i];
+    if(framed) {
+        for (char c = 'A'; c <= 'Z'; ++c) {
+            if(c != 'T' && has_letter(c)) m[c]= get_int(c);
+        }
+        return m;
+    }
+    for(const char *cs = stripped ? command : command + 1; *cs; cs++) {
+        char c= *cs;
         if( c >= 'A' && c <= 'Z' ) {
             if(c == 'T') continue;
             m[c]= get_int(c);
@@ -168,9 +305,75 @@ std::map<char,int> Gcode::get_args_int() const
     return m;
 }
 
+// finds every letter A to Z on the line and reads the number after it, returns how many there are or MAX_LETTERS + 1
+// if there are too many
+uint8_t Gcode::tokenize(letter_t found[]) const
+{
+    uint8_t n= 0;
+    for (const char *cs = command; *cs; cs++) {
+        if(*cs < 'A' || *cs > 'Z') continue;
+        if(n == MAX_LETTERS || cs - command > 0xFFFF) return MAX_LETTERS + 1;
+
+        char *cn;
+        letter_t &l= found[n++];
+        l.letter= *cs;
+        l.offset= cs - command;
+        l.value= strtof(cs + 1, &cn);
+        l.has_value= cn > cs + 1;
+    }
+    return n;
+}
+
+// fills in the table from the letters at or after start, the line has already had everything before start removed
+void Gcode::make_words(const letter_t found[], uint8_t n, size_t start, size_t args_from)
+{
+    letters= 0;
+    valued= 0;
+    num_args= 0;
+    overflow= n > MAX_LETTERS;
+    if(overflow) {
+        // count them the way the table would have
+        for(const char *cs = command + args_from - start; *cs; cs++) {
+            if(*cs >= 'A' && *cs <= 'Z' && *cs != 'T') num_args++;
+        }
+        return;
+    }
+
+    uint8_t num_words= 0;
+    for (uint8_t i = 0; i < n; ++i) {
+        const letter_t &l= found[i];
+        if(l.offset < start) continue;
+
+        uint32_t bit= 1 << (l.letter - 'A');
+        letters |= bit;
+        if(l.offset >= args_from && l.letter != 'T') num_args++;
+        if(!l.has_value || (valued & bit)) continue;
+
+        if(num_words == max_words) {
+            overflow= true;
+            continue;
+        }
+        // the words are kept in letter order
+        int pos= __builtin_popcount(valued & (bit - 1));
+        memmove(&words[pos + 1], &words[pos], (num_words - pos) * sizeof(word_t));
+        words[pos].value= l.value;
+        words[pos].offset= l.offset - start;
+        valued |= bit;
+        num_words++;
+    }
+}
+
 // Cache some of this command's properties, so we don't have to parse the string every time we want to look at them
 void Gcode::prepare_cached_values(bool strip)
 {
+    letter_t found[MAX_LETTERS];
+    uint8_t n= tokenize(found);
+    overflow= n > MAX_LETTERS;
+    if(!overflow) {
+        // the G and M code come from the table
+        make_words(found, n, 0, 0);
+    }
+
     char *p= nullptr;
     if( this->has_letter('G') ) {
         this->has_g = true;
@@ -198,29 +401,42 @@ void Gcode::prepare_cached_values(bool strip)
         }
     }
 
-    if(!strip) return;
-
-    // remove the Gxxx or Mxxx from string
-    if (p != nullptr) {
-        char *n= strdup(p); // create new string starting at end of the numeric value
-        free(command);
-        command= n;
+    size_t start= 0;
+    if(strip && p != nullptr) {
+        // remove the Gxxx or Mxxx from string
+        start= p - command;
+        memmove(command, p, strlen(p) + 1);
     }
+    make_words(found, n, start, strip ? start : 1);
 }
 
 // strip off X Y Z I J K parameters if G0/1/2/3
 void Gcode::strip_parameters()
 {
-    if(has_g && g < 4){
-        // strip the command of the XYZIJK parameters
-        string newcmd;
+    if(has_g && g < 4 && framed) {
+        // there is no text, the words are removed from the table
+        static const uint32_t stripped_letters= (1 << ('X' - 'A')) | (1 << ('Y' - 'A')) | (1 << ('Z' - 'A')) |
+                                                (1 << ('I' - 'A')) | (1 << ('J' - 'A')) | (1 << ('K' - 'A'));
+        uint8_t n= 0;
+        for (uint32_t bits = valued; bits != 0; bits &= bits - 1) {
+            uint32_t bit= bits & -bits;
+            if(!(bit & stripped_letters)) words[n++]= words[__builtin_popcount(valued & (bit - 1))];
+        }
+        valued &= ~stripped_letters;
+        letters &= ~stripped_letters;
+        num_args= __builtin_popcount(letters & ~(1 << ('T' - 'A')));
+
+    } else if(has_g && g < 4){
+        // strip the command of the XYZIJK parameters, the line only gets shorter so it is done in place
+        char *out= command;
         char *cn= command;
         // find the start of each parameter
         char *pch= strpbrk(cn, "XYZIJK");
         while (pch != nullptr) {
             if(pch > cn) {
                 // copy non parameters to new string
-                newcmd.append(cn, pch-cn);
+                memmove(out, cn, pch - cn);
+                out += pch - cn;
             }
             // find the end of the parameter and its value
             char *eos;
@@ -229,14 +445,10 @@ void Gcode::strip_parameters()
             pch= strpbrk(cn, "XYZIJK"); // find next parameter
         }
         // append anything left on the line
-        newcmd.append(cn);
+        memmove(out, cn, strlen(cn) + 1);
 
-        // strip whitespace to save even more, this causes problems so don't do it
-        //newcmd.erase(std::remove_if(newcmd.begin(), newcmd.end(), ::isspace), newcmd.end());
-
-        // release the old one
-        free(command);
-        // copy the new shortened one
-        command= strdup(newcmd.c_str());
+        letter_t found[MAX_LETTERS];
+        uint8_t n= tokenize(found);
+        make_words(found, n, 0, stripped ? 0 : 1);
     }
 }
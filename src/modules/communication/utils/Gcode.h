@@ -10,25 +10,38 @@
 #define GCODE_H
 #include <string>
 #include <map>
+#include <stdint.h>
+#include <stddef.h>
 
 using std::string;
 
 class StreamOutput;
 
 // Object to represent a Gcode command
+// The line is tokenized once when it is made, the letters A to Z on it and the value after the first one of each that
+// has a number are kept in a small table, so looking them up does not scan the line again
 class Gcode {
     public:
         Gcode(const string&, StreamOutput*, bool strip=true);
+        Gcode(const char *line, size_t len, StreamOutput*, bool strip=true);
+        Gcode(unsigned int g, uint32_t letters, const float *values, StreamOutput*);
         Gcode(const Gcode& to_copy);
         Gcode& operator= (const Gcode& to_copy);
         ~Gcode();
 
+        // the most letters a Gcode made from words can have
+        static const uint8_t max_words= 10;
+
+        // a Gcode is made and deleted for every line, they are kept in a few slots for reuse
+        static void *operator new(size_t size);
+        static void operator delete(void *p);
+
         const char* get_command() const { return command; }
         bool has_letter ( char letter ) const;
         float get_value ( char letter, char **ptr= nullptr ) const;
         int get_int ( char letter, char **ptr= nullptr ) const;
         uint32_t get_uint ( char letter, char **ptr= nullptr ) const;
-        int get_num_args() const;
+        int get_num_args() const { return num_args; }
         std::map<char,float> get_args() const;
         std::map<char,int> get_args_int() const;
         void strip_parameters();
@@ -44,13 +57,33 @@ class Gcode {
             bool stripped:1;
             bool is_error:1;
             uint8_t subcode:3;
+            bool framed:1; // made from words that came in a binary frame, there is no text
         };
 
         StreamOutput* stream;
         string txt_after_ok;
 
     private:
+        static const uint8_t line_size= 64; // lines shorter than this are kept in the Gcode, longer ones on the heap
+        struct letter_t;
+        struct word_t {
+            float value;
+            uint16_t offset; // of the letter in command
+        };
+
+        void set_command(const char *line, size_t len);
         void prepare_cached_values(bool strip=true);
+        uint8_t tokenize(letter_t found[]) const;
+        void make_words(const letter_t found[], uint8_t n, size_t start, size_t args_from);
+        bool in_table(char letter) const { return !overflow && letter >= 'A' && letter <= 'Z'; }
+        const word_t *find_word(char letter) const;
+
         char *command;
+        uint32_t letters; // bit set for each letter on the line
+        uint32_t valued; // bit set for each letter with a word, which is words[popcount of the bits below it]
+        word_t words[max_words];
+        uint8_t num_args;
+        bool overflow; // too many letters on the line to tokenize, they are looked up by scanning it
+        char buffer[line_size];
 };
 #endif
@@ -0,0 +1,91 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "GcodeFrame.h"
+#include "Gcode.h"
+
+#include <string.h>
+
+// opcode, letters, the values and the crc
+#define max_frame_size (1 + 4 + Gcode::max_words * 4 + 2)
+
+// the 6 bits a base64 character stands for, or -1
+static inline int base64_value(char c)
+{
+    if(c >= 'A' && c <= 'Z') return c - 'A';
+    if(c >= 'a' && c <= 'z') return c - 'a' + 26;
+    if(c >= '0' && c <= '9') return c - '0' + 52;
+    if(c == '+') return 62;
+    if(c == '/') return 63;
+    return -1;
+}
+
+// decodes base64 with or without padding, returns the number of bytes or -1 if it is not base64 or does not fit
+static int base64_decode(const char *in, size_t len, uint8_t *out, size_t size)
+{
+    while(len > 0 && in[len - 1] == '=') --len;
+    uint32_t bits= 0;
+    int nbits= 0;
+    size_t n= 0;
+    for (size_t i = 0; i < len; ++i) {
+        int v= base64_value(in[i]);
+        if(v < 0) return -1;
+        bits= (bits << 6) | v;
+        nbits += 6;
+        if(nbits >= 8) {
+            nbits -= 8;
+            if(n == size) return -1;
+            out[n++]= bits >> nbits;
+        }
+    }
+    return n;
+}
+
+uint16_t GcodeFrame::crc16(const uint8_t *buf, size_t len)
+{
+    uint16_t crc= 0xFFFF;
+    for (size_t i = 0; i < len; ++i) {
+        crc ^= (uint16_t)buf[i] << 8;
+        for (int b = 0; b < 8; ++b) {
+            crc= (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+        }
+    }
+    return crc;
+}
+
+Gcode *GcodeFrame::decode(const char *line, size_t len, StreamOutput *stream, const char **error)
+{
+    uint8_t frame[max_frame_size];
+    int n= base64_decode(line, len, frame, sizeof(frame));
+    if(n < 1 + 4 + 2) {
+        *error= "Bad frame, not base64 or the wrong size";
+        return nullptr;
+    }
+
+    uint16_t crc= frame[n - 2] | (frame[n - 1] << 8);
+    if(crc16(frame, n - 2) != crc) {
+        *error= "Bad frame, CRC does not match";
+        return nullptr;
+    }
+
+    uint8_t opcode= frame[0];
+    uint32_t letters;
+    memcpy(&letters, &frame[1], sizeof(letters)); // the frame is little endian like the LPC1769
+    int words= __builtin_popcount(letters);
+    if(opcode > 3) {
+        *error= "Bad frame, only G0 to G3 can be framed";
+        return nullptr;
+    }
+    if((letters >> 26) != 0 || (letters & (1 << ('G' - 'A'))) || words > Gcode::max_words || n != 1 + 4 + words * 4 + 2) {
+        *error= "Bad frame, the letters do not match the values";
+        return nullptr;
+    }
+
+    float values[Gcode::max_words];
+    memcpy(values, &frame[5], words * sizeof(float));
+    return new Gcode(opcode, letters, values, stream);
+}
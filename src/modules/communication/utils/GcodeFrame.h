@@ -0,0 +1,34 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+class Gcode;
+class StreamOutput;
+
+// Binary framed moves.
+// Once M881 S1 has been sent on a stream, a G0 to G3 can be sent on it as a frame instead of text, so the numbers do
+// not have to be parsed. A frame is, all little endian
+//   opcode   uint8    the G code, 0 to 3
+//   letters  uint32   bit n is set for letter 'A' + n, at most Gcode::max_words of them, no G
+//   values   float32  one for each letter, in letter order
+//   crc      uint16   CRC-16/CCITT (0x1021, starting at 0xFFFF) of everything before it
+// The consoles are line based and their receive interrupts act on some characters (? ^X ^Y and CR), so the frame is
+// base64 encoded and sent on a line of its own that starts with GCODE_FRAME_START. Anything else is still sent as text.
+// See stream-window.py --binary for an encoder.
+#define GCODE_FRAME_START '\x02'
+
+class GcodeFrame {
+    public:
+        // decodes the base64 after GCODE_FRAME_START into a new Gcode, or returns nullptr and sets error
+        static Gcode *decode(const char *line, size_t len, StreamOutput *stream, const char **error);
+
+        static uint16_t crc16(const uint8_t *buf, size_t len);
+};
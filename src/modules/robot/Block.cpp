@@ -10,6 +10,7 @@
 #include "libs/nuts_bolts.h"
 #include <cmath>
 #include <string>
+#include <string.h>
 #include "Block.h"
 #include "Planner.h"
 #include "Conveyor.h"
@@ -27,6 +28,7 @@ using std::string;
 
 uint8_t Block::n_actuators= 0;
 double Block::fp_scale= 0;
+float Block::s_curve_jerk= 0;
 
 // A block represents a movement, it's length for each stepper motor, and the corresponding acceleration curves.
 // It's stacked on a queue, and that queue is then executed in order, to move the motors.
@@ -35,7 +37,7 @@ double Block::fp_scale= 0;
 
 Block::Block()
 {
-    tick_info= nullptr;
+    path= nullptr;
     clear();
 }
 
@@ -43,6 +45,7 @@ void Block::init(uint8_t n)
 {
     n_actuators= n;
     fp_scale= (double)STEPTICKER_FPSCALE / pow((double)STEP_TICKER_FREQUENCY, 2.0); // we scale up by fixed point offset first to avoid tiny values
+    s_curve_jerk= THEKERNEL->planner->get_s_curve_jerk();
 }
 
 void Block::clear()
@@ -68,18 +71,37 @@ void Block::clear()
     is_ticking          = false;
     is_g123             = false;
     locked              = false;
+    follows_path        = false;
+    chords              = nullptr;
+    s_curve             = false;
+    is_shaped           = false;
     s_value             = 0.0F;
 
     total_move_ticks= 0;
-    if(tick_info == nullptr) {
-        // we create this once for this block
-        tick_info= new tickinfo_t[n_actuators]; //(tickinfo_t *)malloc(sizeof(tickinfo_t) * n_actuators);
-        if(tick_info == nullptr) {
-            // if we ran out of memory in AHB0 just stop here
-            __debugbreak();
-        }
-    }
+    acceleration_in_steps= 0.0F;
+    deceleration_in_steps= 0.0F;
+    active_motors= 0;
+    start_jerk= JERK_NONE;
+    // the conveyor gives the step buffer back once the block is cleared
+    phases= nullptr;
+    tick_info= nullptr;
+    jerk_info= nullptr;
+}
+
+// the phases, then the tick info of each motor, then its jerk info when the ramps are s-curves
+size_t Block::step_buffer_size()
+{
+    return sizeof(phase_t) * n_phases + (sizeof(tickinfo_t) + (s_curve_jerk > 0 ? sizeof(jerkinfo_t) : 0)) * n_actuators;
+}
 
+// the block is given a step buffer by the conveyor shortly before it is executed, the trapezoid is compiled into it then
+void Block::attach(void *step_buffer)
+{
+    this->locked= true;
+    phases= (phase_t *)step_buffer;
+    tick_info= (tickinfo_t *)(phases + n_phases);
+    jerk_info= s_curve_jerk > 0 ? (jerkinfo_t *)(tick_info + n_actuators) : nullptr;
+    for(int i = 0; i < n_phases; ++i) phases[i].tick= UINT32_MAX;
     for(int i = 0; i < n_actuators; ++i) {
         tick_info[i].steps_per_tick= 0;
         tick_info[i].counter= 0;
@@ -88,8 +110,9 @@ void Block::clear()
         tick_info[i].plateau_rate= 0;
         tick_info[i].steps_to_move= 0;
         tick_info[i].step_count= 0;
-        tick_info[i].next_accel_event= 0;
     }
+    prepare();
+    this->locked= false;
 }
 
 // Only used for continuous mode to reuse the same block over and over
@@ -210,9 +233,6 @@ void Block::calculate_trapezoid( float entryspeed, float exitspeed )
     float acceleration_time = acceleration_ticks / STEP_TICKER_FREQUENCY;  // This can be moved into the operation below, separated for clarity, note we need to do this instead of using time_to_accelerate(seconds) directly because time_to_accelerate(seconds) and acceleration_ticks(seconds) do not have the same value anymore due to the rounding
     float deceleration_time = deceleration_ticks / STEP_TICKER_FREQUENCY;
 
-    float acceleration_in_steps = (acceleration_time > 0.0F ) ? ( this->maximum_rate - initial_rate ) / acceleration_time : 0;
-    float deceleration_in_steps =  (deceleration_time > 0.0F ) ? ( this->maximum_rate - final_rate ) / deceleration_time : 0;
-
     // we have a potential race condition here as we could get interrupted anywhere in the middle of this call, we need to lock
     // the updates to the blocks to get around it
     this->locked= true;
@@ -227,8 +247,11 @@ void Block::calculate_trapezoid( float entryspeed, float exitspeed )
     this->initial_rate = initial_rate;
     this->exit_speed = exitspeed;
 
-    // prepare the block for stepticker
-    this->prepare(acceleration_in_steps, deceleration_in_steps);
+    this->acceleration_in_steps = (acceleration_time > 0.0F ) ? ( this->maximum_rate - initial_rate ) / acceleration_time : 0;
+    this->deceleration_in_steps =  (deceleration_time > 0.0F ) ? ( this->maximum_rate - final_rate ) / deceleration_time : 0;
+
+    // prepare the block for stepticker, a block without a step buffer yet is prepared when it gets one
+    if(this->tick_info != nullptr) this->prepare();
 
     this->locked= false;
 }
@@ -310,9 +333,9 @@ float Block::max_exit_speed()
     return min(max, nominal_speed);
 }
 
-// prepare block for the step ticker, called everytime the block changes
+// prepare block for the step ticker, called when it is given a step buffer and everytime the block changes after that
 // this is done during planning so does not delay tick generation and step ticker can simply grab the next block during the interrupt
-void Block::prepare(float acceleration_in_steps, float deceleration_in_steps)
+void Block::prepare()
 {
 
     float inv = 1.0F / this->steps_event_count;
@@ -322,40 +345,79 @@ void Block::prepare(float acceleration_in_steps, float deceleration_in_steps)
     // was....
     // float acceleration_per_tick = acceleration_in_steps / STEP_TICKER_FREQUENCY_2; // that is 100,000² too big for a float
     // float deceleration_per_tick = deceleration_in_steps / STEP_TICKER_FREQUENCY_2;
-    double acceleration_per_tick = acceleration_in_steps * fp_scale; // this is now scaled to fit a 2.30 fixed point number
+    double acceleration_per_tick = acceleration_in_steps * fp_scale; // this is now scaled to the step ticker fixed point
     double deceleration_per_tick = deceleration_in_steps * fp_scale;
 
+    // the jerk ramps take acceleration/jerk seconds, a ramp too short for both is split half up and half down
+    uint32_t accelerate_jerk_ticks= 0, decelerate_jerk_ticks= 0;
+    if(jerk_info != nullptr) {
+        uint32_t jerk_ticks= lroundf(this->acceleration / s_curve_jerk * STEP_TICKER_FREQUENCY);
+        accelerate_jerk_ticks= std::min(jerk_ticks, this->accelerate_until / 2);
+        decelerate_jerk_ticks= std::min(jerk_ticks, (this->total_move_ticks - this->decelerate_after) / 2);
+    }
+    s_curve= accelerate_jerk_ticks != 0 || decelerate_jerk_ticks != 0;
+    if(s_curve) {
+        prepare_s_curve(acceleration_per_tick, deceleration_per_tick, accelerate_jerk_ticks, decelerate_jerk_ticks);
+        return;
+    }
+
+    // figure out the phase the block starts in and when it changes, this is the same for all motors
+    double acceleration_change = 0;
+    #ifdef STEPTICKER_FP32
+    bool ramp_end_correction= false;
+    #endif
+    for(int i = 0; i < n_phases; ++i) phases[i].tick= UINT32_MAX;
+    start_jerk= JERK_NONE;
+    if(this->accelerate_until != 0) {
+        // start off accelerating, when that ends we either decelerate straight away, cruise at the plateau rate or just stop accelerating
+        acceleration_change = acceleration_per_tick;
+        bool has_decel= this->decelerate_after < this->total_move_ticks;
+        phases[0]= {this->accelerate_until, this->accelerate_until == this->decelerate_after, has_decel && this->accelerate_until != this->decelerate_after};
+        if(phases[0].plateau) {
+            phases[1]= {this->decelerate_after, true, false};
+        }
+        #ifdef STEPTICKER_FP32
+        // the 32 bit acceleration has more rounding error, which adds up over the ramp, so the rate is always corrected
+        // when acceleration ends. When there is no plateau it is corrected to the rate the 2.62 ramp would have reached
+        ramp_end_correction= !phases[0].plateau;
+        phases[0].plateau= true;
+        #endif
+
+    } else if(this->decelerate_after == 0) {
+        // we start off decelerating
+        acceleration_change = -deceleration_per_tick;
+
+    } else if(this->decelerate_after != this->total_move_ticks) {
+        // cruise then decelerate
+        phases[0]= {this->decelerate_after, true, false};
+    }
+
+    active_motors= 0;
     for (uint8_t m = 0; m < n_actuators; m++) {
-        uint32_t steps = this->steps[m];
+        // a block that follows a path only has the path axis to prepare, it is kept in tick_info[0]
+        uint32_t steps = follows_path ? (m == 0 ? this->steps_event_count : 0) : this->steps[m];
         this->tick_info[m].steps_to_move = steps;
         if(steps == 0) continue;
 
+        if(!follows_path) active_motors |= (1 << m);
+
         float aratio = inv * steps;
 
-        this->tick_info[m].steps_per_tick = (int64_t)round((((double)this->initial_rate * aratio) / STEP_TICKER_FREQUENCY) * STEPTICKER_FPSCALE); // steps/sec / tick frequency to get steps per tick in 2.62 fixed point
-        this->tick_info[m].counter = 0; // 2.62 fixed point
+        this->tick_info[m].steps_per_tick = (stepticker_fp_t)round((((double)this->initial_rate * aratio) / STEP_TICKER_FREQUENCY) * STEPTICKER_FPSCALE); // steps/sec / tick frequency to get steps per tick in fixed point
+        this->tick_info[m].counter = 0; // fixed point
         this->tick_info[m].step_count = 0;
-        this->tick_info[m].next_accel_event = this->total_move_ticks + 1;
-
-        double acceleration_change = 0;
-        if(this->accelerate_until != 0) { // If the next accel event is the end of accel
-            this->tick_info[m].next_accel_event = this->accelerate_until;
-            acceleration_change = acceleration_per_tick;
-
-        } else if(this->decelerate_after == 0 /*&& this->accelerate_until == 0*/) {
-            // we start off decelerating
-            acceleration_change = -deceleration_per_tick;
-
-        } else if(this->decelerate_after != this->total_move_ticks /*&& this->accelerate_until == 0*/) {
-            // If the next event is the start of decel ( don't set this if the next accel event is accel end )
-            this->tick_info[m].next_accel_event = this->decelerate_after;
-        }
 
         // already converted to fixed point just needs scaling by ratio
         //#define STEPTICKER_TOFP(x) ((int64_t)round((double)(x)*STEPTICKER_FPSCALE))
-        this->tick_info[m].acceleration_change= (int64_t)round(acceleration_change * aratio);
-        this->tick_info[m].deceleration_change= -(int64_t)round(deceleration_per_tick * aratio);
-        this->tick_info[m].plateau_rate= (int64_t)round(((this->maximum_rate * aratio) / STEP_TICKER_FREQUENCY) * STEPTICKER_FPSCALE);
+        this->tick_info[m].acceleration_change= (stepticker_fp_t)round(acceleration_change * aratio);
+        this->tick_info[m].deceleration_change= -(stepticker_fp_t)round(deceleration_per_tick * aratio);
+        this->tick_info[m].plateau_rate= (stepticker_fp_t)round(((this->maximum_rate * aratio) / STEP_TICKER_FREQUENCY) * STEPTICKER_FPSCALE);
+        #ifdef STEPTICKER_FP32
+        if(ramp_end_correction) {
+            // the step ticker adds the acceleration on the tick the phase changes as well
+            this->tick_info[m].plateau_rate= (stepticker_fp_t)round((((double)this->initial_rate * aratio) / STEP_TICKER_FREQUENCY) * STEPTICKER_FPSCALE + (this->accelerate_until + 1) * acceleration_change * aratio);
+        }
+        #endif
 
         #if 0
         THEKERNEL->streams->printf("spt: %08lX %08lX, ac: %08lX %08lX, dc: %08lX %08lX, pr: %08lX %08lX\n",
@@ -372,6 +434,133 @@ void Block::prepare(float acceleration_in_steps, float deceleration_in_steps)
     }
 }
 
+// compiles the ramps into s-curves, each ramp raises the acceleration at a constant jerk for the given ticks, holds it,
+// then lowers it again to zero by the end of the ramp. The acceleration held is the trapezoid acceleration scaled up by
+// ramp/(ramp - jerk ticks) so the rate changes by the same amount over the ramp, as the curve is symmetric the ramp
+// also covers the same distance. So the block takes the same time as the trapezoid and every junction speed the planner
+// worked out still holds, but the acceleration is now continuous and reaches up to twice the configured acceleration
+void Block::prepare_s_curve(double acceleration_per_tick, double deceleration_per_tick, uint32_t accelerate_jerk_ticks, uint32_t decelerate_jerk_ticks)
+{
+    uint32_t accelerate_ticks= this->accelerate_until;
+    uint32_t decelerate_ticks= this->total_move_ticks - this->decelerate_after;
+    double peak_acceleration= accelerate_ticks == 0 ? 0 : acceleration_per_tick * accelerate_ticks / (accelerate_ticks - accelerate_jerk_ticks);
+    double peak_deceleration= decelerate_ticks == 0 ? 0 : deceleration_per_tick * decelerate_ticks / (decelerate_ticks - decelerate_jerk_ticks);
+
+    // the phase ticks are strictly increasing as the jerk ticks are at most half the ramp
+    for(int i = 0; i < n_phases; ++i) phases[i].tick= UINT32_MAX;
+    uint8_t n= 0;
+    double acceleration_change= 0;
+    start_jerk= JERK_NONE;
+    if(accelerate_ticks != 0) {
+        if(accelerate_jerk_ticks == 0) {
+            acceleration_change= peak_acceleration;
+        } else {
+            start_jerk= JERK_ACCELERATE;
+            if(accelerate_ticks - accelerate_jerk_ticks > accelerate_jerk_ticks) {
+                phases[n++]= {accelerate_jerk_ticks, false, false, true, JERK_NONE};
+            }
+            phases[n++]= {accelerate_ticks - accelerate_jerk_ticks, false, false, true, JERK_ACCELERATE_END};
+        }
+        if(decelerate_ticks != 0 && this->decelerate_after == accelerate_ticks) {
+            // no plateau, start decelerating as soon as the plateau rate is reached
+            phases[n++]= {accelerate_ticks, decelerate_jerk_ticks == 0, true, false, (uint8_t)(decelerate_jerk_ticks == 0 ? JERK_NONE : JERK_DECELERATE)};
+        } else {
+            phases[n++]= {accelerate_ticks, false, true, false, JERK_NONE};
+        }
+    }
+
+    if(decelerate_ticks != 0) {
+        if(this->decelerate_after == 0) {
+            // we start off decelerating
+            if(decelerate_jerk_ticks == 0) acceleration_change= -peak_deceleration;
+            else start_jerk= JERK_DECELERATE;
+        } else if(accelerate_ticks == 0 || this->decelerate_after != accelerate_ticks) {
+            phases[n++]= {this->decelerate_after, decelerate_jerk_ticks == 0, false, false, (uint8_t)(decelerate_jerk_ticks == 0 ? JERK_NONE : JERK_DECELERATE)};
+        }
+        if(decelerate_jerk_ticks != 0) {
+            if(decelerate_ticks - decelerate_jerk_ticks > decelerate_jerk_ticks) {
+                phases[n++]= {this->decelerate_after + decelerate_jerk_ticks, true, false, false, JERK_NONE};
+            }
+            phases[n++]= {this->total_move_ticks - decelerate_jerk_ticks, true, false, false, JERK_DECELERATE_END};
+        }
+    }
+
+    float inv = 1.0F / this->steps_event_count;
+    active_motors= 0;
+    for (uint8_t m = 0; m < n_actuators; m++) {
+        uint32_t steps = follows_path ? (m == 0 ? this->steps_event_count : 0) : this->steps[m];
+        this->tick_info[m].steps_to_move = steps;
+        if(steps == 0) continue;
+
+        if(!follows_path) active_motors |= (1 << m);
+
+        double aratio = inv * steps;
+        Block::tickinfo_t &ti= this->tick_info[m];
+        Block::jerkinfo_t &ji= this->jerk_info[m];
+        ti.steps_per_tick = (stepticker_fp_t)round((((double)this->initial_rate * aratio) / STEP_TICKER_FREQUENCY) * STEPTICKER_FPSCALE);
+        ti.counter = 0;
+        ti.step_count = 0;
+        ti.acceleration_change= (stepticker_fp_t)round(acceleration_change * aratio);
+        ti.deceleration_change= -(stepticker_fp_t)round(peak_deceleration * aratio);
+        ti.plateau_rate= (stepticker_fp_t)round(((this->maximum_rate * aratio) / STEP_TICKER_FREQUENCY) * STEPTICKER_FPSCALE);
+        ji.peak_acceleration= (stepticker_fp_t)round(peak_acceleration * aratio);
+        ji.accelerate= accelerate_jerk_ticks == 0 ? 0 : (stepticker_fp_t)round(peak_acceleration * aratio / accelerate_jerk_ticks);
+        ji.decelerate= decelerate_jerk_ticks == 0 ? 0 : (stepticker_fp_t)round(peak_deceleration * aratio / decelerate_jerk_ticks);
+        ji.jerk= 0;
+    }
+}
+
+// position at fraction t along the path, the arc is found by rotating the radius vector at the start so there is no drift
+void Block::path_position(const path_t& path, float t, float pos[])
+{
+    if(t <= 0.0F) {
+        memcpy(pos, path.start, path.n_axis * sizeof(float));
+        return;
+    }
+    if(t >= 1.0F) {
+        memcpy(pos, path.end, path.n_axis * sizeof(float));
+        return;
+    }
+
+    for (int i = 0; i < path.n_axis; ++i) {
+        pos[i] = path.start[i] + (path.end[i] - path.start[i]) * t;
+    }
+    if(path.angle == 0) return; // a straight line
+
+    float r0 = path.start[path.plane[0]] - path.center[0];
+    float r1 = path.start[path.plane[1]] - path.center[1];
+    float cos_t = cosf(path.angle * t);
+    float sin_t = sinf(path.angle * t);
+    pos[path.plane[0]] = path.center[0] + r0 * cos_t - r1 * sin_t;
+    pos[path.plane[1]] = path.center[1] + r0 * sin_t + r1 * cos_t;
+}
+
+// unit vector of the primary axis direction at fraction t along the path, used for the junctions with the blocks either side
+void Block::path_direction(const path_t& path, float t, float dir[])
+{
+    for (int i = 0; i < N_PRIMARY_AXIS; ++i) {
+        dir[i] = path.end[i] - path.start[i];
+    }
+
+    if(path.angle != 0) {
+        float r0 = path.start[path.plane[0]] - path.center[0];
+        float r1 = path.start[path.plane[1]] - path.center[1];
+        float cos_t = cosf(path.angle * t);
+        float sin_t = sinf(path.angle * t);
+        dir[path.plane[0]] = (-r0 * sin_t - r1 * cos_t) * path.angle;
+        dir[path.plane[1]] = (r0 * cos_t - r1 * sin_t) * path.angle;
+    }
+
+    float sos = 0;
+    for (int i = 0; i < N_PRIMARY_AXIS; ++i) {
+        sos += dir[i] * dir[i];
+    }
+    float inv = sos > 0 ? 1.0F / sqrtf(sos) : 0;
+    for (int i = 0; i < N_PRIMARY_AXIS; ++i) {
+        dir[i] *= inv;
+    }
+}
+
 // returns current rate (steps/sec) for the given actuator
 float Block::get_trapezoid_rate(int i) const
 {
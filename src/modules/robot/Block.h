@@ -9,6 +9,7 @@
 
 #include <bitset>
 #include "ActuatorCoordinates.h"
+#include "StepTicker.h"
 
 class Block {
     public:
@@ -17,6 +18,7 @@ class Block {
         static void init(uint8_t);
 
         void calculate_trapezoid( float entry_speed, float exit_speed );
+        void prepare();
 
         float reverse_pass(float exit_speed);
         float forward_pass(float next_entry_speed);
@@ -28,11 +30,13 @@ class Block {
 
     private:
         float max_allowable_speed( float acceleration, float target_velocity, float distance);
-        void prepare(float acceleration_in_steps, float deceleration_in_steps);
+        void prepare_s_curve(double acceleration_per_tick, double deceleration_per_tick, uint32_t accelerate_jerk_ticks, uint32_t decelerate_jerk_ticks);
 
         static double fp_scale; // optimize to store this as it does not change
+        static float s_curve_jerk; // mm/s³, 0 for trapezoid ramps
 
     public:
+        // planner only, the step ticker never reads these
         std::array<uint32_t, k_max_actuators> steps; // Number of steps for each axis for this block
         uint32_t steps_event_count;  // Steps for the longest axis
         float nominal_rate;       // Nominal rate in steps per second
@@ -46,27 +50,95 @@ class Block {
 
         float max_entry_speed;
 
-        // this is tick info needed for this block. applies to all motors
+        // the trapezoid in ticks, and the ramps in steps/sec² the last calculate_trapezoid() found, prepare() compiles
+        // them for the step ticker once the block has a step buffer
         uint32_t accelerate_until;
         uint32_t decelerate_after;
         uint32_t total_move_ticks;
+        float acceleration_in_steps;
+        float deceleration_in_steps;
+
+        // read by the step ticker
         std::bitset<k_max_actuators> direction_bits;     // Direction for each axis in bit form, relative to the direction port's mask
 
         // this is the data needed to determine when each motor needs to be issued a step
+        // fixed point is 2.62 or 2.30 depending on STEPTICKER_FP32
         using tickinfo_t= struct {
-            int64_t steps_per_tick; // 2.62 fixed point
-            int64_t counter; // 2.62 fixed point
-            int64_t acceleration_change; // 2.62 fixed point signed
-            int64_t deceleration_change; // 2.62 fixed point
-            int64_t plateau_rate; // 2.62 fixed point
+            stepticker_fp_t steps_per_tick; // fixed point
+            stepticker_fp_t counter; // fixed point
+            stepticker_fp_t acceleration_change; // fixed point signed
+            stepticker_fp_t deceleration_change; // fixed point
+            stepticker_fp_t plateau_rate; // fixed point
             uint32_t steps_to_move;
             uint32_t step_count;
-            uint32_t next_accel_event;
         };
         void reset(tickinfo_t *saved);
 
-        // need info for each active motor
+        // with a jerk limit each ramp is an s-curve, it takes the same ticks and covers the same distance as the
+        // trapezoid ramp the planner worked out, but the acceleration ramps up and down at a constant jerk instead of
+        // jumping to its full value. Only in the step buffer when s_curve_jerk is set
+        using jerkinfo_t= struct {
+            stepticker_fp_t jerk;               // fixed point signed, added to acceleration_change every tick
+            stepticker_fp_t accelerate;         // fixed point, jerk of the acceleration ramp
+            stepticker_fp_t decelerate;         // fixed point, jerk of the deceleration ramp
+            stepticker_fp_t peak_acceleration;  // fixed point, acceleration held in the middle of the acceleration ramp
+        };
+        enum jerk_t : uint8_t { JERK_NONE, JERK_ACCELERATE, JERK_ACCELERATE_END, JERK_DECELERATE, JERK_DECELERATE_END };
+
+        // prepare() compiles the trapezoid into phases, the block starts in the phase setup in tick_info (accelerate, cruise or decelerate)
+        // and then changes phase on the given ticks. A phase change does the same thing to every active motor so the
+        // step ticker only has to check for it once per tick. A trapezoid needs two phases, an s-curve up to six
+        using phase_t= struct {
+            uint32_t tick;              // tick the phase starts on, UINT32_MAX if this phase is not used
+            bool decelerate:1;          // acceleration_change becomes deceleration_change, otherwise it becomes zero
+            bool plateau:1;             // steps_per_tick is set to the plateau rate
+            bool accelerate:1;          // s-curve, acceleration_change becomes the peak acceleration
+            uint8_t jerk:3;             // s-curve, the jerk_t applied from this phase on
+        };
+        static const int n_phases= 6;
+
+        // the phases, the tick info of each motor and with s-curves its jerk info are only needed once the block is
+        // about to be executed. They are kept together in a step buffer the conveyor gives the block, only as many blocks
+        // as there are step buffers have one, so the rest of the queue only takes the planner's share of the memory.
+        // These are null until the block has a step buffer
+        phase_t *phases;
         tickinfo_t *tick_info;
+        jerkinfo_t *jerk_info;
+        static size_t step_buffer_size();
+        void attach(void *step_buffer);
+
+        uint8_t start_jerk;             // s-curve, the jerk_t the block starts with
+        uint8_t active_motors;          // bit set for each motor that has steps to move in this block
+
+        // a block that follows an arc, or a line that has to be segmented for the arm solution, is planned as one move
+        // along it, see Robot::append_arc() and Robot::append_line(). The step ticker steps a path axis with the speed
+        // profile of the block in tick_info[0], and each motor follows it along a series of short straight chords in
+        // actuator space. The conveyor cuts the path into chords just before it is needed
+        using path_t= struct {
+            float start[k_max_actuators];   // machine position at the start and end of the block
+            float end[k_max_actuators];
+            float center[2];                // arc center in the plane
+            float radius;
+            float angle;                    // angle the arc turns through in radians, positive is counter clockwise, 0 for a line
+            uint8_t plane[3];               // the two plane axis and the linear axis
+            uint8_t n_axis;
+            uint8_t n_chords;
+        };
+        static void path_position(const path_t& path, float t, float pos[]);
+        static void path_direction(const path_t& path, float t, float dir[]);
+
+        using chord_t= struct {
+            uint32_t path_steps;            // path axis steps this chord takes
+            uint32_t steps[k_max_actuators];
+            uint8_t motors;                 // bit set for each motor that has steps in this chord
+            uint8_t direction_bits;
+        };
+        static const uint8_t max_chords= 32;
+
+        uint32_t shaper_start;              // input shaper tick the first impulse started the block on, see StepTicker::shaper_tick()
+
+        path_t *path;                       // allocated the first time the block follows a path, valid when follows_path is set
+        chord_t * volatile chords;          // set by the conveyor once the path is cut into chords
 
         static uint8_t n_actuators;
 
@@ -78,6 +150,9 @@ class Block {
             bool is_g123:1;                      // set if this is a G1, G2 or G3
             volatile bool is_ticking:1;          // set when this block is being actively ticked by the stepticker
             volatile bool locked:1;              // set to true when the critical data is being updated, stepticker will have to skip if this is set
+            bool follows_path:1;                 // set if this block follows the path in path instead of a straight line
+            bool s_curve:1;                      // set if the ramps are s-curves and jerk_info is used
+            bool is_shaped:1;                    // set if the motion is convolved with the input shaper
             uint16_t s_value:12;                 // for laser 1.11 Fixed point
         };
 };
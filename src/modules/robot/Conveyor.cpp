@@ -22,6 +22,8 @@
 #include "StepTicker.h"
 #include "Robot.h"
 #include "StepperMotor.h"
+#include "Scheduler.h"
+#include "Profiler.h"
 
 #include <functional>
 
@@ -29,6 +31,7 @@
 
 #define planner_queue_size_checksum CHECKSUM("planner_queue_size")
 #define queue_delay_time_ms_checksum CHECKSUM("queue_delay_time_ms")
+#define planner_step_buffers_checksum CHECKSUM("planner_step_buffers")
 
 /*
  * The conveyor holds the queue of blocks, takes care of creating them, and starting the executing chain of blocks
@@ -65,24 +68,49 @@ Conveyor::Conveyor()
     flush= false;
     continuous_mode = false;
     hold_queue= false;
+    for (auto &b : chord_buffers) b= nullptr;
+    chord_buffers_used= 0;
+    cut_i= 0;
+    step_buffers= nullptr;
+    n_step_buffers= 0;
+    step_buffers_used= 0;
+    next_step_buffer= 0;
+    prepare_i= 0;
+    idle_expected= true;
+    started_alone= false;
+    depth_time= 0;
+    memset(&stats, 0, sizeof(stats));
 }
 
 void Conveyor::on_module_loaded()
 {
-    register_for_event(ON_IDLE);
+    THEKERNEL->scheduler->add_task("conveyor", this, &Module::on_idle, Scheduler::IDLE);
     register_for_event(ON_HALT);
 
     // Attach to the end_of_move stepper event
     //THEKERNEL->step_ticker->finished_fnc = std::bind( &Conveyor::all_moves_finished, this);
     queue_size = THEKERNEL->config->value(planner_queue_size_checksum)->by_default(32)->as_number();
     queue_delay_time_ms = THEKERNEL->config->value(queue_delay_time_ms_checksum)->by_default(100)->as_number();
+    // by default every block can be ready for the step ticker, with fewer the queue can be made deeper in the same memory
+    n_step_buffers = THEKERNEL->config->value(planner_step_buffers_checksum)->by_default((int)queue_size)->as_number();
+    if(n_step_buffers > queue_size) n_step_buffers= queue_size;
+    // the block being executed and enough after it that the step ticker does not wait for one between short blocks
+    if(n_step_buffers < min_step_buffers) n_step_buffers= min_step_buffers;
 }
 
 // we allocate the queue here after config is completed so we do not run out of memory during config
 void Conveyor::start(uint8_t n)
 {
-    Block::init(n); // set the number of motors which determines how big the tick info vector is
+    Block::init(n); // set the number of motors which determines how big the step buffers are
     queue.resize(queue_size);
+    // the input shaper starts the blocks within its duration ahead of the one being executed, with short segments that
+    // can be most of the queue and it would have to wait for a step buffer, so when it is set up every block gets one
+    if(THEKERNEL->step_ticker->is_shaping() && n_step_buffers < queue_size) {
+        THEKERNEL->streams->printf("WARNING: planner_step_buffers ignored, the input shaper needs a step buffer for every block\n");
+        n_step_buffers= queue_size;
+    }
+    step_buffers= new uint8_t[Block::step_buffer_size() * n_step_buffers];
+    if(step_buffers == nullptr) __debugbreak();
     running = true;
 }
 
@@ -93,6 +121,7 @@ void Conveyor::on_halt(void* argument)
         flush_queue();
         hold_queue= false;
         continuous_mode= false;
+        idle_expected= true;
     }
 }
 
@@ -110,10 +139,123 @@ void Conveyor::on_idle(void*)
             // Cleanly delete block
             Block* block = queue.tail_ref();
             //block->debug();
+            if(block->chords != nullptr) {
+                for (int i = 0; i < n_chord_buffers; ++i) {
+                    if(chord_buffers[i] == block->chords) chord_buffers_used &= ~(1 << i);
+                }
+            }
+            if(block->tick_info != nullptr) --step_buffers_used;
             block->clear();
+            if(cut_i == queue.tail_i) cut_i= queue.next(cut_i);
+            if(prepare_i == queue.tail_i) prepare_i= queue.next(prepare_i);
             queue.consume_tail();
         }
     }
+
+    prepare_blocks();
+    cut_paths();
+    sample_depth();
+}
+
+// the queue depth is sampled every 10ms while there are blocks queued, each sample weighted by the time since the last
+void Conveyor::sample_depth()
+{
+    uint32_t now= us_ticker_read();
+    uint32_t dt= now - depth_time;
+    if(dt < 10000) return;
+    depth_time= now;
+    if(queue.is_empty()) return;
+
+    unsigned int blocks;
+    float mm;
+    get_queue_depth(blocks, mm);
+    stats.queued_us += dt;
+    stats.blocks_us += (uint64_t)blocks * dt;
+    stats.um_us += (uint64_t)(mm * 1000) * dt;
+}
+
+void Conveyor::reset_stats()
+{
+    // forced_decels is counted in the step ticker ISR
+    __disable_irq();
+    memset(&stats, 0, sizeof(stats));
+    __enable_irq();
+}
+
+// give the blocks about to be executed a step buffer, in queue order while there are free step buffers
+void Conveyor::prepare_blocks()
+{
+    while (prepare_i != queue.head_i) {
+        if(step_buffers_used == n_step_buffers) return; // try again when the step ticker is done with a block
+
+        queue.item_ref(prepare_i)->attach(step_buffers + Block::step_buffer_size() * next_step_buffer);
+        if(++next_step_buffer == n_step_buffers) next_step_buffer= 0;
+        ++step_buffers_used;
+        prepare_i= queue.next(prepare_i);
+    }
+}
+
+// cut the paths of the blocks about to be executed into chords, in queue order while there are free chord buffers
+void Conveyor::cut_paths()
+{
+    while (cut_i != queue.head_i) {
+        Block *block = queue.item_ref(cut_i);
+        if(block->follows_path && block->chords == nullptr) {
+            int i = 0;
+            while (i < n_chord_buffers && (chord_buffers_used & (1 << i))) ++i;
+            if(i == n_chord_buffers) return; // try again when the block being executed is done with its buffer
+
+            if(chord_buffers[i] == nullptr) {
+                chord_buffers[i]= new Block::chord_t[Block::max_chords];
+                if(chord_buffers[i] == nullptr) __debugbreak();
+            }
+            chord_buffers_used |= (1 << i);
+            cut_path(block, chord_buffers[i]);
+        }
+        cut_i= queue.next(cut_i);
+    }
+}
+
+// the path is divided into chords of equal length, each one ends on the actuator step position of a point on the path
+// and gets its share of the path axis steps, or more if a motor has more steps than that in the chord
+void Conveyor::cut_path(Block *block, Block::chord_t *chords)
+{
+    const Block::path_t &path = *block->path;
+    uint8_t n_motors = THEROBOT->get_number_registered_motors();
+    int32_t start[n_motors], last[n_motors], next[n_motors];
+
+    THEROBOT->get_path_steps(path, 0, start);
+    memcpy(last, start, sizeof(last));
+    uint32_t last_path_step = 0;
+    for (int c = 0; c < path.n_chords; ++c) {
+        Block::chord_t &chord = chords[c];
+        if(c == path.n_chords - 1) {
+            // the last chord always ends where the planner has the block ending
+            for (int m = 0; m < n_motors; ++m) {
+                next[m] = start[m] + (block->direction_bits[m] ? -(int32_t)block->steps[m] : (int32_t)block->steps[m]);
+            }
+        } else {
+            THEROBOT->get_path_steps(path, (float)(c + 1) / path.n_chords, next);
+        }
+
+        uint32_t path_step = ((uint64_t)block->steps_event_count * (c + 1)) / path.n_chords;
+        chord.path_steps = std::max(path_step - last_path_step, (uint32_t)1);
+        last_path_step = path_step;
+
+        chord.motors = 0;
+        chord.direction_bits = 0;
+        for (int m = 0; m < n_motors; ++m) {
+            int32_t d = next[m] - last[m];
+            chord.steps[m] = labs(d);
+            if(d == 0) continue;
+            chord.motors |= (1 << m);
+            if(d < 0) chord.direction_bits |= (1 << m);
+            if(chord.steps[m] > chord.path_steps) chord.path_steps = chord.steps[m];
+        }
+        memcpy(last, next, sizeof(last));
+    }
+
+    block->chords = chords;
 }
 
 // see if we are idle
@@ -150,6 +292,7 @@ void Conveyor::wait_for_idle(bool wait_for_motors)
     }
 
     running = true;
+    expect_idle();
     // returning now means that everything has totally finished
 }
 
@@ -159,9 +302,12 @@ void Conveyor::wait_for_idle(bool wait_for_motors)
 void Conveyor::queue_head_block()
 {
     // upstream caller will block on this until there is room in the queue
-    while (queue.is_full() && !THEKERNEL->is_halted()) {
-        //check_queue();
-        THEKERNEL->call_event(ON_IDLE, this); // will call check_queue();
+    {
+        PROFILE_WAIT();
+        while (queue.is_full() && !THEKERNEL->is_halted()) {
+            //check_queue();
+            THEKERNEL->call_event(ON_IDLE, this); // will call check_queue();
+        }
     }
 
     if(THEKERNEL->is_halted()) {
@@ -172,6 +318,7 @@ void Conveyor::queue_head_block()
     }
 
     queue.produce_head();
+    prepare_blocks();
 
     // not sure if this is the correct place but we need to turn on the motors if they were not already on
     THEKERNEL->call_event(ON_ENABLE, (void*)1); // turn all enable pins on
@@ -181,6 +328,7 @@ void Conveyor::queue_head_block()
 
 void Conveyor::check_queue(bool force)
 {
+    PROFILE_SCOPE(CHECK_QUEUE);
     static uint32_t last_time_check = us_ticker_read();
 
     if(queue.is_empty()) {
@@ -192,7 +340,10 @@ void Conveyor::check_queue(bool force)
     // if we have been waiting for more than the required waiting time and the queue is not empty, or the queue is full, then allow stepticker to get the tail
     // we do this to allow an idle system to pre load the queue a bit so the first few blocks run smoothly.
     if(force || queue.is_full() || (us_ticker_read() - last_time_check) >= (queue_delay_time_ms * 1000)) {
-        last_time_check = us_ticker_read(); // reset timeout
+        uint32_t now= us_ticker_read();
+        // how long the first block after the queue ran dry was held back
+        if(!allow_fetch && !flush && now - last_time_check > stats.max_fetch_delay_us) stats.max_fetch_delay_us= now - last_time_check;
+        last_time_check = now; // reset timeout
         if(!flush) allow_fetch = true;
         return;
     }
@@ -206,6 +357,7 @@ bool Conveyor::set_continuous_mode(bool f)
         // copy the tickinfo of the second block on the queue
         auto n_actuators= THEROBOT->get_number_registered_motors();
         Block* b= queue.item_ref(queue.next(queue.tail_i));
+        if(b->tick_info == nullptr) return false;
         Block::tickinfo_t *saved= new Block::tickinfo_t[n_actuators];
         if(saved == nullptr) return false;
         for(int i = 0; i < n_actuators; ++i) {
@@ -263,10 +415,15 @@ bool Conveyor::get_next_block(Block **block)
     if(!allow_fetch) return false;
 
     Block *b= queue.item_ref(queue.isr_tail_i);
-    // we cannot use this now if it is being updated
-    if(!b->locked) {
+    // we cannot use this now if it is being updated, if it has no step buffer yet, or if its path has not been cut into chords yet
+    if(!b->locked && b->tick_info != nullptr && (!b->follows_path || b->chords != nullptr)) {
         if(!b->is_ready) __debugbreak(); // should never happen
 
+        // a block started with nothing after it was planned to decelerate to a stop, which it can not be replanned out
+        // of once it is ticking. If more blocks came that was a stop the job did not ask for
+        if(started_alone && !idle_expected) ++stats.forced_decels;
+        started_alone= queue.next(queue.isr_tail_i) == queue.head_i;
+
         b->is_ticking= true;
         b->recalculate_flag= false;
         this->current_feedrate= b->nominal_speed;
@@ -277,6 +434,22 @@ bool Conveyor::get_next_block(Block **block)
     return false;
 }
 
+// called from step ticker ISR by the input shaper, it starts shaped blocks before get_next_block() returns them
+// i is the queue index of the block it wants, it has to be ready and not be the one being executed
+bool Conveyor::get_block_ahead(unsigned int i, Block **block)
+{
+    if(hold_queue || flush || !allow_fetch || continuous_mode != 0 || THEKERNEL->is_halted() || i == queue.head_i) return false;
+
+    Block *b= queue.item_ref(i);
+    if(b->locked || b->tick_info == nullptr || !b->is_shaped) return false;
+    if(!b->is_ready) __debugbreak(); // should never happen
+
+    b->is_ticking= true;
+    b->recalculate_flag= false;
+    *block= b;
+    return true;
+}
+
 // called from step ticker ISR when block is finished, do not do anything slow here
 // if in continuous mode we keep feeding the same block
 void Conveyor::block_finished()
@@ -303,6 +476,17 @@ void Conveyor::flush_queue()
     // TODO force deceleration of last block
 }
 
+// how much is queued that the step ticker has not finished with yet, which is how far ahead the planner can see
+void Conveyor::get_queue_depth(unsigned int &blocks, float &mm)
+{
+    blocks= 0;
+    mm= 0;
+    for (unsigned int i = queue.isr_tail_i; i != queue.head_i; i = queue.next(i)) {
+        ++blocks;
+        mm += queue.item_ref(i)->millimeters;
+    }
+}
+
 // Debug function
 void Conveyor::dump_queue()
 {
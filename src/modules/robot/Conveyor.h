@@ -9,8 +9,7 @@
 
 #include "libs/Module.h"
 #include "BlockQueue.h"
-
-class Block;
+#include "Block.h"
 
 class Conveyor : public Module
 {
@@ -31,6 +30,17 @@ public:
     bool get_next_block(Block **block);
     void block_finished();
 
+    // the input shaper starts blocks ahead of the one being executed, these take a queue index
+    const Block *peek_next_block() { return queue.isr_tail_i == queue.head_i ? nullptr : queue.item_ref(queue.isr_tail_i); }
+    bool get_block_ahead(unsigned int i, Block **block);
+    Block *block_at(unsigned int i) { return queue.item_ref(i); }
+    unsigned int next_index(unsigned int i) const { return queue.next(i); }
+    unsigned int get_isr_tail() const { return queue.isr_tail_i; }
+    bool is_flushing() const { return flush; }
+
+    void get_queue_depth(unsigned int &blocks, float &mm);
+    size_t get_queue_size() const { return queue_size; }
+    size_t get_step_buffers() const { return n_step_buffers; }
     void dump_queue(void);
     void flush_queue(void);
     float get_current_feedrate() const { return current_feedrate; }
@@ -38,16 +48,56 @@ public:
     bool set_continuous_mode(bool f);
     void set_hold(bool f) { hold_queue= f; }
 
+    // how well the queue kept the step ticker fed since the last reset_stats(), see M461
+    using stats_t= struct {
+        uint32_t forced_decels;     // blocks that had nothing after them when they started so decelerated to a stop, and more followed
+        uint32_t max_fetch_delay_us; // longest the first block was held back after the queue had run dry, see check_queue()
+        uint64_t queued_us;         // time with blocks in the queue, the depths below are weighted by it
+        uint64_t blocks_us;
+        uint64_t um_us;
+    };
+    const stats_t& get_stats() const { return stats; }
+    void reset_stats();
+    // the queue is going to run dry, because everything has to finish or the job has ended, so the step ticker
+    // stopping is not an underrun. The step ticker takes it when it starts again
+    void expect_idle() { idle_expected= true; }
+    bool take_idle_expected() { bool e= idle_expected; idle_expected= false; return e; }
+
     friend class Planner; // for queue
 
 private:
     void check_queue(bool force= false);
     void queue_head_block(void);
+    void cut_paths(void);
+    void cut_path(Block *block, Block::chord_t *chords);
+    void prepare_blocks(void);
+    void sample_depth(void);
 
     using  Queue_t= BlockQueue;
     Queue_t queue;  // Queue of Blocks
     void *saved_block;
 
+    // blocks that follow a path are cut into chords just before they are executed, there are only enough chord
+    // buffers for the block being executed and the next few
+    static const int n_chord_buffers= 3;
+    Block::chord_t *chord_buffers[n_chord_buffers];
+    uint8_t chord_buffers_used; // bit set for each buffer in use
+    unsigned int cut_i; // the next block in the queue to look at for a path to cut
+
+    // only the blocks about to be executed have a step buffer for the step ticker, see Block::attach(). They are given
+    // out in queue order and come back in the same order as blocks are cleared, so they are used as a ring
+    static const size_t min_step_buffers= 4;
+    uint8_t *step_buffers;
+    size_t n_step_buffers;
+    size_t step_buffers_used;
+    size_t next_step_buffer;
+    unsigned int prepare_i; // the next block in the queue to give a step buffer to
+
+    stats_t stats;
+    uint32_t depth_time; // us when the depth was last sampled
+    volatile bool idle_expected;
+    bool started_alone; // the last block given to the step ticker was the only one in the queue
+
     uint32_t queue_delay_time_ms;
     size_t queue_size;
     float current_feedrate{0}; // actual nominal feedrate that current block is running at in mm/sec
@@ -0,0 +1,70 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "InputShaper.h"
+
+#include <math.h>
+
+// K is how much the oscillation decays in half a damped period, td is the damped period
+uint8_t InputShaper::impulses(TYPE type, float frequency, float damping, float amplitude[], float delay[])
+{
+    if(type == NONE || frequency <= 0 || damping < 0 || damping >= 1) return 0;
+
+    float df = sqrtf(1.0F - damping * damping);
+    float td = 1.0F / (frequency * df);
+    uint8_t n = 0;
+    switch(type) {
+        case ZV: {
+            float k = expf(-damping * (float)M_PI / df);
+            amplitude[0] = 1;           delay[0] = 0;
+            amplitude[1] = k;           delay[1] = 0.5F * td;
+            n = 2;
+            break;
+        }
+        case ZVD: {
+            float k = expf(-damping * (float)M_PI / df);
+            amplitude[0] = 1;           delay[0] = 0;
+            amplitude[1] = 2 * k;       delay[1] = 0.5F * td;
+            amplitude[2] = k * k;       delay[2] = td;
+            n = 3;
+            break;
+        }
+        case MZV: {
+            float k = expf(-0.75F * damping * (float)M_PI / df);
+            float a1 = 1.0F - 1.0F / sqrtf(2.0F);
+            amplitude[0] = a1;                          delay[0] = 0;
+            amplitude[1] = (sqrtf(2.0F) - 1.0F) * k;    delay[1] = 0.375F * td;
+            amplitude[2] = a1 * k * k;                  delay[2] = 0.75F * td;
+            n = 3;
+            break;
+        }
+        default: return 0;
+    }
+
+    float sum = 0;
+    for (int i = 0; i < n; ++i) sum += amplitude[i];
+    for (int i = 0; i < n; ++i) amplitude[i] /= sum;
+    return n;
+}
+
+const char *InputShaper::name(TYPE type)
+{
+    switch(type) {
+        case ZV: return "zv";
+        case ZVD: return "zvd";
+        case MZV: return "mzv";
+        default: return "none";
+    }
+}
+
+InputShaper::TYPE InputShaper::from_name(const std::string& name)
+{
+    if(name == "zv") return ZV;
+    if(name == "zvd") return ZVD;
+    if(name == "mzv") return MZV;
+    return NONE;
+}
@@ -0,0 +1,24 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <string>
+
+// The impulse trains of the input shapers, the motion is convolved with them by the step ticker so the resonance at
+// the given frequency and damping ratio is cancelled out
+class InputShaper {
+    public:
+        enum TYPE { NONE, ZV, ZVD, MZV };
+        static const uint8_t max_impulses= 3;
+
+        // fills in the amplitude, they add up to 1, and the delay in seconds of each impulse and returns how many there are
+        static uint8_t impulses(TYPE type, float frequency, float damping, float amplitude[], float delay[]);
+        static const char *name(TYPE type);
+        static TYPE from_name(const std::string& name);
+};
@@ -8,6 +8,7 @@
 using namespace std;
 
 #include "mri.h"
+#include "cmsis.h"
 #include "nuts_bolts.h"
 #include "RingBuffer.h"
 #include "Gcode.h"
@@ -15,6 +16,7 @@ using namespace std;
 #include "Kernel.h"
 #include "Block.h"
 #include "Planner.h"
+#include "Profiler.h"
 #include "Conveyor.h"
 #include "StepperMotor.h"
 #include "Config.h"
@@ -28,6 +30,9 @@ using namespace std;
 #define junction_deviation_checksum    CHECKSUM("junction_deviation")
 #define z_junction_deviation_checksum  CHECKSUM("z_junction_deviation")
 #define minimum_planner_speed_checksum CHECKSUM("minimum_planner_speed")
+#define segment_merge_tolerance_checksum CHECKSUM("segment_merge_tolerance")
+#define segment_merge_max_angle_checksum CHECKSUM("segment_merge_max_angle")
+#define s_curve_jerk_checksum          CHECKSUM("s_curve_jerk")
 
 // The Planner does the acceleration math for the queue of Blocks ( movements ).
 // It makes sure the speed stays within the configured constraints ( acceleration, junction_deviation, etc )
@@ -36,6 +41,9 @@ using namespace std;
 Planner::Planner()
 {
     memset(this->previous_unit_vec, 0, sizeof this->previous_unit_vec);
+    memset(&this->stats, 0, sizeof this->stats);
+    this->planned_i= 0;
+    this->can_merge= false;
     config_load();
 }
 
@@ -45,48 +53,71 @@ void Planner::config_load()
     this->junction_deviation = THEKERNEL->config->value(junction_deviation_checksum)->by_default(0.05F)->as_number();
     this->z_junction_deviation = THEKERNEL->config->value(z_junction_deviation_checksum)->by_default(NAN)->as_number(); // disabled by default
     this->minimum_planner_speed = THEKERNEL->config->value(minimum_planner_speed_checksum)->by_default(0.0f)->as_number();
+    this->merge_tolerance = THEKERNEL->config->value(segment_merge_tolerance_checksum)->by_default(0.0f)->as_number(); // disabled by default
+    this->merge_cos_angle = cosf(THEKERNEL->config->value(segment_merge_max_angle_checksum)->by_default(5.0f)->as_number() * 0.0174532925F); // degrees to radians
+    #ifdef STEPTICKER_FP32
+    // the jerk per tick is far below the resolution of the 2.30 fixed point, s-curves need the 2.62 step ticker
+    this->s_curve_jerk = 0;
+    #else
+    this->s_curve_jerk = THEKERNEL->config->value(s_curve_jerk_checksum)->by_default(0.0f)->as_number(); // disabled by default
+    #endif
 }
 
 
 // Append a block to the queue, compute it's speed factors
-bool Planner::append_block( ActuatorCoordinates &actuator_pos, uint8_t n_motors, float rate_mm_s, float distance, float *unit_vec, float acceleration, float s_value, bool g123)
+// when path is set the block follows it instead of a straight line, unit_vec is then the direction it starts in
+bool Planner::append_block( ActuatorCoordinates &actuator_pos, uint8_t n_motors, float rate_mm_s, float distance, float *unit_vec, float acceleration, float s_value, bool g123, bool shaped, const Block::path_t *path)
 {
+    PROFILE_SCOPE(APPEND_BLOCK);
+
     // Create ( recycle ) a new block
     Block* block = THECONVEYOR->queue.head_ref();
 
-    // Direction bits
+    int32_t steps[n_motors];
     bool has_steps = false;
     for (size_t i = 0; i < n_motors; i++) {
-        int32_t steps = THEROBOT->actuators[i]->steps_to_target(actuator_pos[i]);
-        // Update current position
-        if(steps != 0) {
-            THEROBOT->actuators[i]->update_last_milestones(actuator_pos[i], steps);
-            has_steps = true;
-        }
-
-        // find direction
-        block->direction_bits[i] = (steps < 0) ? 1 : 0;
-        // save actual steps in block
-        block->steps[i] = labs(steps);
+        steps[i] = THEROBOT->actuators[i]->steps_to_target(actuator_pos[i]);
+        if(steps[i] != 0) has_steps = true;
     }
 
     // sometimes even though there is a detectable movement it turns out there are no steps to be had from such a small move
-    if(!has_steps) {
-        block->clear();
+    // a full circle ends where it started but still has to be stepped
+    if(!has_steps && path == nullptr) {
         // we still return true so the tiny move will still be accumulated and eventually create steps
         return true;
     }
 
+    // Update current position
+    for (size_t i = 0; i < n_motors; i++) {
+        if(steps[i] != 0) {
+            THEROBOT->actuators[i]->update_last_milestones(actuator_pos[i], steps[i]);
+        }
+    }
+
+    // see if this is close enough to a straight continuation of the last block to just extend that block
+    if(path == nullptr && merge_segment(steps, n_motors, rate_mm_s, distance, unit_vec, acceleration, s_value, g123, shaped)) {
+        ++stats.merged;
+        return true;
+    }
+
+    for (size_t i = 0; i < n_motors; i++) {
+        // find direction
+        block->direction_bits[i] = (steps[i] < 0) ? 1 : 0;
+        // save actual steps in block
+        block->steps[i] = labs(steps[i]);
+    }
+
     // info needed by laser
     block->s_value = roundf(s_value*(1<<11)); // 1.11 fixed point
     block->is_g123 = g123;
+    block->is_shaped = shaped;
 
     // use default JD
     float junction_deviation = this->junction_deviation;
 
     // use either regular junction deviation or z specific and see if a primary axis move
     block->primary_axis = true;
-    if(block->steps[ALPHA_STEPPER] == 0 && block->steps[BETA_STEPPER] == 0) {
+    if(path == nullptr && block->steps[ALPHA_STEPPER] == 0 && block->steps[BETA_STEPPER] == 0) {
         if(block->steps[GAMMA_STEPPER] != 0) {
             // z only move
             if(!isnan(this->z_junction_deviation)) junction_deviation = this->z_junction_deviation;
@@ -108,9 +139,22 @@ bool Planner::append_block( ActuatorCoordinates &actuator_pos, uint8_t n_motors,
 
     block->acceleration = acceleration; // save in block
 
-    // Max number of steps, for all axes
-    auto mi = std::max_element(block->steps.begin(), block->steps.end());
-    block->steps_event_count = *mi;
+    if(path == nullptr) {
+        // Max number of steps, for all axes
+        auto mi = std::max_element(block->steps.begin(), block->steps.end());
+        block->steps_event_count = *mi;
+
+    } else {
+        // the path axis is stepped on most ticks at the nominal speed, so each motor step is within a tick or so of where
+        // it would be on a straight block. It is limited so the trapezoid math stays exact in a float
+        if(block->path == nullptr) {
+            block->path= new Block::path_t;
+            if(block->path == nullptr) __debugbreak();
+        }
+        *block->path= *path;
+        block->follows_path= true;
+        block->steps_event_count = std::max(1.0F, std::min(0.9F * THEKERNEL->step_ticker->get_frequency() * distance / rate_mm_s, 16777216.0F));
+    }
 
     block->millimeters = distance;
 
@@ -145,7 +189,8 @@ bool Planner::append_block( ActuatorCoordinates &actuator_pos, uint8_t n_motors,
     // if unit_vec was null then it was not a primary axis move so we skip the junction deviation stuff
     if (unit_vec != nullptr && !THECONVEYOR->is_queue_empty()) {
         Block *prev_block = THECONVEYOR->queue.item_ref(THECONVEYOR->queue.prev(THECONVEYOR->queue.head_i));
-        float previous_nominal_speed = prev_block->primary_axis ? prev_block->nominal_speed : 0;
+        // the motors have to stop between shaped and unshaped motion, see StepTicker::fetch_next_block()
+        float previous_nominal_speed = prev_block->primary_axis && prev_block->is_shaped == shaped ? prev_block->nominal_speed : 0;
 
         if (junction_deviation > 0.0F && previous_nominal_speed > 0.0F) {
             // Compute cosine of angle between previous and current path. (prev_unit_vec is negative)
@@ -192,14 +237,28 @@ bool Planner::append_block( ActuatorCoordinates &actuator_pos, uint8_t n_motors,
     block->recalculate_flag = true;
 
     // Update previous path unit_vector and nominal speed
-    if(unit_vec != nullptr) {
+    if(path != nullptr) {
+        Block::path_direction(*path, 1.0F, previous_unit_vec);
+    } else if(unit_vec != nullptr) {
         memcpy(previous_unit_vec, unit_vec, sizeof(previous_unit_vec)); // previous_unit_vec[] = unit_vec[]
     } else {
         memset(previous_unit_vec, 0, sizeof(previous_unit_vec));
     }
 
+    // following segments may be merged into this block
+    can_merge= (unit_vec != nullptr && path == nullptr);
+    if(can_merge) {
+        merge_i= THECONVEYOR->queue.head_i;
+        n_merge_points= 1;
+        for (int i = 0; i < N_PRIMARY_AXIS; ++i) {
+            merge_points[0][i]= unit_vec[i] * distance;
+        }
+        memcpy(merge_unit_vec, unit_vec, sizeof(merge_unit_vec));
+    }
+
     // Math-heavy re-computing of the whole queue to take the new
-    this->recalculate();
+    this->recalculate(THECONVEYOR->queue.head_i);
+    ++stats.appended;
 
     // The block can now be used
     block->ready();
@@ -209,8 +268,91 @@ bool Planner::append_block( ActuatorCoordinates &actuator_pos, uint8_t n_motors,
     return true;
 }
 
-void Planner::recalculate()
+// Segments from sliced or CAM generated jobs are often so short and so close to being in line that the machine
+// can not tell the difference, but each one costs a block and a full replan. When enabled a segment whose direction
+// changes by less than segment_merge_max_angle, and that keeps every merged end point within segment_merge_tolerance of
+// the resulting straight line, is added to the last block instead. The block must not have started executing.
+// Only done for linear arm solutions, delta and scara need the segment end points to follow the curve.
+bool Planner::merge_segment(const int32_t steps[], uint8_t n_motors, float rate_mm_s, float distance, const float unit_vec[], float acceleration, float s_value, bool g123, bool shaped)
 {
+    if(merge_tolerance <= 0.0F || !can_merge || unit_vec == nullptr) return false;
+    if(THEROBOT->delta_segments_per_second > 1.0F || THEROBOT->mm_per_line_segment > 0.0F) return false;
+
+    Conveyor::Queue_t &queue = THECONVEYOR->queue;
+    if(queue.is_empty() || merge_i != queue.prev(queue.head_i) || n_merge_points >= max_merged_segments) return false;
+
+    Block *block = queue.item_ref(merge_i);
+    if(block->is_g123 != g123 || block->is_shaped != shaped || block->s_value != (uint16_t)roundf(s_value*(1<<11)) || block->acceleration != acceleration) return false;
+    // the block keeps its speed, so its entry speed can not change which would invalidate the plan before it
+    if(rate_mm_s < block->nominal_speed || rate_mm_s > block->nominal_speed * 1.01F) return false;
+
+    // a motor that reverses is a real corner however small it is
+    for (size_t i = 0; i < n_motors; i++) {
+        if(steps[i] != 0 && block->steps[i] != 0 && block->direction_bits[i] != (steps[i] < 0)) return false;
+    }
+
+    float cos_theta = 0;
+    for (int i = 0; i < N_PRIMARY_AXIS; ++i) {
+        cos_theta += merge_unit_vec[i] * unit_vec[i];
+    }
+    if(cos_theta < merge_cos_angle) return false;
+
+    // the merged block moves in a straight line to the new end point, see how far each end point merged so far is from it
+    float end[N_PRIMARY_AXIS];
+    float sos = 0;
+    for (int i = 0; i < N_PRIMARY_AXIS; ++i) {
+        end[i] = merge_points[n_merge_points-1][i] + unit_vec[i] * distance;
+        sos += end[i] * end[i];
+    }
+    float length = sqrtf(sos);
+    for (int p = 0; p < n_merge_points; ++p) {
+        float along = 0;
+        for (int i = 0; i < N_PRIMARY_AXIS; ++i) {
+            along += merge_points[p][i] * end[i] / length;
+        }
+        float dev = 0;
+        for (int i = 0; i < N_PRIMARY_AXIS; ++i) {
+            dev += powf(merge_points[p][i] - along * end[i] / length, 2);
+        }
+        if(dev > merge_tolerance * merge_tolerance) return false;
+    }
+
+    // the step ticker must not pick the block up while it is changed, it skips a locked block
+    __disable_irq();
+    if(THECONVEYOR->flush || THECONVEYOR->continuous_mode != 0 || queue.isr_tail_i == queue.head_i || block->is_ticking) {
+        __enable_irq();
+        return false;
+    }
+    block->locked= true;
+    __enable_irq();
+
+    for (size_t i = 0; i < n_motors; i++) {
+        if(steps[i] == 0) continue;
+        block->direction_bits[i] = (steps[i] < 0) ? 1 : 0;
+        block->steps[i] += labs(steps[i]);
+    }
+    block->steps_event_count = *std::max_element(block->steps.begin(), block->steps.end());
+    block->millimeters = length;
+    block->nominal_rate = block->steps_event_count * block->nominal_speed / length;
+    block->nominal_length_flag = block->nominal_speed <= max_allowable_speed(-acceleration, minimum_planner_speed, length);
+    block->recalculate_flag = true;
+
+    memcpy(merge_points[n_merge_points++], end, sizeof(end));
+    memcpy(merge_unit_vec, unit_vec, sizeof(merge_unit_vec));
+    // the next junction is with the straight line the block now follows
+    for (int i = 0; i < N_PRIMARY_AXIS; ++i) {
+        previous_unit_vec[i] = end[i] / length;
+    }
+
+    recalculate(merge_i);
+    block->locked= false;
+
+    return true;
+}
+
+void Planner::recalculate(unsigned int last_i)
+{
+    PROFILE_SCOPE(RECALCULATE);
     Conveyor::Queue_t &queue = THECONVEYOR->queue;
 
     unsigned int block_index;
@@ -242,6 +384,12 @@ void Planner::recalculate()
      *     then we're accel limited. set recalculate to false, work out max exit speed
      *
      * finally, work out trapezoid for the final (and newest) block.
+     *
+     * planned_i points at the last block whose entry speed can not change any more, either because it is at its
+     * max entry speed or because it is accel limited. Adding blocks only ever allows blocks to enter faster so
+     * everything up to planned_i is optimal and the passes only need to look at the blocks after it.
+     * So the work done per appended block depends on how many blocks it takes to stop, not on the queue size,
+     * unless the queue is shorter than the stopping distance in which case every block is decel limited.
      */
 
     /*
@@ -251,12 +399,19 @@ void Planner::recalculate()
 
     float entry_speed = minimum_planner_speed;
 
-    block_index = queue.head_i;
+    // last_i is the newest block, normally the one about to be added at the head
+    block_index = last_i;
     current     = queue.item_ref(block_index);
 
     if (!queue.is_empty()) {
-        while ((block_index != queue.tail_i) && current->recalculate_flag) {
+        // if the planned block has been executed and removed from the queue start from the tail
+        if(((planned_i - queue.tail_i + queue.length) % queue.length) >= ((queue.head_i - queue.tail_i + queue.length) % queue.length)) {
+            planned_i= queue.tail_i;
+        }
+
+        while ((block_index != planned_i) && current->recalculate_flag) {
             entry_speed = current->reverse_pass(entry_speed);
+            ++stats.reverse_passes;
 
             block_index = queue.prev(block_index);
             current     = queue.item_ref(block_index);
@@ -264,7 +419,7 @@ void Planner::recalculate()
 
         /*
          * Step 2:
-         * now current points to either tail or first non-recalculate block
+         * now current points to either the planned block or first non-recalculate block
          * and has not had its reverse_pass called
          * or its calculate_trapezoid
          * entry_speed is set to the *exit* speed of current.
@@ -273,7 +428,7 @@ void Planner::recalculate()
 
         float exit_speed = current->max_exit_speed();
 
-        while (block_index != queue.head_i) {
+        while (block_index != last_i) {
             previous    = current;
             block_index = queue.next(block_index);
             current     = queue.item_ref(block_index);
@@ -281,8 +436,14 @@ void Planner::recalculate()
             // we pass the exit speed of the previous block
             // so this block can decide if it's accel or decel limited and update its fields as appropriate
             exit_speed = current->forward_pass(exit_speed);
+            ++stats.forward_passes;
 
             previous->calculate_trapezoid(previous->entry_speed, current->entry_speed);
+
+            // nothing added later can make this block enter faster, so it is the new end of the optimal plan
+            if(!current->recalculate_flag || current->entry_speed == current->max_entry_speed) {
+                planned_i= block_index;
+            }
         }
     }
 
@@ -291,7 +452,7 @@ void Planner::recalculate()
      * work out trapezoid for final (and newest) block
      */
 
-    // now current points to the head item
+    // now current points to the newest item
     // which has not had calculate_trapezoid run yet
     current->calculate_trapezoid(current->entry_speed, minimum_planner_speed);
 }
@@ -9,7 +9,8 @@
 #define PLANNER_H
 
 #include "ActuatorCoordinates.h"
-class Block;
+#include "Block.h"
+#include <stdint.h>
 
 class Planner
 {
@@ -17,16 +18,40 @@ public:
     Planner();
     float max_allowable_speed( float acceleration, float target_velocity, float distance);
 
+    // how much work the planner has done, used to benchmark the planner
+    using stats_t= struct {
+        uint32_t appended;
+        uint32_t reverse_passes;
+        uint32_t forward_passes;
+        uint32_t merged;        // segments merged into the previous block instead of getting their own
+    };
+    const stats_t& get_stats() const { return stats; }
+    float get_s_curve_jerk() const { return s_curve_jerk; }
+
     friend class Robot; // for acceleration, junction deviation, minimum_planner_speed
 
 private:
-    bool append_block(ActuatorCoordinates &target, uint8_t n_motors, float rate_mm_s, float distance, float unit_vec[], float accleration, float s_value, bool g123);
-    void recalculate();
+    bool append_block(ActuatorCoordinates &target, uint8_t n_motors, float rate_mm_s, float distance, float unit_vec[], float accleration, float s_value, bool g123, bool shaped, const Block::path_t *path= nullptr);
+    bool merge_segment(const int32_t steps[], uint8_t n_motors, float rate_mm_s, float distance, const float unit_vec[], float acceleration, float s_value, bool g123, bool shaped);
+    void recalculate(unsigned int last_i);
     void config_load();
     float previous_unit_vec[N_PRIMARY_AXIS];
     float junction_deviation;    // Setting
     float z_junction_deviation;  // Setting
     float minimum_planner_speed; // Setting
+    float merge_tolerance;       // Setting, max distance a merged segment end point can be from the merged block, 0 disables merging
+    float merge_cos_angle;       // Setting, cosine of the max direction change between two segments that can be merged
+    float s_curve_jerk;          // Setting, jerk in mm/s³ the acceleration ramps are limited to, 0 for trapezoid ramps
+    stats_t stats;
+    unsigned int planned_i; // the last block in the queue whose entry speed is optimal
+
+    // the last block appended and the segment end points merged into it so far, relative to its start
+    static const int max_merged_segments= 8;
+    unsigned int merge_i;
+    uint8_t n_merge_points;
+    bool can_merge;
+    float merge_points[max_merged_segments][N_PRIMARY_AXIS];
+    float merge_unit_vec[N_PRIMARY_AXIS]; // direction of the last segment
 };
 
 
@@ -9,6 +9,7 @@
 #include "libs/Kernel.h"
 
 #include "Robot.h"
+#include "Profiler.h"
 #include "Planner.h"
 #include "Conveyor.h"
 #include "Pin.h"
@@ -25,6 +26,7 @@
 #include "arm_solutions/CoreXZSolution.h"
 #include "arm_solutions/MorganSCARASolution.h"
 #include "StepTicker.h"
+#include "InputShaper.h"
 #include "checksumm.h"
 #include "utils.h"
 #include "ConfigValue.h"
@@ -49,6 +51,11 @@
 #define  mm_per_arc_segment_checksum         CHECKSUM("mm_per_arc_segment")
 #define  mm_max_arc_error_checksum           CHECKSUM("mm_max_arc_error")
 #define  arc_correction_checksum             CHECKSUM("arc_correction")
+#define  native_arcs_checksum                CHECKSUM("native_arcs")
+#define  deferred_segmentation_checksum      CHECKSUM("deferred_segmentation")
+#define  input_shaper_checksum               CHECKSUM("input_shaper")
+#define  input_shaper_frequency_checksum     CHECKSUM("input_shaper_frequency")
+#define  input_shaper_damping_checksum       CHECKSUM("input_shaper_damping")
 #define  x_axis_max_speed_checksum           CHECKSUM("x_axis_max_speed")
 #define  y_axis_max_speed_checksum           CHECKSUM("y_axis_max_speed")
 #define  z_axis_max_speed_checksum           CHECKSUM("z_axis_max_speed")
@@ -124,6 +131,7 @@ Robot::Robot()
     this->next_command_is_MCS = false;
     this->disable_segmentation= false;
     this->disable_arm_solution= false;
+    this->is_shaped_move= false;
     this->n_motors= 0;
 }
 
@@ -186,6 +194,16 @@ void Robot::load_config()
     this->mm_per_arc_segment  = THEKERNEL->config->value(mm_per_arc_segment_checksum  )->by_default(    0.0f)->as_number();
     this->mm_max_arc_error    = THEKERNEL->config->value(mm_max_arc_error_checksum    )->by_default(   0.01f)->as_number();
     this->arc_correction      = THEKERNEL->config->value(arc_correction_checksum      )->by_default(    5   )->as_number();
+    this->native_arcs         = THEKERNEL->config->value(native_arcs_checksum         )->by_default(false )->as_bool();
+    this->deferred_segmentation = THEKERNEL->config->value(deferred_segmentation_checksum )->by_default(false)->as_bool();
+
+    // input shaper for G0 to G3 moves, none, zv, zvd or mzv, at the ringing frequency in Hz
+    this->shaper_type         = InputShaper::from_name(THEKERNEL->config->value(input_shaper_checksum)->by_default("none")->as_string());
+    this->shaper_frequency    = THEKERNEL->config->value(input_shaper_frequency_checksum)->by_default(40.0F)->as_number();
+    this->shaper_damping      = THEKERNEL->config->value(input_shaper_damping_checksum  )->by_default( 0.1F)->as_number();
+    if(!set_input_shaper()) {
+        THEKERNEL->streams->printf("WARNING: input shaper settings are not valid, it is off\n");
+    }
 
     // in mm/sec but specified in config as mm/min
     this->max_speeds[X_AXIS]  = THEKERNEL->config->value(x_axis_max_speed_checksum    )->by_default(60000.0F)->as_number() / 60.0F;
@@ -811,7 +829,13 @@ void Robot::on_gcode_received(void *argument)
                 }
                 break;
 
-            case 205: // M205 Xnnn - set junction deviation, Z - set Z junction deviation, Snnn - Set minimum planner speed
+            case 205: // M205 Xnnn - set junction deviation, Z - set Z junction deviation, Snnn - Set minimum planner speed, Qnnn - set segment merge tolerance
+                if(gcode->subcode == 1) {
+                    // M205.1 report how many segments have been merged
+                    const Planner::stats_t &stats= THEKERNEL->planner->get_stats();
+                    gcode->stream->printf("blocks: %lu, merged segments: %lu\n", stats.appended, stats.merged);
+                    break;
+                }
                 if (gcode->has_letter('X')) {
                     float jd = gcode->get_value('X');
                     // enforce minimum
@@ -833,6 +857,13 @@ void Robot::on_gcode_received(void *argument)
                         mps = 0.0F;
                     THEKERNEL->planner->minimum_planner_speed = mps;
                 }
+                if (gcode->has_letter('Q')) {
+                    float mt = gcode->get_value('Q');
+                    // zero disables merging
+                    if (mt < 0.0F)
+                        mt = 0.0F;
+                    THEKERNEL->planner->merge_tolerance = mt;
+                }
                 break;
 
             case 211: // M211 Sn turns soft endstops on/off
@@ -894,7 +925,7 @@ void Robot::on_gcode_received(void *argument)
                 }
                 gcode->stream->printf("\n");
 
-                gcode->stream->printf(";X- Junction Deviation, Z- Z junction deviation, S - Minimum Planner speed mm/sec:\nM205 X%1.5f Z%1.5f S%1.5f\n", THEKERNEL->planner->junction_deviation, isnan(THEKERNEL->planner->z_junction_deviation)?-1:THEKERNEL->planner->z_junction_deviation, THEKERNEL->planner->minimum_planner_speed);
+                gcode->stream->printf(";X- Junction Deviation, Z- Z junction deviation, S - Minimum Planner speed mm/sec, Q - Segment merge tolerance:\nM205 X%1.5f Z%1.5f S%1.5f Q%1.5f\n", THEKERNEL->planner->junction_deviation, isnan(THEKERNEL->planner->z_junction_deviation)?-1:THEKERNEL->planner->z_junction_deviation, THEKERNEL->planner->minimum_planner_speed, THEKERNEL->planner->merge_tolerance);
 
                 gcode->stream->printf(";Max cartesian feedrates in mm/sec:\nM203 X%1.5f Y%1.5f Z%1.5f S%1.5f\n", this->max_speeds[X_AXIS], this->max_speeds[Y_AXIS], this->max_speeds[Z_AXIS], this->max_speed);
 
@@ -915,6 +946,9 @@ void Robot::on_gcode_received(void *argument)
                     }
                     gcode->stream->printf("\n");
                 }
+
+                gcode->stream->printf(";Input shaper P- type (0 none, 1 zv, 2 zvd, 3 mzv), F- frequency Hz, D- damping ratio:\nM593 P%d F%1.2f D%1.4f\n", shaper_type, shaper_frequency, shaper_damping);
+
                 if(gcode->m == 503) {
                     // show temporary settings
                     gcode->stream->printf(";Temporary settings S - delta segs/sec, U - mm/line segment:\nM665 ");
@@ -948,6 +982,24 @@ void Robot::on_gcode_received(void *argument)
             }
             break;
 
+            case 593: // M593 Pn Fnnn Dnnn set the input shaper type, frequency and damping ratio, with no parameters prints them
+                if(gcode->has_letter('P') || gcode->has_letter('F') || gcode->has_letter('D')) {
+                    if(gcode->has_letter('P')) shaper_type = std::min<uint32_t>(gcode->get_uint('P'), InputShaper::MZV);
+                    if(gcode->has_letter('F')) shaper_frequency = gcode->get_value('F');
+                    if(gcode->has_letter('D')) shaper_damping = gcode->get_value('D');
+                    // the step ticker can only change it when nothing is moving
+                    THECONVEYOR->wait_for_idle();
+                    if(!set_input_shaper()) {
+                        gcode->stream->printf("error:input shaper settings are not valid, it is off\n");
+                    } else if(THEKERNEL->step_ticker->is_shaping() && THECONVEYOR->get_step_buffers() < THECONVEYOR->get_queue_size()) {
+                        // only turned on at boot it gets a step buffer for every block, see Conveyor::start()
+                        gcode->stream->printf("WARNING: with planner_step_buffers set the input shaper may wait for a step buffer between short moves\n");
+                    }
+                } else {
+                    gcode->stream->printf("input shaper: %s, frequency %1.2f Hz, damping %1.4f\n", InputShaper::name((InputShaper::TYPE)shaper_type), shaper_frequency, shaper_damping);
+                }
+                break;
+
             case 665: { // M665 set optional arm solution variables based on arm solution.
                 // the parameter args could be any letter each arm solution only accepts certain ones
                 BaseSolution::arm_options_t options = gcode->get_args();
@@ -984,7 +1036,9 @@ void Robot::on_gcode_received(void *argument)
 
     if( motion_mode != NONE) {
         is_g123= motion_mode != SEEK;
+        is_shaped_move= true;
         process_move(gcode, motion_mode);
+        is_shaped_move= false;
 
     }else{
         is_g123= false;
@@ -1232,11 +1286,20 @@ void Robot::reset_compensated_machine_position()
     }
 }
 
+// how far an axis moves at most for each mm along a path, both axis of the plane move at the full speed of the arc
+static float path_axis_ratio(const Block::path_t& path, int axis, float distance)
+{
+    if(axis == path.plane[0] || axis == path.plane[1]) return fabsf(path.angle) * path.radius / distance;
+    return fabsf(path.end[axis] - path.start[axis]) / distance;
+}
+
 // Convert target (in machine coordinates) to machine_position, then convert to actuator position and append this to the planner
 // target is in machine coordinates without the compensation transform, however we save a compensated_machine_position that includes
 // all transforms and is what we actually convert to actuator positions
-bool Robot::append_milestone(const float target[], float rate_mm_s)
+// if path is set the move follows it to the target instead of going in a straight line
+bool Robot::append_milestone(const float target[], float rate_mm_s, const Block::path_t *path)
 {
+    PROFILE_SCOPE(APPEND_MILESTONE);
     float deltas[n_motors];
     float transformed_target[n_motors]; // adjust target for bed compensation
     float unit_vec[N_PRIMARY_AXIS];
@@ -1299,11 +1362,12 @@ bool Robot::append_milestone(const float target[], float rate_mm_s)
         }
     }
 
-    // nothing moved
-    if(!move) return false;
+    // nothing moved, a full circle still has to go around though
+    const bool arc= (path != nullptr && path->angle != 0);
+    if(!move && !arc) return false;
 
     // see if this is a primary axis move or not
-    bool auxilliary_move= true;
+    bool auxilliary_move= !arc;
     for (int i = 0; i < N_PRIMARY_AXIS; ++i) {
         if(fabsf(deltas[i]) >= 0.00001F) {
             auxilliary_move= false;
@@ -1313,19 +1377,25 @@ bool Robot::append_milestone(const float target[], float rate_mm_s)
 
     // total movement, use XYZ if a primary axis otherwise we calculate distance for E after scaling to mm
     float distance= auxilliary_move ? 0 : sqrtf(sos);
+    if(arc) {
+        // the distance along the arc
+        distance= hypotf(path->angle * path->radius, path->end[path->plane[2]] - path->start[path->plane[2]]);
+    }
 
     // it is unlikely but we need to protect against divide by zero, so ignore insanely small moves here
     // as the last milestone won't be updated we do not actually lose any moves as they will be accounted for in the next move
     if(!auxilliary_move && distance < 0.00001F) return false;
 
     if(!auxilliary_move) {
+         // an arc starts off in the direction it is going at the start, the junction with the last block is there
+         if(arc) Block::path_direction(*path, 0, unit_vec);
          for (size_t i = X_AXIS; i < N_PRIMARY_AXIS; i++) {
             // find distance unit vector for primary axis only
-            unit_vec[i] = deltas[i] / distance;
+            if(!arc) unit_vec[i] = deltas[i] / distance;
 
             // Do not move faster than the configured cartesian limits for XYZ
             if ( i <= Z_AXIS && max_speeds[i] > 0 ) {
-                float axis_speed = fabsf(unit_vec[i] * rate_mm_s);
+                float axis_speed = fabsf((arc ? path_axis_ratio(*path, i, distance) : unit_vec[i]) * rate_mm_s);
 
                 if (axis_speed > max_speeds[i])
                     rate_mm_s *= ( max_speeds[i] / axis_speed );
@@ -1381,9 +1451,15 @@ bool Robot::append_milestone(const float target[], float rate_mm_s)
 
     float isecs = rate_mm_s / distance;
 
+    // a straight path is stepped as chords of equal length, each actuator is limited on the chord it moves the most in
+    float chord_travel[n_motors];
+    const bool line= (path != nullptr && !arc);
+    if(line) max_chord_travel(*path, actuator_pos, chord_travel);
+
     // check per-actuator speed limits
     for (size_t actuator = 0; actuator < n_motors; actuator++) {
-        float d = fabsf(actuator_pos[actuator] - actuators[actuator]->get_last_milestone());
+        float d = arc ? path_axis_ratio(*path, actuator, distance) * distance :
+                  line ? chord_travel[actuator] * path->n_chords : fabsf(actuator_pos[actuator] - actuators[actuator]->get_last_milestone());
         if(d < 0.00001F || !actuators[actuator]->is_selected()) continue; // no realistic movement for this actuator
 
         float actuator_rate= d * isecs;
@@ -1407,6 +1483,11 @@ bool Robot::append_milestone(const float target[], float rate_mm_s)
         }
     }
 
+    // limit the speed around an arc so the centripetal acceleration is no more than the acceleration
+    if(arc) {
+        rate_mm_s = std::min(rate_mm_s, sqrtf(acceleration * path->radius));
+    }
+
     // if we are in feed hold wait here until it is released, this means that even segmented lines will pause
     while(THEKERNEL->get_feed_hold()) {
         THEKERNEL->call_event(ON_IDLE, this);
@@ -1417,7 +1498,8 @@ bool Robot::append_milestone(const float target[], float rate_mm_s)
     // Append the block to the planner
     // NOTE that distance here should be either the distance travelled by the XYZ axis, or the E mm travel if a solo E move
     // NOTE this call will bock until there is room in the block queue, on_idle will continue to be called
-    if(THEKERNEL->planner->append_block( actuator_pos, n_motors, rate_mm_s, distance, auxilliary_move ? nullptr : unit_vec, acceleration, s_value, is_g123)) {
+    if(THEKERNEL->planner->append_block( actuator_pos, n_motors, rate_mm_s, distance, auxilliary_move ? nullptr : unit_vec, acceleration, s_value, is_g123,
+                                            is_shaped_move && THEKERNEL->step_ticker->is_shaping(), path)) {
         // this is the new compensated machine position
         memcpy(this->compensated_machine_position, transformed_target, n_motors*sizeof(float));
         return true;
@@ -1427,6 +1509,91 @@ bool Robot::append_milestone(const float target[], float rate_mm_s)
     return false;
 }
 
+// works out the impulses for the shaper settings and hands them to the step ticker, returns false and turns it off if
+// they are not valid. Only the actuators that X and Y move are shaped
+bool Robot::set_input_shaper()
+{
+    float amplitude[InputShaper::max_impulses], delay[InputShaper::max_impulses];
+    uint8_t n = InputShaper::impulses((InputShaper::TYPE)shaper_type, shaper_frequency, shaper_damping, amplitude, delay);
+
+    uint8_t motors = 0;
+    ActuatorCoordinates at, moved;
+    arm_solution->cartesian_to_actuator(machine_position, at);
+    for (int axis = X_AXIS; axis <= Y_AXIS; ++axis) {
+        float p[3] = {machine_position[X_AXIS], machine_position[Y_AXIS], machine_position[Z_AXIS]};
+        p[axis] += 1;
+        arm_solution->cartesian_to_actuator(p, moved);
+        for (int i = X_AXIS; i <= Z_AXIS; ++i) {
+            if(moved[i] != at[i]) motors |= (1 << i);
+        }
+    }
+
+    if((n == 0 && shaper_type != InputShaper::NONE) || !THEKERNEL->step_ticker->set_input_shaper(n, amplitude, delay, motors)) {
+        THEKERNEL->step_ticker->set_input_shaper(0, amplitude, delay, 0);
+        shaper_type = InputShaper::NONE;
+        return false;
+    }
+    return true;
+}
+
+// the actuator position at fraction t along a path, converted the same way append_milestone() converts a target
+void Robot::get_path_actuators(const Block::path_t& path, float t, ActuatorCoordinates& actuator_pos)
+{
+    float target[n_motors];
+    Block::path_position(path, t, target);
+
+    if(compensationTransform) {
+        compensationTransform(target, false);
+    }
+
+    if(!disable_arm_solution) {
+        arm_solution->cartesian_to_actuator(target, actuator_pos);
+    }else{
+        for (size_t i = X_AXIS; i <= Z_AXIS; i++) {
+            actuator_pos[i] = target[i];
+        }
+    }
+
+#if MAX_ROBOT_ACTUATORS > 3
+    for (size_t i = E_AXIS; i < n_motors; i++) {
+        actuator_pos[i]= target[i];
+        if(actuators[i]->is_extruder() && get_e_scale_fnc) {
+            actuator_pos[i] *= get_e_scale_fnc();
+        }
+    }
+#endif
+}
+
+// the actuator position in steps at fraction t along a path, used by the conveyor to cut the path into chords
+void Robot::get_path_steps(const Block::path_t& path, float t, int32_t steps[])
+{
+    ActuatorCoordinates actuator_pos;
+    get_path_actuators(path, t, actuator_pos);
+
+    for (size_t i = 0; i < n_motors; i++) {
+        steps[i] = lroundf(actuator_pos[i] * actuators[i]->get_steps_per_mm());
+    }
+}
+
+// the most each actuator moves in one chord of a straight path, ending at end, as the conveyor will cut it. On a
+// delta a tower can go up and back down over the path so how far it gets over the whole path can be much less
+void Robot::max_chord_travel(const Block::path_t& path, const ActuatorCoordinates& end, float travel[])
+{
+    ActuatorCoordinates last, next;
+    for (size_t i = 0; i < n_motors; i++) {
+        last[i]= actuators[i]->get_last_milestone();
+        travel[i]= 0;
+    }
+    for (int c = 1; c <= path.n_chords; ++c) {
+        if(c == path.n_chords) next= end;
+        else get_path_actuators(path, (float)c / path.n_chords, next);
+        for (size_t i = 0; i < n_motors; i++) {
+            travel[i]= std::max(travel[i], fabsf(next[i] - last[i]));
+        }
+        last= next;
+    }
+}
+
 // Used to plan a single move used by things like endstops when homing, zprobe, extruder firmware retracts etc.
 bool Robot::delta_move(const float *delta, float rate_mm_s, uint8_t naxis)
 {
@@ -1513,6 +1680,24 @@ bool Robot::append_line(Gcode *gcode, const float target[], float rate_mm_s, flo
     }
 
     bool moved= false;
+    if (segments > 1 && this->deferred_segmentation && THEKERNEL->step_ticker->can_follow_paths()) {
+        // the line is planned as a single move, or a few if it has more segments than a block can have chords, and
+        // is cut into the segments just before it is executed
+        Block::path_t line;
+        memcpy(line.start, machine_position, n_motors*sizeof(float));
+        memcpy(line.end, target, n_motors*sizeof(float));
+        line.center[0]= line.center[1]= 0;
+        line.radius= 0;
+        line.angle= 0;
+        line.plane[0]= this->plane_axis_0;
+        line.plane[1]= this->plane_axis_1;
+        line.plane[2]= this->plane_axis_2;
+        line.n_axis= n_motors;
+        moved= append_path(line, segments, rate_mm_s);
+        this->next_command_is_MCS = false; // always reset this
+        return moved;
+    }
+
     if (segments > 1) {
         // A vector to keep track of the endpoint of each segment
         float segment_delta[n_motors];
@@ -1546,6 +1731,30 @@ bool Robot::append_line(Gcode *gcode, const float target[], float rate_mm_s, flo
 }
 
 
+// Append a path that is cut into the given number of segments as it is executed, each block can only have
+// Block::max_chords of them so a long path is planned as a few blocks
+bool Robot::append_path(const Block::path_t &whole, uint16_t segments, float rate_mm_s)
+{
+    Block::path_t path= whole;
+    uint16_t blocks= (segments + Block::max_chords - 1) / Block::max_chords;
+    uint16_t done= 0;
+    bool moved= false;
+    for (uint16_t b = 1; b <= blocks; b++) {
+        if(THEKERNEL->is_halted()) return false; // don't queue any more blocks
+
+        uint16_t upto= (uint32_t)segments * b / blocks;
+        path.n_chords= upto - done;
+        path.angle= whole.angle * path.n_chords / segments;
+        Block::path_position(whole, (float)upto / segments, path.end);
+
+        if(this->append_milestone(path.end, rate_mm_s, &path)) moved= true;
+        memcpy(path.start, path.end, n_motors*sizeof(float));
+        done= upto;
+    }
+
+    return moved;
+}
+
 // Append an arc to the queue ( cutting it into segments as needed )
 bool Robot::append_arc(Gcode * gcode, const float target[], const float offset[], float radius, bool is_clockwise )
 {
@@ -1622,6 +1831,24 @@ bool Robot::append_arc(Gcode * gcode, const float target[], const float offset[]
     uint16_t segments = floorf(millimeters_of_travel / arc_segment);
     bool moved= false;
 
+    if(segments > 1 && this->native_arcs && !this->soft_endstop_enabled && THEKERNEL->step_ticker->can_follow_paths()) {
+        // the arc is planned as a single move, or a few if it has more segments than a block can have chords, and is
+        // cut into the same segments just before it is executed. With soft endstops each segment end point is checked so it is not used
+        Block::path_t arc;
+        memcpy(arc.start, machine_position, n_motors*sizeof(float));
+        memcpy(arc.end, target, n_motors*sizeof(float));
+        arc.center[0]= center_axis0;
+        arc.center[1]= center_axis1;
+        arc.radius= radius;
+        arc.angle= angular_travel;
+        arc.plane[0]= this->plane_axis_0;
+        arc.plane[1]= this->plane_axis_1;
+        arc.plane[2]= this->plane_axis_2;
+        arc.n_axis= n_motors;
+
+        return append_path(arc, segments, rate_mm_s);
+    }
+
     if(segments > 1) {
         float theta_per_segment = angular_travel / segments;
         float linear_per_segment = linear_travel / segments;
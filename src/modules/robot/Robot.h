@@ -18,6 +18,7 @@ using std::string;
 #include "libs/Module.h"
 #include "ActuatorCoordinates.h"
 #include "nuts_bolts.h"
+#include "Block.h"
 
 class Gcode;
 class BaseSolution;
@@ -62,6 +63,7 @@ class Robot : public Module {
         bool delta_move(const float delta[], float rate_mm_s, uint8_t naxis);
         uint8_t register_motor(StepperMotor*);
         uint8_t get_number_registered_motors() const {return n_motors; }
+        void get_path_steps(const Block::path_t& path, float t, int32_t steps[]);
 
         BaseSolution* arm_solution;                           // Selected Arm solution ( millimeters to step calculation )
 
@@ -90,8 +92,11 @@ class Robot : public Module {
             bool save_g92:1;                                  // save g92 on M500 if set
             bool save_g54:1;                                  // save WCS on M500 if set
             bool is_g123:1;
+            bool is_shaped_move:1;                            // set while a G0 to G3 is planned, the input shaper only shapes those
             bool soft_endstop_enabled:1;
             bool soft_endstop_halt:1;
+            bool native_arcs:1;                               // Setting : plan arcs as one move that is cut into chords just before it is executed
+            bool deferred_segmentation:1;                     // Setting : plan segmented lines as one move that is cut into chords just before it is executed
             uint8_t plane_axis_0:2;                           // Current plane ( XY, XZ, YZ )
             uint8_t plane_axis_1:2;
             uint8_t plane_axis_2:2;
@@ -107,11 +112,15 @@ class Robot : public Module {
         };
 
         void load_config();
-        bool append_milestone(const float target[], float rate_mm_s);
+        bool append_milestone(const float target[], float rate_mm_s, const Block::path_t *path= nullptr);
         bool append_line( Gcode* gcode, const float target[], float rate_mm_s, float delta_e);
         bool append_arc( Gcode* gcode, const float target[], const float offset[], float radius, bool is_clockwise );
+        bool append_path(const Block::path_t &path, uint16_t segments, float rate_mm_s);
+        void get_path_actuators(const Block::path_t& path, float t, ActuatorCoordinates& actuator_pos);
+        void max_chord_travel(const Block::path_t& path, const ActuatorCoordinates& end, float travel[]);
         bool compute_arc(Gcode* gcode, const float offset[], const float target[], enum MOTION_MODE_T motion_mode);
         void process_move(Gcode *gcode, enum MOTION_MODE_T);
+        bool set_input_shaper();
         bool is_homed(uint8_t i) const;
 
         float theta(float x, float y);
@@ -140,6 +149,9 @@ class Robot : public Module {
         float seconds_per_minute;                            // for realtime speed change
         float default_acceleration;                          // the defualt accleration if not set for each axis
         float s_value;                                       // modal S value
+        float shaper_frequency;                              // Setting : input shaper ringing frequency in Hz
+        float shaper_damping;                                // Setting : input shaper damping ratio
+        uint8_t shaper_type;                                 // Setting : InputShaper::TYPE
 
         // Number of arc generation iterations by small angle approximation before exact arc trajectory
         // correction. This parameter may be decreased if there are issues with the accuracy of the arc
@@ -18,6 +18,7 @@
 #include "Robot.h"
 #include "Config.h"
 #include "SlowTicker.h"
+#include "Scheduler.h"
 #include "Planner.h"
 #include "checksumm.h"
 #include "utils.h"
@@ -129,11 +130,11 @@ void Endstops::on_module_loaded()
     }
 
     register_for_event(ON_GCODE_RECEIVED);
-    register_for_event(ON_GET_PUBLIC_DATA);
-    register_for_event(ON_SET_PUBLIC_DATA);
-    register_for_event(ON_IDLE);
+    register_for_public_data(ON_GET_PUBLIC_DATA, endstops_checksum);
+    register_for_public_data(ON_SET_PUBLIC_DATA, endstops_checksum);
+    idle_task= THEKERNEL->scheduler->add_task("endstops", this, &Module::on_idle);
 
-    THEKERNEL->slow_ticker->attach(1000, this, &Endstops::read_endstops);
+    THEKERNEL->slow_ticker->attach(1000, this, &Endstops::read_endstops, SlowTicker::SAFETY_PRIORITY);
 }
 
 // Get config using old deprecated syntax Does not support ABC
@@ -557,6 +558,7 @@ void Endstops::check_limits()
             // clear the state
             this->status = NOT_HOMING;
             this->limits_activated= true;
+            THEKERNEL->scheduler->post_task(idle_task);
         }
         return;
 
@@ -586,6 +588,7 @@ void Endstops::check_limits()
                 // however we can stop incoming commands and stop all the motors here
                 THEKERNEL->immediate_halt();
                 trigger_halt= true;
+                THEKERNEL->scheduler->post_task(idle_task);
                 // remember what axis triggered it (first one wins)
                 // TODO gives incorrect result on corexy need to use fk to figure it out
                 triggered_direction= STEPPER[m]->which_direction();
@@ -48,6 +48,7 @@ class Endstops : public Module{
         uint32_t debounce_count;
         uint32_t  debounce_ms;
         axis_bitmap_t axis_to_home;
+        uint32_t idle_task;
 
         float trim_mm[3];
 
@@ -13,6 +13,7 @@
 #include "modules/robot/Conveyor.h"
 #include "modules/robot/Block.h"
 #include "StepperMotor.h"
+#include "StepTicker.h"
 #include "SlowTicker.h"
 #include "Config.h"
 #include "StepperMotor.h"
@@ -45,6 +46,7 @@
 #define retract_recover_feedrate_checksum    CHECKSUM("retract_recover_feedrate")
 #define retract_zlift_length_checksum        CHECKSUM("retract_zlift_length")
 #define retract_zlift_feedrate_checksum      CHECKSUM("retract_zlift_feedrate")
+#define pressure_advance_checksum            CHECKSUM("pressure_advance")
 
 #define PI 3.14159265358979F
 
@@ -80,8 +82,8 @@ void Extruder::on_module_loaded()
 
     // We work on the same Block as Stepper, so we need to know when it gets a new one and drops one
     this->register_for_event(ON_GCODE_RECEIVED);
-    this->register_for_event(ON_GET_PUBLIC_DATA);
-    this->register_for_event(ON_SET_PUBLIC_DATA);
+    this->register_for_public_data(ON_GET_PUBLIC_DATA, extruder_checksum);
+    this->register_for_public_data(ON_SET_PUBLIC_DATA, extruder_checksum);
 }
 
 // Get config
@@ -107,6 +109,7 @@ void Extruder::config_load()
     this->retract_recover_feedrate = THEKERNEL->config->value(extruder_checksum, this->identifier, retract_recover_feedrate_checksum)->by_default(8)->as_number();
     this->retract_zlift_length     = THEKERNEL->config->value(extruder_checksum, this->identifier, retract_zlift_length_checksum)->by_default(0)->as_number();
     this->retract_zlift_feedrate   = THEKERNEL->config->value(extruder_checksum, this->identifier, retract_zlift_feedrate_checksum)->by_default(100 * 60)->as_number() / 60.0F; // mm/min
+    this->pressure_advance         = THEKERNEL->config->value(extruder_checksum, this->identifier, pressure_advance_checksum)->by_default(0)->as_number(); // seconds
 
     if(filament_diameter > 0.01F) {
         this->volumetric_multiplier = 1.0F / (powf(this->filament_diameter / 2, 2) * PI);
@@ -115,6 +118,10 @@ void Extruder::config_load()
     // Stepper motor object for the extruder
     stepper_motor = new StepperMotor(step_pin, dir_pin, en_pin);
     motor_id = THEROBOT->register_motor(stepper_motor);
+    if(!THEKERNEL->step_ticker->set_pressure_advance(motor_id, this->pressure_advance)) {
+        THEKERNEL->streams->printf("WARNING: pressure_advance must be between 0 and 1 second, it is off\n");
+        this->pressure_advance = 0;
+    }
 
     stepper_motor->set_max_rate(THEKERNEL->config->value(extruder_checksum, this->identifier, max_speed_checksum)->by_default(1000)->as_number());
     stepper_motor->set_acceleration(acceleration);
@@ -312,6 +319,21 @@ void Extruder::on_gcode_received(void *argument)
             if(gcode->has_letter('S')) retract_recover_length = gcode->get_value('S');
             if(gcode->has_letter('F')) retract_recover_feedrate = gcode->get_value('F') / 60.0F; // specified in mm/min converted to mm/sec
 
+        } else if (gcode->m == 900 && ( (this->selected && !gcode->has_letter('P')) || (gcode->has_letter('P') && gcode->get_value('P') == this->identifier)) ) {
+            // M900 K[seconds] - set the pressure advance, 0 turns it off
+            if(gcode->has_letter('K')) {
+                // the step ticker can not change it while the extruder is moving
+                THEKERNEL->conveyor->wait_for_idle();
+                if(THEKERNEL->step_ticker->set_pressure_advance(motor_id, gcode->get_value('K'))) {
+                    pressure_advance = gcode->get_value('K');
+                } else {
+                    gcode->stream->printf("error:K must be between 0 and 1 second\n");
+                }
+
+            } else {
+                gcode->stream->printf("Pressure advance K%1.4f\n", pressure_advance);
+            }
+
         } else if (gcode->m == 221 && this->selected) { // M221 S100 change flow rate by percentage
             if(gcode->has_letter('S')) {
                 float last_scale = this->extruder_multiplier;
@@ -334,6 +356,7 @@ void Extruder::on_gcode_received(void *argument)
             gcode->stream->printf(";E retract recover length, feedrate:\nM208 S%1.4f F%1.4f P%d\n", this->retract_recover_length, this->retract_recover_feedrate * 60.0F, this->identifier);
             gcode->stream->printf(";E acceleration mm/sec²:\nM204 E%1.4f P%d\n", stepper_motor->get_acceleration(), this->identifier);
             gcode->stream->printf(";E max feed rate mm/sec:\nM203 E%1.4f P%d\n", stepper_motor->get_max_rate(), this->identifier);
+            gcode->stream->printf(";E pressure advance seconds:\nM900 K%1.4f P%d\n", this->pressure_advance, this->identifier);
             if(this->max_volumetric_rate > 0) {
                 gcode->stream->printf(";E max volumetric rate mm³/sec:\nM203 V%1.4f P%d\n", this->max_volumetric_rate, this->identifier);
             }
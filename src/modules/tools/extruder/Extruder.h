@@ -52,6 +52,8 @@ class Extruder : public Tool {
         float retract_zlift_length;
         float retract_zlift_feedrate;
 
+        float pressure_advance;             // seconds, the filament is pushed ahead by this times the extrusion speed
+
         // for saving and restoring extruder position
         std::tuple<float, float, int32_t> saved_position;
 
@@ -11,6 +11,7 @@
 #include "checksumm.h"
 #include "ConfigValue.h"
 #include "SlowTicker.h"
+#include "Scheduler.h"
 #include "PublicData.h"
 #include "StreamOutputPool.h"
 #include "StreamOutput.h"
@@ -94,7 +95,7 @@ void FilamentDetector::on_module_loaded()
         register_for_event(ON_SECOND_TICK);
     }
 
-    register_for_event(ON_MAIN_LOOP);
+    THEKERNEL->scheduler->add_task("filament", this, &Module::on_main_loop, Scheduler::MAIN_LOOP);
     register_for_event(ON_CONSOLE_LINE_RECEIVED);
     this->register_for_event(ON_GCODE_RECEIVED);
 }
@@ -111,7 +111,7 @@ void Laser::on_module_loaded()
     this->register_for_event(ON_HALT);
     this->register_for_event(ON_GCODE_RECEIVED);
     this->register_for_event(ON_CONSOLE_LINE_RECEIVED);
-    this->register_for_event(ON_GET_PUBLIC_DATA);
+    this->register_for_public_data(ON_GET_PUBLIC_DATA, laser_checksum);
 
     // no point in updating the power more than the PWM frequency, but not faster than 1KHz
     ms_per_tick = 1000 / std::min(1000UL, 1000000 / period);
@@ -123,12 +123,12 @@ void Laser::on_console_line_received( void *argument )
     if(THEKERNEL->is_halted()) return; // if in halted state ignore any commands
 
     SerialMessage *msgp = static_cast<SerialMessage *>(argument);
-    string possible_command = msgp->message;
 
     // ignore anything that is not lowercase or a letter
-    if(possible_command.empty() || !islower(possible_command[0]) || !isalpha(possible_command[0])) {
+    if(msgp->message.empty() || !islower(msgp->message[0]) || !isalpha(msgp->message[0])) {
         return;
     }
+    string possible_command = msgp->message;
 
     string cmd = shift_parameter(possible_command);
 
@@ -206,10 +206,10 @@ void Laser::on_gcode_received(void *argument)
 // calculates the current speed ratio from the currently executing block
 float Laser::current_speed_ratio(const Block *block) const
 {
-    // find the primary moving actuator (the one with the most steps)
+    // find the primary moving actuator (the one with the most steps), a block that follows a path is timed by its path axis in tick_info[0]
     size_t pm = 0;
     uint32_t max_steps = 0;
-    for (size_t i = 0; i < THEROBOT->get_number_registered_motors(); i++) {
+    for (size_t i = 0; !block->follows_path && i < THEROBOT->get_number_registered_motors(); i++) {
         // find the motor with the most steps
         if(block->steps[i] > max_steps) {
             max_steps = block->steps[i];
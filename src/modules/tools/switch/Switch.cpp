@@ -15,6 +15,7 @@
 #include "PublicDataRequest.h"
 #include "SwitchPublicAccess.h"
 #include "SlowTicker.h"
+#include "Scheduler.h"
 #include "Config.h"
 #include "Gcode.h"
 #include "checksumm.h"
@@ -81,9 +82,9 @@ void Switch::on_module_loaded()
     this->switch_changed = false;
 
     this->register_for_event(ON_GCODE_RECEIVED);
-    this->register_for_event(ON_MAIN_LOOP);
-    this->register_for_event(ON_GET_PUBLIC_DATA);
-    this->register_for_event(ON_SET_PUBLIC_DATA);
+    THEKERNEL->scheduler->add_task("switch", this, &Module::on_main_loop, Scheduler::MAIN_LOOP);
+    this->register_for_public_data(ON_GET_PUBLIC_DATA, switch_checksum);
+    this->register_for_public_data(ON_SET_PUBLIC_DATA, switch_checksum);
     this->register_for_event(ON_HALT);
 
     // Settings
@@ -274,7 +275,7 @@ void Switch::on_config_reload(void *argument)
 
     if(this->output_type == SIGMADELTA) {
         // SIGMADELTA
-        THEKERNEL->slow_ticker->attach(1000, this->sigmadelta_pin, &Pwm::on_tick);
+        THEKERNEL->slow_ticker->attach(1000, this->sigmadelta_pin, &Pwm::on_tick, SlowTicker::OUTPUT_PRIORITY);
     }
 
     // for commands we need to replace _ for space
@@ -1,6 +1,7 @@
 #include "PID_Autotuner.h"
 #include "Kernel.h"
 #include "SlowTicker.h"
+#include "Scheduler.h"
 #include "Gcode.h"
 #include "TemperatureControl.h"
 #include "StreamOutput.h"
@@ -27,8 +28,8 @@ PID_Autotuner::PID_Autotuner()
 void PID_Autotuner::on_module_loaded()
 {
     tick = false;
+    idle_task= THEKERNEL->scheduler->add_task("autopid", this, &Module::on_idle);
     THEKERNEL->slow_ticker->attach(20, this, &PID_Autotuner::on_tick );
-    register_for_event(ON_IDLE);
     register_for_event(ON_GCODE_RECEIVED);
 }
 
@@ -138,8 +139,10 @@ void PID_Autotuner::on_gcode_received(void *argument)
 
 uint32_t PID_Autotuner::on_tick(uint32_t dummy)
 {
-    if (temp_control != NULL)
+    if (temp_control != NULL) {
         tick = true;
+        THEKERNEL->scheduler->post_task(idle_task);
+    }
 
     tickCnt += (1000 / 20); // millisecond tick count
     return 0;
@@ -43,6 +43,7 @@ private:
     float oStep;
     int output;
     volatile unsigned long tickCnt;
+    uint32_t idle_task;
     struct {
         bool justchanged:1;
         volatile bool tick:1;
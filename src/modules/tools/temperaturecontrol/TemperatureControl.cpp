@@ -21,6 +21,7 @@
 #include "checksumm.h"
 #include "Gcode.h"
 #include "SlowTicker.h"
+#include "Scheduler.h"
 #include "ConfigValue.h"
 #include "PID_Autotuner.h"
 #include "SerialMessage.h"
@@ -96,12 +97,13 @@ void TemperatureControl::on_module_loaded()
 
     // Register for events
     this->register_for_event(ON_GCODE_RECEIVED);
-    this->register_for_event(ON_GET_PUBLIC_DATA);
-    this->register_for_event(ON_IDLE);
+    this->register_for_public_data(ON_GET_PUBLIC_DATA, temperature_control_checksum);
+    // run after each reading, to report a violation and for sensors that are read outside of the interrupt
+    this->idle_task= THEKERNEL->scheduler->add_task("temperature", this, &Module::on_idle);
 
     if(!this->readonly) {
         this->register_for_event(ON_SECOND_TICK);
-        this->register_for_event(ON_SET_PUBLIC_DATA);
+        this->register_for_public_data(ON_SET_PUBLIC_DATA, temperature_control_checksum);
         this->register_for_event(ON_HALT);
     }
 }
@@ -203,7 +205,7 @@ void TemperatureControl::load_config()
         this->heater_pin.set(0);
         set_low_on_debug(heater_pin.port_number, heater_pin.pin);
         // activate SD-DAC timer
-        THEKERNEL->slow_ticker->attach( THEKERNEL->config->value(temperature_control_checksum, this->name_checksum, pwm_frequency_checksum)->by_default(2000)->as_number(), &heater_pin, &Pwm::on_tick);
+        THEKERNEL->slow_ticker->attach( THEKERNEL->config->value(temperature_control_checksum, this->name_checksum, pwm_frequency_checksum)->by_default(2000)->as_number(), &heater_pin, &Pwm::on_tick, SlowTicker::OUTPUT_PRIORITY);
     }
 
 
@@ -480,6 +482,7 @@ uint32_t TemperatureControl::thermistor_read_tick(uint32_t dummy)
     }
 
     last_reading = temperature;
+    THEKERNEL->scheduler->post_task(idle_task);
     return 0;
 }
 
@@ -56,6 +56,7 @@ class TemperatureControl : public Module {
         float last_reading;
         float readings_per_second;
         Pwm  heater_pin;
+        uint32_t idle_task;
 
         std::string designator;
 
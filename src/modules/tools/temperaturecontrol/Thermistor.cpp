@@ -20,6 +20,7 @@
 #include "predefined_thermistors.h"
 
 #include <fastmath.h>
+#include <algorithm>
 
 #include "MRI_Hooks.h"
 
@@ -38,6 +39,12 @@
 #define coefficients_checksum              CHECKSUM("coefficients")
 #define use_beta_table_checksum            CHECKSUM("use_beta_table")
 
+// the table is in 1/64 °C, between its entries it is within table_tolerance of the formula, and readings hotter than
+// table_max_temp use the formula
+#define table_scale 64
+#define table_tolerance 0.05F
+#define table_max_temp 450.0F
+
 
 Thermistor::Thermistor()
 {
@@ -180,6 +187,7 @@ void Thermistor::UpdateConfig(uint16_t module_checksum, uint16_t name_checksum)
         return;
     }
 
+    build_table();
 }
 
 // print out predefined thermistors
@@ -234,10 +242,82 @@ void Thermistor::calc_jk()
     }
 }
 
+// the ADC values where the temperature is between table_max_temp and the coldest reading that is not taken as an open
+// circuit, split until the line between each pair of entries is close enough to the curve
+void Thermistor::build_table()
+{
+    table.clear();
+    if(!bad_config) {
+        const uint32_t max_adc_value= THEKERNEL->adc->get_max_value();
+
+        // the temperature falls as the ADC value rises, find the last reading with a temperature
+        uint32_t a= 1, b= max_adc_value - 1;
+        while(a < b) {
+            uint32_t m= (a + b + 1) / 2;
+            if(isfinite(adc_value_to_temperature(m))) a= m;
+            else b= m - 1;
+        }
+        uint32_t hi= a;
+
+        // then the first that is not hotter than table_max_temp
+        a= 1;
+        b= hi;
+        while(a < b) {
+            uint32_t m= (a + b) / 2;
+            float t= adc_value_to_temperature(m);
+            if(t <= table_max_temp && t > -273.15F) b= m;
+            else a= m + 1;
+        }
+        uint32_t lo= a;
+
+        if(hi > lo + 1) {
+            // a segment could be curved with its middle on the line, so the curve is first split in 16
+            uint32_t pa= lo;
+            float pt= adc_value_to_temperature(lo);
+            table.push_back({(uint16_t)lo, (int16_t)lroundf(pt * table_scale)});
+            for (int i = 1; i <= 16; ++i) {
+                uint32_t na= lo + (hi - lo) * i / 16;
+                float nt= adc_value_to_temperature(na);
+                split_table(pa, pt, na, nt);
+                pa= na;
+                pt= nt;
+            }
+        }
+    }
+    table.shrink_to_fit();
+}
+
+// adds the entries after a up to b
+void Thermistor::split_table(uint32_t a, float ta, uint32_t b, float tb)
+{
+    if(b - a > 1) {
+        uint32_t m= (a + b) / 2;
+        float tm= adc_value_to_temperature(m);
+        if(fabsf(ta + (tb - ta) * (m - a) / (b - a) - tm) > table_tolerance) {
+            split_table(a, ta, m, tm);
+            split_table(m, tm, b, tb);
+            return;
+        }
+    }
+    table.push_back({(uint16_t)b, (int16_t)lroundf(tb * table_scale)});
+}
+
+// interpolates between the two table entries either side of the reading, in integers
+float Thermistor::table_temperature(uint32_t adc_value)
+{
+    if(table.empty() || adc_value < table.front().adc || adc_value >= table.back().adc)
+        return adc_value_to_temperature(adc_value);
+
+    auto e= std::upper_bound(table.begin(), table.end(), adc_value, [](uint32_t v, const table_entry_t &i) { return v < i.adc; });
+    const table_entry_t &p= *(e - 1);
+    int32_t t= p.t + (int32_t)(e->t - p.t) * (int32_t)(adc_value - p.adc) / (int32_t)(e->adc - p.adc);
+    return t * (1.0F / table_scale);
+}
+
 float Thermistor::get_temperature()
 {
     if(bad_config) return infinityf();
-    float t= adc_value_to_temperature(new_thermistor_reading());
+    float t= table_temperature(new_thermistor_reading());
     // keep track of min/max for M305
     if(t > max_temp) max_temp= t;
     if(t < min_temp) min_temp= t;
@@ -270,6 +350,8 @@ void Thermistor::get_raw()
         THEKERNEL->streams->printf("beta temp= %f, min= %f, max= %f, delta= %f\n", t, min_temp, max_temp, max_temp-min_temp);
     }
 
+    THEKERNEL->streams->printf("%d table entries from adc %d to %d\n", table.size(), table.empty() ? 0 : table.front().adc, table.empty() ? 0 : table.back().adc);
+
     // if using a predefined thermistor show its name and which table it is from
     if(thermistor_number != 0) {
         string name= (thermistor_number&0x80) ? predefined_thermistors_beta[(thermistor_number&0x7F)-1].name :  predefined_thermistors[thermistor_number-1].name;
@@ -352,6 +434,7 @@ bool Thermistor::set_optional(const sensor_options_t& options) {
             calc_jk();
             thermistor_number= predefined;
             this->bad_config= false;
+            build_table();
             return true;
 
         }else {
@@ -370,6 +453,7 @@ bool Thermistor::set_optional(const sensor_options_t& options) {
             use_steinhart_hart= true;
             thermistor_number= predefined;
             this->bad_config= false;
+            build_table();
             return true;
         }
     }
@@ -397,6 +481,7 @@ bool Thermistor::set_optional(const sensor_options_t& options) {
 
     if(this->bad_config) this->bad_config= false;
 
+    build_table();
     return true;
 }
 
@@ -13,6 +13,7 @@
 #include "Pin.h"
 
 #include <tuple>
+#include <vector>
 
 #define QUEUE_LEN 32
 
@@ -36,6 +37,9 @@ class Thermistor : public TempSensor
     private:
         int new_thermistor_reading();
         float adc_value_to_temperature(uint32_t adc_value);
+        float table_temperature(uint32_t adc_value);
+        void build_table();
+        void split_table(uint32_t a, float ta, uint32_t b, float tb);
         void calc_jk();
 
         // Thermistor computation settings using beta, not used if using Steinhart-Hart
@@ -62,6 +66,14 @@ class Thermistor : public TempSensor
 
         Pin  thermistor_pin;
 
+        // the temperature in 1/64 °C at ADC values along the curve, closer together where it bends more, so the
+        // temperature between them is within 0.05 °C of the formula. Readings outside it use the formula.
+        struct table_entry_t {
+            uint16_t adc;
+            int16_t t;
+        };
+        std::vector<table_entry_t> table;
+
         float min_temp, max_temp;
         struct {
             bool bad_config:1;
@@ -35,8 +35,8 @@ void ToolManager::on_module_loaded()
 {
 
     this->register_for_event(ON_GCODE_RECEIVED);
-    this->register_for_event(ON_GET_PUBLIC_DATA);
-    this->register_for_event(ON_SET_PUBLIC_DATA);
+    this->register_for_public_data(ON_GET_PUBLIC_DATA, tool_manager_checksum);
+    this->register_for_public_data(ON_SET_PUBLIC_DATA, tool_manager_checksum);
 }
 
 void ToolManager::on_gcode_received(void *argument)
@@ -73,7 +73,7 @@ void ZProbe::on_module_loaded()
 
     // we read the probe in this timer
     probing= false;
-    THEKERNEL->slow_ticker->attach(1000, this, &ZProbe::read_probe);
+    THEKERNEL->slow_ticker->attach(1000, this, &ZProbe::read_probe, SlowTicker::SAFETY_PRIORITY);
 }
 
 void ZProbe::config_load()
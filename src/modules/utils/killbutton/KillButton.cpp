@@ -4,6 +4,7 @@
 #include "libs/utils.h"
 #include "Config.h"
 #include "SlowTicker.h"
+#include "Scheduler.h"
 #include "libs/SerialMessage.h"
 #include "libs/StreamOutput.h"
 #include "checksumm.h"
@@ -44,7 +45,7 @@ void KillButton::on_module_loaded()
     this->unkill_enable = THEKERNEL->config->value( unkill_checksum )->by_default(true)->as_bool();
     this->toggle_enable = THEKERNEL->config->value( toggle_checksum )->by_default(false)->as_bool();
 
-    this->register_for_event(ON_IDLE);
+    this->idle_task= THEKERNEL->scheduler->add_task("killbutton", this, &Module::on_idle);
 
     this->poll_frequency = THEKERNEL->config->value( poll_frequency_checksum )->by_default(5)->as_number();
     THEKERNEL->slow_ticker->attach( this->poll_frequency, this, &KillButton::button_tick );
@@ -121,5 +122,7 @@ uint32_t KillButton::button_tick(uint32_t dummy)
                 break;
     }
 
+    if(state == KILL_BUTTON_DOWN || state == UNKILL_FIRE) THEKERNEL->scheduler->post_task(idle_task);
+
     return 0;
 }
@@ -32,4 +32,5 @@ class KillButton : public Module {
         };
 
         uint32_t poll_frequency;
+        uint32_t idle_task;
 };
@@ -8,6 +8,7 @@
 #include "Robot.h"
 #include "StepperMotor.h"
 #include "PublicDataRequest.h"
+#include "Scheduler.h"
 
 #include "Gcode.h"
 #include "Config.h"
@@ -181,7 +182,7 @@ bool MotorDriverControl::config_module(uint16_t cs)
     this->register_for_event(ON_GCODE_RECEIVED);
     this->register_for_event(ON_HALT);
     this->register_for_event(ON_ENABLE);
-    this->register_for_event(ON_IDLE);
+    this->idle_task= THEKERNEL->scheduler->add_task("motordriver", this, &Module::on_idle);
 
     if( THEKERNEL->config->value(motor_driver_control_checksum, cs, alarm_checksum )->by_default(false)->as_bool() ) {
         halt_on_alarm= THEKERNEL->config->value(motor_driver_control_checksum, cs, halt_on_alarm_checksum )->by_default(false)->as_bool();
@@ -205,10 +206,12 @@ void MotorDriverControl::on_enable(void *argument)
     if(bm == 0x01) {
         enable_event= true;
         enable_flg= true;
+        THEKERNEL->scheduler->post_task(idle_task);
 
     }else if(bm == 0 || ( (bm&0x01) == 0 && (bm&(0x02<<i)) != 0 )) {
         enable_event= true;
         enable_flg= false;
+        THEKERNEL->scheduler->post_task(idle_task);
     }
 }
 
@@ -60,6 +60,7 @@ class MotorDriverControl : public Module {
         uint32_t microsteps;
 
         char axis;
+        uint32_t idle_task;
 
         struct{
             uint8_t id:4;
@@ -19,6 +19,7 @@
 #include "CustomScreen.h"
 #include "MainMenuScreen.h"
 #include "SlowTicker.h"
+#include "Scheduler.h"
 #include "Gcode.h"
 #include "TemperatureControlPublicAccess.h"
 #include "ModifyValuesScreen.h"
@@ -202,9 +203,9 @@ void Panel::on_module_loaded()
     this->display_extruder = THEKERNEL->config->value( panel_checksum, display_extruder_checksum )->by_default(false)->as_bool();
 
     // Register for events
-    this->register_for_event(ON_IDLE);
-    this->register_for_event(ON_MAIN_LOOP);
-    this->register_for_event(ON_SET_PUBLIC_DATA);
+    THEKERNEL->scheduler->add_task("panel", this, &Module::on_idle, Scheduler::IDLE);
+    THEKERNEL->scheduler->add_task("panel", this, &Module::on_main_loop, Scheduler::MAIN_LOOP);
+    this->register_for_public_data(ON_SET_PUBLIC_DATA, panel_checksum);
 
     // Refresh timer
     THEKERNEL->slow_ticker->attach( 20, this, &Panel::refresh_tick );
@@ -0,0 +1,117 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "CompiledJob.h"
+
+#include "ReadAhead.h"
+#include "libs/Kernel.h"
+#include "libs/SerialMessage.h"
+#include "libs/StreamOutput.h"
+#include "GcodeDispatch.h"
+#include "Gcode.h"
+
+#include <string.h>
+
+static_assert(sizeof(CompiledJobHeader) == 64, "the header is one record");
+static_assert(sizeof(CompiledJobRecord) == 64, "8 records fit in a sector");
+static_assert(sizeof(CompiledJobCheckpoint) == 24, "checkpoints are packed");
+
+#define record_size sizeof(CompiledJobRecord)
+#define sector_size 512
+
+bool CompiledJob::read_header(FILE *fp, CompiledJobHeader &header)
+{
+    fseek(fp, 0, SEEK_SET);
+    bool ok= fread(&header, sizeof(header), 1, fp) == 1 && memcmp(header.magic, COMPILED_JOB_MAGIC, sizeof(header.magic)) == 0;
+    fseek(fp, 0, SEEK_SET);
+    return ok;
+}
+
+bool CompiledJob::start(FILE *fp, const CompiledJobHeader &header, ReadAhead &reader, size_t size, uint32_t &line, std::string &setup)
+{
+    // the last checkpoint at or before line, they are in line order after the end record
+    CompiledJobCheckpoint cp;
+    bool found= false;
+    if(line > 0) {
+        fseek(fp, (header.records + 2) * record_size, SEEK_SET);
+        CompiledJobCheckpoint c;
+        for (uint32_t i = 0; i < header.checkpoints && fread(&c, sizeof(c), 1, fp) == 1 && c.line <= line; ++i) {
+            cp= c;
+            found= true;
+        }
+    }
+
+    uint32_t record= found ? cp.record : 0;
+    line= found ? cp.line : 1;
+    setup.clear();
+    if(found) {
+        char buf[32];
+        setup.append(cp.flags & INCHES ? "G20" : "G21").append(cp.flags & RELATIVE ? " G91" : " G90");
+        // M83 after G90 as G90 and G91 set the extruder too
+        setup.append(cp.flags & RELATIVE_E ? " M83" : " M82");
+        snprintf(buf, sizeof(buf), " G%d", cp.plane);
+        setup.append(buf);
+        if(cp.wcs < 6) snprintf(buf, sizeof(buf), " G%d", 54 + cp.wcs);
+        else snprintf(buf, sizeof(buf), " G59.%d", cp.wcs - 5);
+        setup.append(buf);
+        if(cp.flags & HAS_SEEK) {
+            snprintf(buf, sizeof(buf), " G0 F%1.4f", cp.seek_rate);
+            setup.append(buf);
+        }
+        if(cp.flags & (HAS_FEED | HAS_S)) setup.append(" G1");
+        if(cp.flags & HAS_FEED) {
+            snprintf(buf, sizeof(buf), " F%1.4f", cp.feed_rate);
+            setup.append(buf);
+        }
+        if(cp.flags & HAS_S) {
+            snprintf(buf, sizeof(buf), " S%1.4f", cp.s_value);
+            setup.append(buf);
+        }
+    }
+
+    // the reads are kept to whole sectors, the records before the first one played are skipped
+    uint32_t offset= (record + 1) * record_size;
+    fseek(fp, offset & ~(sector_size - 1), SEEK_SET);
+    if(!reader.start(fp, size)) return false;
+    for (uint32_t n = (offset & (sector_size - 1)) / record_size; n > 0; --n) reader.next_block(record_size);
+    reader.stats.lines= 0;
+    return true;
+}
+
+bool CompiledJob::play_next(ReadAhead &reader, SerialMessage &message, StreamOutput *echo)
+{
+    const CompiledJobRecord *r= (const CompiledJobRecord *)reader.next_block(record_size);
+    if(r == nullptr || r->type == CompiledJobRecord::END) return false;
+
+    if(r->type <= CompiledJobRecord::G3) {
+        if(echo != nullptr) {
+            echo->printf("G%d", r->type);
+            for (int l = 0, i = 0; l < 26; ++l) {
+                if(r->move.letters & (1 << l)) echo->printf(" %c%1.4f", 'A' + l, r->move.values[i++]);
+            }
+            echo->printf("\n");
+        }
+        // the values are copied out of the record before the next one is read
+        THEKERNEL->gcode_dispatch->dispatch_move(new Gcode(r->type, r->move.letters, r->move.values, message.stream));
+        return true;
+    }
+
+    // the text carries on into the records after this one
+    size_t len= r->length;
+    size_t n= len < sizeof(r->text) ? len : sizeof(r->text);
+    message.message.assign(r->text, n);
+    for (len -= n; len > 0; len -= n) {
+        const char *more= reader.next_block(record_size);
+        if(more == nullptr) return false;
+        n= len < record_size ? len : record_size;
+        message.message.append(more, n);
+    }
+
+    if(echo != nullptr) echo->printf("%s\n", message.message.c_str());
+    THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &message);
+    return true;
+}
@@ -0,0 +1,86 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string>
+
+class ReadAhead;
+class StreamOutput;
+struct SerialMessage;
+
+// A compiled job is a gcode file converted on a host by gcode2job (see hostsim/Readme.md), so a job that is played
+// over and over is not parsed every time. The Player plays it instead of the text when a file starts with the magic.
+//
+// It is all little endian 64 byte records, so 8 fit in a sector and a record is never split over the chunks the file
+// is read in. The header is followed by one record for each line of the gcode that does anything, then an end record
+// and then the checkpoints. A G0 to G3 move is kept as the letters and values of its words, with the motion mode of a
+// line with no G already resolved, and is dispatched as it is. Anything else is kept as the text of the line, without
+// its comments, and carries on into as many of the following records as it needs.
+//
+// A checkpoint is kept on a G0 or G1 every so many lines, with the modal state at that line, so a job can be started
+// part way through from the checkpoint at or before a line (play file -l line). The position is not kept, the first
+// move goes straight to where the line says from wherever the machine is.
+#define COMPILED_JOB_MAGIC "SMJOB001"
+
+struct CompiledJobHeader {
+    char magic[8];
+    uint32_t records;       // not counting the header and end records
+    uint32_t checkpoints;
+    uint32_t lines;         // in the gcode file it was made from
+    uint8_t reserved[44];
+};
+
+struct CompiledJobRecord {
+    enum TYPE : uint8_t { G0= 0, G1, G2, G3, TEXT= 0x80, END= 0xFF };
+
+    uint8_t type;
+    uint8_t length;         // TEXT: the length of the text
+    uint16_t reserved;
+    uint32_t line;          // the line of the gcode file it was made from, starting at 1
+    union {
+        struct {
+            uint32_t letters;   // bit n is set for letter 'A' + n
+            float values[10];   // one for each letter in letter order
+        } move;
+        char text[56];
+    };
+};
+
+struct CompiledJobCheckpoint {
+    uint32_t record;        // the first record of the line
+    uint32_t line;
+    uint8_t flags;          // CompiledJob::FLAGS, and whether the rates below were given
+    uint8_t plane;          // 17, 18 or 19
+    uint8_t wcs;            // 0 to 8 for G54 to G59.3
+    uint8_t reserved;
+    float seek_rate;        // the last F given to a G0, in the units of the file
+    float feed_rate;        // the last F given to a G1 to G3
+    float s_value;          // the last S given to a G0 to G3
+};
+
+class CompiledJob {
+    public:
+        enum FLAGS { INCHES= 1, RELATIVE= 2, RELATIVE_E= 4, HAS_SEEK= 8, HAS_FEED= 16, HAS_S= 32 };
+
+        // returns true if fp is a compiled job and reads its header, fp is left at the start of the file either way
+        static bool read_header(FILE *fp, CompiledJobHeader &header);
+
+        // starts reader on the job, at the start or at the checkpoint at or before line if it is not 0. Sets line to
+        // the line it starts at and setup to the gcode that puts back the modal state there, and returns false if
+        // there is not enough memory to read it
+        static bool start(FILE *fp, const CompiledJobHeader &header, ReadAhead &reader, size_t size, uint32_t &line, std::string &setup);
+
+        // dispatches the next record from reader, a move straight to GcodeDispatch and text as a line through message,
+        // both reply on message.stream. Each is echoed on echo if it is not null. Returns false at the end of the job
+        static bool play_next(ReadAhead &reader, SerialMessage &message, StreamOutput *echo);
+
+        // the size of the records that are played, for the progress
+        static uint32_t played_size(const CompiledJobHeader &header) { return (header.records + 2) * sizeof(CompiledJobRecord); }
+};
@@ -15,6 +15,7 @@
 #include "libs/SerialMessage.h"
 #include "libs/StreamOutputPool.h"
 #include "libs/StreamOutput.h"
+#include "libs/Scheduler.h"
 #include "Gcode.h"
 #include "checksumm.h"
 #include "Config.h"
@@ -29,6 +30,7 @@
 #include "TemperatureControlPublicAccess.h"
 #include "TemperatureControlPool.h"
 #include "ExtruderPublicAccess.h"
+#include "CompiledJob.h"
 
 #include <cstddef>
 #include <cmath>
@@ -41,6 +43,7 @@
 #define after_suspend_gcode_checksum      CHECKSUM("after_suspend_gcode")
 #define before_resume_gcode_checksum      CHECKSUM("before_resume_gcode")
 #define leave_heaters_on_suspend_checksum CHECKSUM("leave_heaters_on_suspend")
+#define play_read_ahead_checksum          CHECKSUM("play_read_ahead")
 
 extern SDFAT mounter;
 
@@ -54,15 +57,18 @@ Player::Player()
     this->suspended= false;
     this->suspend_loops= 0;
     this->abort_flag= false;
+    this->compiled_job= false;
+    this->start_line= 0;
 }
 
 void Player::on_module_loaded()
 {
     this->register_for_event(ON_CONSOLE_LINE_RECEIVED);
-    this->register_for_event(ON_MAIN_LOOP);
+    THEKERNEL->scheduler->add_task("player", this, &Module::on_main_loop, Scheduler::MAIN_LOOP);
+    THEKERNEL->scheduler->add_task("player", this, &Module::on_idle, Scheduler::IDLE);
     this->register_for_event(ON_SECOND_TICK);
-    this->register_for_event(ON_GET_PUBLIC_DATA);
-    this->register_for_event(ON_SET_PUBLIC_DATA);
+    this->register_for_public_data(ON_GET_PUBLIC_DATA, player_checksum);
+    this->register_for_public_data(ON_SET_PUBLIC_DATA, player_checksum);
     this->register_for_event(ON_GCODE_RECEIVED);
     this->register_for_event(ON_HALT);
 
@@ -74,6 +80,8 @@ void Player::on_module_loaded()
     std::replace( this->after_suspend_gcode.begin(), this->after_suspend_gcode.end(), '_', ' '); // replace _ with space
     std::replace( this->before_resume_gcode.begin(), this->before_resume_gcode.end(), '_', ' '); // replace _ with space
     this->leave_heaters_on = THEKERNEL->config->value(leave_heaters_on_suspend_checksum)->by_default(false)->as_bool();
+    // bytes of the file being played to read ahead, read in two chunks of half that each
+    this->read_ahead_size = THEKERNEL->config->value(play_read_ahead_checksum)->by_default(4096)->as_number();
 }
 
 // this can be called from on_idle so nothing downstream can call on_idle
@@ -127,9 +135,11 @@ void Player::on_gcode_received(void *argument)
         } else if (gcode->m == 23) { // select file
             this->filename = "/sd/" + args; // filename is whatever is in args
             this->current_stream = nullptr;
+            this->start_line = 0;
 
             if(this->current_file_handler != NULL) {
                 this->playing_file = false;
+                this->reader.stop();
                 fclose(this->current_file_handler);
             }
             this->current_file_handler = fopen( this->filename.c_str(), "r");
@@ -184,6 +194,7 @@ void Player::on_gcode_received(void *argument)
                     } else {
                         this->filename = currentfn;
                         this->file_size = old_size;
+                        this->start_line = 0;
                         this->current_stream = nullptr;
                     }
                 }
@@ -198,9 +209,11 @@ void Player::on_gcode_received(void *argument)
             // Get filename
             this->filename = "/sd/" + args; // filename is whatever is in args including spaces
             this->current_stream = nullptr;
+            this->start_line = 0;
 
             if(this->current_file_handler != NULL) {
                 this->playing_file = false;
+                this->reader.stop();
                 fclose(this->current_file_handler);
             }
 
@@ -249,15 +262,15 @@ void Player::on_console_line_received( void *argument )
 {
     if(THEKERNEL->is_halted()) return; // if in halted state ignore any commands
 
-    SerialMessage new_message = *static_cast<SerialMessage *>(argument);
-
-    string possible_command = new_message.message;
+    SerialMessage &new_message = *static_cast<SerialMessage *>(argument);
 
     // ignore anything that is not lowercase or a letter
-    if(possible_command.empty() || !islower(possible_command[0]) || !isalpha(possible_command[0])) {
+    if(new_message.message.empty() || !islower(new_message.message[0]) || !isalpha(new_message.message[0])) {
         return;
     }
 
+    string possible_command = new_message.message;
+
     string cmd = shift_parameter(possible_command);
 
     //new_message.stream->printf("Received %s\r\n", possible_command.c_str());
@@ -273,6 +286,8 @@ void Player::on_console_line_received( void *argument )
         this->suspend_command( possible_command, new_message.stream );
     }else if (cmd == "resume") {
         this->resume_command( possible_command, new_message.stream );
+    }else if (cmd == "playstats") {
+        this->playstats_command( possible_command, new_message.stream );
     }
 }
 
@@ -290,6 +305,7 @@ void Player::play_command( string parameters, StreamOutput *stream )
     }
 
     if(this->current_file_handler != NULL) { // must have been a paused print
+        this->reader.stop();
         fclose(this->current_file_handler);
     }
 
@@ -299,6 +315,20 @@ void Player::play_command( string parameters, StreamOutput *stream )
         return;
     }
 
+    // -l line starts a compiled job at the checkpoint at or before that line
+    size_t pos = options.find("-l");
+    this->start_line = pos == string::npos ? 0 : strtoul(options.c_str() + pos + 2, nullptr, 10);
+    if(this->start_line > 0) {
+        CompiledJobHeader header;
+        if(!CompiledJob::read_header(this->current_file_handler, header)) {
+            stream->printf("Only a compiled job can be started part way through\r\n");
+            fclose(this->current_file_handler);
+            this->current_file_handler = NULL;
+            this->start_line = 0;
+            return;
+        }
+    }
+
     stream->printf("Playing %s\r\n", this->filename.c_str());
 
     this->playing_file = true;
@@ -381,6 +411,7 @@ void Player::abort_command( string parameters, StreamOutput *stream )
     file_size = 0;
     this->filename = "";
     this->current_stream = NULL;
+    this->reader.stop();
     fclose(current_file_handler);
     current_file_handler = NULL;
     if(parameters.empty()) {
@@ -427,44 +458,62 @@ void Player::on_main_loop(void *argument)
             return;
         }
 
-        char buf[130]; // lines upto 128 characters are allowed, anything longer is discarded
-        bool discard = false;
+        // the buffer is only taken when the file starts playing, so a selected file that is not played does not use it
+        if(!this->reader.is_started()) {
+            CompiledJobHeader header;
+            string setup;
+            uint32_t line = this->start_line;
+            this->compiled_job = CompiledJob::read_header(this->current_file_handler, header);
+            bool started = this->compiled_job ? CompiledJob::start(this->current_file_handler, header, this->reader, this->read_ahead_size, line, setup)
+                                              : this->reader.start(this->current_file_handler, this->read_ahead_size);
+            if(!started) {
+                THEKERNEL->streams->printf("Not enough memory to play the file\r\n");
+                abort_command("1", &(StreamOutput::NullStream));
+                return;
+            }
 
-        while(fgets(buf, sizeof(buf), this->current_file_handler) != NULL) {
-            int len = strlen(buf);
-            if(len == 0) continue; // empty line? should not be possible
-            if(buf[len - 1] == '\n' || feof(this->current_file_handler)) {
-                if(discard) { // we are discarding a long line
-                    discard = false;
-                    continue;
-                }
-                if(len == 1) continue; // empty line
-                if(buf[len - 2] == '\r') {
-                    // \r\n terminated ignore \r
-                    len -=1;
-                    if(len == 1) continue; // empty line
-                }
-                if(this->current_stream != nullptr) {
-                    this->current_stream->printf("%s", buf);
-                }
+            if(this->compiled_job) {
+                // the progress is of the records played
+                this->file_size = CompiledJob::played_size(header);
+                this->played_cnt = this->reader.get_consumed();
+            }
+            if(!setup.empty()) {
+                // put back the modal state the job had at the line it starts at
+                THEKERNEL->streams->printf("Starting at line %lu\r\n", line);
+                this->message.message = setup;
+                this->message.stream = this->current_stream == nullptr ? &(StreamOutput::NullStream) : this->current_stream;
+                THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &this->message);
+                return;
+            }
+        }
+
+        if(this->compiled_job) {
+            // moves go straight to the planner, the rest is played as lines
+            this->message.stream = this->current_stream == nullptr ? &(StreamOutput::NullStream) : this->current_stream;
+            if(CompiledJob::play_next(this->reader, this->message, this->current_stream)) {
+                played_cnt = this->reader.get_consumed();
+                return;
+            }
+
+        } else {
+            uint32_t discarded = this->reader.stats.discarded;
+            size_t len;
+            const char *line = this->reader.next_line(len);
+            if(this->reader.stats.discarded != discarded && this->current_stream != nullptr) {
+                this->current_stream->printf("Warning: Discarded long line\n");
+            }
 
-                struct SerialMessage message;
-                if(buf[len-1] == '\n' || buf[len-1] == '\r') {
-                    message.message.assign(buf, len-1); // we do not want to include the \n
-                }else{
-                    message.message.assign(buf, len);
+            if(line != nullptr) {
+                this->message.message.assign(line, len);
+                if(this->current_stream != nullptr) {
+                    this->current_stream->printf("%s\n", this->message.message.c_str());
                 }
-                message.stream = this->current_stream == nullptr ? &(StreamOutput::NullStream) : this->current_stream;
+                this->message.stream = this->current_stream == nullptr ? &(StreamOutput::NullStream) : this->current_stream;
 
                 // waits for the queue to have enough room
-                THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &message);
-                played_cnt += len;
+                THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &this->message);
+                played_cnt = this->reader.get_consumed();
                 return; // we feed one line per main loop
-
-            } else {
-                // discard long line
-                if(this->current_stream != nullptr) { this->current_stream->printf("Warning: Discarded long line\n"); }
-                discard = true;
             }
         }
 
@@ -472,6 +521,9 @@ void Player::on_main_loop(void *argument)
         this->filename = "";
         played_cnt = 0;
         file_size = 0;
+        this->reader.stop();
+        // the queue runs dry at the end of the file, that is not an underrun
+        THECONVEYOR->expect_idle();
         fclose(this->current_file_handler);
         current_file_handler = NULL;
         this->current_stream = NULL;
@@ -484,6 +536,33 @@ void Player::on_main_loop(void *argument)
     }
 }
 
+// the queue is full, so read the next chunk of the file now rather than when its first line is wanted
+void Player::on_idle(void *argument)
+{
+    if(this->playing_file) {
+        this->reader.fill();
+    }
+}
+
+// report how fast the file being played, or the last one played, was read and how long playing waited on the reads
+void Player::playstats_command( string parameters, StreamOutput *stream )
+{
+    if(this->reader.get_chunk_size() == 0) {
+        stream->printf("Nothing has been played\r\n");
+        return;
+    }
+
+    uint32_t us = this->reader.stats.fill_us + this->reader.stats.stall_us;
+    stream->printf("read %lu bytes in %lu reads of up to %u bytes, %lu lines played, %lu discarded\r\n",
+                   this->reader.stats.bytes, this->reader.stats.fills + this->reader.stats.stalls, (unsigned int)this->reader.get_chunk_size(),
+                   this->reader.stats.lines, this->reader.stats.discarded);
+    if(us > 0) {
+        stream->printf("read at %1.1f KB/s, %lu reads ahead took %lu ms, waited %lu ms on %lu reads\r\n",
+                       this->reader.stats.bytes * 1000000.0F / 1024 / us, this->reader.stats.fills, this->reader.stats.fill_us / 1000,
+                       this->reader.stats.stall_us / 1000, this->reader.stats.stalls);
+    }
+}
+
 void Player::on_get_public_data(void *argument)
 {
     PublicDataRequest *pdr = static_cast<PublicDataRequest *>(argument);
@@ -9,6 +9,8 @@
 #pragma once
 
 #include "Module.h"
+#include "ReadAhead.h"
+#include "SerialMessage.h"
 
 #include <stdio.h>
 #include <string>
@@ -25,6 +27,7 @@ class Player : public Module {
         void on_module_loaded();
         void on_console_line_received( void* argument );
         void on_main_loop( void* argument );
+        void on_idle( void* argument );
         void on_second_tick(void* argument);
         void on_get_public_data(void* argument);
         void on_set_public_data(void* argument);
@@ -37,6 +40,7 @@ class Player : public Module {
         void abort_command( string parameters, StreamOutput* stream );
         void suspend_command( string parameters, StreamOutput* stream );
         void resume_command( string parameters, StreamOutput* stream );
+        void playstats_command( string parameters, StreamOutput* stream );
         string extract_options(string& args);
         void suspend_part2();
 
@@ -48,6 +52,10 @@ class Player : public Module {
         StreamOutput* reply_stream;
 
         FILE* current_file_handler;
+        ReadAhead reader;
+        SerialMessage message; // reused for every line played
+        size_t read_ahead_size;
+        uint32_t start_line; // play -l, where to start a compiled job
         long file_size;
         unsigned long played_cnt;
         unsigned long elapsed_secs;
@@ -62,6 +70,7 @@ class Player : public Module {
             bool leave_heaters_on:1;
             bool override_leave_heaters_on:1;
             bool abort_flag:1;
+            bool compiled_job:1;
             uint8_t suspend_loops:4;
         };
 };
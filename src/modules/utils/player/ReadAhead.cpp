@@ -0,0 +1,191 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "ReadAhead.h"
+
+#include "MemoryPool.h"
+#include "platform_memory.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "mbed.h" // for us_ticker_read()
+
+// chunks are whole sectors so FatFs reads them straight into the buffer
+#define sector_size 512
+
+ReadAhead::ReadAhead()
+{
+    buf= nullptr;
+    data= nullptr;
+    half= 0;
+    memset(&stats, 0, sizeof(stats));
+}
+
+ReadAhead::~ReadAhead()
+{
+    stop();
+}
+
+bool ReadAhead::start(FILE *fp, size_t size)
+{
+    size_t h= (size / 2) & ~(sector_size - 1);
+    if(h < sector_size) h= sector_size;
+
+    if(buf != nullptr && h != half) stop();
+    // the buffer is kept in AHB0 if there is room, it is only needed while a file is played
+    for (; buf == nullptr && h >= sector_size; h /= 2) {
+        buf= (char *)AHB0.alloc(max_line + 2 * h);
+        if(buf == nullptr) buf= (char *)malloc(max_line + 2 * h);
+        if(buf != nullptr) half= h;
+    }
+    if(buf == nullptr) return false;
+
+    data= buf + max_line;
+    rd= data;
+    len[0]= len[1]= 0;
+    full[0]= full[1]= false;
+    eof= false;
+    discarding= false;
+    cur= next= 0;
+    memset(&stats, 0, sizeof(stats));
+
+    // newlib may have read ahead in its own buffer when the file size was found, so read on from where the FILE is
+    fd= fileno(fp);
+    consumed= ftell(fp);
+    lseek(fd, consumed, SEEK_SET);
+    return true;
+}
+
+void ReadAhead::stop()
+{
+    if(buf == nullptr) return;
+    if(AHB0.has(buf)) AHB0.dealloc(buf);
+    else free(buf);
+    buf= nullptr;
+}
+
+void ReadAhead::read_half(int i, bool stalled)
+{
+    uint32_t t= us_ticker_read();
+    int n= read(fd, data + i * half, half);
+    t= us_ticker_read() - t;
+
+    // a read error ends the file, as it did when the file was read with fgets
+    if(n < 0) n= 0;
+    len[i]= n;
+    full[i]= true;
+    if((size_t)n < half) eof= true;
+    next= i ^ 1;
+
+    stats.bytes += n;
+    if(stalled) {
+        ++stats.stalls;
+        stats.stall_us += t;
+    } else {
+        ++stats.fills;
+        stats.fill_us += t;
+    }
+}
+
+bool ReadAhead::fill()
+{
+    if(buf == nullptr || eof || full[next]) return false;
+    read_half(next, false);
+    return true;
+}
+
+const char *ReadAhead::next_line(size_t &n)
+{
+    if(buf == nullptr) return nullptr;
+
+    for (;;) {
+        if(!full[cur]) {
+            if(eof) return nullptr;
+            read_half(cur, true);
+        }
+
+        char *end= data + cur * half + len[cur];
+        char *line= rd;
+        char *nl= (char *)memchr(rd, '\n', end - rd);
+        if(nl != nullptr) {
+            n= nl - line;
+            rd= nl + 1;
+            consumed += n + 1;
+        } else if(len[cur] < half) {
+            // the end of the file, the last line need not have an end of line
+            n= end - line;
+            rd= end;
+            consumed += n;
+            full[cur]= false;
+            if(n == 0 && !discarding) return nullptr;
+
+        } else {
+            // the line carries on in the other half, it is read now if fill() has not read it already
+            size_t rest= end - line;
+            full[cur]= false;
+            cur ^= 1;
+            if(discarding || rest > max_line) {
+                // too long to play anyway, skip to the end of it
+                discarding= true;
+                consumed += rest;
+                rd= data + cur * half;
+            } else if(cur == 0) {
+                // put the start of the line in front of the first half so the line is in one piece
+                memcpy(data - rest, line, rest);
+                rd= data - rest;
+            }
+            continue;
+        }
+
+        if(discarding) {
+            discarding= false;
+            ++stats.discarded;
+            continue;
+        }
+        if(n > 0 && line[n - 1] == '\r') --n;
+        if(n == 0) continue;
+        if(n > max_line) {
+            ++stats.discarded;
+            continue;
+        }
+        ++stats.lines;
+        return line;
+    }
+}
+
+const char *ReadAhead::next_block(size_t size)
+{
+    if(buf == nullptr) return nullptr;
+
+    for (;;) {
+        if(!full[cur]) {
+            if(eof) return nullptr;
+            read_half(cur, true);
+        }
+
+        char *end= data + cur * half + len[cur];
+        if((size_t)(end - rd) >= size) {
+            // the half is only let go on the next call, so fill() does not read over the block
+            const char *block= rd;
+            rd += size;
+            consumed += size;
+            ++stats.lines;
+            return block;
+        }
+        if(len[cur] < half) {
+            // the end of the file, anything short of a block is left
+            full[cur]= false;
+            return nullptr;
+        }
+
+        full[cur]= false;
+        cur ^= 1;
+        rd= data + cur * half;
+    }
+}
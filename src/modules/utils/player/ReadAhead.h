@@ -0,0 +1,74 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stddef.h>
+
+// Reads a file being played in large chunks into the two halves of a buffer and splits the lines in place.
+// Each chunk is a single read() of whole sectors, which FatFs reads straight into the buffer, so neither the newlib
+// FILE buffer nor the FatFs sector cache is used. While the lines of one half are played the other half is read by
+// fill(), which the Player calls from on_idle so the SD card is read while the queue is full and not when the next
+// line is wanted.
+class ReadAhead {
+    public:
+        ReadAhead();
+        ~ReadAhead();
+
+        // starts reading fp from where it is, with a buffer of up to size bytes, a smaller one is used if there is not
+        // enough memory. Returns false if there is not even enough memory for the smallest one
+        bool start(FILE *fp, size_t size);
+        // frees the buffer, the file is left open and the stats are kept
+        void stop();
+        bool is_started() const { return buf != nullptr; }
+
+        // reads the half that is due next if it has been played, returns true if it read anything
+        bool fill();
+
+        // the next line without its end of line, or nullptr at the end of the file. Empty lines and lines longer than
+        // max_line are skipped. The line is only valid until the next call to fill() or next_line()
+        const char *next_line(size_t &len);
+
+        // the next size bytes of the file in one piece, or nullptr at the end of the file. size has to divide the chunk
+        // size, the chunks are whole sectors so any power of two up to the sector size does. The block is valid until
+        // the next call to fill() or next_block()
+        const char *next_block(size_t size);
+
+        // where in the file next_line() or next_block() will carry on from
+        uint32_t get_consumed() const { return consumed; }
+        size_t get_chunk_size() const { return half; }
+
+        static const size_t max_line= 128;
+
+        struct {
+            uint32_t bytes;     // read from the file
+            uint32_t lines;     // returned by next_line() or next_block()
+            uint32_t discarded; // lines that were too long
+            uint32_t fills;     // reads made ahead of time by fill()
+            uint32_t fill_us;
+            uint32_t stalls;    // reads next_line() had to make before it had a line
+            uint32_t stall_us;
+        } stats;
+
+    private:
+        void read_half(int i, bool stalled);
+
+        char *buf;
+        char *data;         // the two halves, after room for the start of a line carried over from the second half
+        size_t half;
+        size_t len[2];      // bytes read into each half, less than half at the end of the file
+        char *rd;           // the next byte to be split into lines
+        uint32_t consumed;
+        int fd;
+        bool full[2];       // the half has been read and not played yet
+        bool eof;
+        bool discarding;    // skipping to the end of a line that is too long
+        uint8_t cur;        // the half rd is in
+        uint8_t next;       // the half to be read next
+};
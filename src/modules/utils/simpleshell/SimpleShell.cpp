@@ -30,6 +30,10 @@
 #include "StepperMotor.h"
 #include "Configurator.h"
 #include "Block.h"
+#include "Scheduler.h"
+#include "SlowTicker.h"
+#include "Profiler.h"
+#include "StepTicker.h"
 
 #include "TemperatureControlPublicAccess.h"
 #include "EndstopsPublicAccess.h"
@@ -54,6 +58,7 @@ extern unsigned int g_maximumHeapAddress;
 #include <stdio.h>
 #include <stdint.h>
 #include <functional>
+#include <algorithm>
 
 extern "C" uint32_t  __end__;
 extern "C" uint32_t  __malloc_free_list;
@@ -78,6 +83,9 @@ const SimpleShell::ptentry_t SimpleShell::commands_table[] = {
     {"?",        SimpleShell::help_command},
     {"version",  SimpleShell::version_command},
     {"mem",      SimpleShell::mem_command},
+    {"top",      SimpleShell::top_command},
+    {"prof",     SimpleShell::prof_command},
+    {"queue",    SimpleShell::queue_command},
     {"get",      SimpleShell::get_command},
     {"set_temp", SimpleShell::set_temp_command},
     {"switch",   SimpleShell::switch_command},
@@ -95,6 +103,9 @@ const SimpleShell::ptentry_t SimpleShell::commands_table[] = {
 };
 
 int SimpleShell::reset_delay_secs = 0;
+int SimpleShell::queue_report_secs = 0;
+int SimpleShell::queue_report_count = 0;
+StreamOutput *SimpleShell::queue_report_stream = nullptr;
 
 // Adam Greens heap walk from http://mbed.org/forum/mbed/topic/2701/?page=4#comment-22556
 static uint32_t heapWalk(StreamOutput *stream, bool verbose)
@@ -169,6 +180,12 @@ void SimpleShell::on_second_tick(void *)
             system_reset(false);
         }
     }
+
+    // the queue over the last few seconds, to line up with the rate the host was sending at
+    if (queue_report_secs > 0 && ++queue_report_count >= queue_report_secs) {
+        queue_report_count = 0;
+        queue_command("-r", queue_report_stream);
+    }
 }
 
 void SimpleShell::on_gcode_received(void *argument)
@@ -185,6 +202,21 @@ void SimpleShell::on_gcode_received(void *argument)
         } else if (gcode->m == 30) { // remove file
             if(!args.empty() && !THEKERNEL->is_grbl_mode())
                 rm_command("/sd/" + args, gcode->stream);
+
+        } else if (gcode->m == 460) { // M460 [V] [R] show the probe cycles as prof does
+            prof_command(string(gcode->has_letter('V') ? "-v " : "") + (gcode->has_letter('R') ? "-r" : ""), gcode->stream);
+
+        } else if (gcode->m == 461) { // M461 [R] [S<seconds>] show the queue as the queue command does, S reports it every so many seconds, S0 stops
+            if (gcode->has_letter('S')) {
+                queue_report_secs = gcode->get_value('S');
+                queue_report_count = 0;
+                queue_report_stream = gcode->stream;
+                // each report is of the seconds since the last one
+                THECONVEYOR->reset_stats();
+                THEKERNEL->step_ticker->reset_stats();
+            } else {
+                queue_command(gcode->has_letter('R') ? "-r" : "", gcode->stream);
+            }
         }
     }
 }
@@ -204,13 +236,13 @@ bool SimpleShell::parse_command(const char *cmd, string args, StreamOutput *stre
 // When a new line is received, check if it is a command, and if it is, act upon it
 void SimpleShell::on_console_line_received( void *argument )
 {
-    SerialMessage new_message = *static_cast<SerialMessage *>(argument);
-    string possible_command = new_message.message;
+    SerialMessage &new_message = *static_cast<SerialMessage *>(argument);
 
-    // ignore anything that is not lowercase or a $ as it is not a command
-    if(possible_command.size() == 0 || (!islower(possible_command[0]) && possible_command[0] != '$')) {
+    // ignore anything that is not lowercase or a $ as it is not a command, before anything is copied as this sees every line
+    if(new_message.message.size() == 0 || (!islower(new_message.message[0]) && new_message.message[0] != '$')) {
         return;
     }
+    string possible_command = new_message.message;
 
     // it is a grbl compatible command
     if(possible_command[0] == '$' && possible_command.size() >= 2) {
@@ -280,7 +312,7 @@ void SimpleShell::on_console_line_received( void *argument )
         } else if (cmd == "config-load"){
             THEKERNEL->configurator->config_load_command(  possible_command, new_message.stream );
 
-        } else if (cmd == "play" || cmd == "progress" || cmd == "abort" || cmd == "suspend" || cmd == "resume") {
+        } else if (cmd == "play" || cmd == "progress" || cmd == "abort" || cmd == "suspend" || cmd == "resume" || cmd == "playstats") {
             // these are handled by Player module
 
         } else if (cmd == "fire") {
@@ -616,12 +648,92 @@ void SimpleShell::mem_command( string parameters, StreamOutput *stream)
     stream->printf("Total Free RAM: %lu bytes\r\n", m + f);
 
     stream->printf("Free AHB0: %lu, AHB1: %lu\r\n", AHB0.free(), AHB1.free());
+    AHB0.stats(stream, "AHB0");
+    AHB1.stats(stream, "AHB1");
     if (verbose) {
         AHB0.debug(stream);
         AHB1.debug(stream);
     }
 
-    stream->printf("Block size: %u bytes, Tickinfo size: %u bytes\n", sizeof(Block), sizeof(Block::tickinfo_t) * Block::n_actuators);
+    stream->printf("Block size: %u bytes, Step buffer size: %u bytes\n", sizeof(Block), Block::step_buffer_size());
+    stream->printf("Queue: %u blocks, %u step buffers, %u bytes\n", THECONVEYOR->get_queue_size(), THECONVEYOR->get_step_buffers(),
+                   sizeof(Block) * THECONVEYOR->get_queue_size() + Block::step_buffer_size() * THECONVEYOR->get_step_buffers());
+}
+
+// show the time each task took since the last top -r, busiest first
+void SimpleShell::top_command( string parameters, StreamOutput *stream)
+{
+    static const char *when[]= {"posted", "idle", "main"};
+    const std::vector<Scheduler::task_t> &tasks= THEKERNEL->scheduler->get_tasks();
+    float elapsed= THEKERNEL->scheduler->get_elapsed_us();
+
+    std::vector<uint16_t> order;
+    for (uint16_t i = 0; i < tasks.size(); ++i) order.push_back(i);
+    std::sort(order.begin(), order.end(), [&tasks](uint16_t a, uint16_t b) { return tasks[a].us > tasks[b].us; });
+
+    stream->printf("%lu idle loops in %1.3f s\n", THEKERNEL->scheduler->get_idle_loops(), elapsed / 1e6F);
+    stream->printf("%-12s %-6s %10s %10s %6s %8s\n", "task", "on", "runs", "ms", "cpu", "max us");
+    for (auto i : order) {
+        const Scheduler::task_t &t= tasks[i];
+        stream->printf("%-12s %-6s %10lu %10lu %5.1f%% %8lu\n", t.name, when[t.when], t.runs, (uint32_t)(t.us / 1000),
+                       elapsed > 0 ? t.us * 100 / elapsed : 0, t.max_us);
+    }
+
+    // the slow ticker hooks in the order they were attached, how late they were called and how long they took
+    SlowTicker *st= THEKERNEL->slow_ticker;
+    float per_us= st->get_counts_per_us();
+    stream->printf("%lu slow ticker interrupts\n", st->get_interrupts());
+    stream->printf("%-4s %6s %4s %10s %8s %8s %8s %10s\n", "hook", "hz", "pri", "calls", "late us", "max us", "missed", "ms");
+    int n= 0;
+    for (auto h : st->get_hooks()) {
+        stream->printf("%-4d %6lu %4d %10lu %8.1f %8.1f %8lu %10lu\n", n++, (SystemCoreClock >> 2) / h->interval, h->priority, h->calls,
+                       h->calls > 0 ? h->total_late / h->calls / per_us : 0, h->max_late / per_us, h->missed, (uint32_t)(h->busy / per_us / 1000));
+    }
+
+    if(shift_parameter(parameters) == "-r") {
+        THEKERNEL->scheduler->reset_stats();
+        st->reset_stats();
+        stream->printf("reset\n");
+    }
+}
+
+// show the cycles each probe took since the last prof -r, only when built with PROFILE_PROBES=1
+void SimpleShell::prof_command( string parameters, StreamOutput *stream)
+{
+#ifdef PROFILE_PROBES
+    bool histograms= false, reset= false;
+    for (string p= shift_parameter(parameters); !p.empty(); p= shift_parameter(parameters)) {
+        if(p == "-v") histograms= true;
+        else if(p == "-r") reset= true;
+    }
+    Profiler::report(stream, histograms);
+    if(reset) {
+        Profiler::reset();
+        stream->printf("reset\n");
+    }
+#else
+    stream->printf("probes are not built in, build with PROFILE_PROBES=1\n");
+#endif
+}
+
+// show how well the queue kept the step ticker fed since the last queue -r: how often the step ticker ran out of blocks
+// during a job and how long it waited, how often a block decelerated to a stop because nothing followed it in time, how
+// deep the queue was on average while it had blocks, and the longest the first block was held back once it ran dry
+void SimpleShell::queue_command( string parameters, StreamOutput *stream)
+{
+    const Conveyor::stats_t &cs= THECONVEYOR->get_stats();
+    const StepTicker::stats_t &ss= THEKERNEL->step_ticker->get_stats();
+    float blocks= cs.queued_us > 0 ? (float)cs.blocks_us / cs.queued_us : 0;
+    float mm= cs.queued_us > 0 ? (float)cs.um_us / cs.queued_us / 1000 : 0;
+
+    stream->printf("queue: %lu underruns %1.3f s, %lu forced decels, %1.1f blocks %1.2f mm on average over %1.3f s, %lu ms max fetch delay\n",
+                   (unsigned long)ss.underruns, ss.underrun_ticks / THEKERNEL->step_ticker->get_frequency(), (unsigned long)cs.forced_decels,
+                   blocks, mm, cs.queued_us / 1e6F, (unsigned long)(cs.max_fetch_delay_us / 1000));
+
+    if(shift_parameter(parameters) == "-r") {
+        THECONVEYOR->reset_stats();
+        THEKERNEL->step_ticker->reset_stats();
+    }
 }
 
 static uint32_t getDeviceType()
@@ -1411,6 +1523,9 @@ void SimpleShell::help_command( string parameters, StreamOutput *stream )
     stream->printf("Commands:\r\n");
     stream->printf("version\r\n");
     stream->printf("mem [-v]\r\n");
+    stream->printf("top [-r] - shows the time each task and slow ticker hook took since the last top -r, -r starts again\r\n");
+    stream->printf("prof [-v] [-r] - shows the cycles the step tick, planner and conveyor took since the last prof -r, -v with histograms\r\n");
+    stream->printf("queue [-r] - shows the underruns, forced decelerations, average depth and fetch delay of the queue since the last queue -r\r\n");
     stream->printf("ls [-s] [folder]\r\n");
     stream->printf("cd folder\r\n");
     stream->printf("pwd\r\n");
@@ -1418,9 +1533,10 @@ void SimpleShell::help_command( string parameters, StreamOutput *stream )
     stream->printf("rm file\r\n");
     stream->printf("mv file newfile\r\n");
     stream->printf("remount\r\n");
-    stream->printf("play file [-v]\r\n");
+    stream->printf("play file [-v] [-l line] - -l starts a compiled job at the checkpoint at or before line\r\n");
     stream->printf("progress - shows progress of current play\r\n");
     stream->printf("abort - abort currently playing file\r\n");
+    stream->printf("playstats - shows how fast the file being played is read from the sd card\r\n");
     stream->printf("reset - reset smoothie\r\n");
     stream->printf("dfu - enter dfu boot loader\r\n");
     stream->printf("break - break into debugger\r\n");
@@ -55,6 +55,9 @@ private:
 
     static void switch_command(string parameters, StreamOutput *stream );
     static void mem_command(string parameters, StreamOutput *stream );
+    static void top_command(string parameters, StreamOutput *stream );
+    static void prof_command(string parameters, StreamOutput *stream );
+    static void queue_command(string parameters, StreamOutput *stream );
 
     static void net_command( string parameters, StreamOutput *stream);
 
@@ -73,4 +76,8 @@ private:
 
     static const ptentry_t commands_table[];
     static int reset_delay_secs;
+    // M461 S reports the queue every so many seconds on the stream that asked
+    static int queue_report_secs;
+    static int queue_report_count;
+    static StreamOutput *queue_report_stream;
 };
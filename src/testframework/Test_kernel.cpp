@@ -14,6 +14,7 @@ This is aprt of the Smoothie test framework, it generates a Mockable Kernl so ke
 #include "libs/Config.h"
 #include "libs/nuts_bolts.h"
 #include "libs/SlowTicker.h"
+#include "libs/Scheduler.h"
 #include "libs/Adc.h"
 #include "libs/StreamOutputPool.h"
 #include <mri.h>
@@ -43,6 +44,8 @@ Kernel* Kernel::instance;
 Kernel::Kernel(){
     instance= this; // setup the Singleton instance of the kernel
 
+    this->scheduler = new Scheduler();
+
     // serial first at fixed baud rate (DEFAULT_SERIAL_BAUD_RATE) so config can report errors to serial
     // Set to UART0, this will be changed to use the same UART as MRI if it's enabled
     this->serial = new SerialConsole(USBTX, USBRX, DEFAULT_SERIAL_BAUD_RATE);
@@ -84,6 +87,8 @@ void Kernel::call_event(_EVENT_ENUM id_event, void * argument){
     for (auto m : hooks[id_event]) {
         (m->*kernel_callback_functions[id_event])(argument);
     }
+    if(id_event == ON_IDLE) this->scheduler->run(Scheduler::IDLE);
+    else if(id_event == ON_MAIN_LOOP) this->scheduler->run(Scheduler::MAIN_LOOP);
     if(event_callbacks.find(id_event) != event_callbacks.end()){
         event_callbacks[id_event](argument);
     }else{
@@ -60,3 +60,92 @@ TEST(GCodeTest,subcode)
     ASSERT_EQUALS_DELTA_V(2.3, gc4.get_value('Y'), 0.001);
 
 }
+
+TEST(GCodeTest,tokenizer)
+{
+    // a letter with no number is on the line but has no value
+    Gcode gc1("G28 X Y10", nullptr);
+    ASSERT_TRUE(gc1.has_letter('X'));
+    ASSERT_TRUE(gc1.has_letter('Y'));
+    ASSERT_TRUE(!gc1.has_letter('Z'));
+    ASSERT_TRUE(!gc1.has_letter('G'));
+    ASSERT_EQUALS_V(2, gc1.get_num_args());
+    ASSERT_EQUALS_DELTA_V(0, gc1.get_value('X'), 0.001);
+    ASSERT_EQUALS_DELTA_V(10, gc1.get_value('Y'), 0.001);
+
+    // the first letter that has a number is the one used
+    Gcode gc2("M117 X X5 X6", nullptr);
+    ASSERT_TRUE(gc2.has_m);
+    ASSERT_EQUALS_V(117, gc2.m);
+    ASSERT_EQUALS_V(3, gc2.get_num_args());
+    ASSERT_EQUALS_DELTA_V(5, gc2.get_value('X'), 0.001);
+    ASSERT_EQUALS_V(5, gc2.get_int('X'));
+
+    // ints are not rounded through a float, and one that is not an int uses the next that is
+    Gcode gc3("M203 P123456789 S.5 S7", nullptr);
+    ASSERT_EQUALS_V(123456789, gc3.get_uint('P'));
+    ASSERT_EQUALS_DELTA_V(0.5, gc3.get_value('S'), 0.001);
+    ASSERT_EQUALS_V(7, gc3.get_int('S'));
+
+    // not stripped the code stays on the line
+    Gcode gc4("G1 X1 Y2 E3", nullptr, false);
+    ASSERT_TRUE(gc4.has_g);
+    ASSERT_EQUALS_V(1, gc4.g);
+    ASSERT_TRUE(gc4.has_letter('G'));
+    ASSERT_EQUALS_V(3, gc4.get_num_args());
+    ASSERT_EQUALS_DELTA_V(3, gc4.get_value('E'), 0.001);
+
+    // a long line is kept on the heap and one with too many letters for the table is scanned
+    Gcode gc5("M117 THIS IS A VERY LONG MESSAGE WITH MORE LETTERS THAN THE TABLE HOLDS X5", nullptr);
+    ASSERT_TRUE(gc5.has_m);
+    ASSERT_EQUALS_V(117, gc5.m);
+    ASSERT_TRUE(gc5.has_letter('V'));
+    ASSERT_TRUE(!gc5.has_letter('Z'));
+    ASSERT_EQUALS_DELTA_V(5, gc5.get_value('X'), 0.001);
+    ASSERT_TRUE(strcmp(gc5.get_command(), " THIS IS A VERY LONG MESSAGE WITH MORE LETTERS THAN THE TABLE HOLDS X5") == 0);
+
+    Gcode gc6("", nullptr);
+    gc6= gc5;
+    ASSERT_EQUALS_DELTA_V(5, gc6.get_value('X'), 0.001);
+    ASSERT_EQUALS_V(gc5.get_num_args(), gc6.get_num_args());
+
+    // lower case letters are not in the table
+    Gcode gc7("M118 hello x", nullptr);
+    ASSERT_TRUE(gc7.has_letter('x'));
+    ASSERT_TRUE(!gc7.has_letter('X'));
+
+    gc4.strip_parameters();
+    ASSERT_TRUE(!gc4.has_letter('X'));
+    ASSERT_TRUE(!gc4.has_letter('Y'));
+    ASSERT_EQUALS_DELTA_V(3, gc4.get_value('E'), 0.001);
+}
+
+TEST(GCodeTest,framed)
+{
+    // the words of a binary frame are in letter order
+    const float values[]= {1.5F, 2000, 10.7F, -3};
+    Gcode gc1(1, (1 << ('E' - 'A')) | (1 << ('F' - 'A')) | (1 << ('X' - 'A')) | (1 << ('Y' - 'A')), values, nullptr);
+    ASSERT_TRUE(gc1.has_g);
+    ASSERT_TRUE(!gc1.has_m);
+    ASSERT_EQUALS_V(1, gc1.g);
+    ASSERT_EQUALS_V(4, gc1.get_num_args());
+    ASSERT_TRUE(gc1.has_letter('X'));
+    ASSERT_TRUE(!gc1.has_letter('Z'));
+    ASSERT_TRUE(!gc1.has_letter('G'));
+    ASSERT_EQUALS_DELTA_V(10.7, gc1.get_value('X'), 0.001);
+    ASSERT_EQUALS_DELTA_V(-3, gc1.get_value('Y'), 0.001);
+    ASSERT_EQUALS_V(10, gc1.get_int('X'));
+    ASSERT_EQUALS_V(2000, gc1.get_uint('F'));
+    ASSERT_EQUALS_DELTA_V(0, gc1.get_value('Z'), 0.001);
+
+    std::map<char,float> args= gc1.get_args();
+    ASSERT_EQUALS_V(4, (int)args.size());
+    ASSERT_EQUALS_DELTA_V(1.5, args['E'], 0.001);
+
+    Gcode gc2(gc1);
+    gc2.strip_parameters();
+    ASSERT_TRUE(!gc2.has_letter('X'));
+    ASSERT_TRUE(!gc2.has_letter('Y'));
+    ASSERT_EQUALS_DELTA_V(2000, gc2.get_value('F'), 0.001);
+    ASSERT_EQUALS_DELTA_V(1.5, gc2.get_value('E'), 0.001);
+}
@@ -0,0 +1,165 @@
+#!/usr/bin/env python
+"""\
+Stream g-code to Smoothie USB serial connection using windowed streaming
+
+Turns on windowed streaming with M880 S1, Smoothie replies with the size of its receive buffer (window:<bytes>) and
+from then on reports the bytes it has taken out of the buffer (freed:<bytes>). The lines are sent whenever there is
+room for them in the buffer, without waiting for each ok, so the USB latency does not limit how fast lines get there.
+Falls back to waiting for the ok of each line if the port does not support it.
+
+With --binary it also turns on binary frames with M881 S1 and sends the G0 to G3 moves as frames, so Smoothie does
+not have to parse their numbers, see src/modules/communication/utils/GcodeFrame.h for the format. Anything else is
+sent as text.
+"""
+
+from __future__ import print_function
+import argparse
+import base64
+import re
+import serial
+import struct
+import threading
+import time
+
+# Define command line argument interface
+parser = argparse.ArgumentParser(description='Stream g-code file to Smoothie over USB serial with windowed streaming.')
+parser.add_argument('gcode_file', type=argparse.FileType('r'), help='g-code filename to be streamed')
+parser.add_argument('device', help='Smoothie Serial Device')
+parser.add_argument('-q', '--quiet', action='store_true', default=False, help='suppress output text')
+parser.add_argument('-b', '--binary', action='store_true', default=False, help='send G0 to G3 moves as binary frames')
+args = parser.parse_args()
+
+f = args.gcode_file
+verbose = not args.quiet
+
+s = serial.Serial(args.device, 115200)
+s.flushInput()  # Flush startup text in serial input
+
+lock = threading.Condition()
+okcnt = 0
+window = None
+in_flight = 0
+errorflg = False
+
+
+def read_thread():
+    """reads the replies, counting oks and the bytes freed in the receive buffer"""
+    global okcnt, window, in_flight, errorflg
+    while True:
+        rep = s.readline().decode('latin1').strip()
+        with lock:
+            if rep.startswith("ok"):
+                okcnt += 1
+            elif rep.startswith("window:"):
+                window = int(rep[7:])
+            elif rep.startswith("freed:"):
+                in_flight -= int(rep[6:])
+            else:
+                print("Incoming: " + rep)
+                if "error" in rep or "!!" in rep or "ALARM" in rep or "ERROR" in rep:
+                    errorflg = True
+            lock.notify()
+        if errorflg:
+            break
+
+
+def crc16(data):
+    """CRC-16/CCITT starting at 0xFFFF, as GcodeFrame::crc16"""
+    crc = 0xFFFF
+    for b in bytearray(data):
+        crc ^= b << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else crc << 1
+        crc &= 0xFFFF
+    return crc
+
+
+move = re.compile(r'^G([0-3])((?: *[A-FH-Z][-+]?(?:\d+\.?\d*|\.\d+))*) *$')
+word = re.compile(r'([A-Z])([-+.\d]+)')
+
+
+def encode_frame(l):
+    """the frame for a G0 to G3 made of letters and numbers, or None if it has to go as text"""
+    m = move.match(l)
+    if not m:
+        return None
+    words = dict()
+    for letter, value in word.findall(m.group(2)):
+        if letter in words:
+            return None
+        words[letter] = float(value)
+    if len(words) > 10:
+        return None
+    letters = 0
+    for letter in words:
+        letters |= 1 << (ord(letter) - ord('A'))
+    frame = struct.pack('<BI', int(m.group(1)), letters)
+    for letter in sorted(words):
+        frame += struct.pack('<f', words[letter])
+    frame += struct.pack('<H', crc16(frame))
+    return b"\x02" + base64.b64encode(frame).rstrip(b"=") + b"\n"
+
+
+t = threading.Thread(target=read_thread)
+t.daemon = True
+t.start()
+
+# ask for windowed streaming and wait for its ok
+s.write(b"M880 S1\n")
+with lock:
+    while okcnt == 0 and not errorflg:
+        lock.wait()
+    okcnt = 0
+    if not window:
+        print("Windowed streaming not supported, waiting for each ok")
+
+if args.binary:
+    s.write(b"M881 S1\n")
+    with lock:
+        while okcnt == 0 and not errorflg:
+            lock.wait()
+        okcnt = 0
+
+print("Streaming " + f.name + " to " + args.device + (" with a %d byte window" % window if window else ""))
+
+start = time.time()
+linecnt = 0
+for line in f:
+    l = line.split(';', 1)[0].strip()
+    if len(l) == 0:
+        continue
+    o = encode_frame(l) if args.binary else None
+    if o is None:
+        o = "{}\n".format(l).encode('latin1')
+    with lock:
+        if window:
+            # wait until there is room for the line in the receive buffer
+            while in_flight + len(o) > window and not errorflg:
+                lock.wait()
+            in_flight += len(o)
+        else:
+            while okcnt < linecnt and not errorflg:
+                lock.wait()
+        if errorflg:
+            break
+    s.write(o)
+    linecnt += 1
+    if verbose:
+        print("SND " + str(linecnt) + ": " + l + " - " + str(okcnt))
+
+with lock:
+    while okcnt < linecnt and not errorflg:
+        lock.wait()
+
+if errorflg:
+    print("Target halted due to errors")
+else:
+    elapsed = time.time() - start
+    print("Sent %d lines in %1.1f s, %1.0f lines/s" % (linecnt, elapsed, linecnt / elapsed if elapsed > 0 else 0))
+
+# back to text and waiting for each ok for the next host
+if args.binary:
+    s.write(b"M881 S0\n")
+s.write(b"M880 S0\n")
+f.close()
+s.close()